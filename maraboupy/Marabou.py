@@ -122,7 +122,10 @@ def createOptions(numWorkers=1, initialTimeout=5, initialDivides=0, onlineDivide
                   splittingStrategy="auto", sncSplittingStrategy="auto",
                   restoreTreeStates=False, splitThreshold=20, solveWithMILP=False,
                   preprocessorBoundTolerance=0.0000000001, dumpBounds=False,
-                  tighteningStrategy="deeppoly" ):
+                  tighteningStrategy="deeppoly", trailBacktracking=False,
+                  tighteningThreads=1, dualSimplex=False, dualRatioTest="bound-flipping",
+                  primalRatioTest="harris",
+                  partialPricing=False ):
     """Create an options object for how Marabou should solve the query
 
     Args:
@@ -143,6 +146,12 @@ def createOptions(numWorkers=1, initialTimeout=5, initialDivides=0, onlineDivide
         preprocessorBoundTolerance ( float, optional): epsilon value for preprocess bound tightening . Defaults to 10^-10.
         dumpBounds (bool, optional): Print out the bounds of each neuron after preprocessing. defaults to False
         tighteningStrategy (string, optional): The abstract-interpretation-based bound tightening techniques used during the search (deeppoly/sbt/none). default to deeppoly.
+        trailBacktracking (bool, optional): Backtrack by undoing bound changes instead of restoring stored tableau states. defaults to False
+        tighteningThreads (int, optional): Number of threads used for DeepPoly bound tightening within a layer, defaults to 1
+        dualSimplex (bool, optional): Restore feasibility after case splits using dual simplex steps, defaults to False
+        dualRatioTest (string, optional): The ratio test used in dual simplex steps (textbook/bound-flipping), defaults to bound-flipping
+        primalRatioTest (string, optional): The ratio test used in primal simplex steps (textbook/harris/long-step), defaults to harris
+        partialPricing (bool, optional): Pick entering variables from a pool of candidates maintained by partial pricing, defaults to False
     Returns:
         :class:`~maraboupy.MarabouCore.Options`
     """
@@ -163,4 +172,10 @@ def createOptions(numWorkers=1, initialTimeout=5, initialDivides=0, onlineDivide
     options._preprocessorBoundTolerance = preprocessorBoundTolerance
     options._dumpBounds = dumpBounds
     options._tighteningStrategy = tighteningStrategy
+    options._trailBacktracking = trailBacktracking
+    options._tighteningThreads = tighteningThreads
+    options._dualSimplex = dualSimplex
+    options._dualRatioTest = dualRatioTest
+    options._primalRatioTest = primalRatioTest
+    options._partialPricing = partialPricing
     return options
@@ -116,12 +116,6 @@ bool createInputQuery(InputQuery &inputQuery, std::string networkFilePath, std::
     AcasParser* acasParser = new AcasParser( String(networkFilePath) );
     acasParser->generateQuery( inputQuery );
 
-    bool success = inputQuery.constructNetworkLevelReasoner();
-    if ( success )
-      printf("Successfully created a network level reasoner.\n");
-    else
-      printf("Warning: network level reasoner construction failed.\n");
-
     String propertyFilePathM = String(propertyFilePath);
     if ( propertyFilePath != "" )
       {
@@ -183,6 +177,9 @@ struct MarabouOptions {
         , _restoreTreeStates( Options::get()->getBool( Options::RESTORE_TREE_STATES ) )
         , _solveWithMILP( Options::get()->getBool( Options::SOLVE_WITH_MILP ) )
         , _dumpBounds( Options::get()->getBool( Options::DUMP_BOUNDS ) )
+        , _trailBacktracking( Options::get()->getBool( Options::TRAIL_BACKTRACKING ) )
+        , _dualSimplex( Options::get()->getBool( Options::DUAL_SIMPLEX ) )
+        , _partialPricing( Options::get()->getBool( Options::PARTIAL_PRICING ) )
         , _numWorkers( Options::get()->getInt( Options::NUM_WORKERS ) )
         , _initialTimeout( Options::get()->getInt( Options::INITIAL_TIMEOUT ) )
         , _initialDivides( Options::get()->getInt( Options::NUM_INITIAL_DIVIDES ) )
@@ -190,11 +187,14 @@ struct MarabouOptions {
         , _verbosity( Options::get()->getInt( Options::VERBOSITY ) )
         , _timeoutInSeconds( Options::get()->getInt( Options::TIMEOUT ) )
         , _splitThreshold( Options::get()->getInt( Options::CONSTRAINT_VIOLATION_THRESHOLD ) )
+        , _tighteningThreads( Options::get()->getInt( Options::NUM_TIGHTENING_THREADS ) )
         , _timeoutFactor( Options::get()->getFloat( Options::TIMEOUT_FACTOR ) )
         , _preprocessorBoundTolerance( Options::get()->getFloat( Options::PREPROCESSOR_BOUND_TOLERANCE ) )
         , _splittingStrategyString( Options::get()->getString( Options::SPLITTING_STRATEGY ).ascii() )
         , _sncSplittingStrategyString( Options::get()->getString( Options::SNC_SPLITTING_STRATEGY ).ascii() )
         , _tighteningStrategyString( Options::get()->getString( Options::SYMBOLIC_BOUND_TIGHTENING_TYPE ).ascii() )
+        , _dualRatioTestString( Options::get()->getString( Options::DUAL_RATIO_TEST_TYPE ).ascii() )
+        , _primalRatioTestString( Options::get()->getString( Options::PRIMAL_RATIO_TEST_TYPE ).ascii() )
     {};
 
   void setOptions()
@@ -204,6 +204,9 @@ struct MarabouOptions {
     Options::get()->setBool( Options::RESTORE_TREE_STATES, _restoreTreeStates );
     Options::get()->setBool( Options::SOLVE_WITH_MILP, _solveWithMILP );
     Options::get()->setBool( Options::DUMP_BOUNDS, _dumpBounds );
+    Options::get()->setBool( Options::TRAIL_BACKTRACKING, _trailBacktracking );
+    Options::get()->setBool( Options::DUAL_SIMPLEX, _dualSimplex );
+    Options::get()->setBool( Options::PARTIAL_PRICING, _partialPricing );
 
     // int options
     Options::get()->setInt( Options::NUM_WORKERS, _numWorkers );
@@ -213,6 +216,7 @@ struct MarabouOptions {
     Options::get()->setInt( Options::VERBOSITY, _verbosity );
     Options::get()->setInt( Options::TIMEOUT, _timeoutInSeconds );
     Options::get()->setInt( Options::CONSTRAINT_VIOLATION_THRESHOLD, _splitThreshold );
+    Options::get()->setInt( Options::NUM_TIGHTENING_THREADS, _tighteningThreads );
 
     // float options
     Options::get()->setFloat( Options::TIMEOUT_FACTOR, _timeoutFactor );
@@ -222,12 +226,17 @@ struct MarabouOptions {
     Options::get()->setString( Options::SPLITTING_STRATEGY, _splittingStrategyString );
     Options::get()->setString( Options::SNC_SPLITTING_STRATEGY, _sncSplittingStrategyString );
     Options::get()->setString( Options::SYMBOLIC_BOUND_TIGHTENING_TYPE, _tighteningStrategyString );
+    Options::get()->setString( Options::DUAL_RATIO_TEST_TYPE, _dualRatioTestString );
+    Options::get()->setString( Options::PRIMAL_RATIO_TEST_TYPE, _primalRatioTestString );
   }
 
     bool _snc;
     bool _restoreTreeStates;
     bool _solveWithMILP;
     bool _dumpBounds;
+    bool _trailBacktracking;
+    bool _dualSimplex;
+    bool _partialPricing;
     unsigned _numWorkers;
     unsigned _initialTimeout;
     unsigned _initialDivides;
@@ -235,11 +244,14 @@ struct MarabouOptions {
     unsigned _verbosity;
     unsigned _timeoutInSeconds;
     unsigned _splitThreshold;
+    unsigned _tighteningThreads;
     float _timeoutFactor;
     float _preprocessorBoundTolerance;
     std::string _splittingStrategyString;
     std::string _sncSplittingStrategyString;
     std::string _tighteningStrategyString;
+    std::string _dualRatioTestString;
+    std::string _primalRatioTestString;
 };
 
 /* The default parameters here are just for readability, you should specify
@@ -422,13 +434,19 @@ PYBIND11_MODULE(MarabouCore, m) {
         .def_readwrite("_preprocessorBoundTolerance", &MarabouOptions::_preprocessorBoundTolerance)
         .def_readwrite("_verbosity", &MarabouOptions::_verbosity)
         .def_readwrite("_splitThreshold", &MarabouOptions::_splitThreshold)
+        .def_readwrite("_tighteningThreads", &MarabouOptions::_tighteningThreads)
         .def_readwrite("_snc", &MarabouOptions::_snc)
         .def_readwrite("_solveWithMILP", &MarabouOptions::_solveWithMILP)
         .def_readwrite("_dumpBounds", &MarabouOptions::_dumpBounds)
+        .def_readwrite("_trailBacktracking", &MarabouOptions::_trailBacktracking)
+        .def_readwrite("_dualSimplex", &MarabouOptions::_dualSimplex)
+        .def_readwrite("_partialPricing", &MarabouOptions::_partialPricing)
         .def_readwrite("_restoreTreeStates", &MarabouOptions::_restoreTreeStates)
         .def_readwrite("_splittingStrategy", &MarabouOptions::_splittingStrategyString)
         .def_readwrite("_sncSplittingStrategy", &MarabouOptions::_sncSplittingStrategyString)
-        .def_readwrite("_tighteningStrategy", &MarabouOptions::_tighteningStrategyString);
+        .def_readwrite("_tighteningStrategy", &MarabouOptions::_tighteningStrategyString)
+        .def_readwrite("_dualRatioTest", &MarabouOptions::_dualRatioTestString)
+        .def_readwrite("_primalRatioTest", &MarabouOptions::_primalRatioTestString);
     py::enum_<PiecewiseLinearFunctionType>(m, "PiecewiseLinearFunctionType")
         .value("ReLU", PiecewiseLinearFunctionType::RELU)
         .value("AbsoluteValue", PiecewiseLinearFunctionType::ABSOLUTE_VALUE)
@@ -20,6 +20,9 @@
 #include "MString.h"
 #include "SparseUnsortedList.h"
 
+#include <algorithm>
+#include <vector>
+
 CSRMatrix::CSRMatrix()
     : _m( 0 )
     , _n( 0 )
@@ -49,6 +52,16 @@ CSRMatrix::~CSRMatrix()
 }
 
 void CSRMatrix::initialize( const double *M, unsigned m, unsigned n )
+{
+    initializeFromDense( M, m, n, false );
+}
+
+void CSRMatrix::initializeExact( const double *M, unsigned m, unsigned n )
+{
+    initializeFromDense( M, m, n, true );
+}
+
+void CSRMatrix::initializeFromDense( const double *M, unsigned m, unsigned n, bool exact )
 {
     initializeToEmpty( m, n );
 
@@ -61,7 +74,7 @@ void CSRMatrix::initialize( const double *M, unsigned m, unsigned n )
         for ( unsigned j = 0; j < _n; ++j )
         {
             // Ignore zero entries
-            if ( FloatUtils::isZero( M[i*_n + j] ) )
+            if ( exact ? M[i*_n + j] == 0 : FloatUtils::isZero( M[i*_n + j] ) )
                 continue;
 
             if ( _nnz >= _estimatedNnz )
@@ -76,6 +89,64 @@ void CSRMatrix::initialize( const double *M, unsigned m, unsigned n )
     }
 }
 
+void CSRMatrix::initialize( const SparseUnsortedList **V, unsigned m, unsigned n )
+{
+    freeMemoryIfNeeded();
+
+    _m = m;
+    _n = n;
+
+    // The number of entries is known in advance, allocate exactly
+    _estimatedNnz = 0;
+    for ( unsigned i = 0; i < _m; ++i )
+        _estimatedNnz += V[i]->getNnz();
+    _estimatedNnz = std::max( 1U, _estimatedNnz );
+
+    _A = new double[_estimatedNnz];
+    if ( !_A )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED, "CSRMatrix::A" );
+
+    _IA = new unsigned[_m + 1];
+    if ( !_IA )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED, "CSRMatrix::IA" );
+
+    _JA = new unsigned[_estimatedNnz];
+    if ( !_JA )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED, "CSRMatrix::JA" );
+
+    // The entries of each row are sorted by column, as required by JA
+    std::vector<SparseUnsortedList::Entry> rowEntries;
+
+    _nnz = 0;
+    _IA[0] = 0;
+    for ( unsigned i = 0; i < _m; ++i )
+    {
+        rowEntries.clear();
+        for ( const auto &entry : *V[i] )
+        {
+            // Ignore zero entries
+            if ( !FloatUtils::isZero( entry._value ) )
+                rowEntries.push_back( entry );
+        }
+
+        std::sort( rowEntries.begin(),
+                   rowEntries.end(),
+                   []( const SparseUnsortedList::Entry &a, const SparseUnsortedList::Entry &b )
+                   {
+                       return a._index < b._index;
+                   } );
+
+        for ( const auto &entry : rowEntries )
+        {
+            _A[_nnz] = entry._value;
+            _JA[_nnz] = entry._index;
+            ++_nnz;
+        }
+
+        _IA[i + 1] = _nnz;
+    }
+}
+
 void CSRMatrix::initializeToEmpty( unsigned m, unsigned n )
 {
     _m = m;
@@ -772,6 +843,11 @@ const double *CSRMatrix::getA() const
     return _A;
 }
 
+const unsigned *CSRMatrix::getIA() const
+{
+    return _IA;
+}
+
 const unsigned *CSRMatrix::getJA() const
 {
     return _JA;
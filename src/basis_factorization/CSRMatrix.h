@@ -47,13 +47,22 @@ public:
     /*
       Initialize a CSR matrix from a given matrix M of dimensions
       m x n, or create an empty object and then initialize it separately.
+      When initialized from sparse rows, the rows need not be sorted.
     */
     CSRMatrix( const double *M, unsigned m, unsigned n );
     CSRMatrix();
     ~CSRMatrix();
     void initialize( const double *M, unsigned m, unsigned n );
+    void initialize( const SparseUnsortedList **V, unsigned m, unsigned n );
     void initializeToEmpty( unsigned m, unsigned n );
 
+    /*
+      Initialize from a dense matrix, dropping only the entries that
+      are exactly zero. The other initializers also drop entries that
+      are within the comparison epsilon of zero.
+    */
+    void initializeExact( const double *M, unsigned m, unsigned n );
+
     /*
       Obtain a single element/row/column of the matrix.
     */
@@ -128,6 +137,7 @@ public:
       Read-only access to the internal data structures
     */
     const double *getA() const;
+    const unsigned *getIA() const;
     const unsigned *getJA() const;
 
 private:
@@ -173,6 +183,12 @@ private:
     */
     void increaseCapacity();
 
+    /*
+      Initialize from a dense matrix. If exact is set, only entries
+      that are exactly zero are dropped.
+    */
+    void initializeFromDense( const double *M, unsigned m, unsigned n, bool exact );
+
     /*
       Release allocated memory
     */
@@ -16,9 +16,10 @@
 #ifndef __IBasisFactorization_h__
 #define __IBasisFactorization_h__
 
+#include "SparseUnsortedList.h"
+
 class SparseColumnsOfBasis;
 class SparseMatrix;
-class SparseUnsortedList;
 class Statistics;
 
 class IBasisFactorization
@@ -73,6 +74,28 @@ public:
     */
     virtual void backwardTransformation( const double *y, double *x ) const = 0;
 
+    /*
+      Forward and backward transformations for a sparse y, e.g. a
+      column of the constraint matrix or a unit vector. Factorizations
+      that can exploit the sparsity of y override these; by default, y
+      is converted to dense form. Result needs to be of size m.
+    */
+    virtual void sparseForwardTransformation( const SparseUnsortedList &y, double *x ) const
+    {
+        double *denseY = new double[y.getSize()];
+        y.toDense( denseY );
+        forwardTransformation( denseY, x );
+        delete[] denseY;
+    }
+
+    virtual void sparseBackwardTransformation( const SparseUnsortedList &y, double *x ) const
+    {
+        double *denseY = new double[y.getSize()];
+        y.toDense( denseY );
+        backwardTransformation( denseY, x );
+        delete[] denseY;
+    }
+
     /*
       Store/restore the basis factorization.
     */
@@ -19,6 +19,7 @@
 #include "GlobalConfiguration.h"
 #include "MalformedBasisException.h"
 #include "SparseFTFactorization.h"
+#include "TimeUtils.h"
 
 SparseFTFactorization::SparseFTFactorization( unsigned m, const BasisColumnOracle &basisColumnOracle )
     : IBasisFactorization( basisColumnOracle )
@@ -31,6 +32,7 @@ SparseFTFactorization::SparseFTFactorization( unsigned m, const BasisColumnOracl
     , _z2( NULL )
     , _z3( NULL )
     , _z4( NULL )
+    , _nonZeroIndices( NULL )
 {
     _z1 = new double[m];
     if ( !_z1 )
@@ -47,6 +49,10 @@ SparseFTFactorization::SparseFTFactorization( unsigned m, const BasisColumnOracl
     _z4 = new double[m];
     if ( !_z4 )
         throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED, "SparseFTFactorization::z4" );
+
+    _nonZeroIndices = new unsigned[m];
+    if ( !_nonZeroIndices )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED, "SparseFTFactorization::nonZeroIndices" );
 }
 
 SparseFTFactorization::~SparseFTFactorization()
@@ -81,6 +87,12 @@ void SparseFTFactorization::freeIfNeeded()
         delete[] _z4;
         _z4 = NULL;
     }
+
+    if ( _nonZeroIndices )
+    {
+        delete[] _nonZeroIndices;
+        _nonZeroIndices = NULL;
+    }
 }
 
 const double *SparseFTFactorization::getBasis() const
@@ -343,6 +355,44 @@ void SparseFTFactorization::backwardTransformation( const double *y, double *x )
     _sparseLUFactors.fBackwardTransformation( _z2, x );
 }
 
+void SparseFTFactorization::sparseForwardTransformation( const SparseUnsortedList &y, double *x ) const
+{
+    unsigned nnz;
+    scatter( y, x, _nonZeroIndices, nnz );
+
+    // Eliminate F, then H, then V
+    _sparseLUFactors.fForwardTransformation( x, _nonZeroIndices, nnz );
+    hForwardTransformation( x, _nonZeroIndices, nnz );
+    _sparseLUFactors.vForwardTransformation( x, _nonZeroIndices, nnz );
+}
+
+void SparseFTFactorization::sparseBackwardTransformation( const SparseUnsortedList &y, double *x ) const
+{
+    unsigned nnz;
+    scatter( y, x, _nonZeroIndices, nnz );
+
+    // Eliminate V, then H, then F
+    _sparseLUFactors.vBackwardTransformation( x, _nonZeroIndices, nnz );
+    hBackwardTransformation( x, _nonZeroIndices, nnz );
+    _sparseLUFactors.fBackwardTransformation( x, _nonZeroIndices, nnz );
+}
+
+void SparseFTFactorization::scatter( const SparseUnsortedList &y,
+                                     double *x,
+                                     unsigned *indices,
+                                     unsigned &nnz ) const
+{
+    ASSERT( y.getSize() == _m );
+
+    std::fill_n( x, _m, 0.0 );
+    nnz = 0;
+    for ( const auto &entry : y )
+    {
+        x[entry._index] = entry._value;
+        indices[nnz++] = entry._index;
+    }
+}
+
 void SparseFTFactorization::clearFactorization()
 {
     List<SparseEtaMatrix *>::iterator it;
@@ -356,6 +406,8 @@ void SparseFTFactorization::factorizeBasis()
 {
     clearFactorization();
 
+    struct timespec factorizationStart = TimeUtils::sampleMicro();
+
     try
     {
         _sparseGaussianEliminator.run( &_B, &_sparseLUFactors );
@@ -369,7 +421,13 @@ void SparseFTFactorization::factorizeBasis()
     }
 
     if ( _statistics )
+    {
         _statistics->incNumBasisRefactorizations();
+
+        struct timespec factorizationEnd = TimeUtils::sampleMicro();
+        _statistics->addTimeBasisFactorization( TimeUtils::timePassed( factorizationStart,
+                                                                       factorizationEnd ) );
+    }
 }
 
 void SparseFTFactorization::storeFactorization( IBasisFactorization *other )
@@ -479,6 +537,68 @@ void SparseFTFactorization::hBackwardTransformation( const double *y, double *x
     }
 }
 
+void SparseFTFactorization::hForwardTransformation( double *x, unsigned *indices, unsigned &nnz ) const
+{
+    /*
+      Each eta only changes the entry of its pivot. A pivot that
+      becomes non-zero is added to the indices; if the indices are
+      full, they are recomputed, as they may contain duplicates.
+    */
+    for ( const auto &eta : _etas )
+    {
+        unsigned pivotIndex = eta->_columnIndex;
+        bool wasZero = ( x[pivotIndex] == 0.0 );
+
+        for ( const auto &entry : eta->_sparseColumn )
+            x[pivotIndex] -= entry._value * x[entry._index];
+
+        if ( wasZero && x[pivotIndex] != 0.0 )
+        {
+            if ( nnz < _m )
+                indices[nnz++] = pivotIndex;
+            else
+                collectNonZeros( x, indices, nnz );
+        }
+    }
+}
+
+void SparseFTFactorization::hBackwardTransformation( double *x, unsigned *indices, unsigned &nnz ) const
+{
+    for ( auto eta = _etas.rbegin(); eta != _etas.rend(); ++eta )
+    {
+        unsigned pivotIndex = (*eta)->_columnIndex;
+        double pivotValue = x[pivotIndex];
+        if ( pivotValue == 0.0 )
+            continue;
+
+        for ( const auto &entry : (*eta)->_sparseColumn )
+        {
+            unsigned entryIndex = entry._index;
+            bool wasZero = ( x[entryIndex] == 0.0 );
+
+            x[entryIndex] -= entry._value * pivotValue;
+
+            if ( wasZero && x[entryIndex] != 0.0 )
+            {
+                if ( nnz < _m )
+                    indices[nnz++] = entryIndex;
+                else
+                    collectNonZeros( x, indices, nnz );
+            }
+        }
+    }
+}
+
+void SparseFTFactorization::collectNonZeros( const double *x, unsigned *indices, unsigned &nnz ) const
+{
+    nnz = 0;
+    for ( unsigned i = 0; i < _m; ++i )
+    {
+        if ( x[i] != 0.0 )
+            indices[nnz++] = i;
+    }
+}
+
 void SparseFTFactorization::fixPForL()
 {
     if ( !_sparseLUFactors._usePForF )
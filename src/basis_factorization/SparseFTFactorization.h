@@ -71,6 +71,13 @@ public:
     */
     void backwardTransformation( const double *y, double *x ) const;
 
+    /*
+      The same, for a sparse y. Only the parts of the factorization
+      reachable from the non-zero entries of y are visited.
+    */
+    void sparseForwardTransformation( const SparseUnsortedList &y, double *x ) const;
+    void sparseBackwardTransformation( const SparseUnsortedList &y, double *x ) const;
+
     /*
       Store and restore the basis factorization.
     */
@@ -144,12 +151,31 @@ private:
     double *_z3;
     double *_z4;
 
+    /*
+      The indices of the (possibly) non-zero entries of the vector
+      being transformed by a sparse transformation.
+    */
+    unsigned *_nonZeroIndices;
+
     /*
       Transformations on the H matrix (the list of etas)
     */
     void hForwardTransformation( const double *y, double *x ) const;
     void hBackwardTransformation( const double *y, double *x ) const;
 
+    /*
+      In-place versions of the above, that maintain the indices of the
+      (possibly) non-zero entries of x
+    */
+    void hForwardTransformation( double *x, unsigned *indices, unsigned &nnz ) const;
+    void hBackwardTransformation( double *x, unsigned *indices, unsigned &nnz ) const;
+
+    /*
+      Load a sparse vector into dense x, recording its indices
+    */
+    void scatter( const SparseUnsortedList &y, double *x, unsigned *indices, unsigned &nnz ) const;
+    void collectNonZeros( const double *x, unsigned *indices, unsigned &nnz ) const;
+
     /*
       Free any allocated memory.
     */
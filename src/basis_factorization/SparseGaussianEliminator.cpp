@@ -22,35 +22,36 @@
 #include "MalformedBasisException.h"
 #include "SparseGaussianEliminator.h"
 
+#include <algorithm>
 #include <cstdio>
 
 SparseGaussianEliminator::SparseGaussianEliminator( unsigned m )
     : _m( m )
     , _work( NULL )
-    , _work2( NULL )
+    , _columnMarks( NULL )
     , _statistics( NULL )
-    , _numURowElements( NULL )
-    , _numUColumnElements( NULL )
+    , _havePreviousPivots( false )
 {
     _work = new double[_m];
     if ( !_work )
         throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
                                        "SparseGaussianEliminator::work" );
+    std::fill_n( _work, _m, 0 );
 
-    _work2 = new double[_m];
-    if ( !_work2 )
+    _columnMarks = new bool[_m];
+    if ( !_columnMarks )
         throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
-                                       "SparseGaussianEliminator::work2" );
+                                       "SparseGaussianEliminator::columnMarks" );
+    std::fill_n( _columnMarks, _m, false );
 
-    _numURowElements = new unsigned[_m];
-    if ( !_numURowElements )
-        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
-                                       "SparseGaussianEliminator::numURowElements" );
+    _rowEntries.reserve( _m );
 
-    _numUColumnElements = new unsigned[_m];
-    if ( !_numUColumnElements )
-        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
-                                       "SparseGaussianEliminator::numUColumnElements" );
+    _previousPivotRows.resize( _m );
+    _previousPivotColumns.resize( _m );
+    _previousPivotCosts.resize( _m );
+    _pivotRows.resize( _m );
+    _pivotColumns.resize( _m );
+    _pivotCosts.resize( _m );
 }
 
 SparseGaussianEliminator::~SparseGaussianEliminator()
@@ -61,22 +62,10 @@ SparseGaussianEliminator::~SparseGaussianEliminator()
         _work = NULL;
     }
 
-    if ( _work2 )
-    {
-        delete[] _work2;
-        _work2 = NULL;
-    }
-
-    if ( _numURowElements )
+    if ( _columnMarks )
     {
-        delete[] _numURowElements;
-        _numURowElements = NULL;
-    }
-
-    if ( _numUColumnElements )
-    {
-        delete[] _numUColumnElements;
-        _numUColumnElements = NULL;
+        delete[] _columnMarks;
+        _columnMarks = NULL;
     }
 }
 
@@ -105,7 +94,13 @@ void SparseGaussianEliminator::initializeFactorization( const SparseColumnsOfBas
     _sparseLUFactors->_Q.resetToIdentity();
 
     // Count number of non-zeros in U ( = V )
-    _sparseLUFactors->_V->countElements( _numURowElements, _numUColumnElements );
+    _rowCounts.initialize( _m );
+    _columnCounts.initialize( _m );
+    for ( unsigned i = 0; i < _m; ++i )
+    {
+        _rowCounts.insert( i, _sparseLUFactors->_V->getRow( i )->getNnz() );
+        _columnCounts.insert( i, _sparseLUFactors->_Vt->getRow( i )->getNnz() );
+    }
 
     // Use same matrix P for L and V
     _sparseLUFactors->_usePForF = false;
@@ -121,16 +116,6 @@ void SparseGaussianEliminator::permute()
 
     _sparseLUFactors->_P.swapColumns( _uPivotRow, _eliminationStep );
     _sparseLUFactors->_Q.swapRows( _uPivotColumn, _eliminationStep );
-
-    // Adjust the element counters
-    unsigned temp;
-    temp = _numURowElements[_uPivotRow];
-    _numURowElements[_uPivotRow] = _numURowElements[_eliminationStep];
-    _numURowElements[_eliminationStep] = temp;
-
-    temp = _numUColumnElements[_uPivotColumn];
-    _numUColumnElements[_uPivotColumn] = _numUColumnElements[_eliminationStep];
-    _numUColumnElements[_eliminationStep] = temp;
 }
 
 void SparseGaussianEliminator::run( const SparseColumnsOfBasis *A, SparseLUFactors *sparseLUFactors )
@@ -141,6 +126,12 @@ void SparseGaussianEliminator::run( const SparseColumnsOfBasis *A, SparseLUFacto
     // Do the work
     factorize();
 
+    // The pivot sequence is a good guess for the next factorization
+    _previousPivotRows.swap( _pivotRows );
+    _previousPivotColumns.swap( _pivotColumns );
+    _previousPivotCosts.swap( _pivotCosts );
+    _havePreviousPivots = true;
+
     // DEBUG({
     //         // Check that the factorization is correct
     //         double *product = new double[_m * _m];
@@ -217,165 +208,260 @@ void SparseGaussianEliminator::choosePivot()
       We pick a pivot a_ij \neq 0 that minimizes (p_i - 1)(q_i - 1).
     */
 
-    const SparseUnsortedArray *sparseRow;
-    const SparseUnsortedArray *sparseColumn;
-    const SparseUnsortedArray::Entry *entry;
-    unsigned nnz;
+    if ( _havePreviousPivots && tryPreviousPivot() )
+    {
+        SGAUSSIAN_LOG( Stringf( "Choose pivot selected a pivot (previous factorization): V[%u,%u] = %lf",
+                                _vPivotRow,
+                                _vPivotColumn,
+                                _pivotElement ).ascii() );
+        return;
+    }
 
     // If there's a singleton row, use it as the pivot row
-    for ( unsigned i = _eliminationStep; i < _m; ++i )
+    unsigned vRow = _rowCounts.first( 1 );
+    if ( vRow != CountBuckets::NONE )
     {
-        if ( _numURowElements[i] == 1 )
-        {
-            _uPivotRow = i;
-            _vPivotRow = _sparseLUFactors->_P._columnOrdering[i];
-
-            // Get the singleton element
-            sparseRow = _sparseLUFactors->_V->getRow( _vPivotRow );
+        // Get the singleton element
+        const SparseUnsortedArray *sparseRow = _sparseLUFactors->_V->getRow( vRow );
 
-            ASSERT( sparseRow->getNnz() == 1U );
+        ASSERT( sparseRow->getNnz() == 1U );
 
-            entry = sparseRow->getArray();
+        const SparseUnsortedArray::Entry *entry = sparseRow->getArray();
+        setPivot( vRow, entry->_index, entry->_value, 0 );
 
-            _vPivotColumn = entry->_index;
-            _uPivotColumn = _sparseLUFactors->_Q._columnOrdering[_vPivotColumn];
-            _pivotElement = entry->_value;
-
-            SGAUSSIAN_LOG( Stringf( "Choose pivot selected a pivot (singleton row): V[%u,%u] = %lf",
-                          _vPivotRow,
-                          _vPivotColumn,
-                          _pivotElement ).ascii() );
-            return;
-        }
+        SGAUSSIAN_LOG( Stringf( "Choose pivot selected a pivot (singleton row): V[%u,%u] = %lf",
+                                _vPivotRow,
+                                _vPivotColumn,
+                                _pivotElement ).ascii() );
+        return;
     }
 
     // If there's a singleton column, use it as the pivot column
-    for ( unsigned i = _eliminationStep; i < _m; ++i )
+    unsigned vColumn = _columnCounts.first( 1 );
+    if ( vColumn != CountBuckets::NONE )
     {
-        if ( _numUColumnElements[i] == 1 )
+        const SparseUnsortedArray *sparseColumn = _sparseLUFactors->_Vt->getRow( vColumn );
+        const SparseUnsortedArray::Entry *entry = sparseColumn->getArray();
+        unsigned nnz = sparseColumn->getNnz();
+
+        // There may be some elements in higher rows - we need just the one
+        // in the active submatrix.
+
+        DEBUG( bool found = false; );
+
+        for ( unsigned i = 0; i < nnz; ++i )
         {
-            _uPivotColumn = i;
-            _vPivotColumn = _sparseLUFactors->_Q._rowOrdering[i];
+            if ( _rowCounts.isActive( entry[i]._index ) )
+            {
+                DEBUG( found = true; );
+                setPivot( entry[i]._index, vColumn, entry[i]._value, 0 );
+                break;
+            }
+        }
 
-            // Get the singleton element
-            sparseColumn = _sparseLUFactors->_Vt->getRow( _vPivotColumn );
-            entry = sparseColumn->getArray();
-            nnz = sparseColumn->getNnz();
+        ASSERT( found );
 
-            // There may be some elements in higher rows - we need just the one
-            // in the active submatrix.
+        SGAUSSIAN_LOG( Stringf( "Choose pivot selected a pivot (singleton column): V[%u,%u] = %lf",
+                                _vPivotRow,
+                                _vPivotColumn,
+                                _pivotElement ).ascii() );
+        return;
+    }
 
-            DEBUG( bool found = false; );
+    if ( _columnCounts.first( 0 ) != CountBuckets::NONE )
+        throw BasisFactorizationError( BasisFactorizationError::GAUSSIAN_ELIMINATION_FAILED,
+                                       "Have a zero column" );
 
-            for ( unsigned i = 0; i < nnz; ++i )
-            {
-                unsigned vRow = entry[i]._index;
-                unsigned uRow = _sparseLUFactors->_P._rowOrdering[vRow];
+    if ( _rowCounts.first( 0 ) != CountBuckets::NONE )
+        throw BasisFactorizationError( BasisFactorizationError::GAUSSIAN_ELIMINATION_FAILED,
+                                       "Have a zero row" );
 
-                if ( uRow >= _eliminationStep )
-                {
-                    DEBUG( found = true; );
+    markowitzSearch();
+}
 
-                    _vPivotRow = vRow;
-                    _uPivotRow = uRow;
-                    _pivotElement = entry[i]._value;
+bool SparseGaussianEliminator::tryPreviousPivot()
+{
+    unsigned vRow = _previousPivotRows[_eliminationStep];
+    unsigned vColumn = _previousPivotColumns[_eliminationStep];
 
-                    break;
-                }
-            }
+    if ( !_rowCounts.isActive( vRow ) || !_columnCounts.isActive( vColumn ) )
+        return false;
 
-            ASSERT( found );
+    unsigned cost = ( _rowCounts.getCount( vRow ) - 1 ) * ( _columnCounts.getCount( vColumn ) - 1 );
 
-            SGAUSSIAN_LOG( Stringf( "Choose pivot selected a pivot (singleton column): V[%u,%u] = %lf",
-                          _vPivotRow,
-                          _vPivotColumn,
-                          _pivotElement ).ascii() );
-            return;
-        }
-    }
+    // Singletons are always preferable to a pivot that causes fill-in
+    if ( cost > 0 &&
+         ( _rowCounts.first( 1 ) != CountBuckets::NONE ||
+           _columnCounts.first( 1 ) != CountBuckets::NONE ) )
+        return false;
 
-    // No singletons, apply the Markowitz rule. Find the element with acceptable
-    // magnitude that has the smallet Markowitz value.
-    // Fail if no elements exists that are within acceptable magnitude
+    if ( cost > _previousPivotCosts[_eliminationStep] )
+        return false;
 
-    // Todo: more clever heuristics to reduce the search space
-    unsigned minimalCost = _m * _m;
-    _pivotElement = 0.0;
-    double absPivotElement = 0.0;
+    double value = _sparseLUFactors->_V->get( vRow, vColumn );
+    if ( FloatUtils::isZero( value ) )
+        return false;
 
-    bool found = false;
-    for ( unsigned uColumn = _eliminationStep; uColumn < _m; ++uColumn )
-    {
-        unsigned vColumn = _sparseLUFactors->_Q._rowOrdering[uColumn];
-        sparseColumn = _sparseLUFactors->_Vt->getRow( vColumn );
+    if ( !FloatUtils::gt( FloatUtils::abs( value ),
+                          maxInActiveColumn( vColumn ) *
+                          GlobalConfiguration::GAUSSIAN_ELIMINATION_PIVOT_SCALE_THRESHOLD ) )
+        return false;
 
-        double maxInColumn = 0;
-        nnz = sparseColumn->getNnz();
-        entry = sparseColumn->getArray();
+    setPivot( vRow, vColumn, value, cost );
+    return true;
+}
 
-        for ( unsigned i = 0; i < nnz; ++i )
-        {
-            // Ignore entries that are not in the active submatrix
-            unsigned vRow = entry[i]._index;
-            unsigned uRow = _sparseLUFactors->_P._rowOrdering[vRow];
-            if ( uRow < _eliminationStep )
-                continue;
-
-            double contender = FloatUtils::abs( entry[i]._value );
-            if ( FloatUtils::gt( contender, maxInColumn ) )
-                maxInColumn = contender;
-        }
+void SparseGaussianEliminator::markowitzSearch()
+{
+    /*
+      No singletons, apply the Markowitz rule. Find the element with
+      acceptable magnitude that has the smallest Markowitz value. Columns
+      and rows are searched in increasing order of their counts: once
+      all columns and rows with count below k have been searched, every
+      remaining candidate costs at least (k-1)^2, so the search can stop
+      as soon as a candidate that cheap has been found.
+
+      Fail if no elements exists that are within acceptable magnitude.
+    */
+    unsigned minimalCost = _m * _m;
+    unsigned bestRow = 0;
+    unsigned bestColumn = 0;
+    double bestValue = 0.0;
+    double absBestValue = 0.0;
+    bool found = false;
 
-        if ( FloatUtils::isZero( maxInColumn ) )
-        {
-            throw BasisFactorizationError( BasisFactorizationError::GAUSSIAN_ELIMINATION_FAILED,
-                                           "Have a zero column" );
-        }
+    double threshold = GlobalConfiguration::GAUSSIAN_ELIMINATION_PIVOT_SCALE_THRESHOLD;
 
-        for ( unsigned i = 0; i < nnz; ++i )
+    for ( unsigned count = 2; count <= _m; ++count )
+    {
+        // Columns with this count
+        for ( unsigned vColumn = _columnCounts.first( count );
+              vColumn != CountBuckets::NONE;
+              vColumn = _columnCounts.next( vColumn ) )
         {
-            unsigned vRow = entry[i]._index;
-            unsigned uRow = _sparseLUFactors->_P._rowOrdering[vRow];
-
-            // Ignore entries that are not in the active submatrix
-            if ( uRow < _eliminationStep )
-                continue;
+            double maxInColumn = maxInActiveColumn( vColumn );
+            if ( FloatUtils::isZero( maxInColumn ) )
+            {
+                throw BasisFactorizationError( BasisFactorizationError::GAUSSIAN_ELIMINATION_FAILED,
+                                               "Have a zero column" );
+            }
 
-            double contender = entry[i]._value;
-            double absContender = FloatUtils::abs( contender );
+            const SparseUnsortedArray *sparseColumn = _sparseLUFactors->_Vt->getRow( vColumn );
+            const SparseUnsortedArray::Entry *entry = sparseColumn->getArray();
+            unsigned nnz = sparseColumn->getNnz();
 
-            // Only consider large-enough elements
-            if ( FloatUtils::gt( absContender,
-                                 maxInColumn * GlobalConfiguration::GAUSSIAN_ELIMINATION_PIVOT_SCALE_THRESHOLD ) )
+            for ( unsigned i = 0; i < nnz; ++i )
             {
-                unsigned cost = ( _numURowElements[uRow] - 1 ) * ( _numUColumnElements[uColumn] - 1 );
+                // Ignore entries that are not in the active submatrix
+                unsigned vRow = entry[i]._index;
+                if ( !_rowCounts.isActive( vRow ) )
+                    continue;
+
+                double absContender = FloatUtils::abs( entry[i]._value );
 
-                ASSERT( ( cost != minimalCost ) || found );
+                // Only consider large-enough elements
+                if ( !FloatUtils::gt( absContender, maxInColumn * threshold ) )
+                    continue;
 
+                unsigned cost = ( _rowCounts.getCount( vRow ) - 1 ) * ( count - 1 );
                 if ( ( cost < minimalCost ) ||
-                     ( ( cost == minimalCost ) && FloatUtils::gt( absContender, absPivotElement ) ) )
+                     ( ( cost == minimalCost ) && FloatUtils::gt( absContender, absBestValue ) ) )
                 {
                     minimalCost = cost;
-                    _uPivotRow = uRow;
-                    _uPivotColumn = uColumn;
-                    _vPivotRow = vRow;
-                    _vPivotColumn = vColumn;
-                    _pivotElement = contender;
-                    absPivotElement = absContender;
-
+                    bestRow = vRow;
+                    bestColumn = vColumn;
+                    bestValue = entry[i]._value;
+                    absBestValue = absContender;
                     found = true;
                 }
             }
         }
+
+        if ( found && minimalCost <= count * ( count - 1 ) )
+            break;
+
+        // Rows with this count
+        for ( unsigned vRow = _rowCounts.first( count );
+              vRow != CountBuckets::NONE;
+              vRow = _rowCounts.next( vRow ) )
+        {
+            const SparseUnsortedArray *sparseRow = _sparseLUFactors->_V->getRow( vRow );
+            const SparseUnsortedArray::Entry *entry = sparseRow->getArray();
+            unsigned nnz = sparseRow->getNnz();
+
+            // Rows of the active submatrix only have active entries
+            for ( unsigned i = 0; i < nnz; ++i )
+            {
+                unsigned vColumn = entry[i]._index;
+                unsigned cost = ( count - 1 ) * ( _columnCounts.getCount( vColumn ) - 1 );
+                double absContender = FloatUtils::abs( entry[i]._value );
+
+                if ( ( cost > minimalCost ) ||
+                     ( ( cost == minimalCost ) && !FloatUtils::gt( absContender, absBestValue ) ) )
+                    continue;
+
+                if ( !FloatUtils::gt( absContender, maxInActiveColumn( vColumn ) * threshold ) )
+                    continue;
+
+                minimalCost = cost;
+                bestRow = vRow;
+                bestColumn = vColumn;
+                bestValue = entry[i]._value;
+                absBestValue = absContender;
+                found = true;
+            }
+        }
+
+        if ( found && minimalCost <= count * count )
+            break;
     }
 
     if ( !found )
         throw BasisFactorizationError( BasisFactorizationError::GAUSSIAN_ELIMINATION_FAILED,
                                        "Couldn't find a pivot" );
 
+    setPivot( bestRow, bestColumn, bestValue, minimalCost );
+
     SGAUSSIAN_LOG( Stringf( "Choose pivot selected a pivot: V[%u,%u] = %lf (cost %u)", _vPivotRow, _vPivotColumn, _pivotElement, minimalCost ).ascii() );
 }
 
+double SparseGaussianEliminator::maxInActiveColumn( unsigned vColumn ) const
+{
+    const SparseUnsortedArray *sparseColumn = _sparseLUFactors->_Vt->getRow( vColumn );
+    const SparseUnsortedArray::Entry *entry = sparseColumn->getArray();
+    unsigned nnz = sparseColumn->getNnz();
+
+    double maxInColumn = 0;
+    for ( unsigned i = 0; i < nnz; ++i )
+    {
+        // Ignore entries that are not in the active submatrix
+        if ( !_rowCounts.isActive( entry[i]._index ) )
+            continue;
+
+        double contender = FloatUtils::abs( entry[i]._value );
+        if ( FloatUtils::gt( contender, maxInColumn ) )
+            maxInColumn = contender;
+    }
+
+    return maxInColumn;
+}
+
+void SparseGaussianEliminator::setPivot( unsigned vRow, unsigned vColumn, double value, unsigned cost )
+{
+    _vPivotRow = vRow;
+    _vPivotColumn = vColumn;
+    _uPivotRow = _sparseLUFactors->_P._rowOrdering[vRow];
+    _uPivotColumn = _sparseLUFactors->_Q._columnOrdering[vColumn];
+    _pivotElement = value;
+
+    ASSERT( _uPivotRow >= _eliminationStep );
+    ASSERT( _uPivotColumn >= _eliminationStep );
+
+    _pivotRows[_eliminationStep] = vRow;
+    _pivotColumns[_eliminationStep] = vColumn;
+    _pivotCosts[_eliminationStep] = cost;
+}
+
 void SparseGaussianEliminator::eliminate()
 {
     unsigned fColumn = _sparseLUFactors->_P._columnOrdering[_eliminationStep];
@@ -385,19 +471,24 @@ void SparseGaussianEliminator::eliminate()
       We know that V[_vPivotRow, _vPivotColumn] = U[k,k].
     */
 
-    // Get the pivot row in dense format, due to repeated access
-    _sparseLUFactors->_V->getRowDense( _vPivotRow, _work );
-
     /*
       The pivot row is not eliminated per se, but it is excluded
-      from the active submatrix, so we adjust the element counters
+      from the active submatrix, so we adjust the element counters.
+      Also keep the pivot row in dense format, due to repeated access.
     */
-    _numURowElements[_eliminationStep] = 0;
-    for ( unsigned uColumn = _eliminationStep; uColumn < _m; ++uColumn )
+    _rowCounts.remove( _vPivotRow );
+
+    const SparseUnsortedArray *pivotRow = _sparseLUFactors->_V->getRow( _vPivotRow );
+    const SparseUnsortedArray::Entry *pivotRowEntry = pivotRow->getArray();
+    unsigned pivotRowNnz = pivotRow->getNnz();
+    for ( unsigned i = 0; i < pivotRowNnz; ++i )
     {
-        unsigned vColumn = _sparseLUFactors->_Q._rowOrdering[uColumn];
-        if ( !FloatUtils::isZero( _work[vColumn] ) )
-            --_numUColumnElements[uColumn];
+        unsigned vColumn = pivotRowEntry[i]._index;
+        if ( vColumn == _vPivotColumn )
+            continue;
+
+        _work[vColumn] = pivotRowEntry[i]._value;
+        _columnCounts.decrement( vColumn );
     }
 
     // Process all rows below the pivot row
@@ -409,9 +500,8 @@ void SparseGaussianEliminator::eliminate()
     while ( index < sparseColumn->getNnz() )
     {
         unsigned vRow = entry[index]._index;
-        unsigned uRow = _sparseLUFactors->_P._rowOrdering[vRow];
 
-        if ( uRow <= _eliminationStep )
+        if ( !_rowCounts.isActive( vRow ) )
         {
             ++index;
             continue;
@@ -423,55 +513,12 @@ void SparseGaussianEliminator::eliminate()
         */
         double rowMultiplier = - entry[index]._value / _pivotElement;
 
-        // Get the row being eliminated in dense format
-        _sparseLUFactors->_V->getRowDense( vRow, _work2 );
-
         // Eliminate the sub-diagonal entry
-        --_numUColumnElements[_eliminationStep];
-        --_numURowElements[uRow];
         sparseColumn->erase( index );
-        _work2[_vPivotColumn] = 0;
+        _rowCounts.decrement( vRow );
 
         // Handle the rest of the row
-        for ( unsigned vColumnIndex = 0; vColumnIndex < _m; ++vColumnIndex )
-        {
-            unsigned uColumnIndex = _sparseLUFactors->_Q._columnOrdering[vColumnIndex];
-
-            // Only care about the active submatirx
-            if ( uColumnIndex <= _eliminationStep )
-                continue;
-
-            // If the value does not change, skip
-            if ( FloatUtils::isZero( _work[vColumnIndex] ) )
-                continue;
-
-            // Value will change
-            double oldValue = _work2[vColumnIndex];
-            bool wasZero = FloatUtils::isZero( oldValue );
-            double newValue = oldValue + ( rowMultiplier * _work[vColumnIndex] );
-            bool isZero = FloatUtils::isZero( newValue );
-
-            if ( !wasZero && isZero )
-            {
-                newValue = 0;
-                --_numUColumnElements[uColumnIndex];
-                --_numURowElements[uRow];
-            }
-            else if ( wasZero && !isZero )
-            {
-                ++_numUColumnElements[uColumnIndex];
-                ++_numURowElements[uRow];
-            }
-
-            _work2[vColumnIndex] = newValue;
-
-            // Transposed matrix is updated immediately, regular matrix will
-            // be updated when entire row has been processed
-            if ( newValue != oldValue )
-                _sparseLUFactors->_Vt->set( vColumnIndex, vRow, newValue );
-        }
-
-        _sparseLUFactors->_V->updateSingleRow( vRow, _work2 );
+        eliminateRow( vRow, rowMultiplier );
 
         /*
           Store the row multiplier in matrix F, using F = PLP'.
@@ -481,10 +528,171 @@ void SparseGaussianEliminator::eliminate()
         _sparseLUFactors->_Ft->set( fColumn, vRow, -rowMultiplier );
     }
 
+    _columnCounts.remove( _vPivotColumn );
+
+    // Clear the dense pivot row
+    for ( unsigned i = 0; i < pivotRowNnz; ++i )
+        _work[pivotRowEntry[i]._index] = 0;
+
     // Store the pivot element
     _sparseLUFactors->_vDiagonalElements[_vPivotRow] = _pivotElement;
 }
 
+void SparseGaussianEliminator::eliminateRow( unsigned vRow, double rowMultiplier )
+{
+    SparseUnsortedArray *sparseRow = _sparseLUFactors->_V->getRow( vRow );
+
+    // The row is rebuilt from its old entries
+    const SparseUnsortedArray::Entry *rowEntry = sparseRow->getArray();
+    _rowEntries.assign( rowEntry, rowEntry + sparseRow->getNnz() );
+    sparseRow->clear();
+
+    // Entries that appear in the pivot row change, the rest are kept
+    for ( const auto &oldEntry : _rowEntries )
+    {
+        unsigned vColumn = oldEntry._index;
+        if ( vColumn == _vPivotColumn )
+            continue;
+
+        if ( _work[vColumn] == 0 )
+        {
+            sparseRow->append( vColumn, oldEntry._value );
+            continue;
+        }
+
+        _columnMarks[vColumn] = true;
+
+        double newValue = oldEntry._value + ( rowMultiplier * _work[vColumn] );
+        if ( FloatUtils::isZero( newValue ) )
+        {
+            _columnCounts.decrement( vColumn );
+            _rowCounts.decrement( vRow );
+            newValue = 0;
+        }
+        else
+        {
+            sparseRow->append( vColumn, newValue );
+        }
+
+        // Transposed matrix is updated immediately
+        _sparseLUFactors->_Vt->set( vColumn, vRow, newValue );
+    }
+
+    // Entries of the pivot row that the row did not have are fill-in
+    const SparseUnsortedArray *pivotRow = _sparseLUFactors->_V->getRow( _vPivotRow );
+    const SparseUnsortedArray::Entry *pivotRowEntry = pivotRow->getArray();
+    unsigned pivotRowNnz = pivotRow->getNnz();
+    for ( unsigned i = 0; i < pivotRowNnz; ++i )
+    {
+        unsigned vColumn = pivotRowEntry[i]._index;
+        if ( vColumn == _vPivotColumn )
+            continue;
+
+        if ( _columnMarks[vColumn] )
+        {
+            _columnMarks[vColumn] = false;
+            continue;
+        }
+
+        double newValue = rowMultiplier * pivotRowEntry[i]._value;
+        if ( FloatUtils::isZero( newValue ) )
+            continue;
+
+        sparseRow->append( vColumn, newValue );
+        _sparseLUFactors->_Vt->getRow( vColumn )->append( vRow, newValue );
+        _columnCounts.increment( vColumn );
+        _rowCounts.increment( vRow );
+    }
+}
+
+void SparseGaussianEliminator::CountBuckets::initialize( unsigned size )
+{
+    _count.assign( size, 0 );
+    _next.assign( size, NONE );
+    _previous.assign( size, NONE );
+    _head.assign( size + 1, NONE );
+    _active.assign( size, false );
+}
+
+void SparseGaussianEliminator::CountBuckets::insert( unsigned index, unsigned count )
+{
+    ASSERT( !_active[index] );
+    ASSERT( count < _head.size() );
+
+    _active[index] = true;
+    _count[index] = count;
+    link( index );
+}
+
+void SparseGaussianEliminator::CountBuckets::remove( unsigned index )
+{
+    ASSERT( _active[index] );
+
+    unlink( index );
+    _active[index] = false;
+}
+
+void SparseGaussianEliminator::CountBuckets::increment( unsigned index )
+{
+    ASSERT( _active[index] );
+
+    unlink( index );
+    ++_count[index];
+    link( index );
+}
+
+void SparseGaussianEliminator::CountBuckets::decrement( unsigned index )
+{
+    ASSERT( _active[index] );
+    ASSERT( _count[index] > 0 );
+
+    unlink( index );
+    --_count[index];
+    link( index );
+}
+
+bool SparseGaussianEliminator::CountBuckets::isActive( unsigned index ) const
+{
+    return _active[index];
+}
+
+unsigned SparseGaussianEliminator::CountBuckets::getCount( unsigned index ) const
+{
+    return _count[index];
+}
+
+unsigned SparseGaussianEliminator::CountBuckets::first( unsigned count ) const
+{
+    return _head[count];
+}
+
+unsigned SparseGaussianEliminator::CountBuckets::next( unsigned index ) const
+{
+    return _next[index];
+}
+
+void SparseGaussianEliminator::CountBuckets::link( unsigned index )
+{
+    unsigned count = _count[index];
+
+    _previous[index] = NONE;
+    _next[index] = _head[count];
+    if ( _head[count] != NONE )
+        _previous[_head[count]] = index;
+    _head[count] = index;
+}
+
+void SparseGaussianEliminator::CountBuckets::unlink( unsigned index )
+{
+    if ( _previous[index] != NONE )
+        _next[_previous[index]] = _next[index];
+    else
+        _head[_count[index]] = _next[index];
+
+    if ( _next[index] != NONE )
+        _previous[_next[index]] = _previous[index];
+}
+
 void SparseGaussianEliminator::setStatistics( Statistics *statistics )
 {
     _statistics = statistics;
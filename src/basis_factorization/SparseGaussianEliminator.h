@@ -22,6 +22,8 @@
 #include "SparseMatrix.h"
 #include "Statistics.h"
 
+#include <vector>
+
 #define SGAUSSIAN_LOG( x, ... ) LOG( GlobalConfiguration::GAUSSIAN_ELIMINATION_LOGGING, "SparseGaussianEliminator: %s\n", x )
 
 class SparseGaussianEliminator
@@ -63,10 +65,14 @@ private:
     SparseLUFactors *_sparseLUFactors;
 
     /*
-      Work memory
+      Work memory: a dense copy of the pivot row that is kept zeroed
+      between uses, marks for the columns of the pivot row that have
+      already been updated in the row being eliminated, and the entries
+      of that row
     */
     double *_work;
-    double *_work2;
+    bool *_columnMarks;
+    std::vector<SparseUnsortedArray::Entry> _rowEntries;
 
     /*
       An object for reporting statistics
@@ -74,17 +80,86 @@ private:
     Statistics *_statistics;
 
     /*
-      Information on the number of non-zero elements in
-      every row of the current active submatrix of U
+      The rows (or columns) of the active submatrix, bucketed by their
+      number of non-zero elements, so that rows and columns with a
+      given count can be enumerated without scanning the matrix. Each
+      bucket is a doubly-linked list threaded through arrays indexed by
+      row (or column). Rows and columns are indexed as in V.
     */
-    unsigned *_numURowElements;
-    unsigned *_numUColumnElements;
+    class CountBuckets
+    {
+    public:
+        enum {
+            NONE = 0xFFFFFFFF,
+        };
+
+        /*
+          Start with no elements in any bucket
+        */
+        void initialize( unsigned size );
+
+        void insert( unsigned index, unsigned count );
+        void remove( unsigned index );
+        void increment( unsigned index );
+        void decrement( unsigned index );
+
+        bool isActive( unsigned index ) const;
+        unsigned getCount( unsigned index ) const;
+
+        /*
+          Iterate over the elements with the given count. Returns NONE
+          when there are no more elements.
+        */
+        unsigned first( unsigned count ) const;
+        unsigned next( unsigned index ) const;
+
+    private:
+        std::vector<unsigned> _count;
+        std::vector<unsigned> _next;
+        std::vector<unsigned> _previous;
+        std::vector<unsigned> _head;
+        std::vector<char> _active;
+
+        void link( unsigned index );
+        void unlink( unsigned index );
+    };
+
+    CountBuckets _rowCounts;
+    CountBuckets _columnCounts;
+
+    /*
+      The pivots chosen in the previous factorization, by elimination
+      step: their V indices and Markowitz costs. Consecutive bases
+      usually differ in a few columns, so these are tried first.
+    */
+    bool _havePreviousPivots;
+    std::vector<unsigned> _previousPivotRows;
+    std::vector<unsigned> _previousPivotColumns;
+    std::vector<unsigned> _previousPivotCosts;
+    std::vector<unsigned> _pivotRows;
+    std::vector<unsigned> _pivotColumns;
+    std::vector<unsigned> _pivotCosts;
 
     void choosePivot();
     void initializeFactorization( const SparseColumnsOfBasis *A, SparseLUFactors *sparseLUFactors );
     void factorize();
     void permute();
     void eliminate();
+
+    /*
+      Helpers for choosing the pivot. The largest absolute value in an
+      active column is used for the numerical stability threshold.
+    */
+    bool tryPreviousPivot();
+    void markowitzSearch();
+    double maxInActiveColumn( unsigned vColumn ) const;
+    void setPivot( unsigned vRow, unsigned vColumn, double value, unsigned cost );
+
+    /*
+      Add a multiple of the pivot row to a row of the active submatrix,
+      eliminating its entry in the pivot column
+    */
+    void eliminateRow( unsigned vRow, double rowMultiplier );
 };
 
 #endif // __SparseGaussianEliminator_h__
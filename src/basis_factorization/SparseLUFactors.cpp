@@ -16,9 +16,12 @@
 #include "BasisFactorizationError.h"
 #include "Debug.h"
 #include "FloatUtils.h"
+#include "GlobalConfiguration.h"
 #include "MString.h"
 #include "SparseLUFactors.h"
 
+#include <algorithm>
+
 SparseLUFactors::SparseLUFactors( unsigned m )
     : _m( m )
     , _F( NULL )
@@ -33,6 +36,10 @@ SparseLUFactors::SparseLUFactors( unsigned m )
     , _z( NULL )
     , _workMatrix( NULL )
     , _workVector( NULL )
+    , _reachMarks( NULL )
+    , _reachStack( NULL )
+    , _reachStackPosition( NULL )
+    , _reach( NULL )
 {
     _F = new SparseUnsortedArrays();
     if ( !_F )
@@ -65,6 +72,23 @@ SparseLUFactors::SparseLUFactors( unsigned m )
     _workVector = new double[m];
     if ( !_workVector )
         throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED, "SparseLUFactors::workVector" );
+
+    _reachMarks = new bool[m];
+    if ( !_reachMarks )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED, "SparseLUFactors::reachMarks" );
+    std::fill_n( _reachMarks, m, false );
+
+    _reachStack = new unsigned[m];
+    if ( !_reachStack )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED, "SparseLUFactors::reachStack" );
+
+    _reachStackPosition = new unsigned[m];
+    if ( !_reachStackPosition )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED, "SparseLUFactors::reachStackPosition" );
+
+    _reach = new unsigned[m];
+    if ( !_reach )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED, "SparseLUFactors::reach" );
 }
 
 SparseLUFactors::~SparseLUFactors()
@@ -116,6 +140,30 @@ SparseLUFactors::~SparseLUFactors()
         delete[] _workVector;
         _workVector = NULL;
     }
+
+    if ( _reachMarks )
+    {
+        delete[] _reachMarks;
+        _reachMarks = NULL;
+    }
+
+    if ( _reachStack )
+    {
+        delete[] _reachStack;
+        _reachStack = NULL;
+    }
+
+    if ( _reachStackPosition )
+    {
+        delete[] _reachStackPosition;
+        _reachStackPosition = NULL;
+    }
+
+    if ( _reach )
+    {
+        delete[] _reach;
+        _reach = NULL;
+    }
 }
 
 void SparseLUFactors::dump() const
@@ -430,6 +478,305 @@ void SparseLUFactors::backwardTransformation( const double *y, double *x ) const
     fBackwardTransformation( _z, x );
 }
 
+bool SparseLUFactors::useHypersparse( unsigned nnz ) const
+{
+    return nnz <= maxReach();
+}
+
+unsigned SparseLUFactors::maxReach() const
+{
+    return (unsigned)( GlobalConfiguration::HYPERSPARSE_TRANSFORMATION_DENSITY * _m );
+}
+
+void SparseLUFactors::collectNonZeros( const double *x, unsigned *indices, unsigned &nnz ) const
+{
+    nnz = 0;
+    for ( unsigned i = 0; i < _m; ++i )
+    {
+        if ( x[i] != 0.0 )
+            indices[nnz++] = i;
+    }
+}
+
+template <typename GetSuccessors>
+bool SparseLUFactors::computeReach( const unsigned *start,
+                                    unsigned numStart,
+                                    unsigned maxReach,
+                                    GetSuccessors getSuccessors,
+                                    unsigned &reachSize ) const
+{
+    /*
+      An iterative depth-first search. A pivot is appended to _reach
+      once all of its successors have been appended, so _reach ends up
+      in reverse topological order. Every marked pivot is either in
+      _reach or on the stack, which is how the marks are cleared.
+    */
+    unsigned numReached = 0;
+    unsigned depth = 0;
+    unsigned numMarked = 0;
+    bool tooMany = false;
+
+    for ( unsigned i = 0; i < numStart && !tooMany; ++i )
+    {
+        if ( _reachMarks[start[i]] )
+            continue;
+
+        _reachMarks[start[i]] = true;
+        ++numMarked;
+        _reachStack[0] = start[i];
+        _reachStackPosition[0] = 0;
+        depth = 1;
+
+        while ( depth > 0 )
+        {
+            unsigned pivot = _reachStack[depth - 1];
+            const SparseUnsortedArray *successors = getSuccessors( pivot );
+            const SparseUnsortedArray::Entry *entry = successors->getArray();
+            unsigned nnz = successors->getNnz();
+
+            unsigned &position = _reachStackPosition[depth - 1];
+            while ( position < nnz && _reachMarks[entry[position]._index] )
+                ++position;
+
+            if ( position < nnz )
+            {
+                unsigned successor = entry[position]._index;
+                ++position;
+
+                if ( ++numMarked > maxReach )
+                {
+                    tooMany = true;
+                    break;
+                }
+
+                _reachMarks[successor] = true;
+                _reachStack[depth] = successor;
+                _reachStackPosition[depth] = 0;
+                ++depth;
+            }
+            else
+            {
+                _reach[numReached++] = pivot;
+                --depth;
+            }
+        }
+    }
+
+    for ( unsigned i = 0; i < numReached; ++i )
+        _reachMarks[_reach[i]] = false;
+
+    if ( tooMany )
+    {
+        for ( unsigned i = 0; i < depth; ++i )
+            _reachMarks[_reachStack[i]] = false;
+        return false;
+    }
+
+    std::reverse( _reach, _reach + numReached );
+    reachSize = numReached;
+    return true;
+}
+
+void SparseLUFactors::fForwardTransformation( double *x, unsigned *indices, unsigned &nnz ) const
+{
+    // The pivots of F that x[fColumn] affects are those in column fColumn
+    unsigned reachSize = 0;
+    if ( !useHypersparse( nnz ) ||
+         !computeReach( indices,
+                        nnz,
+                        maxReach(),
+                        [this]( unsigned fColumn ) { return _Ft->getRow( fColumn ); },
+                        reachSize ) )
+    {
+        memcpy( _z, x, sizeof(double) * _m );
+        fForwardTransformation( _z, x );
+        collectNonZeros( x, indices, nnz );
+        return;
+    }
+
+    for ( unsigned i = 0; i < reachSize; ++i )
+    {
+        unsigned fColumn = _reach[i];
+        double xElement = x[fColumn];
+        if ( xElement != 0.0 )
+        {
+            const SparseUnsortedArray *sparseColumn = _Ft->getRow( fColumn );
+            const SparseUnsortedArray::Entry *entry = sparseColumn->getArray();
+            unsigned columnNnz = sparseColumn->getNnz();
+
+            for ( unsigned j = 0; j < columnNnz; ++j )
+                x[entry[j]._index] -= xElement * entry[j]._value;
+        }
+    }
+
+    memcpy( indices, _reach, sizeof(unsigned) * reachSize );
+    nnz = reachSize;
+}
+
+void SparseLUFactors::fBackwardTransformation( double *x, unsigned *indices, unsigned &nnz ) const
+{
+    // The pivots of F that x[fColumn] affects are those in row fColumn
+    unsigned reachSize = 0;
+    if ( !useHypersparse( nnz ) ||
+         !computeReach( indices,
+                        nnz,
+                        maxReach(),
+                        [this]( unsigned fColumn ) { return _F->getRow( fColumn ); },
+                        reachSize ) )
+    {
+        memcpy( _z, x, sizeof(double) * _m );
+        fBackwardTransformation( _z, x );
+        collectNonZeros( x, indices, nnz );
+        return;
+    }
+
+    for ( unsigned i = 0; i < reachSize; ++i )
+    {
+        unsigned fColumn = _reach[i];
+        double xElement = x[fColumn];
+        if ( xElement != 0.0 )
+        {
+            const SparseUnsortedArray *sparseRow = _F->getRow( fColumn );
+            const SparseUnsortedArray::Entry *entry = sparseRow->getArray();
+            unsigned rowNnz = sparseRow->getNnz();
+
+            for ( unsigned j = 0; j < rowNnz; ++j )
+                x[entry[j]._index] -= xElement * entry[j]._value;
+        }
+    }
+
+    memcpy( indices, _reach, sizeof(unsigned) * reachSize );
+    nnz = reachSize;
+}
+
+void SparseLUFactors::vForwardTransformation( double *x, unsigned *indices, unsigned &nnz ) const
+{
+    /*
+      The pivots are the rows of V. Row vRow is the pivot row of
+      column vColumn = Q[P'[vRow]], and the value of x[vColumn] affects
+      the rows of the entries in that column.
+    */
+    auto pivotColumn = [this]( unsigned vRow )
+    {
+        return _Q._rowOrdering[_P._rowOrdering[vRow]];
+    };
+
+    unsigned reachSize = 0;
+    if ( !useHypersparse( nnz ) ||
+         !computeReach( indices,
+                        nnz,
+                        maxReach(),
+                        [this, &pivotColumn]( unsigned vRow ) { return _Vt->getRow( pivotColumn( vRow ) ); },
+                        reachSize ) )
+    {
+        memcpy( _z, x, sizeof(double) * _m );
+        vForwardTransformation( _z, x );
+        collectNonZeros( x, indices, nnz );
+        return;
+    }
+
+    // Move y into the work vector, leaving x zero
+    for ( unsigned i = 0; i < reachSize; ++i )
+        _workVector[_reach[i]] = 0;
+
+    for ( unsigned i = 0; i < nnz; ++i )
+    {
+        _workVector[indices[i]] += x[indices[i]];
+        x[indices[i]] = 0;
+    }
+
+    for ( unsigned i = 0; i < reachSize; ++i )
+    {
+        unsigned vRow = _reach[i];
+        unsigned vColumn = pivotColumn( vRow );
+
+        double xElement = x[vColumn] = ( _workVector[vRow] / _vDiagonalElements[vRow] );
+        if ( xElement != 0.0 )
+        {
+            const SparseUnsortedArray *sparseColumn = _Vt->getRow( vColumn );
+            const SparseUnsortedArray::Entry *entry = sparseColumn->getArray();
+            unsigned columnNnz = sparseColumn->getNnz();
+
+            for ( unsigned j = 0; j < columnNnz; ++j )
+                _workVector[entry[j]._index] -= xElement * entry[j]._value;
+        }
+
+        indices[i] = vColumn;
+    }
+
+    nnz = reachSize;
+}
+
+void SparseLUFactors::vBackwardTransformation( double *x, unsigned *indices, unsigned &nnz ) const
+{
+    /*
+      The pivots are the columns of V. Column vColumn is the pivot
+      column of row vRow = P[Q'[vColumn]], and the value of x[vRow]
+      affects the columns of the entries in that row.
+    */
+    auto pivotRow = [this]( unsigned vColumn )
+    {
+        return _P._columnOrdering[_Q._columnOrdering[vColumn]];
+    };
+
+    unsigned reachSize = 0;
+    if ( !useHypersparse( nnz ) ||
+         !computeReach( indices,
+                        nnz,
+                        maxReach(),
+                        [this, &pivotRow]( unsigned vColumn ) { return _V->getRow( pivotRow( vColumn ) ); },
+                        reachSize ) )
+    {
+        memcpy( _z, x, sizeof(double) * _m );
+        vBackwardTransformation( _z, x );
+        collectNonZeros( x, indices, nnz );
+        return;
+    }
+
+    // Move y into the work vector, leaving x zero
+    for ( unsigned i = 0; i < reachSize; ++i )
+        _workVector[_reach[i]] = 0;
+
+    for ( unsigned i = 0; i < nnz; ++i )
+    {
+        _workVector[indices[i]] += x[indices[i]];
+        x[indices[i]] = 0;
+    }
+
+    for ( unsigned i = 0; i < reachSize; ++i )
+    {
+        unsigned vColumn = _reach[i];
+        unsigned vRow = pivotRow( vColumn );
+
+        double xElement = x[vRow] = ( _workVector[vColumn] / _vDiagonalElements[vRow] );
+        if ( xElement != 0.0 )
+        {
+            const SparseUnsortedArray *sparseRow = _V->getRow( vRow );
+            const SparseUnsortedArray::Entry *entry = sparseRow->getArray();
+            unsigned rowNnz = sparseRow->getNnz();
+
+            for ( unsigned j = 0; j < rowNnz; ++j )
+                _workVector[entry[j]._index] -= xElement * entry[j]._value;
+        }
+
+        indices[i] = vRow;
+    }
+
+    nnz = reachSize;
+}
+
+void SparseLUFactors::forwardTransformation( double *x, unsigned *indices, unsigned &nnz ) const
+{
+    fForwardTransformation( x, indices, nnz );
+    vForwardTransformation( x, indices, nnz );
+}
+
+void SparseLUFactors::backwardTransformation( double *x, unsigned *indices, unsigned &nnz ) const
+{
+    vBackwardTransformation( x, indices, nnz );
+    fBackwardTransformation( x, indices, nnz );
+}
+
 void SparseLUFactors::invertBasis( double *result )
 {
     ASSERT( result );
@@ -110,6 +110,27 @@ public:
     void vForwardTransformation( const double *y, double *x ) const;
     void vBackwardTransformation( const double *y, double *x ) const;
 
+    /*
+      Hypersparse versions of the above, for right hand sides with few
+      non-zero entries. The vector x is dense and is transformed in
+      place. On entry, x contains y and its non-zero entries are all
+      among the first nnz entries of indices; on exit, the same holds
+      for the solution.
+
+      The pivots that can affect the solution are those reachable from
+      the non-zero entries of y in the graph of the triangular factor.
+      They are found by a depth-first search, which also yields an
+      order in which to eliminate them (Gilbert-Peierls). If y or the
+      reached set is too dense, a full sweep is performed instead.
+    */
+    void forwardTransformation( double *x, unsigned *indices, unsigned &nnz ) const;
+    void backwardTransformation( double *x, unsigned *indices, unsigned &nnz ) const;
+
+    void fForwardTransformation( double *x, unsigned *indices, unsigned &nnz ) const;
+    void fBackwardTransformation( double *x, unsigned *indices, unsigned &nnz ) const;
+    void vForwardTransformation( double *x, unsigned *indices, unsigned &nnz ) const;
+    void vBackwardTransformation( double *x, unsigned *indices, unsigned &nnz ) const;
+
     /*
       Compute the inverse of the factorized basis
     */
@@ -122,6 +143,16 @@ public:
     double *_workMatrix;
     double *_workVector;
 
+    /*
+      Work memory for the hypersparse transformations: marks for the
+      visited pivots (all false between searches), the search stack
+      and the reached pivots in elimination order.
+    */
+    bool *_reachMarks;
+    unsigned *_reachStack;
+    unsigned *_reachStackPosition;
+    unsigned *_reach;
+
     /*
       Clone this SparseLUFactors object into another object
     */
@@ -131,6 +162,34 @@ public:
       For debugging purposes
     */
     void dump() const;
+
+private:
+    /*
+      Find the pivots reachable from the given ones, where the
+      successors of a pivot are the indices of the entries of
+      getSuccessors( pivot ), and store them in _reach in topological
+      order. Return false (and leave _reach undefined) if more than
+      maxReach pivots are reachable.
+    */
+    template <typename GetSuccessors>
+    bool computeReach( const unsigned *start,
+                       unsigned numStart,
+                       unsigned maxReach,
+                       GetSuccessors getSuccessors,
+                       unsigned &reachSize ) const;
+
+    /*
+      Whether a right hand side with the given number of non-zero
+      entries should be transformed hypersparsely, and the maximal
+      number of pivots that may then be reached.
+    */
+    bool useHypersparse( unsigned nnz ) const;
+    unsigned maxReach() const;
+
+    /*
+      Collect the indices of the non-zero entries of a dense vector
+    */
+    void collectNonZeros( const double *x, unsigned *indices, unsigned &nnz ) const;
 };
 
 #endif // __SparseLUFactors_h__
@@ -48,7 +48,7 @@ void SparseUnsortedList::initialize( const double *V, unsigned size )
         if ( FloatUtils::isZero( V[i] ) )
             continue;
 
-        _list.append( Entry( i, V[i] ) );
+        _list.push_back( Entry( i, V[i] ) );
     }
 }
 
@@ -80,7 +80,7 @@ double SparseUnsortedList::get( unsigned entry ) const
 
 void SparseUnsortedList::dump() const
 {
-    printf( "\nDumping sparse unsortedList: (nnz = %u)\n", _list.size() );
+    printf( "\nDumping sparse unsortedList: (nnz = %u)\n", getNnz() );
     for ( const auto &entry : _list )
         printf( "\tEntry %u: %6.2lf\n", entry._index, entry._value );
     printf( "\n" );
@@ -119,22 +119,22 @@ void SparseUnsortedList::storeIntoOther( SparseUnsortedList *other ) const
     other->_list = _list;
 }
 
-List<SparseUnsortedList::Entry>::const_iterator SparseUnsortedList::begin() const
+SparseUnsortedList::const_iterator SparseUnsortedList::begin() const
 {
     return _list.begin();
 }
 
-List<SparseUnsortedList::Entry>::const_iterator SparseUnsortedList::end() const
+SparseUnsortedList::const_iterator SparseUnsortedList::end() const
 {
     return _list.end();
 }
 
-List<SparseUnsortedList::Entry>::iterator SparseUnsortedList::begin()
+SparseUnsortedList::iterator SparseUnsortedList::begin()
 {
     return _list.begin();
 }
 
-List<SparseUnsortedList::Entry>::iterator SparseUnsortedList::end()
+SparseUnsortedList::iterator SparseUnsortedList::end()
 {
     return _list.end();
 }
@@ -148,7 +148,7 @@ void SparseUnsortedList::set( unsigned index, double value )
         if ( it->_index == index )
         {
             if ( isZero )
-                _list.erase( it );
+                erase( it );
             else
                 it->_value = value;
 
@@ -157,18 +157,18 @@ void SparseUnsortedList::set( unsigned index, double value )
     }
 
     if ( !isZero )
-        _list.append( Entry( index, value ) );
+        _list.push_back( Entry( index, value ) );
 }
 
 void SparseUnsortedList::append( unsigned index, double value )
 {
-    _list.append( Entry( index, value ) );
+    _list.push_back( Entry( index, value ) );
 }
 
 void SparseUnsortedList::addLastEntry( double entry )
 {
     if ( !FloatUtils::isZero( entry ) )
-        _list.append( Entry( _size, entry ) );
+        _list.push_back( Entry( _size, entry ) );
 
     ++_size;
 }
@@ -178,51 +178,74 @@ void SparseUnsortedList::incrementSize()
     ++_size;
 }
 
+void SparseUnsortedList::setSize( unsigned size )
+{
+    _size = size;
+}
+
 void SparseUnsortedList::mergeEntries( unsigned source, unsigned target )
 {
-    List<Entry>::iterator sourceIt = _list.end();
-    List<Entry>::iterator targetIt = _list.end();
-    List<Entry>::iterator it;
+    unsigned nnz = _list.size();
+    unsigned sourceIndex = nnz;
+    unsigned targetIndex = nnz;
 
-    for ( it = _list.begin(); it != _list.end(); ++it )
+    for ( unsigned i = 0; i < nnz; ++i )
     {
-        if ( it->_index == source )
+        if ( _list[i]._index == source )
         {
-            sourceIt = it;
-            if ( targetIt != _list.end() )
+            sourceIndex = i;
+            if ( targetIndex != nnz )
                 break;
         }
 
-        if ( it->_index == target )
+        if ( _list[i]._index == target )
         {
-            targetIt = it;
-            if ( sourceIt != _list.end() )
+            targetIndex = i;
+            if ( sourceIndex != nnz )
                 break;
         }
     }
 
     // If no source entry exists, we are done
-    if ( sourceIt == _list.end() )
+    if ( sourceIndex == nnz )
         return;
 
     // If no target entry, simply change index on source entry
-    if ( targetIt == _list.end() )
+    if ( targetIndex == nnz )
     {
-        sourceIt->_index = target;
+        _list[sourceIndex]._index = target;
         return;
     }
 
     // Both source and target entries
-    targetIt->_value += sourceIt->_value;
+    _list[targetIndex]._value += _list[sourceIndex]._value;
+    bool targetIsZero = FloatUtils::isZero( _list[targetIndex]._value );
+
+    // Erase the larger position first, so that the other entry is not
+    // the one moved into its place
+    unsigned first = sourceIndex;
+    unsigned second = targetIndex;
+    if ( first < second )
+    {
+        first = targetIndex;
+        second = sourceIndex;
+    }
 
-    _list.erase( sourceIt );
-    if ( FloatUtils::isZero( targetIt->_value ) )
-         _list.erase( targetIt );
+    if ( first == sourceIndex || targetIsZero )
+        erase( _list.begin() + first );
+    if ( second == sourceIndex || targetIsZero )
+        erase( _list.begin() + second );
 }
 
-List<SparseUnsortedList::Entry>::iterator SparseUnsortedList::erase( List<SparseUnsortedList::Entry>::iterator it )
+SparseUnsortedList::iterator SparseUnsortedList::erase( iterator it )
 {
-    return _list.erase( it );
+    // Move the last entry into the erased one's place
+    unsigned position = it - _list.begin();
+    if ( position + 1 != _list.size() )
+        _list[position] = _list.back();
+    _list.pop_back();
+
+    return _list.begin() + position;
 }
 
 unsigned SparseUnsortedList::getSize() const
@@ -19,6 +19,14 @@
 #include "HashMap.h"
 #include "SparseMatrix.h"
 
+#include <vector>
+
+/*
+  A sparse vector, stored as an unsorted array of (index, value)
+  entries. The entries are contiguous in memory, so iterating over
+  them is cache-friendly; erasing an entry moves the last entry into
+  its place.
+*/
 class SparseUnsortedList
 {
 public:
@@ -84,6 +92,12 @@ public:
     void addLastEntry( double entry );
     void incrementSize();
 
+    /*
+      Change the size of the list. Entries beyond the new size, if any,
+      must have been removed beforehand.
+    */
+    void setSize( unsigned size );
+
     /*
       Cloning
     */
@@ -93,15 +107,19 @@ public:
     /*
       Retrieve entries
     */
-    List<Entry>::const_iterator begin() const;
-    List<Entry>::const_iterator end() const;
-    List<Entry>::iterator begin();
-    List<Entry>::iterator end();
+    typedef std::vector<Entry>::iterator iterator;
+    typedef std::vector<Entry>::const_iterator const_iterator;
+
+    const_iterator begin() const;
+    const_iterator end() const;
+    iterator begin();
+    iterator end();
 
     /*
-      Erasing an element by iterator
+      Erasing an element by iterator. Returns an iterator to the entry
+      that takes its place, which has not been visited yet.
     */
-    List<Entry>::iterator erase( List<Entry>::iterator it );
+    iterator erase( iterator it );
 
     /*
       Addes the coefficient for entry 'source' to entry 'target'
@@ -122,7 +140,7 @@ public:
 
 private:
     unsigned _size;
-    List<Entry> _list;
+    std::vector<Entry> _list;
 };
 
 #endif // __SparseUnsortedList_h__
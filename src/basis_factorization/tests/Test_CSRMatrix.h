@@ -78,6 +78,67 @@ public:
                 TS_ASSERT_EQUALS( M2[i*4 + j], csr2.get( i, j ) );
     }
 
+    void test_initialize_exact()
+    {
+        double M1[] = {
+                0, 0, 0, 0,
+                5, 1e-12, 0, 0,
+                0, 0, 3, 0,
+                0, 6, 0, -1e-15,
+            };
+
+        CSRMatrix csr1;
+        csr1.initialize( M1, 4, 4 );
+        TS_ASSERT_EQUALS( csr1.getNnz(), 3U );
+        TS_ASSERT_EQUALS( csr1.get( 1, 1 ), 0.0 );
+
+        CSRMatrix csr2;
+        csr2.initializeExact( M1, 4, 4 );
+        TS_ASSERT_EQUALS( csr2.getNnz(), 5U );
+        for ( unsigned i = 0; i < 4; ++i )
+            for ( unsigned j = 0; j < 4; ++j )
+                TS_ASSERT_EQUALS( M1[i*4 + j], csr2.get( i, j ) );
+    }
+
+    void test_initialize_from_sparse_rows()
+    {
+        double M1[] = {
+            0, 0, 0, 0,
+            5, 8, 0, 0,
+            0, 0, 3, 0,
+            0, 6, 0, 2,
+        };
+
+        // Unsorted rows, with an explicit zero entry
+        SparseUnsortedList row0( 4 );
+        SparseUnsortedList row1( 4 );
+        row1.append( 1, 8 );
+        row1.append( 0, 5 );
+        SparseUnsortedList row2( 4 );
+        row2.append( 2, 3 );
+        row2.append( 0, 0 );
+        SparseUnsortedList row3( 4 );
+        row3.append( 3, 2 );
+        row3.append( 1, 6 );
+
+        const SparseUnsortedList *rows[] = { &row0, &row1, &row2, &row3 };
+
+        CSRMatrix csr1;
+        TS_ASSERT_THROWS_NOTHING( csr1.initialize( rows, 4, 4 ) );
+        TS_ASSERT_EQUALS( csr1.getNnz(), 5U );
+
+        for ( unsigned i = 0; i < 4; ++i )
+            for ( unsigned j = 0; j < 4; ++j )
+                TS_ASSERT_EQUALS( M1[i*4 + j], csr1.get( i, j ) );
+
+        // The matrix can still be extended afterwards
+        double row[] = { 1, 0, 0, 7 };
+        TS_ASSERT_THROWS_NOTHING( csr1.addLastRow( row ) );
+        TS_ASSERT_EQUALS( csr1.get( 4, 0 ), 1 );
+        TS_ASSERT_EQUALS( csr1.get( 4, 3 ), 7 );
+        TS_ASSERT_EQUALS( csr1.get( 3, 3 ), 2 );
+    }
+
     void test_store_restore()
     {
         double M1[] = {
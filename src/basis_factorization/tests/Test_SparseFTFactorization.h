@@ -20,6 +20,7 @@
 #include "FloatUtils.h"
 #include "GlobalConfiguration.h"
 #include "SparseFTFactorization.h"
+#include "SparseUnsortedList.h"
 #include "List.h"
 #include "MockColumnOracle.h"
 #include "MockErrno.h"
@@ -375,6 +376,83 @@ public:
         TS_ASSERT_THROWS_NOTHING( basis.forwardTransformation( a3, d3 ) );
         TS_ASSERT( memcmp( d3other, d3, sizeof(double) * 3 ) );
     }
+
+    void checkSparseTransformations( const SparseFTFactorization &basis, unsigned m )
+    {
+        double *y = new double[m];
+        double *expected = new double[m];
+        double *x = new double[m];
+
+        // Unit vectors and vectors with a few non-zero entries
+        for ( unsigned numNonZeros = 1; numNonZeros <= 8; numNonZeros *= 2 )
+        {
+            for ( unsigned first = 0; first < m; ++first )
+            {
+                SparseUnsortedList sparseY( m );
+                for ( unsigned i = 0; i < numNonZeros; ++i )
+                    sparseY.set( ( first + 11 * i ) % m, 1.0 + i );
+                sparseY.toDense( y );
+
+                basis.forwardTransformation( y, expected );
+                std::fill_n( x, m, 7.0 );
+                TS_ASSERT_THROWS_NOTHING( basis.sparseForwardTransformation( sparseY, x ) );
+                for ( unsigned i = 0; i < m; ++i )
+                    TS_ASSERT( FloatUtils::areEqual( x[i], expected[i] ) );
+
+                basis.backwardTransformation( y, expected );
+                std::fill_n( x, m, 7.0 );
+                TS_ASSERT_THROWS_NOTHING( basis.sparseBackwardTransformation( sparseY, x ) );
+                for ( unsigned i = 0; i < m; ++i )
+                    TS_ASSERT( FloatUtils::areEqual( x[i], expected[i] ) );
+            }
+        }
+
+        delete[] x;
+        delete[] expected;
+        delete[] y;
+    }
+
+    void test_sparse_transformations()
+    {
+        /*
+          A block-diagonal basis with blocks of size 3, so that the
+          transformation of a sparse vector only reaches a few pivots
+          and is done hypersparsely.
+        */
+        const unsigned m = 60;
+        SparseFTFactorization basis( m, *oracle );
+
+        double *B = new double[m * m];
+        std::fill_n( B, m * m, 0.0 );
+        for ( unsigned i = 0; i < m; ++i )
+        {
+            B[i * m + i] = 2 + ( i % 3 );
+            if ( i % 3 != 0 )
+                B[i * m + i - 1] = 1;
+            if ( i % 3 == 0 )
+                B[i * m + i + 2] = -1;
+        }
+
+        oracle->storeBasis( m, B );
+        basis.obtainFreshBasis();
+        checkSparseTransformations( basis, m );
+
+        // Replace a few columns of the basis, to introduce etas
+        double *newColumn = new double[m];
+        for ( unsigned column = 1; column < m; column += 17 )
+        {
+            std::fill_n( newColumn, m, 0.0 );
+            newColumn[column] = 3;
+            newColumn[( column + 1 ) % m] = 1;
+            newColumn[( column + 30 ) % m] = -2;
+            basis.updateToAdjacentBasis( column, NULL, newColumn );
+        }
+
+        checkSparseTransformations( basis, m );
+
+        delete[] newColumn;
+        delete[] B;
+    }
 };
 
 //
@@ -69,7 +69,7 @@ public:
     }
 
     List<SparseUnsortedList *> cleanup;
-    void basisIntoSparseColumns( double *B, unsigned m, SparseColumnsOfBasis &sparse )
+    void basisIntoSparseColumns( const double *B, unsigned m, SparseColumnsOfBasis &sparse )
     {
         double *denseColumn = new double[m];
 
@@ -334,6 +334,96 @@ public:
             TS_ASSERT_THROWS_NOTHING( delete ge );
         }
     }
+
+    void checkFactorization( SparseGaussianEliminator &ge, const double *A, unsigned m )
+    {
+        SparseLUFactors lu( m );
+        SparseColumnsOfBasis sparseCols( m );
+        basisIntoSparseColumns( A, m, sparseCols );
+
+        TS_ASSERT_THROWS_NOTHING( ge.run( &sparseCols, &lu ) );
+
+        double *result = new double[m * m];
+        computeMatrixFromFactorization( &lu, result );
+        for ( unsigned i = 0; i < m * m; ++i )
+            TS_ASSERT( FloatUtils::areEqual( A[i], result[i] ) );
+
+        double *At = new double[m * m];
+        transposeMatrix( A, At, m );
+        computeTransposedMatrixFromFactorization( &lu, result );
+        for ( unsigned i = 0; i < m * m; ++i )
+            TS_ASSERT( FloatUtils::areEqual( At[i], result[i] ) );
+
+        delete[] At;
+        delete[] result;
+    }
+
+    void test_refactorization()
+    {
+        // The same eliminator factorizes a sequence of bases, each
+        // differing from its predecessor in a single column
+        SparseGaussianEliminator ge( 5 );
+
+        double A[] =
+        {
+            2, 3, 0, 1, 0,
+            0, 1, 4, 0, 2,
+            1, 0, 1, 3, 0,
+            0, 2, 0, 1, 5,
+            3, 0, 2, 0, 1,
+        };
+
+        checkFactorization( ge, A, 5 );
+
+        // Replace column 2
+        A[2] = 1; A[7] = 0; A[12] = -2; A[17] = 4; A[22] = 0;
+        checkFactorization( ge, A, 5 );
+
+        // Replace column 0, zeroing out some previous pivots
+        A[0] = 0; A[5] = 0; A[10] = 0; A[15] = 7; A[20] = 0;
+        checkFactorization( ge, A, 5 );
+
+        // A singular basis fails, but does not affect the next run
+        double singular[25];
+        memcpy( singular, A, sizeof(singular) );
+        for ( unsigned i = 0; i < 5; ++i )
+            singular[i*5 + 1] = singular[i*5 + 3];
+
+        SparseLUFactors lu( 5 );
+        SparseColumnsOfBasis sparseCols( 5 );
+        basisIntoSparseColumns( singular, 5, sparseCols );
+        TS_ASSERT_THROWS_EQUALS( ge.run( &sparseCols, &lu ),
+                                 const BasisFactorizationError &e,
+                                 e.getCode(),
+                                 BasisFactorizationError::GAUSSIAN_ELIMINATION_FAILED );
+
+        checkFactorization( ge, A, 5 );
+    }
+
+    void test_larger_sparse_matrix()
+    {
+        // A sparse, diagonally dominant matrix with a few dense rows
+        // and columns, so that some pivots cause fill-in
+        const unsigned m = 40;
+        double A[m * m];
+        std::fill_n( A, m * m, 0.0 );
+
+        for ( unsigned i = 0; i < m; ++i )
+        {
+            A[i*m + i] = 10 + i;
+            A[i*m + ( ( i * 7 + 3 ) % m )] += 1;
+            A[( ( i * 11 + 5 ) % m ) * m + i] -= 2;
+            A[i*m + ( m - 1 )] += 0.5;
+            A[3*m + i] += 1.5;
+        }
+
+        SparseGaussianEliminator ge( m );
+        checkFactorization( ge, A, m );
+
+        for ( unsigned i = 0; i < m; ++i )
+            A[i*m + 17] = ( i % 3 == 0 ) ? 1 + i : 0;
+        checkFactorization( ge, A, m );
+    }
 };
 
 //
@@ -31,19 +31,24 @@ void matrixMultiplication( const double *matA, const double *matB, double *matC,
                  columnsA, alpha, matA, columnsA, matB, columnsB, beta, matC, columnsB);
 }
 #else
+#include "SimdKernels.h"
 void matrixMultiplication( const double *matA, const double *matB, double *matC,
                            unsigned rowsA, unsigned columnsA,
                            unsigned columnsB )
 {
+    // Row i of matC accumulates the rows of matB, scaled by the entries
+    // of row i of matA. This walks both matrices contiguously, and lets
+    // the zero entries of matA be skipped.
     for ( unsigned i = 0; i < rowsA; ++i )
     {
-        for ( unsigned j = 0; j < columnsB; ++j )
+        for ( unsigned k = 0; k < columnsA; ++k )
         {
-            for ( unsigned k = 0; k < columnsA; ++k )
-            {
-                matC[i * columnsB + j] += matA[i * columnsA + k]
-                    * matB[k * columnsB + j];
-            }
+            double scale = matA[i * columnsA + k];
+            if ( scale == 0 )
+                continue;
+
+            SimdKernels::addScaled( matB + k * columnsB, scale,
+                                    matC + i * columnsB, columnsB );
         }
     }
 }
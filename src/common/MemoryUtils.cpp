@@ -0,0 +1,65 @@
+/*********************                                                        */
+/*! \file MemoryUtils.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include "MemoryUtils.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <cstdio>
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+unsigned long long MemoryUtils::residentMemoryInKB()
+{
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if ( GetProcessMemoryInfo( GetCurrentProcess(), &counters, sizeof( counters ) ) )
+        return counters.WorkingSetSize / 1024;
+    return 0;
+#else
+#if defined( __linux__ )
+    FILE *statm = fopen( "/proc/self/statm", "r" );
+    if ( statm )
+    {
+        unsigned long long totalPages = 0;
+        unsigned long long residentPages = 0;
+        int read = fscanf( statm, "%llu %llu", &totalPages, &residentPages );
+        fclose( statm );
+        if ( read == 2 )
+            return residentPages * ( sysconf( _SC_PAGESIZE ) / 1024 );
+    }
+#endif
+    struct rusage usage;
+    if ( getrusage( RUSAGE_SELF, &usage ) != 0 )
+        return 0;
+#ifdef __APPLE__
+    // Reported in bytes on macOS
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+#endif
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,38 @@
+/*********************                                                        */
+/*! \file MemoryUtils.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#ifndef __MemoryUtils_h__
+#define __MemoryUtils_h__
+
+class MemoryUtils
+{
+public:
+    /*
+      The resident set size of the current process, in kilobytes. Returns
+      the peak resident set size on platforms where the current one is not
+      available, and 0 if neither is.
+    */
+    static unsigned long long residentMemoryInKB();
+};
+
+#endif // __MemoryUtils_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,210 @@
+/*********************                                                        */
+/*! \file SimdKernels.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include "SimdKernels.h"
+
+#include <atomic>
+
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#define SIMD_KERNELS_X86
+#include <immintrin.h>
+#endif
+
+/*
+  The scalar kernels are written without branches, so that the compiler
+  can still vectorize them for the baseline instruction set
+*/
+static void addScaledScalar( const double *x, double alpha, double *y, unsigned n )
+{
+    for ( unsigned i = 0; i < n; ++i )
+        y[i] += alpha * x[i];
+}
+
+static void addSignedScaledScalar( const double *x, double positiveScale,
+                                   double negativeScale, double *y, unsigned n )
+{
+    for ( unsigned i = 0; i < n; ++i )
+        y[i] += x[i] * ( x[i] >= 0 ? positiveScale : negativeScale );
+}
+
+#ifdef SIMD_KERNELS_X86
+
+__attribute__(( target( "avx2,fma" ) ))
+static void addScaledAvx2( const double *x, double alpha, double *y, unsigned n )
+{
+    __m256d alphas = _mm256_set1_pd( alpha );
+
+    unsigned i = 0;
+    for ( ; i + 4 <= n; i += 4 )
+    {
+        __m256d result = _mm256_fmadd_pd( _mm256_loadu_pd( x + i ), alphas,
+                                          _mm256_loadu_pd( y + i ) );
+        _mm256_storeu_pd( y + i, result );
+    }
+
+    addScaledScalar( x + i, alpha, y + i, n - i );
+}
+
+__attribute__(( target( "avx2,fma" ) ))
+static void addSignedScaledAvx2( const double *x, double positiveScale,
+                                 double negativeScale, double *y, unsigned n )
+{
+    __m256d zeros = _mm256_setzero_pd();
+    __m256d positiveScales = _mm256_set1_pd( positiveScale );
+    __m256d negativeScales = _mm256_set1_pd( negativeScale );
+
+    unsigned i = 0;
+    for ( ; i + 4 <= n; i += 4 )
+    {
+        __m256d values = _mm256_loadu_pd( x + i );
+        __m256d isNonNegative = _mm256_cmp_pd( values, zeros, _CMP_GE_OQ );
+        __m256d scales = _mm256_blendv_pd( negativeScales, positiveScales, isNonNegative );
+        __m256d result = _mm256_fmadd_pd( values, scales, _mm256_loadu_pd( y + i ) );
+        _mm256_storeu_pd( y + i, result );
+    }
+
+    addSignedScaledScalar( x + i, positiveScale, negativeScale, y + i, n - i );
+}
+
+__attribute__(( target( "avx512f" ) ))
+static void addScaledAvx512( const double *x, double alpha, double *y, unsigned n )
+{
+    __m512d alphas = _mm512_set1_pd( alpha );
+
+    unsigned i = 0;
+    for ( ; i + 8 <= n; i += 8 )
+    {
+        __m512d result = _mm512_fmadd_pd( _mm512_loadu_pd( x + i ), alphas,
+                                          _mm512_loadu_pd( y + i ) );
+        _mm512_storeu_pd( y + i, result );
+    }
+
+    addScaledScalar( x + i, alpha, y + i, n - i );
+}
+
+__attribute__(( target( "avx512f" ) ))
+static void addSignedScaledAvx512( const double *x, double positiveScale,
+                                   double negativeScale, double *y, unsigned n )
+{
+    __m512d zeros = _mm512_setzero_pd();
+    __m512d positiveScales = _mm512_set1_pd( positiveScale );
+    __m512d negativeScales = _mm512_set1_pd( negativeScale );
+
+    unsigned i = 0;
+    for ( ; i + 8 <= n; i += 8 )
+    {
+        __m512d values = _mm512_loadu_pd( x + i );
+        __mmask8 isNonNegative = _mm512_cmp_pd_mask( values, zeros, _CMP_GE_OQ );
+        __m512d scales = _mm512_mask_blend_pd( isNonNegative, negativeScales, positiveScales );
+        __m512d result = _mm512_fmadd_pd( values, scales, _mm512_loadu_pd( y + i ) );
+        _mm512_storeu_pd( y + i, result );
+    }
+
+    addSignedScaledScalar( x + i, positiveScale, negativeScale, y + i, n - i );
+}
+
+#endif // SIMD_KERNELS_X86
+
+static SimdKernels::InstructionSet detectInstructionSet()
+{
+#ifdef SIMD_KERNELS_X86
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports( "avx512f" ) )
+        return SimdKernels::AVX512;
+    if ( __builtin_cpu_supports( "avx2" ) && __builtin_cpu_supports( "fma" ) )
+        return SimdKernels::AVX2;
+#endif
+    return SimdKernels::SCALAR;
+}
+
+static std::atomic<int> &currentInstructionSet()
+{
+    static std::atomic<int> instructionSet( SimdKernels::getSupportedInstructionSet() );
+    return instructionSet;
+}
+
+void SimdKernels::addScaled( const double *x, double alpha, double *y, unsigned n )
+{
+    switch ( currentInstructionSet().load( std::memory_order_relaxed ) )
+    {
+#ifdef SIMD_KERNELS_X86
+    case AVX512:
+        addScaledAvx512( x, alpha, y, n );
+        return;
+    case AVX2:
+        addScaledAvx2( x, alpha, y, n );
+        return;
+#endif
+    default:
+        addScaledScalar( x, alpha, y, n );
+    }
+}
+
+void SimdKernels::addSignedScaled( const double *x, double positiveScale,
+                                   double negativeScale, double *y, unsigned n )
+{
+    switch ( currentInstructionSet().load( std::memory_order_relaxed ) )
+    {
+#ifdef SIMD_KERNELS_X86
+    case AVX512:
+        addSignedScaledAvx512( x, positiveScale, negativeScale, y, n );
+        return;
+    case AVX2:
+        addSignedScaledAvx2( x, positiveScale, negativeScale, y, n );
+        return;
+#endif
+    default:
+        addSignedScaledScalar( x, positiveScale, negativeScale, y, n );
+    }
+}
+
+SimdKernels::InstructionSet SimdKernels::getSupportedInstructionSet()
+{
+    static InstructionSet supported = detectInstructionSet();
+    return supported;
+}
+
+SimdKernels::InstructionSet SimdKernels::getInstructionSet()
+{
+    return (InstructionSet)currentInstructionSet().load();
+}
+
+void SimdKernels::setInstructionSet( InstructionSet instructionSet )
+{
+    if ( instructionSet > getSupportedInstructionSet() )
+        instructionSet = getSupportedInstructionSet();
+    currentInstructionSet().store( instructionSet );
+}
+
+const char *SimdKernels::instructionSetToString( InstructionSet instructionSet )
+{
+    switch ( instructionSet )
+    {
+    case AVX512:
+        return "AVX-512";
+    case AVX2:
+        return "AVX2";
+    default:
+        return "scalar";
+    }
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,74 @@
+/*********************                                                        */
+/*! \file SimdKernels.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#ifndef __SimdKernels_h__
+#define __SimdKernels_h__
+
+/*
+  Vector kernels for the inner loops of the bound propagation passes.
+  On x86 processors, AVX2 and AVX-512 versions are compiled alongside a
+  portable scalar version, and the widest one supported by the running
+  processor is selected the first time a kernel is called. This keeps
+  a single (possibly static) binary fast on any machine, without
+  requiring OpenBLAS.
+*/
+class SimdKernels
+{
+public:
+    enum InstructionSet {
+        SCALAR = 0,
+        AVX2 = 1,
+        AVX512 = 2,
+    };
+
+    /*
+      y += alpha * x, for vectors of length n
+    */
+    static void addScaled( const double *x, double alpha, double *y, unsigned n );
+
+    /*
+      y[i] += x[i] * positiveScale if x[i] >= 0, and
+      y[i] += x[i] * negativeScale otherwise, for vectors of length n.
+      This is the basic step of concretizing a symbolic bound, and of
+      substituting the relaxation of an activation function into one.
+    */
+    static void addSignedScaled( const double *x, double positiveScale,
+                                 double negativeScale, double *y, unsigned n );
+
+    /*
+      The widest instruction set supported by the processor and by the
+      compiler that built Marabou
+    */
+    static InstructionSet getSupportedInstructionSet();
+
+    /*
+      The instruction set currently used by the kernels. It can be
+      lowered, e.g. for testing, but not raised above the supported one.
+    */
+    static InstructionSet getInstructionSet();
+    static void setInstructionSet( InstructionSet instructionSet );
+
+    static const char *instructionSetToString( InstructionSet instructionSet );
+};
+
+#endif // __SimdKernels_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -36,12 +36,21 @@ Statistics::Statistics()
     , _numSplits( 0 )
     , _numPops( 0 )
     , _numVisitedTreeStates( 1 )
+    , _numStoredTableauStates( 0 )
+    , _totalSizeOfStoredTableauStates( 0 )
+    , _currentTrailSize( 0 )
+    , _maxTrailSize( 0 )
     , _numTableauPivots( 0 )
     , _numTableauDegeneratePivots( 0 )
     , _numTableauDegeneratePivotsByRequest( 0 )
     , _timePivotsMicro( 0 )
     , _numSimplexPivotSelectionsIgnoredForStability( 0 )
     , _numSimplexUnstablePivots( 0 )
+    , _numDualSimplexSteps( 0 )
+    , _numBoundFlips( 0 )
+    , _numLongStepBreakpoints( 0 )
+    , _numFeasibilityRestorations( 0 )
+    , _numPivotsToRestoreFeasibility( 0 )
     , _numAddedRows( 0 )
     , _numMergedColumns( 0 )
     , _currentTableauM( 0 )
@@ -49,21 +58,32 @@ Statistics::Statistics()
     , _numTableauBoundHopping( 0 )
     , _numTightenedBounds( 0 )
     , _numTighteningsFromSymbolicBoundTightening( 0 )
+    , _numLayersRecomputedBySymbolicBoundTightening( 0 )
+    , _numLayersReusedBySymbolicBoundTightening( 0 )
+    , _lpBoundTighteningBusyTimeMicro( 0 )
+    , _lpBoundTighteningIdleTimeMicro( 0 )
     , _numRowsExaminedByRowTightener( 0 )
     , _numTighteningsFromRows( 0 )
     , _numBoundTighteningsOnExplicitBasis( 0 )
     , _numTighteningsFromExplicitBasis( 0 )
+    , _numExplicitBasisRowsSkipped( 0 )
     , _numBoundNotificationsToPlConstraints( 0 )
     , _numBoundsProposedByPlConstraints( 0 )
     , _numBoundTighteningsOnConstraintMatrix( 0 )
     , _numTighteningsFromConstraintMatrix( 0 )
     , _numBasisRefactorizations( 0 )
+    , _timeBasisFactorizationMicro( 0 )
     , _pseNumIterations( 0 )
     , _pseNumResetReferenceSpace( 0 )
     , _ppNumEliminatedVars( 0 )
     , _ppNumTighteningIterations( 0 )
     , _ppNumConstraintsRemoved( 0 )
     , _ppNumEquationsRemoved( 0 )
+    , _ppNumEquationsExamined( 0 )
+    , _ppTimeEquationsMicro( 0 )
+    , _ppTimeConstraintsMicro( 0 )
+    , _ppTimeIdenticalVariablesMicro( 0 )
+    , _ppTimeVariableEliminationMicro( 0 )
     , _totalTimePerformingValidCaseSplitsMicro( 0 )
     , _totalTimePerformingSymbolicBoundTightening( 0 )
     , _totalTimeHandlingStatisticsMicro( 0 )
@@ -191,6 +211,14 @@ void Statistics::print()
             _ppNumConstraintsRemoved );
     printf( "\tNumber of equations removed due to variable elimination: %u\n",
             _ppNumEquationsRemoved );
+    printf( "\tNumber of equations examined for bound tightening: %llu\n",
+            _ppNumEquationsExamined );
+    printf( "\tTime spent on bound tightening using equations: %llu milli. Using PL constraints: %llu milli\n"
+            , _ppTimeEquationsMicro / 1000
+            , _ppTimeConstraintsMicro / 1000 );
+    printf( "\tTime spent on merging identical variables: %llu milli. Eliminating variables: %llu milli\n"
+            , _ppTimeIdenticalVariablesMicro / 1000
+            , _ppTimeVariableEliminationMicro / 1000 );
 
     printf( "\t--- Engine Statistics ---\n" );
     printf( "\tNumber of main loop iterations: %llu\n"
@@ -223,6 +251,13 @@ void Statistics::print()
             "\tUnstable pivots performed anyway: %llu\n"
             , _numSimplexPivotSelectionsIgnoredForStability
             , _numSimplexUnstablePivots );
+    printf( "\tDual simplex steps: %llu. Bound flips: %llu. Average flips per step: %.2lf\n"
+            , _numDualSimplexSteps
+            , _numBoundFlips
+            , printAverage( _numBoundFlips, _numDualSimplexSteps ) );
+    printf( "\tFeasibility restored after splits: %llu times. Average pivots per restoration: %.2lf\n"
+            , _numFeasibilityRestorations
+            , printAverage( _numPivotsToRestoreFeasibility, _numFeasibilityRestorations ) );
 
     printf( "\t--- Tableau Statistics ---\n" );
     printf( "\tTotal number of pivots performed: %llu\n", _numTableauPivots );
@@ -239,6 +274,7 @@ void Statistics::print()
             printAverage( _timePivotsMicro / 1000, _numTableauPivots ) );
 
     printf( "\tTotal number of fake pivots performed: %llu\n", _numTableauBoundHopping );
+    printf( "\tBasic bounds passed by long-step ratio tests: %llu\n", _numLongStepBreakpoints );
     printf( "\tTotal number of rows added: %llu. Number of merged columns: %llu\n"
             , _numAddedRows
             , _numMergedColumns );
@@ -254,6 +290,13 @@ void Statistics::print()
             , _numPops );
     printf( "\tMax stack depth: %u\n"
             , _maxStackDepth );
+    printf( "\tStored tableau states: %llu. Average size: %.2lf KB\n"
+            , _numStoredTableauStates
+            , printAverage( _totalSizeOfStoredTableauStates, _numStoredTableauStates ) / 1024 );
+    printf( "\tTrail size: %llu. Max trail size: %llu. Max trail size / max stack depth: %.2lf\n"
+            , _currentTrailSize
+            , _maxTrailSize
+            , printAverage( _maxTrailSize, _maxStackDepth ) );
 
     printf( "\t--- Bound Tightening Statistics ---\n" );
     printf( "\tNumber of tightened bounds: %llu.\n", _numTightenedBounds );
@@ -265,6 +308,9 @@ void Statistics::print()
             , _numBoundTighteningsOnExplicitBasis
             , _numTighteningsFromExplicitBasis );
 
+    printf( "\t\tNumber of explicit basis rows skipped for lack of tightening potential: %llu\n"
+            , _numExplicitBasisRowsSkipped );
+
     printf( "\t\tNumber of bound tightening rounds on the entire constraint matrix: %llu. "
             "Consequent tightenings: %llu\n"
             , _numBoundTighteningsOnConstraintMatrix
@@ -277,6 +323,9 @@ void Statistics::print()
     printf( "\t--- Basis Factorization statistics ---\n" );
     printf( "\tNumber of basis refactorizations: %llu\n",
             _numBasisRefactorizations );
+    printf( "\tTotal time factorizing bases: %llu milli. Average per factorization: %.2lf milli\n"
+            , _timeBasisFactorizationMicro / 1000
+            , printAverage( _timeBasisFactorizationMicro / 1000, _numBasisRefactorizations ) );
 
     printf( "\t--- Projected Steepest Edge Statistics ---\n" );
     printf( "\tNumber of iterations: %llu.\n", _pseNumIterations );
@@ -287,6 +336,44 @@ void Statistics::print()
 
     printf( "\t--- SBT ---\n" );
     printf( "\tNumber of tightened bounds: %llu\n", _numTighteningsFromSymbolicBoundTightening );
+    printf( "\tLayers recomputed: %llu. Layers reused: %llu\n"
+            , _numLayersRecomputedBySymbolicBoundTightening
+            , _numLayersReusedBySymbolicBoundTightening );
+
+    if ( !_lpBoundTighteningSolves.empty() ||
+         _lpBoundTighteningBusyTimeMicro + _lpBoundTighteningIdleTimeMicro > 0 )
+    {
+        unsigned long long totalSolves = 0;
+        unsigned long long totalWarmStartedSolves = 0;
+        unsigned long long totalTime = 0;
+        for ( const auto &layer : _lpBoundTighteningSolves )
+        {
+            totalSolves += layer.second._numSolves;
+            totalWarmStartedSolves += layer.second._numWarmStartedSolves;
+            totalTime += layer.second._timeMicro;
+        }
+
+        printf( "\t--- LP-based bound tightening ---\n" );
+        printf( "\tNumber of LP solves: %llu (%llu warm started). Total time: %llu milli\n"
+                , totalSolves
+                , totalWarmStartedSolves
+                , totalTime / 1000 );
+        printf( "\tWorker threads: busy %llu milli, idle %llu milli (%.2f%% busy)\n"
+                , _lpBoundTighteningBusyTimeMicro / 1000
+                , _lpBoundTighteningIdleTimeMicro / 1000
+                , printPercents( _lpBoundTighteningBusyTimeMicro,
+                                 _lpBoundTighteningBusyTimeMicro + _lpBoundTighteningIdleTimeMicro ) );
+
+        for ( const auto &layer : _lpBoundTighteningSolves )
+            printf( "\t\tLayer %u: %llu solves (%llu warm started). Time: %llu milli. "
+                    "Average: %.2f milli\n"
+                    , layer.first
+                    , layer.second._numSolves
+                    , layer.second._numWarmStartedSolves
+                    , layer.second._timeMicro / 1000
+                    , layer.second._numSolves > 0 ?
+                    ( (double)layer.second._timeMicro / 1000 ) / layer.second._numSolves : 0 );
+    }
 }
 
 double Statistics::printPercents( unsigned long long part, unsigned long long total ) const
@@ -436,6 +523,27 @@ void Statistics::incNumSimplexUnstablePivots()
     ++_numSimplexUnstablePivots;
 }
 
+void Statistics::incNumDualSimplexSteps()
+{
+    ++_numDualSimplexSteps;
+}
+
+void Statistics::addNumBoundFlips( unsigned numFlips )
+{
+    _numBoundFlips += numFlips;
+}
+
+void Statistics::addNumLongStepBreakpoints( unsigned numBreakpoints )
+{
+    _numLongStepBreakpoints += numBreakpoints;
+}
+
+void Statistics::addPivotsToRestoreFeasibility( unsigned long long numPivots )
+{
+    ++_numFeasibilityRestorations;
+    _numPivotsToRestoreFeasibility += numPivots;
+}
+
 void Statistics::incNumAddedRows()
 {
     ++_numAddedRows;
@@ -477,6 +585,11 @@ void Statistics::incNumTighteningsFromExplicitBasis( unsigned increment )
     _numTighteningsFromExplicitBasis += increment;
 }
 
+void Statistics::incNumExplicitBasisRowsSkipped()
+{
+    ++_numExplicitBasisRowsSkipped;
+}
+
 void Statistics::incNumBoundNotificationsPlConstraints()
 {
     ++_numBoundNotificationsToPlConstraints;
@@ -502,6 +615,11 @@ void Statistics::incNumBasisRefactorizations()
     ++_numBasisRefactorizations;
 }
 
+void Statistics::addTimeBasisFactorization( unsigned long long time )
+{
+    _timeBasisFactorizationMicro += time;
+}
+
 void Statistics::pseIncNumIterations()
 {
     ++_pseNumIterations;
@@ -549,6 +667,36 @@ void Statistics::ppIncNumEquationsRemoved()
     ++_ppNumEquationsRemoved;
 }
 
+void Statistics::ppAddNumEquationsExamined( unsigned numEquations )
+{
+    _ppNumEquationsExamined += numEquations;
+}
+
+void Statistics::ppAddTimeForEquations( unsigned long long time )
+{
+    _ppTimeEquationsMicro += time;
+}
+
+void Statistics::ppAddTimeForConstraints( unsigned long long time )
+{
+    _ppTimeConstraintsMicro += time;
+}
+
+void Statistics::ppAddTimeForIdenticalVariables( unsigned long long time )
+{
+    _ppTimeIdenticalVariablesMicro += time;
+}
+
+void Statistics::ppAddTimeForVariableElimination( unsigned long long time )
+{
+    _ppTimeVariableEliminationMicro += time;
+}
+
+unsigned long long Statistics::ppGetNumEquationsExamined() const
+{
+    return _ppNumEquationsExamined;
+}
+
 void Statistics::addTimeForValidCaseSplit( unsigned long long time )
 {
     _totalTimePerformingValidCaseSplitsMicro += time;
@@ -600,6 +748,19 @@ void Statistics::incNumVisitedTreeStates()
     ++_numVisitedTreeStates;
 }
 
+void Statistics::incNumStoredTableauStates( unsigned long long sizeInBytes )
+{
+    ++_numStoredTableauStates;
+    _totalSizeOfStoredTableauStates += sizeInBytes;
+}
+
+void Statistics::setCurrentTrailSize( unsigned long long size )
+{
+    _currentTrailSize = size;
+    if ( _currentTrailSize > _maxTrailSize )
+        _maxTrailSize = _currentTrailSize;
+}
+
 unsigned Statistics::getNumVisitedTreeStates() const
 {
     return _numVisitedTreeStates;
@@ -610,6 +771,16 @@ unsigned Statistics::getNumSplits() const
     return _numSplits;
 }
 
+unsigned long long Statistics::getNumStoredTableauStates() const
+{
+    return _numStoredTableauStates;
+}
+
+unsigned long long Statistics::getMaxTrailSize() const
+{
+    return _maxTrailSize;
+}
+
 unsigned long long Statistics::getNumTableauPivots() const
 {
     return _numTableauPivots;
@@ -645,6 +816,36 @@ unsigned long long Statistics::getNumSimplexUnstablePivots() const
     return _numSimplexUnstablePivots;
 }
 
+unsigned long long Statistics::getNumDualSimplexSteps() const
+{
+    return _numDualSimplexSteps;
+}
+
+unsigned long long Statistics::getNumBoundFlips() const
+{
+    return _numBoundFlips;
+}
+
+unsigned long long Statistics::getNumLongStepBreakpoints() const
+{
+    return _numLongStepBreakpoints;
+}
+
+unsigned long long Statistics::getNumExplicitBasisRowsSkipped() const
+{
+    return _numExplicitBasisRowsSkipped;
+}
+
+unsigned long long Statistics::getNumFeasibilityRestorations() const
+{
+    return _numFeasibilityRestorations;
+}
+
+unsigned long long Statistics::getNumPivotsToRestoreFeasibility() const
+{
+    return _numPivotsToRestoreFeasibility;
+}
+
 unsigned long long Statistics::getTotalTime() const
 {
     unsigned long long total =
@@ -685,6 +886,29 @@ void Statistics::incNumTighteningsFromSymbolicBoundTightening( unsigned incremen
     _numTighteningsFromSymbolicBoundTightening += increment;
 }
 
+void Statistics::incNumLayersBySymbolicBoundTightening( unsigned recomputed, unsigned reused )
+{
+    _numLayersRecomputedBySymbolicBoundTightening += recomputed;
+    _numLayersReusedBySymbolicBoundTightening += reused;
+}
+
+void Statistics::addLPBoundTighteningSolves( unsigned layer, unsigned numSolves,
+                                             unsigned numWarmStartedSolves,
+                                             unsigned long long timeMicro )
+{
+    LPSolveCounters &counters = _lpBoundTighteningSolves[layer];
+    counters._numSolves += numSolves;
+    counters._numWarmStartedSolves += numWarmStartedSolves;
+    counters._timeMicro += timeMicro;
+}
+
+void Statistics::addLPBoundTighteningThreadTime( unsigned long long busyMicro,
+                                                 unsigned long long idleMicro )
+{
+    _lpBoundTighteningBusyTimeMicro += busyMicro;
+    _lpBoundTighteningIdleTimeMicro += idleMicro;
+}
+
 //
 // Local Variables:
 // compile-command: "make -C ../.. "
@@ -17,6 +17,7 @@
 #define __Statistics_h__
 
 #include "List.h"
+#include "Map.h"
 #include "TimeUtils.h"
 
 class Statistics
@@ -77,6 +78,10 @@ public:
     void incNumTableauDegeneratePivotsByRequest();
     void incNumSimplexPivotSelectionsIgnoredForStability();
     void incNumSimplexUnstablePivots();
+    void incNumDualSimplexSteps();
+    void addNumBoundFlips( unsigned numFlips );
+    void addNumLongStepBreakpoints( unsigned numBreakpoints );
+    void addPivotsToRestoreFeasibility( unsigned long long numPivots );
     void incNumAddedRows();
     void incNumMergedColumns();
     void setCurrentTableauDimension( unsigned m, unsigned n );
@@ -85,6 +90,12 @@ public:
     unsigned long long getNumTableauPivots() const;
     unsigned long long getNumSimplexPivotSelectionsIgnoredForStability() const;
     unsigned long long getNumSimplexUnstablePivots() const;
+    unsigned long long getNumDualSimplexSteps() const;
+    unsigned long long getNumBoundFlips() const;
+    unsigned long long getNumLongStepBreakpoints() const;
+    unsigned long long getNumExplicitBasisRowsSkipped() const;
+    unsigned long long getNumFeasibilityRestorations() const;
+    unsigned long long getNumPivotsToRestoreFeasibility() const;
 
     /*
       Smt core related statistics.
@@ -94,10 +105,14 @@ public:
     void incNumPops();
     void addTimeSmtCore( unsigned long long time );
     void incNumVisitedTreeStates();
+    void incNumStoredTableauStates( unsigned long long sizeInBytes );
+    void setCurrentTrailSize( unsigned long long size );
     unsigned getMaxStackDepth() const;
     unsigned getNumPops() const;
     unsigned getNumVisitedTreeStates() const;
     unsigned getNumSplits() const;
+    unsigned long long getNumStoredTableauStates() const;
+    unsigned long long getMaxTrailSize() const;
     unsigned long long getTotalTime() const;
 
     /*
@@ -119,16 +134,28 @@ public:
 
     void incNumBoundTighteningsOnExplicitBasis();
     void incNumTighteningsFromExplicitBasis( unsigned increment = 1 );
+    void incNumExplicitBasisRowsSkipped();
 
     void incNumBoundNotificationsPlConstraints();
     void incNumBoundsProposedByPlConstraints();
 
     void incNumTighteningsFromSymbolicBoundTightening( unsigned increment );
+    void incNumLayersBySymbolicBoundTightening( unsigned recomputed, unsigned reused );
+
+    /*
+      LP-based bound tightening statistics, per layer of the network
+    */
+    void addLPBoundTighteningSolves( unsigned layer, unsigned numSolves,
+                                     unsigned numWarmStartedSolves,
+                                     unsigned long long timeMicro );
+    void addLPBoundTighteningThreadTime( unsigned long long busyMicro,
+                                         unsigned long long idleMicro );
 
     /*
       Basis factorization statistics
     */
     void incNumBasisRefactorizations();
+    void addTimeBasisFactorization( unsigned long long time );
 
     /*
       Projected Steepest Edge related statistics.
@@ -143,6 +170,12 @@ public:
     void ppIncNumTighteningIterations();
     void ppIncNumConstraintsRemoved();
     void ppIncNumEquationsRemoved();
+    void ppAddNumEquationsExamined( unsigned numEquations );
+    void ppAddTimeForEquations( unsigned long long time );
+    void ppAddTimeForConstraints( unsigned long long time );
+    void ppAddTimeForIdenticalVariables( unsigned long long time );
+    void ppAddTimeForVariableElimination( unsigned long long time );
+    unsigned long long ppGetNumEquationsExamined() const;
 
     /*
       For debugging purposes
@@ -200,6 +233,15 @@ private:
     // Total number of states in the search tree visited so far
     unsigned _numVisitedTreeStates;
 
+    // Number and total size (in bytes) of complete tableau states
+    // stored, either for backtracking or as trail checkpoints
+    unsigned long long _numStoredTableauStates;
+    unsigned long long _totalSizeOfStoredTableauStates;
+
+    // Current and max number of bound changes on the tableau trail
+    unsigned long long _currentTrailSize;
+    unsigned long long _maxTrailSize;
+
     // Total number of tableau pivot operations performed, both
     // degenerate and non-degenerate
     unsigned long long _numTableauPivots;
@@ -222,6 +264,22 @@ private:
     // no better option could be found.
     unsigned long long _numSimplexUnstablePivots;
 
+    // Total number of simplex steps performed by the dual simplex
+    unsigned long long _numDualSimplexSteps;
+
+    // Total number of non-basic variables flipped to their opposite
+    // bounds by the bound-flipping dual ratio test
+    unsigned long long _numBoundFlips;
+
+    // Total number of basic variables that the long-step primal ratio
+    // test moved past their bounds, without them leaving the basis
+    unsigned long long _numLongStepBreakpoints;
+
+    // Number of times feasibility was restored after a split, and the
+    // total number of pivots it took
+    unsigned long long _numFeasibilityRestorations;
+    unsigned long long _numPivotsToRestoreFeasibility;
+
     // Total number of rows added to the tableau
     unsigned long long _numAddedRows;
 
@@ -243,6 +301,34 @@ private:
     // The number of bounds tightened via symbolic bound tightening
     unsigned long long _numTighteningsFromSymbolicBoundTightening;
 
+    // The number of layers that symbolic bound tightening recomputed, and
+    // the number of layers whose results it reused from the previous pass
+    unsigned long long _numLayersRecomputedBySymbolicBoundTightening;
+    unsigned long long _numLayersReusedBySymbolicBoundTightening;
+
+    // The number of LP solves performed by LP-based bound tightening for the
+    // neurons of each layer, how many of them started from the basis of a
+    // previous solve, and the time they took
+    struct LPSolveCounters
+    {
+        LPSolveCounters()
+            : _numSolves( 0 )
+            , _numWarmStartedSolves( 0 )
+            , _timeMicro( 0 )
+        {
+        }
+
+        unsigned long long _numSolves;
+        unsigned long long _numWarmStartedSolves;
+        unsigned long long _timeMicro;
+    };
+    Map<unsigned, LPSolveCounters> _lpBoundTighteningSolves;
+
+    // Time the worker threads of the LP-based bound tightening spent
+    // solving, and waiting for the other workers
+    unsigned long long _lpBoundTighteningBusyTimeMicro;
+    unsigned long long _lpBoundTighteningIdleTimeMicro;
+
     // Number of pivot rows examined by the row tightener, and consequent tightenings
     // proposed.
     unsigned long long _numRowsExaminedByRowTightener;
@@ -253,6 +339,10 @@ private:
     unsigned long long _numBoundTighteningsOnExplicitBasis;
     unsigned long long _numTighteningsFromExplicitBasis;
 
+    // Number of explicit basis rows that were computed on demand, and then
+    // skipped because they could not lead to tighter bounds.
+    unsigned long long _numExplicitBasisRowsSkipped;
+
     // Number of bound notifications sent to pl constraints
     unsigned long long _numBoundNotificationsToPlConstraints;
 
@@ -267,6 +357,9 @@ private:
     // Basis factorization statistics
     unsigned long long _numBasisRefactorizations;
 
+    // Total time spent factorizing bases from scratch, in microseconds
+    unsigned long long _timeBasisFactorizationMicro;
+
     // Projected steepest edge statistics
     unsigned long long _pseNumIterations;
     unsigned long long _pseNumResetReferenceSpace;
@@ -277,6 +370,17 @@ private:
     unsigned _ppNumConstraintsRemoved;
     unsigned _ppNumEquationsRemoved;
 
+    // Number of times the preprocessor derived bounds from an equation
+    unsigned long long _ppNumEquationsExamined;
+
+    // Time spent in the preprocessor phases: bound tightening using the
+    // equations and the pl constraints, merging identical variables, and
+    // eliminating variables
+    unsigned long long _ppTimeEquationsMicro;
+    unsigned long long _ppTimeConstraintsMicro;
+    unsigned long long _ppTimeIdenticalVariablesMicro;
+    unsigned long long _ppTimeVariableEliminationMicro;
+
     // Total amount of time spent performing valid case splits
     unsigned long long _totalTimePerformingValidCaseSplitsMicro;
 
@@ -0,0 +1,43 @@
+/*********************                                                        */
+/*! \file mman.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief [[ Add one-line brief description here ]]
+ **
+ ** [[ Add lengthier description here ]]
+ **/
+
+#ifndef __T__sys__Mman_h__
+#define __T__sys__Mman_h__
+
+#include <cxxtest/Mock.h>
+
+#include <sys/mman.h>
+#include <sys/types.h>
+
+CXXTEST_MOCK_GLOBAL( void *,
+                     mmap,
+                     ( void *addr, size_t length, int prot, int flags, int fd, off_t offset ),
+                     ( addr, length, prot, flags, fd, offset ) );
+
+CXXTEST_MOCK_GLOBAL( int,
+                     munmap,
+                     ( void *addr, size_t length ),
+                     ( addr, length ) );
+
+#endif // __T__sys__Mman_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../../../.. "
+// tags-file-name: "../../../../TAGS"
+// c-basic-offset: 4
+// End:
+//
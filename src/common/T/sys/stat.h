@@ -32,6 +32,11 @@ CXXTEST_MOCK_GLOBAL( int,
 					 ( const char *pathname, int flags, mode_t mode ),
 					 ( pathname, flags, mode  ) );
 
+CXXTEST_MOCK_GLOBAL( int,
+                     fstat,
+                     ( int fd, struct stat *buf ),
+                     ( fd, buf ) );
+
 #endif // __T__sys__Stat_h__
 
 //
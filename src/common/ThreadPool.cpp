@@ -0,0 +1,181 @@
+/*********************                                                        */
+/*! \file ThreadPool.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include "ThreadPool.h"
+#include "TimeUtils.h"
+
+ThreadPool::ThreadPool( unsigned numThreads )
+    : _numThreads( numThreads > 0 ? numThreads : 1 )
+    , _job( NULL )
+    , _numJobs( 0 )
+    , _nextJob( 0 )
+    , _numBusyThreads( 0 )
+    , _generation( 0 )
+    , _quit( false )
+    , _busyTimeMicro( 0 )
+    , _loopTimeMicro( 0 )
+{
+    for ( unsigned i = 1; i < _numThreads; ++i )
+        _threads.append( new std::thread( &ThreadPool::helperThreadLoop, this, i ) );
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock( _mutex );
+        _quit = true;
+    }
+    _loopStarted.notify_all();
+
+    for ( auto &thread : _threads )
+    {
+        thread->join();
+        delete thread;
+        thread = NULL;
+    }
+    _threads.clear();
+}
+
+unsigned ThreadPool::getNumThreads() const
+{
+    return _numThreads;
+}
+
+void ThreadPool::parallelFor( unsigned numJobs, const Job &job )
+{
+    if ( numJobs == 0 )
+        return;
+
+    struct timespec start = TimeUtils::sampleMicro();
+
+    // Small loops are not worth waking up the helper threads
+    if ( numJobs == 1 || _numThreads == 1 )
+    {
+        for ( unsigned i = 0; i < numJobs; ++i )
+            job( i, 0 );
+
+        unsigned long long time = TimeUtils::timePassed( start, TimeUtils::sampleMicro() );
+        std::lock_guard<std::mutex> lock( _mutex );
+        _busyTimeMicro += time;
+        _loopTimeMicro += time * _numThreads;
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock( _mutex );
+        _job = &job;
+        _numJobs = numJobs;
+        _nextJob = 0;
+        _numBusyThreads = 1;
+        _exception = nullptr;
+        ++_generation;
+    }
+    _loopStarted.notify_all();
+
+    executeJobs( 0 );
+
+    std::exception_ptr exception;
+    {
+        std::unique_lock<std::mutex> lock( _mutex );
+        _loopFinished.wait( lock, [this] { return _numBusyThreads == 0; } );
+        _job = NULL;
+        exception = _exception;
+        _loopTimeMicro += TimeUtils::timePassed( start, TimeUtils::sampleMicro() ) * _numThreads;
+        _exception = nullptr;
+    }
+
+    if ( exception )
+        std::rethrow_exception( exception );
+}
+
+unsigned long long ThreadPool::getBusyTimeMicro() const
+{
+    std::lock_guard<std::mutex> lock( _mutex );
+    return _busyTimeMicro;
+}
+
+unsigned long long ThreadPool::getIdleTimeMicro() const
+{
+    std::lock_guard<std::mutex> lock( _mutex );
+    return _loopTimeMicro > _busyTimeMicro ? _loopTimeMicro - _busyTimeMicro : 0;
+}
+
+void ThreadPool::helperThreadLoop( unsigned threadIndex )
+{
+    unsigned long long lastGeneration = 0;
+    while ( true )
+    {
+        {
+            std::unique_lock<std::mutex> lock( _mutex );
+            _loopStarted.wait( lock, [&] { return _quit || _generation != lastGeneration; } );
+            if ( _quit )
+                return;
+
+            lastGeneration = _generation;
+
+            // The loop may already be over if the other threads were faster
+            if ( _job == NULL || _nextJob >= _numJobs )
+                continue;
+            ++_numBusyThreads;
+        }
+
+        executeJobs( threadIndex );
+    }
+}
+
+void ThreadPool::executeJobs( unsigned threadIndex )
+{
+    unsigned long long busyTime = 0;
+    while ( true )
+    {
+        unsigned jobIndex;
+        const Job *job;
+        {
+            std::lock_guard<std::mutex> lock( _mutex );
+            if ( _nextJob >= _numJobs )
+            {
+                _busyTimeMicro += busyTime;
+                if ( --_numBusyThreads == 0 )
+                    _loopFinished.notify_all();
+                return;
+            }
+            jobIndex = _nextJob++;
+            job = _job;
+        }
+
+        struct timespec start = TimeUtils::sampleMicro();
+        try
+        {
+            ( *job )( jobIndex, threadIndex );
+        }
+        catch ( ... )
+        {
+            std::lock_guard<std::mutex> lock( _mutex );
+            if ( !_exception )
+                _exception = std::current_exception();
+            // Skip the remaining jobs
+            _nextJob = _numJobs;
+        }
+        busyTime += TimeUtils::timePassed( start, TimeUtils::sampleMicro() );
+    }
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
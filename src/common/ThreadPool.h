@@ -0,0 +1,101 @@
+/*********************                                                        */
+/*! \file ThreadPool.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#ifndef __ThreadPool_h__
+#define __ThreadPool_h__
+
+#include "Vector.h"
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+/*
+  A fixed set of threads that repeatedly execute parallel loops. The
+  thread calling parallelFor() takes part in the loop as thread 0, so a
+  pool of n threads only spawns n - 1 helper threads, which sleep
+  between loops.
+*/
+class ThreadPool
+{
+public:
+    typedef std::function<void( unsigned jobIndex, unsigned threadIndex )> Job;
+
+    ThreadPool( unsigned numThreads );
+    ~ThreadPool();
+
+    unsigned getNumThreads() const;
+
+    /*
+      Run job( jobIndex, threadIndex ) for every jobIndex in [0, numJobs),
+      and return once all of them have finished. Each threadIndex is used
+      by at most one thread at a time, so it can select per-thread
+      working memory. If jobs throw, the first exception is rethrown
+      here. Loops must not be nested, and only one thread may start loops
+      on a given pool.
+    */
+    void parallelFor( unsigned numJobs, const Job &job );
+
+    /*
+      The total time the threads of the pool spent executing jobs, and
+      the time they spent waiting for the other threads during loops.
+      Both are summed over all threads.
+    */
+    unsigned long long getBusyTimeMicro() const;
+    unsigned long long getIdleTimeMicro() const;
+
+private:
+    unsigned _numThreads;
+    Vector<std::thread *> _threads;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _loopStarted;
+    std::condition_variable _loopFinished;
+
+    /*
+      The state of the current loop, protected by _mutex. Every loop has
+      a new generation number, which wakes up the helper threads.
+    */
+    const Job *_job;
+    unsigned _numJobs;
+    unsigned _nextJob;
+    unsigned _numBusyThreads;
+    unsigned long long _generation;
+    bool _quit;
+    std::exception_ptr _exception;
+
+    // Accumulated over all loops, protected by _mutex
+    unsigned long long _busyTimeMicro;
+    unsigned long long _loopTimeMicro;
+
+    void helperThreadLoop( unsigned threadIndex );
+
+    /*
+      Execute jobs of the current loop until there are none left
+    */
+    void executeJobs( unsigned threadIndex );
+};
+
+#endif // __ThreadPool_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -16,6 +16,7 @@
 
 #define CXXTEST_MOCK_TEST_SOURCE_FILE
 #include "T/stdlib.h"
+#include "T/sys/mman.h"
 #include "T/sys/stat.h"
 #include "T/unistd.h"
 
@@ -0,0 +1,153 @@
+/*********************                                                        */
+/*! \file Test_FloatUtils.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief [[ Add one-line brief description here ]]
+ **
+ ** [[ Add lengthier description here ]]
+ **/
+
+#include <cxxtest/TestSuite.h>
+
+#include "FloatUtils.h"
+#include "MatrixMultiplication.h"
+#include "SimdKernels.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+class SimdKernelsTestSuite : public CxxTest::TestSuite
+{
+public:
+    SimdKernels::InstructionSet _originalInstructionSet;
+
+    void setUp()
+    {
+        _originalInstructionSet = SimdKernels::getInstructionSet();
+    }
+
+    void tearDown()
+    {
+        SimdKernels::setInstructionSet( _originalInstructionSet );
+    }
+
+    void fillRandomly( double *values, unsigned n )
+    {
+        for ( unsigned i = 0; i < n; ++i )
+            values[i] = ( rand() % 2001 - 1000 ) / 100.0;
+    }
+
+    void test_instruction_set_cannot_exceed_supported()
+    {
+        SimdKernels::setInstructionSet( SimdKernels::AVX512 );
+        TS_ASSERT_EQUALS( SimdKernels::getInstructionSet(),
+                          SimdKernels::getSupportedInstructionSet() );
+
+        SimdKernels::setInstructionSet( SimdKernels::SCALAR );
+        TS_ASSERT_EQUALS( SimdKernels::getInstructionSet(), SimdKernels::SCALAR );
+    }
+
+    void test_kernels_agree_with_scalar()
+    {
+        srand( 1 );
+
+        // Cover the vector bodies and the scalar tails
+        for ( unsigned n = 0; n <= 37; ++n )
+        {
+            double x[37];
+            double y[37];
+            fillRandomly( x, n );
+            fillRandomly( y, n );
+
+            double expectedScaled[37];
+            double expectedSigned[37];
+            for ( unsigned i = 0; i < n; ++i )
+            {
+                expectedScaled[i] = y[i] + 1.5 * x[i];
+                expectedSigned[i] = y[i] + x[i] * ( x[i] >= 0 ? 2 : -3 );
+            }
+
+            for ( int set = SimdKernels::SCALAR; set <= SimdKernels::AVX512; ++set )
+            {
+                SimdKernels::setInstructionSet( (SimdKernels::InstructionSet)set );
+
+                double scaled[37];
+                double signedScaled[37];
+                for ( unsigned i = 0; i < n; ++i )
+                    scaled[i] = signedScaled[i] = y[i];
+
+                SimdKernels::addScaled( x, 1.5, scaled, n );
+                SimdKernels::addSignedScaled( x, 2, -3, signedScaled, n );
+
+                for ( unsigned i = 0; i < n; ++i )
+                {
+                    TS_ASSERT( FloatUtils::areEqual( scaled[i], expectedScaled[i] ) );
+                    TS_ASSERT( FloatUtils::areEqual( signedScaled[i], expectedSigned[i] ) );
+                }
+            }
+        }
+    }
+
+    void test_signed_scale_of_zero_is_positive()
+    {
+        double x[9] = { 0, -0.0, 1, -1, 0, 0, 0, 0, -2 };
+        double y[9] = { 0 };
+
+        SimdKernels::addSignedScaled( x, 1, 5, y, 9 );
+
+        TS_ASSERT_EQUALS( y[2], 1 );
+        TS_ASSERT_EQUALS( y[3], -5 );
+        TS_ASSERT_EQUALS( y[8], -10 );
+        TS_ASSERT_EQUALS( y[0], 0 );
+        TS_ASSERT_EQUALS( y[1], 0 );
+    }
+
+    void test_matrix_multiplication_with_each_instruction_set()
+    {
+        srand( 2 );
+
+        double matA[5 * 7];
+        double matB[7 * 11];
+        fillRandomly( matA, 5 * 7 );
+        fillRandomly( matB, 7 * 11 );
+        matA[3] = 0;
+
+        double expected[5 * 11];
+        for ( unsigned i = 0; i < 5; ++i )
+        {
+            for ( unsigned j = 0; j < 11; ++j )
+            {
+                expected[i * 11 + j] = 1;
+                for ( unsigned k = 0; k < 7; ++k )
+                    expected[i * 11 + j] += matA[i * 7 + k] * matB[k * 11 + j];
+            }
+        }
+
+        for ( int set = SimdKernels::SCALAR; set <= SimdKernels::AVX512; ++set )
+        {
+            SimdKernels::setInstructionSet( (SimdKernels::InstructionSet)set );
+
+            double matC[5 * 11];
+            std::fill_n( matC, 5 * 11, 1 );
+            matrixMultiplication( matA, matB, matC, 5, 7, 11 );
+
+            for ( unsigned i = 0; i < 5 * 11; ++i )
+                TS_ASSERT( FloatUtils::areEqual( matC[i], expected[i] ) );
+        }
+    }
+};
+
+//
+// Local Variables:
+// compile-command: "make -C ../../.. "
+// tags-file-name: "../../../TAGS"
+// c-basic-offset: 4
+// End:
+//
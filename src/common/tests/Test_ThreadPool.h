@@ -0,0 +1,115 @@
+/*********************                                                        */
+/*! \file Test_FloatUtils.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief [[ Add one-line brief description here ]]
+ **
+ ** [[ Add lengthier description here ]]
+ **/
+
+#include <cxxtest/TestSuite.h>
+
+#include "ThreadPool.h"
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+
+class ThreadPoolTestSuite : public CxxTest::TestSuite
+{
+public:
+    void test_parallel_for()
+    {
+        ThreadPool threadPool( 4 );
+        TS_ASSERT_EQUALS( threadPool.getNumThreads(), 4U );
+
+        // Loops can be run repeatedly on the same pool
+        for ( unsigned round = 0; round < 20; ++round )
+        {
+            unsigned numJobs = round * 3;
+            Vector<unsigned> executions( numJobs, 0 );
+            std::atomic_uint invalidThreadIndices( 0 );
+
+            threadPool.parallelFor( numJobs, [&]( unsigned jobIndex, unsigned threadIndex )
+                                    {
+                                        if ( threadIndex >= 4 )
+                                            ++invalidThreadIndices;
+                                        ++executions[jobIndex];
+                                    } );
+
+            TS_ASSERT_EQUALS( invalidThreadIndices.load(), 0U );
+            for ( unsigned i = 0; i < numJobs; ++i )
+                TS_ASSERT_EQUALS( executions[i], 1U );
+        }
+    }
+
+    void test_single_thread_runs_on_caller()
+    {
+        ThreadPool threadPool( 1 );
+        std::thread::id caller = std::this_thread::get_id();
+        bool onCaller = true;
+
+        threadPool.parallelFor( 5, [&]( unsigned, unsigned threadIndex )
+                                {
+                                    if ( threadIndex != 0 ||
+                                         std::this_thread::get_id() != caller )
+                                        onCaller = false;
+                                } );
+
+        TS_ASSERT( onCaller );
+    }
+
+    void test_exceptions_are_rethrown()
+    {
+        ThreadPool threadPool( 3 );
+
+        TS_ASSERT_THROWS( threadPool.parallelFor( 10, []( unsigned jobIndex, unsigned )
+                                                  {
+                                                      if ( jobIndex == 7 )
+                                                          throw std::runtime_error( "job" );
+                                                  } ),
+                          const std::runtime_error & );
+
+        // The pool is still usable afterwards
+        std::atomic_uint count( 0 );
+        threadPool.parallelFor( 10, [&]( unsigned, unsigned ) { ++count; } );
+        TS_ASSERT_EQUALS( count.load(), 10U );
+    }
+
+    void test_busy_and_idle_time()
+    {
+        ThreadPool threadPool( 2 );
+        TS_ASSERT_EQUALS( threadPool.getBusyTimeMicro(), 0U );
+        TS_ASSERT_EQUALS( threadPool.getIdleTimeMicro(), 0U );
+
+        threadPool.parallelFor( 4, []( unsigned, unsigned )
+                                {
+                                    std::this_thread::sleep_for( std::chrono::milliseconds( 5 ) );
+                                } );
+        TS_ASSERT_LESS_THAN_EQUALS( 20000U, threadPool.getBusyTimeMicro() );
+
+        // One thread waits while the other executes the only long job
+        unsigned long long idleTime = threadPool.getIdleTimeMicro();
+        threadPool.parallelFor( 2, []( unsigned jobIndex, unsigned )
+                                {
+                                    if ( jobIndex == 0 )
+                                        std::this_thread::sleep_for( std::chrono::milliseconds( 20 ) );
+                                } );
+        TS_ASSERT_LESS_THAN_EQUALS( idleTime + 10000, threadPool.getIdleTimeMicro() );
+    }
+};
+
+//
+// Local Variables:
+// compile-command: "make -C ../../.. "
+// tags-file-name: "../../../TAGS"
+// c-basic-offset: 4
+// End:
+//
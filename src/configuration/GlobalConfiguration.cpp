@@ -53,12 +53,15 @@ const double GlobalConfiguration::COST_FUNCTION_ERROR_THRESHOLD = 0.0000000001;
 const bool GlobalConfiguration::USE_HARRIS_RATIO_TEST = true;
 
 const double GlobalConfiguration::SYMBOLIC_TIGHTENING_ROUNDING_CONSTANT = 0.00000005;
+const double GlobalConfiguration::NLR_SPARSE_WEIGHTS_DENSITY_THRESHOLD = 0.1;
+const unsigned GlobalConfiguration::DEEPPOLY_MIN_NEURONS_PER_JOB = 16;
 
 const bool GlobalConfiguration::PREPROCESS_INPUT_QUERY = true;
 const bool GlobalConfiguration::PREPROCESSOR_ELIMINATE_VARIABLES = true;
 const bool GlobalConfiguration::PREPROCESSOR_PL_CONSTRAINTS_ADD_AUX_EQUATIONS = true;
 const double GlobalConfiguration::PREPROCESSOR_ALMOST_FIXED_THRESHOLD = 0.00001;
 const bool GlobalConfiguration::PREPROCESSOR_MERGE_CONSECUTIVE_WEIGHTED_SUMS = false;
+const unsigned GlobalConfiguration::PREPROCESSOR_EQUATIONS_PER_JOB = 256;
 
 const bool GlobalConfiguration::WARM_START = false;
 
@@ -68,18 +71,34 @@ const unsigned GlobalConfiguration::PSE_ITERATIONS_BEFORE_RESET = 1000;
 const double GlobalConfiguration::PSE_GAMMA_ERROR_THRESHOLD = 0.001;
 const double GlobalConfiguration::PSE_GAMMA_UPDATE_TOLERANCE = 0.000000001;
 
+const unsigned GlobalConfiguration::DUAL_SIMPLEX_MAX_STEPS_AFTER_SPLIT = 1000;
+const double GlobalConfiguration::DUAL_STEEPEST_EDGE_MIN_WEIGHT = 0.0001;
+
+const unsigned GlobalConfiguration::PARTIAL_PRICING_POOL_SIZE = 16;
+const unsigned GlobalConfiguration::PARTIAL_PRICING_NUM_SEGMENTS = 8;
+const unsigned GlobalConfiguration::PARTIAL_PRICING_PIVOTS_BEFORE_REFILL = 8;
+
 const double GlobalConfiguration::RELU_CONSTRAINT_COMPARISON_TOLERANCE = 0.00001;
 const double GlobalConfiguration::ABS_CONSTRAINT_COMPARISON_TOLERANCE = 0.00001;
 
 const bool GlobalConfiguration::ONLY_AUX_INITIAL_BASIS = false;
 
 const GlobalConfiguration::ExplicitBasisBoundTighteningType GlobalConfiguration::EXPLICIT_BASIS_BOUND_TIGHTENING_TYPE =
-    GlobalConfiguration::COMPUTE_INVERTED_BASIS_MATRIX;
+    GlobalConfiguration::COMPUTE_INVERTED_BASIS_ROWS_ON_DEMAND;
 const bool GlobalConfiguration::EXPLICIT_BOUND_TIGHTENING_UNTIL_SATURATION = false;
 
 const unsigned GlobalConfiguration::REFACTORIZATION_THRESHOLD = 100;
 const GlobalConfiguration::BasisFactorizationType GlobalConfiguration::BASIS_FACTORIZATION_TYPE =
     GlobalConfiguration::SPARSE_FORREST_TOMLIN_FACTORIZATION;
+const double GlobalConfiguration::HYPERSPARSE_TRANSFORMATION_DENSITY = 0.1;
+
+const double GlobalConfiguration::NATIVE_LP_FEASIBILITY_TOLERANCE = 0.000000001;
+const double GlobalConfiguration::NATIVE_LP_OPTIMALITY_TOLERANCE = 0.000000001;
+const unsigned GlobalConfiguration::NATIVE_LP_RECOMPUTE_ASSIGNMENT_FREQUENCY = 50;
+const unsigned GlobalConfiguration::NATIVE_LP_MAX_DEGENERATE_PIVOTS = 20;
+const double GlobalConfiguration::NATIVE_LP_BOUND_PERTURBATION = 0.000001;
+
+const unsigned GlobalConfiguration::ITERATIVE_PROPAGATION_MAX_PASSES = 10;
 
 const unsigned GlobalConfiguration::POLARITY_CANDIDATES_THRESHOLD = 5;
 
@@ -141,6 +160,8 @@ void GlobalConfiguration::print()
             PREPROCESSOR_PL_CONSTRAINTS_ADD_AUX_EQUATIONS ? "Yes" : "No" );
     printf( "  PSE_ITERATIONS_BEFORE_RESET: %u\n", PSE_ITERATIONS_BEFORE_RESET );
     printf( "  PSE_GAMMA_ERROR_THRESHOLD: %.15lf\n", PSE_GAMMA_ERROR_THRESHOLD );
+    printf( "  DUAL_SIMPLEX_MAX_STEPS_AFTER_SPLIT: %u\n", DUAL_SIMPLEX_MAX_STEPS_AFTER_SPLIT );
+    printf( "  PARTIAL_PRICING_POOL_SIZE: %u\n", PARTIAL_PRICING_POOL_SIZE );
     printf( "  RELU_CONSTRAINT_COMPARISON_TOLERANCE: %.15lf\n", RELU_CONSTRAINT_COMPARISON_TOLERANCE );
 
     String basisBoundTighteningType;
@@ -154,6 +175,10 @@ void GlobalConfiguration::print()
         basisBoundTighteningType = "Use implicit inverted basis matrix";
         break;
 
+    case COMPUTE_INVERTED_BASIS_ROWS_ON_DEMAND:
+        basisBoundTighteningType = "Compute inverted basis rows on demand";
+        break;
+
     default:
         basisBoundTighteningType = "Unknown";
         break;
@@ -177,6 +202,7 @@ void GlobalConfiguration::print()
         basisFactorizationType = "Unknown";
 
     printf( "  BASIS_FACTORIZATION_TYPE: %s\n", basisFactorizationType.ascii() );
+    printf( "  HYPERSPARSE_TRANSFORMATION_DENSITY: %.2lf\n", HYPERSPARSE_TRANSFORMATION_DENSITY );
     printf( "****************************\n" );
 }
 
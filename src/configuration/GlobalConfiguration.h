@@ -85,6 +85,10 @@ public:
     // weighted sum layer, to reduce the number of variables
     static const bool PREPROCESSOR_MERGE_CONSECUTIVE_WEIGHTED_SUMS;
 
+    // When the preprocessor runs on several threads, each job derives bounds
+    // from this many equations
+    static const unsigned PREPROCESSOR_EQUATIONS_PER_JOB;
+
     // Try to set the initial tableau assignment to an assignment that is legal with
     // respect to the input network.
     static const bool WARM_START;
@@ -142,6 +146,21 @@ public:
     // PSE's Gamma function's update tolerance
     static const double PSE_GAMMA_UPDATE_TOLERANCE;
 
+    // When dual simplex mode is on, the maximal number of dual simplex
+    // steps performed after a split before falling back to the primal
+    // simplex
+    static const unsigned DUAL_SIMPLEX_MAX_STEPS_AFTER_SPLIT;
+
+    // The minimal weight of a row in the dual steepest edge pricing rule
+    static const double DUAL_STEEPEST_EDGE_MIN_WEIGHT;
+
+    // Partial pricing: the maximal size of the candidate pool, the number
+    // of segments the non-basic variables are divided into when refilling
+    // the pool, and the number of pivots after which the pool is refilled
+    static const unsigned PARTIAL_PRICING_POOL_SIZE;
+    static const unsigned PARTIAL_PRICING_NUM_SEGMENTS;
+    static const unsigned PARTIAL_PRICING_PIVOTS_BEFORE_REFILL;
+
     // The tolerance for checking whether f = Relu( b )
     static const double RELU_CONSTRAINT_COMPARISON_TOLERANCE;
 
@@ -162,6 +181,9 @@ public:
         USE_IMPLICIT_INVERTED_BASIS_MATRIX = 1,
         // Disable explicit basis bound tightening
         DISABLE_EXPLICIT_BASIS_TIGHTENING = 2,
+        // Compute the rows of inv(B) * A one at a time, via BTRANs, without
+        // storing them
+        COMPUTE_INVERTED_BASIS_ROWS_ON_DEMAND = 3,
     };
 
     // When doing bound tightening using the explicit basis matrix, should the basis matrix be inverted?
@@ -177,6 +199,14 @@ public:
     // Symbolic tightening rounding constant
     static const double SYMBOLIC_TIGHTENING_ROUNDING_CONSTANT;
 
+    // Weight matrices of the network-level reasoner whose density (fraction of
+    // non-zero entries) is at most this threshold are propagated in sparse form
+    static const double NLR_SPARSE_WEIGHTS_DENSITY_THRESHOLD;
+
+    // When DeepPoly runs on several threads, each back-substitution job
+    // handles at least this many neurons of a layer
+    static const unsigned DEEPPOLY_MIN_NEURONS_PER_JOB;
+
     /*
       Constraint fixing heuristics
     */
@@ -205,6 +235,38 @@ public:
     };
     static const BasisFactorizationType BASIS_FACTORIZATION_TYPE;
 
+    // Forward and backward transformations with a right hand side whose
+    // non-zero entries are at most this fraction of its size, or that
+    // reach at most this fraction of the factorization's pivots, skip
+    // the pivots that cannot affect the result
+    static const double HYPERSPARSE_TRANSFORMATION_DENSITY;
+
+    /*
+      Native LP solver options
+    */
+
+    // A basic variable is considered within its bounds up to this tolerance
+    static const double NATIVE_LP_FEASIBILITY_TOLERANCE;
+
+    // A non-basic variable is only eligible for entering the basis if its
+    // reduced cost exceeds this tolerance
+    static const double NATIVE_LP_OPTIMALITY_TOLERANCE;
+
+    // The basic assignment is recomputed from scratch after this many pivots,
+    // to limit the accumulation of numerical errors
+    static const unsigned NATIVE_LP_RECOMPUTE_ASSIGNMENT_FREQUENCY;
+
+    // After this many consecutive degenerate pivots the bounds are perturbed,
+    // and if they already are, Bland's rule is used to avoid cycling
+    static const unsigned NATIVE_LP_MAX_DEGENERATE_PIVOTS;
+
+    // The relative amount by which the bounds are perturbed
+    static const double NATIVE_LP_BOUND_PERTURBATION;
+
+    // The maximal number of passes over the network made by iterative
+    // propagation
+    static const unsigned ITERATIVE_PROPAGATION_MAX_PASSES;
+
     /* In the polarity-based branching heuristics, only this many earliest nodes
        are considered to branch on.
     */
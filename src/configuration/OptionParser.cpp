@@ -51,6 +51,15 @@ void OptionParser::initialize()
         ( "dump-bounds",
           boost::program_options::bool_switch( &((*_boolOptions)[Options::DUMP_BOUNDS]) ),
           "Dump the bounds after preprocessing" )
+        ( "trail-backtracking",
+          boost::program_options::bool_switch( &((*_boolOptions)[Options::TRAIL_BACKTRACKING]) ),
+          "Backtrack by undoing bound changes instead of restoring stored tableau states" )
+        ( "dual-simplex",
+          boost::program_options::bool_switch( &((*_boolOptions)[Options::DUAL_SIMPLEX]) ),
+          "Restore feasibility after case splits using dual simplex steps" )
+        ( "partial-pricing",
+          boost::program_options::bool_switch( &((*_boolOptions)[Options::PARTIAL_PRICING]) ),
+          "Pick entering variables from a pool of candidates maintained by partial pricing" )
         ( "input",
           boost::program_options::value<std::string>( &((*_stringOptions)[Options::INPUT_FILE_PATH]) ),
           "Neural netowrk file" )
@@ -75,6 +84,12 @@ void OptionParser::initialize()
         ( "tightening-strategy",
           boost::program_options::value<std::string>( &((*_stringOptions)[Options::SYMBOLIC_BOUND_TIGHTENING_TYPE]) ),
           "type of bound tightening technique to use: sbt/deeppoly/none. default: deeppoly" )
+        ( "dual-ratio-test",
+          boost::program_options::value<std::string>( &((*_stringOptions)[Options::DUAL_RATIO_TEST_TYPE]) ),
+          "type of ratio test for dual simplex steps, used only with --dual-simplex: textbook/bound-flipping. default: bound-flipping" )
+        ( "primal-ratio-test",
+          boost::program_options::value<std::string>( &((*_stringOptions)[Options::PRIMAL_RATIO_TEST_TYPE]) ),
+          "type of ratio test for primal simplex steps: textbook/harris/long-step. default: harris" )
         ( "initial-divides",
           boost::program_options::value<int>( &((*_intOptions)[Options::NUM_INITIAL_DIVIDES]) ),
           "(DNC) Number of times to initially bisect the input region" )
@@ -94,6 +109,9 @@ void OptionParser::initialize()
         ( "split-threshold",
           boost::program_options::value<int>( &((*_intOptions)[Options::CONSTRAINT_VIOLATION_THRESHOLD]) ),
           "Max number of tries to repair a relu before splitting" )
+        ( "tightening-threads",
+          boost::program_options::value<int>( &((*_intOptions)[Options::NUM_TIGHTENING_THREADS]) ),
+          "Number of threads used for DeepPoly bound tightening within a layer. default: 1" )
         ( "timeout-factor",
           boost::program_options::value<float>( &((*_floatOptions)[Options::TIMEOUT_FACTOR]) ),
           "(DNC) The timeout factor" )
@@ -106,16 +124,19 @@ void OptionParser::initialize()
          ( "preprocessor-bound-tolerance",
           boost::program_options::value<float>( &((*_floatOptions)[Options::PREPROCESSOR_BOUND_TOLERANCE]) ),
           "epsilon for preprocessor bound tightening comparisons" )
-#ifdef ENABLE_GUROBI
-        ( "milp",
-          boost::program_options::bool_switch( &((*_boolOptions)[Options::SOLVE_WITH_MILP]) ),
-          "Use a MILP solver to solve the input query" )
         ( "milp-tightening",
           boost::program_options::value<std::string>( &((*_stringOptions)[Options::MILP_SOLVER_BOUND_TIGHTENING_TYPE ]) ),
-          "The MILP solver bound tightening type: lp/lp-inc/milp/milp-inc/iter-prop/none. default: lp" )
+          "The MILP solver bound tightening type: lp/lp-inc/milp/milp-inc/iter-prop/none. default: lp with Gurobi, none otherwise" )
         ( "milp-timeout",
           boost::program_options::value<float>( &((*_floatOptions)[Options::MILP_SOLVER_TIMEOUT]) ),
           "Per-ReLU timeout for iterative propagation" )
+        ( "lp-solver",
+          boost::program_options::value<std::string>( &((*_stringOptions)[Options::LP_SOLVER]) ),
+          "The LP solver for LP/MILP bound tightening: native/gurobi. default: gurobi if available, native otherwise" )
+#ifdef ENABLE_GUROBI
+        ( "milp",
+          boost::program_options::bool_switch( &((*_boolOptions)[Options::SOLVE_WITH_MILP]) ),
+          "Use a MILP solver to solve the input query" )
 #endif // ENABLE_GUROBI
 
         ;
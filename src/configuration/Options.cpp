@@ -47,6 +47,9 @@ void Options::initializeDefaultValues()
     _boolOptions[RESTORE_TREE_STATES] = false;
     _boolOptions[DUMP_BOUNDS] = false;
     _boolOptions[SOLVE_WITH_MILP] = false;
+    _boolOptions[TRAIL_BACKTRACKING] = false;
+    _boolOptions[DUAL_SIMPLEX] = false;
+    _boolOptions[PARTIAL_PRICING] = false;
 
     /*
       Int options
@@ -58,6 +61,7 @@ void Options::initializeDefaultValues()
     _intOptions[VERBOSITY] = 2;
     _intOptions[TIMEOUT] = 0;
     _intOptions[CONSTRAINT_VIOLATION_THRESHOLD] = 20;
+    _intOptions[NUM_TIGHTENING_THREADS] = 1;
 
     /*
       Float options
@@ -78,7 +82,10 @@ void Options::initializeDefaultValues()
     _stringOptions[SNC_SPLITTING_STRATEGY] = "";
     _stringOptions[SYMBOLIC_BOUND_TIGHTENING_TYPE] = "";
     _stringOptions[MILP_SOLVER_BOUND_TIGHTENING_TYPE] = "";
+    _stringOptions[DUAL_RATIO_TEST_TYPE] = "";
+    _stringOptions[PRIMAL_RATIO_TEST_TYPE] = "";
     _stringOptions[QUERY_DUMP_FILE] = "";
+    _stringOptions[LP_SOLVER] = "";
 }
 
 void Options::parseOptions( int argc, char **argv )
@@ -172,30 +179,61 @@ SymbolicBoundTighteningType Options::getSymbolicBoundTighteningType() const
         return SymbolicBoundTighteningType::DEEP_POLY;
 }
 
+DualRatioTestType Options::getDualRatioTestType() const
+{
+    String strategyString = String( _stringOptions.get( Options::DUAL_RATIO_TEST_TYPE ) );
+    if ( strategyString == "textbook" )
+        return DualRatioTestType::TEXTBOOK;
+    else if ( strategyString == "bound-flipping" )
+        return DualRatioTestType::BOUND_FLIPPING;
+    else
+        return DualRatioTestType::BOUND_FLIPPING;
+}
+
+PrimalRatioTestType Options::getPrimalRatioTestType() const
+{
+    String strategyString = String( _stringOptions.get( Options::PRIMAL_RATIO_TEST_TYPE ) );
+    if ( strategyString == "textbook" )
+        return PrimalRatioTestType::TEXTBOOK;
+    else if ( strategyString == "harris" )
+        return PrimalRatioTestType::HARRIS;
+    else if ( strategyString == "long-step" )
+        return PrimalRatioTestType::LONG_STEP;
+    else
+        return GlobalConfiguration::USE_HARRIS_RATIO_TEST ?
+            PrimalRatioTestType::HARRIS : PrimalRatioTestType::TEXTBOOK;
+}
+
 MILPSolverBoundTighteningType Options::getMILPSolverBoundTighteningType() const
 {
+    String strategyString = String( _stringOptions.get( Options::MILP_SOLVER_BOUND_TIGHTENING_TYPE ) );
+    if ( strategyString == "lp" )
+        return MILPSolverBoundTighteningType::LP_RELAXATION;
+    else if ( strategyString == "lp-inc" )
+        return MILPSolverBoundTighteningType::LP_RELAXATION_INCREMENTAL;
+    else if ( strategyString == "milp" )
+        return MILPSolverBoundTighteningType::MILP_ENCODING;
+    else if ( strategyString == "milp-inc" )
+        return MILPSolverBoundTighteningType::MILP_ENCODING_INCREMENTAL;
+    else if ( strategyString == "iter-prop" )
+        return MILPSolverBoundTighteningType::ITERATIVE_PROPAGATION;
+    else if ( strategyString == "none" )
+        return MILPSolverBoundTighteningType::NONE;
+
+    // LP-based tightening is on by default only if Gurobi is available
     if ( gurobiEnabled() )
-    {
-        String strategyString = String( _stringOptions.get( Options::MILP_SOLVER_BOUND_TIGHTENING_TYPE ) );
-        if ( strategyString == "lp" )
-            return MILPSolverBoundTighteningType::LP_RELAXATION;
-        else if ( strategyString == "lp-inc" )
-            return MILPSolverBoundTighteningType::LP_RELAXATION_INCREMENTAL;
-        else if ( strategyString == "milp" )
-            return MILPSolverBoundTighteningType::MILP_ENCODING;
-        else if ( strategyString == "milp-inc" )
-            return MILPSolverBoundTighteningType::MILP_ENCODING_INCREMENTAL;
-        else if ( strategyString == "iter-prop" )
-            return MILPSolverBoundTighteningType::ITERATIVE_PROPAGATION;
-        else if ( strategyString == "none" )
-            return MILPSolverBoundTighteningType::NONE;
-        else
-            return MILPSolverBoundTighteningType::LP_RELAXATION;
-    }
+        return MILPSolverBoundTighteningType::LP_RELAXATION;
     else
-    {
         return MILPSolverBoundTighteningType::NONE;
-    }
+}
+
+LPSolverType Options::getLPSolverType() const
+{
+    String solverString = String( _stringOptions.get( Options::LP_SOLVER ) );
+    if ( solverString == "native" || !gurobiEnabled() )
+        return LPSolverType::NATIVE;
+    else
+        return LPSolverType::GUROBI;
 }
 
 //
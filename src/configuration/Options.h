@@ -17,10 +17,13 @@
 #define __Options_h__
 
 #include "DivideStrategy.h"
+#include "DualRatioTestType.h"
+#include "LPSolverType.h"
 #include "MString.h"
 #include "Map.h"
 #include "MILPSolverBoundTighteningType.h"
 #include "OptionParser.h"
+#include "PrimalRatioTestType.h"
 #include "SnCDivideStrategy.h"
 #include "SymbolicBoundTighteningType.h"
 
@@ -52,7 +55,17 @@ public:
         VERSION,
 
         // Solve the input query with a MILP solver
-        SOLVE_WITH_MILP
+        SOLVE_WITH_MILP,
+
+        // Backtrack by undoing recorded bound changes, instead of
+        // restoring complete copies of the tableau
+        TRAIL_BACKTRACKING,
+
+        // Restore feasibility after splits using the dual simplex method
+        DUAL_SIMPLEX,
+
+        // Pick entering variables with partial pricing
+        PARTIAL_PRICING,
     };
 
     enum IntOptions {
@@ -69,6 +82,9 @@ public:
         TIMEOUT,
 
         CONSTRAINT_VIOLATION_THRESHOLD,
+
+        // Number of threads the engine uses for bound tightening
+        NUM_TIGHTENING_THREADS,
     };
 
     enum FloatOptions{
@@ -91,7 +107,12 @@ public:
         SNC_SPLITTING_STRATEGY,
         SYMBOLIC_BOUND_TIGHTENING_TYPE,
         MILP_SOLVER_BOUND_TIGHTENING_TYPE,
+        DUAL_RATIO_TEST_TYPE,
+        PRIMAL_RATIO_TEST_TYPE,
         QUERY_DUMP_FILE,
+
+        // The LP solver used for LP/MILP-based bound tightening
+        LP_SOLVER,
     };
 
     /*
@@ -120,6 +141,9 @@ public:
     SnCDivideStrategy getSnCDivideStrategy() const;
     SymbolicBoundTighteningType getSymbolicBoundTighteningType() const;
     MILPSolverBoundTighteningType getMILPSolverBoundTighteningType() const;
+    DualRatioTestType getDualRatioTestType() const;
+    PrimalRatioTestType getPrimalRatioTestType() const;
+    LPSolverType getLPSolverType() const;
 
     /*
       Retrieve the value of the various options, by type
@@ -110,7 +110,7 @@ void AbsoluteValueConstraint::unregisterAsWatcher( ITableau *tableau )
 
 void AbsoluteValueConstraint::notifyVariableValue( unsigned variable, double value )
 {
-    _assignment[variable] = value;
+    setAssignment( variable, value );
 }
 
 void AbsoluteValueConstraint::notifyLowerBound( unsigned variable, double bound )
@@ -118,11 +118,11 @@ void AbsoluteValueConstraint::notifyLowerBound( unsigned variable, double bound
     if ( _statistics )
         _statistics->incNumBoundNotificationsPlConstraints();
 
-    if ( _lowerBounds.exists( variable ) &&
-         !FloatUtils::gt( bound, _lowerBounds[variable] ) )
+    if ( existsLowerBound( variable ) &&
+         !FloatUtils::gt( bound, getLowerBound( variable ) ) )
         return;
 
-    _lowerBounds[variable] = bound;
+    setLowerBound( variable, bound );
 
     // Check whether the phase has become fixed
     fixPhaseIfNeeded();
@@ -134,7 +134,7 @@ void AbsoluteValueConstraint::notifyLowerBound( unsigned variable, double bound
         {
             if ( bound < 0 )
             {
-                double fUpperBound = FloatUtils::max( -bound, _upperBounds[_b] );
+                double fUpperBound = FloatUtils::max( -bound, getUpperBound( _b ) );
                 _constraintBoundTightener->registerTighterUpperBound( _f, fUpperBound );
 
                 if ( _auxVarsInUse )
@@ -169,10 +169,10 @@ void AbsoluteValueConstraint::notifyUpperBound( unsigned variable, double bound
     if ( _statistics )
         _statistics->incNumBoundNotificationsPlConstraints();
 
-    if ( _upperBounds.exists( variable ) && !FloatUtils::lt( bound, _upperBounds[variable] ) )
+    if ( existsUpperBound( variable ) && !FloatUtils::lt( bound, getUpperBound( variable ) ) )
         return;
 
-    _upperBounds[variable] = bound;
+    setUpperBound( variable, bound );
 
     // Check whether the phase has become fixed
     fixPhaseIfNeeded();
@@ -184,7 +184,7 @@ void AbsoluteValueConstraint::notifyUpperBound( unsigned variable, double bound
         {
             if ( bound > 0 )
             {
-                double fUpperBound = FloatUtils::max( bound, -_lowerBounds[_b] );
+                double fUpperBound = FloatUtils::max( bound, -getLowerBound( _b ) );
                 _constraintBoundTightener->registerTighterUpperBound( _f, fUpperBound );
 
                 if ( _auxVarsInUse )
@@ -201,24 +201,24 @@ void AbsoluteValueConstraint::notifyUpperBound( unsigned variable, double bound
         else if ( variable == _f )
         {
             // F's upper bound can restrict both bounds of B
-            if ( bound < _upperBounds[_b] )
+            if ( bound < getUpperBound( _b ) )
                 _constraintBoundTightener->registerTighterUpperBound( _b, bound );
 
-            if ( -bound > _lowerBounds[_b] )
+            if ( -bound > getLowerBound( _b ) )
                 _constraintBoundTightener->registerTighterLowerBound( _b, -bound );
 
             if ( _auxVarsInUse )
             {
-                if ( _lowerBounds.exists( _b ) )
+                if ( existsLowerBound( _b ) )
                 {
                     _constraintBoundTightener->
-                        registerTighterUpperBound( _posAux, bound - _lowerBounds[_b] );
+                        registerTighterUpperBound( _posAux, bound - getLowerBound( _b ) );
                 }
 
-                if ( _upperBounds.exists( _b ) )
+                if ( existsUpperBound( _b ) )
                 {
                     _constraintBoundTightener->
-                        registerTighterUpperBound( _negAux, bound + _upperBounds[_b] );
+                        registerTighterUpperBound( _negAux, bound + getUpperBound( _b ) );
                 }
             }
         }
@@ -226,30 +226,30 @@ void AbsoluteValueConstraint::notifyUpperBound( unsigned variable, double bound
         {
             if ( variable == _posAux )
             {
-                if ( _upperBounds.exists( _b ) )
+                if ( existsUpperBound( _b ) )
                 {
                     _constraintBoundTightener->
-                        registerTighterUpperBound( _f, _upperBounds[_b] + bound );
+                        registerTighterUpperBound( _f, getUpperBound( _b ) + bound );
                 }
 
-                if ( _lowerBounds.exists( _f ) )
+                if ( existsLowerBound( _f ) )
                 {
                     _constraintBoundTightener->
-                        registerTighterLowerBound( _b, _lowerBounds[_f] - bound );
+                        registerTighterLowerBound( _b, getLowerBound( _f ) - bound );
                 }
             }
             else if ( variable == _negAux )
             {
-                if ( _lowerBounds.exists( _b ) )
+                if ( existsLowerBound( _b ) )
                 {
                     _constraintBoundTightener->
-                        registerTighterUpperBound( _f, bound - _lowerBounds[_b] );
+                        registerTighterUpperBound( _f, bound - getLowerBound( _b ) );
                 }
 
-                if ( _lowerBounds.exists( _f ) )
+                if ( existsLowerBound( _f ) )
                 {
                     _constraintBoundTightener->
-                        registerTighterUpperBound( _b, bound - _lowerBounds[_f] );
+                        registerTighterUpperBound( _b, bound - getLowerBound( _f ) );
                 }
             }
         }
@@ -271,11 +271,11 @@ List<unsigned> AbsoluteValueConstraint::getParticipatingVariables() const
 
 bool AbsoluteValueConstraint::satisfied() const
 {
-    if ( !( _assignment.exists( _b ) && _assignment.exists( _f ) ) )
+    if ( !( existsAssignment( _b ) && existsAssignment( _f ) ) )
         throw MarabouError( MarabouError::PARTICIPATING_VARIABLES_ABSENT );
 
-    double bValue = _assignment.get( _b );
-    double fValue = _assignment.get( _f );
+    double bValue = getAssignment( _b );
+    double fValue = getAssignment( _f );
 
     // Possible violations:
     //   1. f is negative
@@ -292,11 +292,11 @@ bool AbsoluteValueConstraint::satisfied() const
 List<PiecewiseLinearConstraint::Fix> AbsoluteValueConstraint::getPossibleFixes() const
 {
     ASSERT( !satisfied() );
-    ASSERT( _assignment.exists( _b ) );
-    ASSERT( _assignment.exists( _f ) );
+    ASSERT( existsAssignment( _b ) );
+    ASSERT( existsAssignment( _f ) );
 
-    double bValue = _assignment.get( _b );
-    double fValue = _assignment.get( _f );
+    double bValue = getAssignment( _b );
+    double fValue = getAssignment( _f );
 
     ASSERT( !FloatUtils::isNegative( fValue ) );
 
@@ -320,7 +320,7 @@ List<PiecewiseLinearConstraint::Fix> AbsoluteValueConstraint::getSmartFixes( ITa
 
 List<PiecewiseLinearCaseSplit> AbsoluteValueConstraint::getCaseSplits() const
 {
-    ASSERT( _phaseStatus == PhaseStatus::PHASE_NOT_FIXED );
+    ASSERT( getPhaseStatus() == PhaseStatus::PHASE_NOT_FIXED );
 
     List<PiecewiseLinearCaseSplit> splits;
     splits.append( getNegativeSplit() );
@@ -375,14 +375,14 @@ PiecewiseLinearCaseSplit AbsoluteValueConstraint::getPositiveSplit() const
 
 bool AbsoluteValueConstraint::phaseFixed() const
 {
-    return _phaseStatus != PhaseStatus::PHASE_NOT_FIXED;
+    return getPhaseStatus() != PhaseStatus::PHASE_NOT_FIXED;
 }
 
 PiecewiseLinearCaseSplit AbsoluteValueConstraint::getValidCaseSplit() const
 {
-    ASSERT( _phaseStatus != PHASE_NOT_FIXED );
+    ASSERT( getPhaseStatus() != PHASE_NOT_FIXED );
 
-    if ( _phaseStatus == ABS_PHASE_POSITIVE )
+    if ( getPhaseStatus() == ABS_PHASE_POSITIVE )
         return getPositiveSplit();
 
     return getNegativeSplit();
@@ -403,29 +403,29 @@ void AbsoluteValueConstraint::dump( String &output ) const
 {
     output = Stringf( "AbsoluteValueCosntraint: x%u = Abs( x%u ). Active? %s. PhaseStatus = %u (%s).\n",
                       _f, _b,
-                      _constraintActive ? "Yes" : "No",
-                      _phaseStatus, phaseToString( _phaseStatus ).ascii()
+                      isActive() ? "Yes" : "No",
+                      getPhaseStatus(), phaseToString( getPhaseStatus() ).ascii()
                       );
 
     output += Stringf( "b in [%s, %s], ",
-                       _lowerBounds.exists( _b ) ? Stringf( "%lf", _lowerBounds[_b] ).ascii() : "-inf",
-                       _upperBounds.exists( _b ) ? Stringf( "%lf", _upperBounds[_b] ).ascii() : "inf" );
+                       existsLowerBound( _b ) ? Stringf( "%lf", getLowerBound( _b ) ).ascii() : "-inf",
+                       existsUpperBound( _b ) ? Stringf( "%lf", getUpperBound( _b ) ).ascii() : "inf" );
 
     output += Stringf( "f in [%s, %s]",
-                       _lowerBounds.exists( _f ) ? Stringf( "%lf", _lowerBounds[_f] ).ascii() : "-inf",
-                       _upperBounds.exists( _f ) ? Stringf( "%lf", _upperBounds[_f] ).ascii() : "inf" );
+                       existsLowerBound( _f ) ? Stringf( "%lf", getLowerBound( _f ) ).ascii() : "-inf",
+                       existsUpperBound( _f ) ? Stringf( "%lf", getUpperBound( _f ) ).ascii() : "inf" );
 
     if ( _auxVarsInUse )
     {
         output += Stringf( ". PosAux: %u. Range: [%s, %s]",
                            _posAux,
-                           _lowerBounds.exists( _posAux ) ? Stringf( "%lf", _lowerBounds[_posAux] ).ascii() : "-inf",
-                           _upperBounds.exists( _posAux ) ? Stringf( "%lf", _upperBounds[_posAux] ).ascii() : "inf" );
+                           existsLowerBound( _posAux ) ? Stringf( "%lf", getLowerBound( _posAux ) ).ascii() : "-inf",
+                           existsUpperBound( _posAux ) ? Stringf( "%lf", getUpperBound( _posAux ) ).ascii() : "inf" );
 
         output += Stringf( ". NegAux: %u. Range: [%s, %s]",
                            _negAux,
-                           _lowerBounds.exists( _negAux ) ? Stringf( "%lf", _lowerBounds[_negAux] ).ascii() : "-inf",
-                           _upperBounds.exists( _negAux ) ? Stringf( "%lf", _upperBounds[_negAux] ).ascii() : "inf" );
+                           existsLowerBound( _negAux ) ? Stringf( "%lf", getLowerBound( _negAux ) ).ascii() : "-inf",
+                           existsUpperBound( _negAux ) ? Stringf( "%lf", getUpperBound( _negAux ) ).ascii() : "inf" );
     }
 }
 
@@ -434,28 +434,12 @@ void AbsoluteValueConstraint::updateVariableIndex( unsigned oldIndex, unsigned n
     ASSERT( oldIndex == _b || oldIndex == _f ||
             ( _auxVarsInUse && ( oldIndex == _posAux || oldIndex == _negAux ) ) );
 
-    ASSERT( !_assignment.exists( newIndex ) &&
-            !_lowerBounds.exists( newIndex ) &&
-            !_upperBounds.exists( newIndex ) &&
+    ASSERT( !existsAssignment( newIndex ) &&
+            !existsLowerBound( newIndex ) &&
+            !existsUpperBound( newIndex ) &&
             newIndex != _b && newIndex != _f && ( !_auxVarsInUse || ( newIndex != _posAux && newIndex != _negAux ) ) );
 
-    if ( _assignment.exists( oldIndex ) )
-    {
-        _assignment[newIndex] = _assignment.get( oldIndex );
-        _assignment.erase( oldIndex );
-    }
-
-    if ( _lowerBounds.exists( oldIndex ) )
-    {
-        _lowerBounds[newIndex] = _lowerBounds.get( oldIndex );
-        _lowerBounds.erase( oldIndex );
-    }
-
-    if ( _upperBounds.exists( oldIndex ) )
-    {
-        _upperBounds[newIndex] = _upperBounds.get( oldIndex );
-        _upperBounds.erase( oldIndex );
-    }
+    renameVariableValues( oldIndex, newIndex );
 
     if ( oldIndex == _b )
         _b = newIndex;
@@ -474,15 +458,15 @@ bool AbsoluteValueConstraint::constraintObsolete() const
 
 void AbsoluteValueConstraint::getEntailedTightenings( List<Tightening> &tightenings ) const
 {
-    ASSERT( _lowerBounds.exists( _b ) && _lowerBounds.exists( _f ) &&
-            _upperBounds.exists( _b ) && _upperBounds.exists( _f ) );
+    ASSERT( existsLowerBound( _b ) && existsLowerBound( _f ) &&
+            existsUpperBound( _b ) && existsUpperBound( _f ) );
 
     // Upper bounds
-    double bUpperBound = _upperBounds[_b];
-    double fUpperBound = _upperBounds[_f];
+    double bUpperBound = getUpperBound( _b );
+    double fUpperBound = getUpperBound( _f );
     // Lower bounds
-    double bLowerBound = _lowerBounds[_b];
-    double fLowerBound = _lowerBounds[_f];
+    double bLowerBound = getLowerBound( _b );
+    double fLowerBound = getLowerBound( _f );
 
     // F's lower bound should always be non-negative
     if ( fLowerBound < 0 )
@@ -622,10 +606,10 @@ void AbsoluteValueConstraint::addAuxiliaryEquations( InputQuery &inputQuery )
     inputQuery.setLowerBound( _posAux, 0 );
     inputQuery.setLowerBound( _negAux, 0 );
 
-    _lowerBounds[_posAux] = 0;
-    _lowerBounds[_negAux] = 0;
-    _upperBounds[_posAux] = FloatUtils::infinity();
-    _upperBounds[_negAux] = FloatUtils::infinity();
+    setLowerBound( _posAux, 0 );
+    setLowerBound( _negAux, 0 );
+    setUpperBound( _posAux, FloatUtils::infinity() );
+    setUpperBound( _negAux, FloatUtils::infinity() );
 
     // Mark that the aux vars are in use
     _auxVarsInUse = true;
@@ -642,25 +626,25 @@ String AbsoluteValueConstraint::serializeToString() const
 void AbsoluteValueConstraint::fixPhaseIfNeeded()
 {
     // Option 1: b's range is strictly positive
-    if ( _lowerBounds.exists( _b ) && _lowerBounds[_b] >= 0 )
+    if ( existsLowerBound( _b ) && getLowerBound( _b ) >= 0 )
     {
         setPhaseStatus( ABS_PHASE_POSITIVE );
         return;
     }
 
     // Option 2: b's range is strictly negative:
-    if ( _upperBounds.exists( _b ) && _upperBounds[_b] <= 0 )
+    if ( existsUpperBound( _b ) && getUpperBound( _b ) <= 0 )
     {
         setPhaseStatus( ABS_PHASE_NEGATIVE );
         return;
     }
 
-    if ( !_lowerBounds.exists( _f ) )
+    if ( !existsLowerBound( _f ) )
         return;
 
     // Option 3: f's range is strictly disjoint from b's positive
     // range
-    if ( _upperBounds.exists( _b ) && _lowerBounds[_f] > _upperBounds[_b] )
+    if ( existsUpperBound( _b ) && getLowerBound( _f ) > getUpperBound( _b ) )
     {
         setPhaseStatus( ABS_PHASE_NEGATIVE );
         return;
@@ -668,7 +652,7 @@ void AbsoluteValueConstraint::fixPhaseIfNeeded()
 
     // Option 4: f's range is strictly disjoint from b's negative
     // range, in absolute value
-    if ( _lowerBounds.exists( _b ) && _lowerBounds[_f] > -_lowerBounds[_b] )
+    if ( existsLowerBound( _b ) && getLowerBound( _f ) > -getLowerBound( _b ) )
     {
         setPhaseStatus( ABS_PHASE_POSITIVE );
         return;
@@ -677,28 +661,28 @@ void AbsoluteValueConstraint::fixPhaseIfNeeded()
     if ( _auxVarsInUse )
     {
         // Option 5: posAux has become zero, phase is positive
-        if ( _upperBounds.exists( _posAux ) && FloatUtils::isZero( _upperBounds[_posAux] ) )
+        if ( existsUpperBound( _posAux ) && FloatUtils::isZero( getUpperBound( _posAux ) ) )
         {
             setPhaseStatus( ABS_PHASE_POSITIVE );
             return;
         }
 
         // Option 6: posAux can never be zero, phase is negative
-        if ( _lowerBounds.exists( _posAux ) && FloatUtils::isPositive( _lowerBounds[_posAux] ) )
+        if ( existsLowerBound( _posAux ) && FloatUtils::isPositive( getLowerBound( _posAux ) ) )
         {
             setPhaseStatus( ABS_PHASE_NEGATIVE );
             return;
         }
 
         // Option 7: negAux has become zero, phase is negative
-        if ( _upperBounds.exists( _negAux ) && FloatUtils::isZero( _upperBounds[_negAux] ) )
+        if ( existsUpperBound( _negAux ) && FloatUtils::isZero( getUpperBound( _negAux ) ) )
         {
             setPhaseStatus( ABS_PHASE_NEGATIVE );
             return;
         }
 
         // Option 8: negAux can never be zero, phase is positive
-        if ( _lowerBounds.exists( _negAux ) && FloatUtils::isPositive( _lowerBounds[_negAux] ) )
+        if ( existsLowerBound( _negAux ) && FloatUtils::isPositive( getLowerBound( _negAux ) ) )
         {
             setPhaseStatus( ABS_PHASE_POSITIVE );
             return;
@@ -18,8 +18,13 @@
 #include "MarabouError.h"
 #include "Statistics.h"
 
+#include <algorithm>
+
 ConstraintBoundTightener::ConstraintBoundTightener( const ITableau &tableau )
     : _tableau( tableau )
+    , _n( 0 )
+    , _m( 0 )
+    , _nCapacity( 0 )
     , _lowerBounds( NULL )
     , _upperBounds( NULL )
     , _tightenedLower( NULL )
@@ -30,24 +35,34 @@ ConstraintBoundTightener::ConstraintBoundTightener( const ITableau &tableau )
 
 void ConstraintBoundTightener::setDimensions()
 {
-    freeMemoryIfNeeded();
-
     _n = _tableau.getN();
     _m = _tableau.getM();
 
-    _lowerBounds = new double[_n];
+    /*
+      Reallocate only when the tableau has outgrown the arrays
+    */
+    if ( _lowerBounds && _n <= _nCapacity )
+    {
+        resetBounds();
+        return;
+    }
+
+    freeMemoryIfNeeded();
+    _nCapacity = std::max( _n, 2 * _nCapacity );
+
+    _lowerBounds = new double[_nCapacity];
     if ( !_lowerBounds )
         throw MarabouError( MarabouError::ALLOCATION_FAILED, "ConstraintBoundTightener::lowerBounds" );
 
-    _upperBounds = new double[_n];
+    _upperBounds = new double[_nCapacity];
     if ( !_upperBounds )
         throw MarabouError( MarabouError::ALLOCATION_FAILED, "ConstraintBoundTightener::upperBounds" );
 
-    _tightenedLower = new bool[_n];
+    _tightenedLower = new bool[_nCapacity];
     if ( !_tightenedLower )
         throw MarabouError( MarabouError::ALLOCATION_FAILED, "ConstraintBoundTightener::tightenedLower" );
 
-    _tightenedUpper = new bool[_n];
+    _tightenedUpper = new bool[_nCapacity];
     if ( !_tightenedUpper )
         throw MarabouError( MarabouError::ALLOCATION_FAILED, "ConstraintBoundTightener::tightenedUpper" );
 
@@ -68,6 +68,11 @@ private:
     unsigned _n;
     unsigned _m;
 
+    /*
+      The number of variables for which the arrays are allocated.
+    */
+    unsigned _nCapacity;
+
     /*
       Work space for the tightener to derive tighter bounds. These
       represent the tightest bounds currently known, either taken
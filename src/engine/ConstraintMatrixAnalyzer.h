@@ -35,6 +35,7 @@ public:
     */
     void analyze( const double *matrix, unsigned m, unsigned n );
     void analyze( const SparseUnsortedList **matrix, unsigned m, unsigned n );
+    void analyze( const SparseUnsortedArrays &matrix, unsigned m, unsigned n );
     List<unsigned> getIndependentColumns() const;
     Set<unsigned> getRedundantRows() const;
 
@@ -0,0 +1,283 @@
+/*********************                                                        */
+/*! \file ConstraintStateStore.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "CommonError.h"
+#include "ConstraintStateStore.h"
+#include "Debug.h"
+#include "FloatUtils.h"
+
+ConstraintStateStore::ConstraintStateStore()
+    : _numAbandonedSlots( 0 )
+{
+}
+
+unsigned ConstraintStateStore::addConstraint()
+{
+    _active.push_back( true );
+    _phaseStatus.push_back( PHASE_NOT_FIXED );
+    _direction.push_back( PHASE_NOT_FIXED );
+    _score.push_back( FloatUtils::negativeInfinity() );
+    _firstSlot.push_back( _slotVariable.size() );
+    _numSlots.push_back( 0 );
+    _slotCapacity.push_back( 0 );
+
+    return _active.size() - 1;
+}
+
+unsigned ConstraintStateStore::addConstraint( const ConstraintStateStore &other, unsigned otherIndex )
+{
+    unsigned index = addConstraint();
+    copyConstraint( index, other, otherIndex );
+    return index;
+}
+
+void ConstraintStateStore::copyConstraint( unsigned index,
+                                           const ConstraintStateStore &other,
+                                           unsigned otherIndex )
+{
+    if ( this == &other && index == otherIndex )
+        return;
+
+    _active[index] = other._active[otherIndex];
+    _phaseStatus[index] = other._phaseStatus[otherIndex];
+    _direction[index] = other._direction[otherIndex];
+    _score[index] = other._score[otherIndex];
+
+    // Resizing may move the slots of this store, so read the other
+    // constraint's slots only afterwards
+    unsigned numSlots = other._numSlots[otherIndex];
+    resizeSlots( index, numSlots );
+
+    unsigned first = _firstSlot[index];
+    unsigned otherFirst = other._firstSlot[otherIndex];
+    for ( unsigned i = 0; i < numSlots; ++i )
+    {
+        _slotVariable[first + i] = other._slotVariable[otherFirst + i];
+        _slotFlags[first + i] = other._slotFlags[otherFirst + i];
+        for ( unsigned type = 0; type < NUM_VALUE_TYPES; ++type )
+            _slotValues[type][first + i] = other._slotValues[type][otherFirst + i];
+    }
+}
+
+void ConstraintStateStore::reserveSlots( unsigned index, unsigned numSlots )
+{
+    if ( numSlots > _slotCapacity[index] )
+        growSlots( index, numSlots );
+}
+
+unsigned ConstraintStateStore::getNumConstraints() const
+{
+    return _active.size();
+}
+
+void ConstraintStateStore::clear()
+{
+    _active.clear();
+    _phaseStatus.clear();
+    _direction.clear();
+    _score.clear();
+    _firstSlot.clear();
+    _numSlots.clear();
+    _slotCapacity.clear();
+    _slotVariable.clear();
+    _slotFlags.clear();
+    for ( unsigned type = 0; type < NUM_VALUE_TYPES; ++type )
+        _slotValues[type].clear();
+    _numAbandonedSlots = 0;
+}
+
+bool ConstraintStateStore::exists( unsigned index, ValueType type, unsigned variable ) const
+{
+    unsigned slot;
+    return findSlot( index, variable, slot ) && ( _slotFlags[slot] & ( 1 << type ) );
+}
+
+double ConstraintStateStore::get( unsigned index, ValueType type, unsigned variable ) const
+{
+    unsigned slot;
+    if ( !findSlot( index, variable, slot ) || !( _slotFlags[slot] & ( 1 << type ) ) )
+        throw CommonError( CommonError::KEY_DOESNT_EXIST_IN_MAP );
+
+    return _slotValues[type][slot];
+}
+
+void ConstraintStateStore::set( unsigned index, ValueType type, unsigned variable, double value )
+{
+    unsigned slot;
+    if ( !findSlot( index, variable, slot ) )
+    {
+        // Prefer the slot of a variable whose values were all erased,
+        // e.g. when a variable is renamed
+        if ( !findFreeSlot( index, slot ) )
+        {
+            resizeSlots( index, _numSlots[index] + 1 );
+            slot = _firstSlot[index] + _numSlots[index] - 1;
+        }
+        _slotVariable[slot] = variable;
+        _slotFlags[slot] = 0;
+    }
+
+    _slotValues[type][slot] = value;
+    _slotFlags[slot] |= ( 1 << type );
+}
+
+void ConstraintStateStore::erase( unsigned index, ValueType type, unsigned variable )
+{
+    unsigned slot;
+    if ( findSlot( index, variable, slot ) )
+        _slotFlags[slot] &= ~( 1 << type );
+}
+
+unsigned ConstraintStateStore::count( unsigned index, ValueType type ) const
+{
+    unsigned result = 0;
+    unsigned end = _firstSlot[index] + _numSlots[index];
+    for ( unsigned slot = _firstSlot[index]; slot < end; ++slot )
+    {
+        if ( _slotFlags[slot] & ( 1 << type ) )
+            ++result;
+    }
+
+    return result;
+}
+
+unsigned ConstraintStateStore::getTotalNumSlots() const
+{
+    return _slotVariable.size();
+}
+
+bool ConstraintStateStore::findSlot( unsigned index, unsigned variable, unsigned &slot ) const
+{
+    // Constraints have few variables, so a linear scan is fastest
+    unsigned end = _firstSlot[index] + _numSlots[index];
+    for ( unsigned i = _firstSlot[index]; i < end; ++i )
+    {
+        if ( _slotVariable[i] == variable )
+        {
+            slot = i;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool ConstraintStateStore::findFreeSlot( unsigned index, unsigned &slot ) const
+{
+    unsigned end = _firstSlot[index] + _numSlots[index];
+    for ( unsigned i = _firstSlot[index]; i < end; ++i )
+    {
+        if ( _slotFlags[i] == 0 )
+        {
+            slot = i;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void ConstraintStateStore::resizeSlots( unsigned index, unsigned numSlots )
+{
+    if ( numSlots > _slotCapacity[index] )
+        growSlots( index, numSlots );
+
+    _numSlots[index] = numSlots;
+
+    ASSERT( _firstSlot[index] + _numSlots[index] <= _slotVariable.size() );
+}
+
+void ConstraintStateStore::growSlots( unsigned index, unsigned capacity )
+{
+    unsigned first = _firstSlot[index];
+    unsigned oldCapacity = _slotCapacity[index];
+    unsigned end = _slotVariable.size();
+
+    if ( first + oldCapacity != end )
+    {
+        // Move the used slots to the end
+        for ( unsigned i = 0; i < _numSlots[index]; ++i )
+        {
+            unsigned variable = _slotVariable[first + i];
+            char flags = _slotFlags[first + i];
+            _slotVariable.push_back( variable );
+            _slotFlags.push_back( flags );
+            for ( unsigned type = 0; type < NUM_VALUE_TYPES; ++type )
+            {
+                double value = _slotValues[type][first + i];
+                _slotValues[type].push_back( value );
+            }
+        }
+
+        _numAbandonedSlots += oldCapacity;
+
+        first = end;
+        _firstSlot[index] = first;
+    }
+
+    _slotVariable.resize( first + capacity );
+    _slotFlags.resize( first + capacity, 0 );
+    for ( unsigned type = 0; type < NUM_VALUE_TYPES; ++type )
+        _slotValues[type].resize( first + capacity, 0 );
+
+    _slotCapacity[index] = capacity;
+
+    if ( 2 * _numAbandonedSlots >= _slotVariable.size() )
+        compact();
+}
+
+void ConstraintStateStore::compact()
+{
+    unsigned totalCapacity = 0;
+    for ( const auto &capacity : _slotCapacity )
+        totalCapacity += capacity;
+
+    std::vector<unsigned> slotVariable( totalCapacity, 0 );
+    std::vector<char> slotFlags( totalCapacity, 0 );
+    std::vector<double> slotValues[NUM_VALUE_TYPES];
+    for ( unsigned type = 0; type < NUM_VALUE_TYPES; ++type )
+        slotValues[type].resize( totalCapacity, 0 );
+
+    unsigned newFirst = 0;
+    for ( unsigned index = 0; index < _firstSlot.size(); ++index )
+    {
+        unsigned first = _firstSlot[index];
+        for ( unsigned i = 0; i < _numSlots[index]; ++i )
+        {
+            slotVariable[newFirst + i] = _slotVariable[first + i];
+            slotFlags[newFirst + i] = _slotFlags[first + i];
+            for ( unsigned type = 0; type < NUM_VALUE_TYPES; ++type )
+                slotValues[type][newFirst + i] = _slotValues[type][first + i];
+        }
+
+        _firstSlot[index] = newFirst;
+        newFirst += _slotCapacity[index];
+    }
+
+    _slotVariable.swap( slotVariable );
+    _slotFlags.swap( slotFlags );
+    for ( unsigned type = 0; type < NUM_VALUE_TYPES; ++type )
+        _slotValues[type].swap( slotValues[type] );
+
+    _numAbandonedSlots = 0;
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,190 @@
+/*********************                                                        */
+/*! \file ConstraintStateStore.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#ifndef __ConstraintStateStore_h__
+#define __ConstraintStateStore_h__
+
+#include "PhaseStatus.h"
+
+#include <vector>
+
+/*
+  The search state of a collection of piecewise linear constraints:
+  their phase status, whether they are active, their splitting score
+  and direction, and the values (assignment and bounds) that they have
+  been notified of for their participating variables.
+
+  The state is kept in structure-of-arrays form: one array per field,
+  indexed by the constraint's index in the store, and one array per
+  variable value, indexed by slot. The slots of a constraint are
+  contiguous. Copying a store is thus a handful of array copies, which
+  is how the engine stores and restores the state of all its
+  constraints when splitting and backtracking.
+*/
+class ConstraintStateStore
+{
+public:
+    ConstraintStateStore();
+
+    enum ValueType {
+        ASSIGNMENT = 0,
+        LOWER_BOUND = 1,
+        UPPER_BOUND = 2,
+        NUM_VALUE_TYPES = 3,
+    };
+
+    /*
+      Add a constraint with the initial state, or with a copy of the
+      state of a constraint in another store. Return the index of the
+      new constraint.
+    */
+    unsigned addConstraint();
+    unsigned addConstraint( const ConstraintStateStore &other, unsigned otherIndex );
+
+    /*
+      Overwrite the state of a constraint with that of a constraint in
+      another store.
+    */
+    void copyConstraint( unsigned index, const ConstraintStateStore &other, unsigned otherIndex );
+
+    /*
+      Make room for the given number of slots for a constraint, e.g. one
+      per participating variable, so that setting values for these
+      variables does not move the constraint's slots
+    */
+    void reserveSlots( unsigned index, unsigned numSlots );
+
+    unsigned getNumConstraints() const;
+    void clear();
+
+    /*
+      The per-constraint state
+    */
+    bool isActive( unsigned index ) const
+    {
+        return _active[index];
+    }
+
+    void setActive( unsigned index, bool active )
+    {
+        _active[index] = active;
+    }
+
+    PhaseStatus getPhaseStatus( unsigned index ) const
+    {
+        return _phaseStatus[index];
+    }
+
+    void setPhaseStatus( unsigned index, PhaseStatus phase )
+    {
+        _phaseStatus[index] = phase;
+    }
+
+    PhaseStatus getDirection( unsigned index ) const
+    {
+        return _direction[index];
+    }
+
+    void setDirection( unsigned index, PhaseStatus direction )
+    {
+        _direction[index] = direction;
+    }
+
+    double getScore( unsigned index ) const
+    {
+        return _score[index];
+    }
+
+    void setScore( unsigned index, double score )
+    {
+        _score[index] = score;
+    }
+
+    /*
+      The values of a constraint's variables. Getting a value that
+      has not been set throws an error.
+    */
+    bool exists( unsigned index, ValueType type, unsigned variable ) const;
+    double get( unsigned index, ValueType type, unsigned variable ) const;
+    void set( unsigned index, ValueType type, unsigned variable, double value );
+    void erase( unsigned index, ValueType type, unsigned variable );
+
+    /*
+      The number of variables that have a value of the given type
+    */
+    unsigned count( unsigned index, ValueType type ) const;
+
+    /*
+      For testing purposes: the size of the slot arrays, including
+      unused slots
+    */
+    unsigned getTotalNumSlots() const;
+
+private:
+    std::vector<char> _active;
+    std::vector<PhaseStatus> _phaseStatus;
+    std::vector<PhaseStatus> _direction;
+    std::vector<double> _score;
+
+    /*
+      The slots of constraint i are [_firstSlot[i], _firstSlot[i] +
+      _numSlots[i]), out of the _slotCapacity[i] slots reserved for
+      it. Each slot holds a variable, its values, and a bit per value
+      type indicating whether that value has been set.
+    */
+    std::vector<unsigned> _firstSlot;
+    std::vector<unsigned> _numSlots;
+    std::vector<unsigned> _slotCapacity;
+    std::vector<unsigned> _slotVariable;
+    std::vector<char> _slotFlags;
+    std::vector<double> _slotValues[NUM_VALUE_TYPES];
+
+    /*
+      The number of slots left behind by constraints that were moved
+    */
+    unsigned _numAbandonedSlots;
+
+    bool findSlot( unsigned index, unsigned variable, unsigned &slot ) const;
+
+    /*
+      Find a slot of a constraint whose values have all been erased
+    */
+    bool findFreeSlot( unsigned index, unsigned &slot ) const;
+
+    /*
+      Set the number of slots of a constraint, keeping its existing
+      slots and growing its capacity if needed.
+    */
+    void resizeSlots( unsigned index, unsigned numSlots );
+
+    /*
+      Grow the capacity of a constraint. A constraint whose slots are
+      not at the end of the arrays is moved to the end, and once the
+      slots left behind make up half of the arrays, the store is
+      compacted.
+    */
+    void growSlots( unsigned index, unsigned capacity );
+    void compact();
+};
+
+#endif // __ConstraintStateStore_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -20,6 +20,8 @@
 #include "MarabouError.h"
 #include "TableauRow.h"
 
+#include <algorithm>
+
 CostFunctionManager::CostFunctionManager( ITableau *tableau )
     : _tableau( tableau )
     , _costFunction( NULL )
@@ -27,6 +29,8 @@ CostFunctionManager::CostFunctionManager( ITableau *tableau )
     , _multipliers( NULL )
     , _n( 0 )
     , _m( 0 )
+    , _mCapacity( 0 )
+    , _nonBasicCapacity( 0 )
     , _costFunctionStatus( COST_FUNCTION_INVALID )
     , _ANColumn( NULL )
 {
@@ -56,6 +60,9 @@ void CostFunctionManager::freeMemoryIfNeeded()
         delete[] _costFunction;
         _costFunction = NULL;
     }
+
+    _mCapacity = 0;
+    _nonBasicCapacity = 0;
 }
 
 void CostFunctionManager::initialize()
@@ -63,19 +70,39 @@ void CostFunctionManager::initialize()
     _n = _tableau->getN();
     _m = _tableau->getM();
 
-    freeMemoryIfNeeded();
+    /*
+      Reallocate only when the current dimensions exceed the capacity. The
+      tableau grows by a few rows at a time, so the basic arrays grow
+      geometrically.
+    */
+    if ( _n - _m > _nonBasicCapacity )
+    {
+        if ( _costFunction )
+            delete[] _costFunction;
 
-    _costFunction = new double[_n - _m];
-    if ( !_costFunction )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "CostFunctionManager::costFunction" );
+        _nonBasicCapacity = _n - _m;
+        _costFunction = new double[_nonBasicCapacity];
+        if ( !_costFunction )
+            throw MarabouError( MarabouError::ALLOCATION_FAILED, "CostFunctionManager::costFunction" );
+    }
+
+    if ( _m > _mCapacity )
+    {
+        if ( _basicCosts )
+            delete[] _basicCosts;
+        if ( _multipliers )
+            delete[] _multipliers;
 
-    _basicCosts = new double[_m];
-    if ( !_basicCosts )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "CostFunctionManager::basicCosts" );
+        _mCapacity = std::max( _m, 2 * _mCapacity );
 
-    _multipliers = new double[_m];
-    if ( !_multipliers )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "CostFunctionManager::multipliers" );
+        _basicCosts = new double[_mCapacity];
+        if ( !_basicCosts )
+            throw MarabouError( MarabouError::ALLOCATION_FAILED, "CostFunctionManager::basicCosts" );
+
+        _multipliers = new double[_mCapacity];
+        if ( !_multipliers )
+            throw MarabouError( MarabouError::ALLOCATION_FAILED, "CostFunctionManager::multipliers" );
+    }
 
     invalidateCostFunction();
 }
@@ -100,6 +100,12 @@ private:
     unsigned _n;
     unsigned _m;
 
+    /*
+      The allocated sizes of the basic arrays and of the cost function.
+    */
+    unsigned _mCapacity;
+    unsigned _nonBasicCapacity;
+
     /*
       Status of the cost function.
     */
@@ -63,7 +63,7 @@ void DisjunctionConstraint::unregisterAsWatcher( ITableau *tableau )
 
 void DisjunctionConstraint::notifyVariableValue( unsigned variable, double value )
 {
-    _assignment[variable] = value;
+    setAssignment( variable, value );
 }
 
 void DisjunctionConstraint::notifyLowerBound( unsigned variable, double bound )
@@ -71,10 +71,10 @@ void DisjunctionConstraint::notifyLowerBound( unsigned variable, double bound )
     if ( _statistics )
         _statistics->incNumBoundNotificationsPlConstraints();
 
-    if ( _lowerBounds.exists( variable ) && !FloatUtils::gt( bound, _lowerBounds[variable] ) )
+    if ( existsLowerBound( variable ) && !FloatUtils::gt( bound, getLowerBound( variable ) ) )
         return;
 
-    _lowerBounds[variable] = bound;
+    setLowerBound( variable, bound );
 
     updateFeasibleDisjuncts();
 }
@@ -84,10 +84,10 @@ void DisjunctionConstraint::notifyUpperBound( unsigned variable, double bound )
     if ( _statistics )
         _statistics->incNumBoundNotificationsPlConstraints();
 
-    if ( _upperBounds.exists( variable ) && !FloatUtils::lt( bound, _upperBounds[variable] ) )
+    if ( existsUpperBound( variable ) && !FloatUtils::lt( bound, getUpperBound( variable ) ) )
         return;
 
-    _upperBounds[variable] = bound;
+    setUpperBound( variable, bound );
 
     updateFeasibleDisjuncts();
 }
@@ -151,30 +151,14 @@ void DisjunctionConstraint::dump( String &output ) const
         output += Stringf( "\t%s\n", disjunctOutput.ascii() );
     }
 
-    output += Stringf( "Active? %s.", _constraintActive ? "Yes" : "No" );
+    output += Stringf( "Active? %s.", isActive() ? "Yes" : "No" );
 }
 
 void DisjunctionConstraint::updateVariableIndex( unsigned oldIndex, unsigned newIndex )
 {
     ASSERT( !participatingVariable( newIndex ) );
 
-    if ( _assignment.exists( oldIndex ) )
-    {
-        _assignment[newIndex] = _assignment.get( oldIndex );
-        _assignment.erase( oldIndex );
-    }
-
-    if ( _lowerBounds.exists( oldIndex ) )
-    {
-        _lowerBounds[newIndex] = _lowerBounds.get( oldIndex );
-        _lowerBounds.erase( oldIndex );
-    }
-
-    if ( _upperBounds.exists( oldIndex ) )
-    {
-        _upperBounds[newIndex] = _upperBounds.get( oldIndex );
-        _upperBounds.erase( oldIndex );
-    }
+    renameVariableValues( oldIndex, newIndex );
 
     for ( auto &disjunct : _disjuncts )
         disjunct.updateVariableIndex( oldIndex, newIndex );
@@ -237,12 +221,12 @@ bool DisjunctionConstraint::disjunctSatisfied( const PiecewiseLinearCaseSplit &d
     {
         if ( bound._type == Tightening::LB )
         {
-            if ( _assignment[bound._variable] < bound._value )
+            if ( getAssignment( bound._variable ) < bound._value )
                 return false;
         }
         else
         {
-            if ( _assignment[bound._variable] > bound._value )
+            if ( getAssignment( bound._variable ) > bound._value )
                 return false;
         }
     }
@@ -252,7 +236,7 @@ bool DisjunctionConstraint::disjunctSatisfied( const PiecewiseLinearCaseSplit &d
     {
         double result = 0;
         for ( const auto &addend : equation._addends )
-            result += addend._coefficient * _assignment[addend._variable];
+            result += addend._coefficient * getAssignment( addend._variable );
 
         if ( !FloatUtils::areEqual( result, equation._scalar ) )
             return false;
@@ -278,14 +262,14 @@ bool DisjunctionConstraint::disjunctIsFeasible( const PiecewiseLinearCaseSplit &
     {
         if ( bound._type == Tightening::LB )
         {
-            if ( _upperBounds.exists( bound._variable ) &&
-                 _upperBounds[bound._variable] < bound._value )
+            if ( existsUpperBound( bound._variable ) &&
+                 getUpperBound( bound._variable ) < bound._value )
                 return false;
         }
         else
         {
-            if ( _lowerBounds.exists( bound._variable ) &&
-                 _lowerBounds[bound._variable] > bound._value )
+            if ( existsLowerBound( bound._variable ) &&
+                 getLowerBound( bound._variable ) > bound._value )
                 return false;
         }
     }
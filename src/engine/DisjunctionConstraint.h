@@ -41,6 +41,14 @@ public:
     */
     void restoreState( const PiecewiseLinearConstraint *state );
 
+    /*
+      The feasible disjuncts are not kept in the state store.
+    */
+    bool hasStateOutsideStore() const
+    {
+        return true;
+    }
+
     /*
       Register/unregister the constraint with a talbeau.
      */
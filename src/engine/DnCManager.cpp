@@ -22,6 +22,7 @@
 #include "LargestIntervalDivider.h"
 #include "MStringf.h"
 #include "MarabouError.h"
+#include "MemoryUtils.h"
 #include "Options.h"
 #include "PiecewiseLinearCaseSplit.h"
 #include "PolarityBasedDivider.h"
@@ -29,12 +30,10 @@
 #include "TimeUtils.h"
 #include "Vector.h"
 #include <atomic>
-#include <chrono>
 #include <cmath>
 #include <thread>
 
 void DnCManager::dncSolve( WorkerQueue *workload, std::shared_ptr<Engine> engine,
-                           std::unique_ptr<InputQuery> inputQuery,
                            std::atomic_uint &numUnsolvedSubQueries,
                            std::atomic_bool &shouldQuitSolving,
                            unsigned threadId, unsigned onlineDivides,
@@ -48,8 +47,6 @@ void DnCManager::dncSolve( WorkerQueue *workload, std::shared_ptr<Engine> engine
     getCPUId( cpuId );
     DNC_MANAGER_LOG( Stringf( "Thread #%u on CPU %u", threadId, cpuId ).ascii() );
 
-    engine->processInputQuery( *inputQuery, false );
-
     DnCWorker worker( workload, engine, std::ref( numUnsolvedSubQueries ),
                       std::ref( shouldQuitSolving ), threadId, onlineDivides,
                       timeoutFactor, divideStrategy, verbosity );
@@ -97,11 +94,8 @@ void DnCManager::freeMemoryIfNeeded()
     if ( _workload )
     {
         SubQuery *subQuery = NULL;
-        while ( !_workload->empty() )
-        {
-            _workload->pop( subQuery );
+        while ( _workload->pop( 0, subQuery ) )
             delete subQuery;
-        }
 
         delete _workload;
         _workload = NULL;
@@ -134,9 +128,9 @@ void DnCManager::solve()
     for ( unsigned i = 0; i < numWorkers; ++i )
         quitThreads.append( _engines[i]->getQuitRequested() );
 
-    // Partition the input query into initial subqueries, and place these
-    // queries in the queue
-    _workload = new WorkerQueue( 0 );
+    // Partition the input query into initial subqueries, and deal these
+    // queries out to the workers' deques
+    _workload = new WorkerQueue( numWorkers );
     if ( !_workload )
         throw MarabouError( MarabouError::ALLOCATION_FAILED, "DnCManager::workload" );
 
@@ -146,14 +140,11 @@ void DnCManager::solve()
     // Create objects shared across workers
     _numUnsolvedSubQueries = subQueries.size();
     std::atomic_bool shouldQuitSolving( false );
-    WorkerQueue *workload = new WorkerQueue( 0 );
+    unsigned workerId = 0;
     for ( auto &subQuery : subQueries )
     {
-        if ( !workload->push( subQuery ) )
-        {
-            // This should never happen
-            ASSERT( false );
-        }
+        _workload->push( workerId, subQuery );
+        workerId = ( workerId + 1 ) % numWorkers;
     }
 
     unsigned onlineDivides = Options::get()->getInt( Options::NUM_ONLINE_DIVIDES );
@@ -164,11 +155,7 @@ void DnCManager::solve()
     std::list<std::thread> threads;
     for ( unsigned threadId = 0; threadId < numWorkers; ++threadId )
     {
-        // Get the processed input query from the base engine
-        auto inputQuery = std::unique_ptr<InputQuery>
-            ( new InputQuery( *( _baseEngine->getInputQuery() ) ) );
-        threads.push_back( std::thread( dncSolve, workload, _engines[ threadId ],
-                                        std::move( inputQuery ),
+        threads.push_back( std::thread( dncSolve, _workload, _engines[ threadId ],
                                         std::ref( _numUnsolvedSubQueries ),
                                         std::ref( shouldQuitSolving ),
                                         threadId, onlineDivides,
@@ -177,28 +164,44 @@ void DnCManager::solve()
     }
 
     // Wait until either all subQueries are solved or a satisfying assignment is
-    // found by some worker
+    // found by some worker. The workers wake us up when that happens.
     while ( !shouldQuitSolving.load() )
     {
         updateTimeoutReached( startTime, timeoutInMicroSeconds );
         if ( _timeoutReached )
             shouldQuitSolving = true;
         else
-            std::this_thread::sleep_for( std::chrono::milliseconds( 100 ) );
+            _workload->waitForQuit( shouldQuitSolving,
+                                    getRemainingTime( startTime, timeoutInMicroSeconds ) );
     }
 
-
-    // Now that we are done, tell all workers to quit
+    // Now that we are done, tell all workers to quit, and wake up the idle ones
     for ( auto &quitThread : quitThreads )
         *quitThread = true;
+    _workload->notifyAll();
 
     for ( auto &thread : threads )
         thread.join();
 
+    if ( _verbosity > 0 )
+        printWorkerStatistics();
+
     updateDnCExitCode();
     return;
 }
 
+void DnCManager::printWorkerStatistics() const
+{
+    printf( "\nDnC worker statistics:\n" );
+    for ( unsigned i = 0; i < _workload->getNumWorkers(); ++i )
+    {
+        WorkerQueue::WorkerStatistics statistics = _workload->getWorkerStatistics( i );
+        printf( "\tWorker %u: popped %llu subqueries (%llu stolen). Idle time: %llu milli\n",
+                i, statistics._numPopped, statistics._numStolen,
+                statistics._idleTimeMicro / 1000 );
+    }
+}
+
 DnCManager::DnCExitCode DnCManager::getExitCode() const
 {
     return _exitCode;
@@ -341,13 +344,19 @@ void DnCManager::printResult()
 
 bool DnCManager::createEngines( unsigned numberOfEngines )
 {
+    struct timespec start = TimeUtils::sampleMicro();
+
     // Create the base engine
     _baseEngine = std::make_shared<Engine>();
     if ( !_baseEngine->processInputQuery( *_baseInputQuery ) )
         // Solved by preprocessing, we are done!
         return false;
 
-    // Create engines for each thread
+    struct timespec preprocessingEnd = TimeUtils::sampleMicro();
+
+    // Create engines for each thread. The query is preprocessed only once,
+    // by the base engine: the other engines copy its results in parallel,
+    // and share the network weights with it.
     for ( unsigned i = 0; i < numberOfEngines; ++i )
     {
         auto engine = std::make_shared<Engine>();
@@ -355,9 +364,34 @@ bool DnCManager::createEngines( unsigned numberOfEngines )
         _engines.append( engine );
     }
 
+    std::list<std::thread> threads;
+    for ( auto &engine : _engines )
+        threads.push_back( std::thread( initializeEngine, engine,
+                                        std::cref( *_baseEngine ) ) );
+    for ( auto &thread : threads )
+        thread.join();
+
+    struct timespec end = TimeUtils::sampleMicro();
+
+    if ( _verbosity > 0 )
+    {
+        printf( "DnC startup with %u workers: preprocessing %llu milli, "
+                "worker initialization %llu milli, resident memory %llu MB\n",
+                numberOfEngines,
+                TimeUtils::timePassed( start, preprocessingEnd ) / 1000,
+                TimeUtils::timePassed( preprocessingEnd, end ) / 1000,
+                MemoryUtils::residentMemoryInKB() / 1024 );
+    }
+
     return true;
 }
 
+void DnCManager::initializeEngine( std::shared_ptr<Engine> engine,
+                                   const Engine &baseEngine )
+{
+    engine->processInputQuery( baseEngine );
+}
+
 void DnCManager::initialDivide( SubQueries &subQueries )
 {
     auto split = std::unique_ptr<PiecewiseLinearCaseSplit>
@@ -405,3 +439,15 @@ void DnCManager::updateTimeoutReached( timespec startTime, unsigned long long
     _timeoutReached = TimeUtils::timePassed( startTime, now ) >=
         timeoutInMicroSeconds;
 }
+
+unsigned long long DnCManager::getRemainingTime( timespec startTime,
+                                                 unsigned long long
+                                                 timeoutInMicroSeconds ) const
+{
+    if ( timeoutInMicroSeconds == 0 )
+        return 0;
+    struct timespec now = TimeUtils::sampleMicro();
+    unsigned long long passed = TimeUtils::timePassed( startTime, now );
+    // Never return 0 here, as that would mean waiting with no time limit
+    return passed >= timeoutInMicroSeconds ? 1 : timeoutInMicroSeconds - passed;
+}
@@ -77,7 +77,6 @@ private:
       Create and run a DnCWorker
     */
     static void dncSolve( WorkerQueue *workload, std::shared_ptr<Engine> engine,
-                          std::unique_ptr<InputQuery> inputQuery,
                           std::atomic_uint &numUnsolvedSubQueries,
                           std::atomic_bool &shouldQuitSolving,
                           unsigned threadId, unsigned onlineDivides,
@@ -90,6 +89,13 @@ private:
     */
     bool createEngines( unsigned numberOfEngines );
 
+    /*
+      Initialize a worker's engine from the base engine, which has already
+      processed the input query
+    */
+    static void initializeEngine( std::shared_ptr<Engine> engine,
+                                  const Engine &baseEngine );
+
     /*
       Divide up the input region and store them in subqueries
     */
@@ -107,6 +113,19 @@ private:
     void updateTimeoutReached( timespec startTime,
                                unsigned long long timeoutInMicroSeconds );
 
+    /*
+      Return the number of microseconds left before the timeout is reached,
+      or 0 if there is no timeout
+    */
+    unsigned long long getRemainingTime( timespec startTime,
+                                         unsigned long long timeoutInMicroSeconds ) const;
+
+    /*
+      Print the number of subqueries, the number of steals and the idle
+      time of each worker
+    */
+    void printWorkerStatistics() const;
+
     /*
       The base engine that is used to perform the initial divides
     */
@@ -65,7 +65,6 @@ void DnCMarabou::run()
 
         AcasParser acasParser( networkFilePath );
         acasParser.generateQuery( _inputQuery );
-        _inputQuery.constructNetworkLevelReasoner();
 
         /*
           Step 2: extract the property in question
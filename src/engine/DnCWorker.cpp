@@ -26,9 +26,7 @@
 #include "SubQuery.h"
 
 #include <atomic>
-#include <chrono>
 #include <cmath>
-#include <thread>
 
 DnCWorker::DnCWorker( WorkerQueue *workload, std::shared_ptr<IEngine> engine,
                       std::atomic_uint &numUnsolvedSubQueries,
@@ -49,7 +47,7 @@ DnCWorker::DnCWorker( WorkerQueue *workload, std::shared_ptr<IEngine> engine,
 
     // Obtain the current state of the engine
     _initialState = std::make_shared<EngineState>();
-    _engine->storeState( *_initialState, true );
+    _engine->storeState( *_initialState, TableauStateStorageLevel::STORE_ENTIRE_TABLEAU_STATE );
 }
 
 void DnCWorker::setQueryDivider( SnCDivideStrategy divideStrategy )
@@ -68,10 +66,10 @@ void DnCWorker::setQueryDivider( SnCDivideStrategy divideStrategy )
 void DnCWorker::popOneSubQueryAndSolve( bool restoreTreeStates )
 {
     SubQuery *subQuery = NULL;
-    // Boost queue stores the next element into the passed-in pointer
-    // and returns true if the pop is successful (aka, the queue is not empty
-    // in most cases)
-    if ( _workload->pop( subQuery ) )
+    // Pop from this worker's own deque, or steal from another worker. If
+    // there is no work, sleep until some is pushed or solving should stop,
+    // in which case false is returned
+    if ( _workload->waitAndPop( _threadId, subQuery, *_shouldQuitSolving ) )
     {
         String queryId = subQuery->_queryId;
         unsigned depth = subQuery->_depth;
@@ -115,7 +113,10 @@ void DnCWorker::popOneSubQueryAndSolve( bool restoreTreeStates )
             // If UNSAT, continue to solve
             *_numUnsolvedSubQueries -= 1;
             if ( _numUnsolvedSubQueries->load() == 0 )
+            {
                 *_shouldQuitSolving = true;
+                _workload->notifyAll();
+            }
             delete subQuery;
         }
         else if ( result == IEngine::TIMEOUT )
@@ -150,12 +151,10 @@ void DnCWorker::popOneSubQueryAndSolve( bool restoreTreeStates )
                     newSubQuery->_smtState = std::move( newSmtStates[i++] );
                 }
 
-                if ( !_workload->push( std::move( newSubQuery ) ) )
-                {
-                    throw MarabouError( MarabouError::UNSUCCESSFUL_QUEUE_PUSH );
-                }
-
+                // Count the new subquery before it becomes visible to
+                // other workers
                 *_numUnsolvedSubQueries += 1;
+                _workload->push( _threadId, std::move( newSubQuery ) );
             }
             *_numUnsolvedSubQueries -= 1;
             delete subQuery;
@@ -173,6 +172,7 @@ void DnCWorker::popOneSubQueryAndSolve( bool restoreTreeStates )
             // TIMEOUT. This way, the DnCManager will kill all the DnCWorkers.
 
             *_shouldQuitSolving = true;
+            _workload->notifyAll();
             if ( result == IEngine::SAT )
             {
                 // case SAT
@@ -194,11 +194,6 @@ void DnCWorker::popOneSubQueryAndSolve( bool restoreTreeStates )
             }
         }
     }
-    else
-    {
-        // If the queue is empty but the pop fails, wait and retry
-        std::this_thread::sleep_for( std::chrono::milliseconds( 100 ) );
-    }
 }
 
 void DnCWorker::printProgress( String queryId, IEngine::ExitCode result ) const
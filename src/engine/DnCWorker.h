@@ -33,8 +33,8 @@ public:
                SnCDivideStrategy divideStrategy, unsigned verbosity );
 
     /*
-      Pop one subQuery, solve it and handle the result
-      Return true if the DnCWorker should continue running
+      Pop one subQuery, solve it and handle the result. If no subQuery is
+      available, sleep until one is pushed or until solving should stop
     */
     void popOneSubQueryAndSolve( bool restoreTreeStates = false );
 
@@ -55,7 +55,8 @@ private:
     void printProgress( String queryId, IEngine::ExitCode result ) const;
 
     /*
-      The queue of subqueries (shared across threads)
+      The queue of subqueries (shared across threads). This worker pushes
+      and pops its own deque, identified by _threadId
     */
     WorkerQueue *_workload;
     std::shared_ptr<IEngine> _engine;
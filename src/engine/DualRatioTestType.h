@@ -0,0 +1,31 @@
+/*********************                                                        */
+/*! \file DualRatioTestType.h
+** \verbatim
+** Top contributors (to current version):
+**   Guy Katz
+** This file is part of the Marabou project.
+** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved. See the file COPYING in the top-level source
+** directory for licensing information.\endverbatim
+**
+** [[ Add lengthier description here ]]
+
+**/
+
+#ifndef __DualRatioTestType_h__
+#define __DualRatioTestType_h__
+
+/*
+  Ratio test options for dual simplex steps
+*/
+enum class DualRatioTestType
+{
+     // Pick the entering variable with the largest pivot element
+     TEXTBOOK = 0,
+     // Also flip boxed non-basics to their opposite bounds, as long
+     // as the leaving variable stays infeasible
+     BOUND_FLIPPING = 1,
+};
+
+#endif // __DualRatioTestType_h__
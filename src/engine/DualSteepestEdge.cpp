@@ -0,0 +1,192 @@
+/*********************                                                        */
+/*! \file DualSteepestEdge.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "Debug.h"
+#include "DualSteepestEdge.h"
+#include "FloatUtils.h"
+#include "GlobalConfiguration.h"
+#include "ITableau.h"
+#include "MarabouError.h"
+
+#include <algorithm>
+#include <cstring>
+
+DualSteepestEdgeRule::DualSteepestEdgeRule()
+    : _weights( NULL )
+    , _work1( NULL )
+    , _work2( NULL )
+    , _m( 0 )
+{
+}
+
+DualSteepestEdgeRule::~DualSteepestEdgeRule()
+{
+    freeIfNeeded();
+}
+
+void DualSteepestEdgeRule::freeIfNeeded()
+{
+    if ( _weights )
+    {
+        delete[] _weights;
+        _weights = NULL;
+    }
+
+    if ( _work1 )
+    {
+        delete[] _work1;
+        _work1 = NULL;
+    }
+
+    if ( _work2 )
+    {
+        delete[] _work2;
+        _work2 = NULL;
+    }
+}
+
+void DualSteepestEdgeRule::allocate( unsigned m )
+{
+    _m = m;
+
+    _weights = new double[_m];
+    if ( !_weights )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "DualSteepestEdgeRule::weights" );
+
+    _work1 = new double[_m];
+    if ( !_work1 )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "DualSteepestEdgeRule::work1" );
+
+    _work2 = new double[_m];
+    if ( !_work2 )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "DualSteepestEdgeRule::work2" );
+}
+
+void DualSteepestEdgeRule::initialize( const ITableau &tableau )
+{
+    freeIfNeeded();
+    allocate( tableau.getM() );
+
+    std::fill_n( _weights, _m, 1.0 );
+}
+
+void DualSteepestEdgeRule::resizeHook( const ITableau &tableau )
+{
+    double *oldWeights = _weights;
+    unsigned numToCopy = oldWeights ? std::min( _m, tableau.getM() ) : 0;
+    _weights = NULL;
+
+    freeIfNeeded();
+    allocate( tableau.getM() );
+
+    if ( numToCopy > 0 )
+        memcpy( _weights, oldWeights, sizeof(double) * numToCopy );
+    std::fill_n( _weights + numToCopy, _m - numToCopy, 1.0 );
+
+    if ( oldWeights )
+        delete[] oldWeights;
+}
+
+bool DualSteepestEdgeRule::select( ITableau &tableau )
+{
+    ASSERT( tableau.getM() == _m );
+
+    bool found = false;
+    unsigned bestCandidate = 0;
+    double bestValue = 0;
+
+    for ( unsigned i = 0; i < _m; ++i )
+    {
+        if ( !tableau.basicOutOfBounds( i ) )
+            continue;
+
+        unsigned variable = tableau.basicIndexToVariable( i );
+        double value = tableau.getBasicAssignment( i );
+        double infeasibility = tableau.basicTooLow( i ) ?
+            tableau.getLowerBound( variable ) - value :
+            value - tableau.getUpperBound( variable );
+
+        double contenderValue = ( infeasibility * infeasibility ) / _weights[i];
+        if ( !found || contenderValue > bestValue )
+        {
+            found = true;
+            bestCandidate = i;
+            bestValue = contenderValue;
+        }
+    }
+
+    if ( found )
+        tableau.setLeavingVariableIndex( bestCandidate );
+
+    return found;
+}
+
+void DualSteepestEdgeRule::prePivotHook( const ITableau &tableau )
+{
+    ASSERT( tableau.getM() == _m );
+
+    unsigned leavingIndex = tableau.getLeavingVariableIndex();
+    const double *changeColumn = tableau.getChangeColumn();
+    double pivotElement = changeColumn[leavingIndex];
+
+    if ( FloatUtils::isZero( pivotElement ) )
+        return;
+
+    /*
+      Let rho denote the pivot row of inv(B), and tau = inv(B) * rho.
+      The weight of the leaving row is recomputed exactly, and then:
+
+        new weight[r] = weight[r] / alpha_r^2
+        new weight[i] = weight[i] - 2 (alpha_i / alpha_r) tau_i
+                        + (alpha_i / alpha_r)^2 weight[r]
+
+      where alpha is the change column.
+    */
+    std::fill_n( _work1, _m, 0.0 );
+    _work1[leavingIndex] = 1;
+    tableau.backwardTransformation( _work1, _work2 );
+
+    double leavingWeight = 0;
+    for ( unsigned i = 0; i < _m; ++i )
+        leavingWeight += _work2[i] * _work2[i];
+
+    tableau.forwardTransformation( _work2, _work1 );
+
+    for ( unsigned i = 0; i < _m; ++i )
+    {
+        if ( i == leavingIndex || FloatUtils::isZero( changeColumn[i] ) )
+            continue;
+
+        double ratio = changeColumn[i] / pivotElement;
+        double weight = _weights[i] - 2 * ratio * _work1[i] + ratio * ratio * leavingWeight;
+        _weights[i] = FloatUtils::max( weight, GlobalConfiguration::DUAL_STEEPEST_EDGE_MIN_WEIGHT );
+    }
+
+    _weights[leavingIndex] = FloatUtils::max( leavingWeight / ( pivotElement * pivotElement ),
+                                              GlobalConfiguration::DUAL_STEEPEST_EDGE_MIN_WEIGHT );
+}
+
+double DualSteepestEdgeRule::getWeight( unsigned basicIndex ) const
+{
+    return _weights[basicIndex];
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
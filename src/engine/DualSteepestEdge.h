@@ -0,0 +1,94 @@
+/*********************                                                        */
+/*! \file DualSteepestEdge.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#ifndef __DualSteepestEdge_h__
+#define __DualSteepestEdge_h__
+
+class ITableau;
+
+/*
+  The dual steepest edge pricing rule, used for picking the leaving
+  variable in a dual simplex step. The rule picks the out-of-bounds
+  basic variable i that maximizes
+
+                infeasibility[i]^2
+                ------------------
+                    weight[i]
+
+  where weight[i] is the squared norm of the i'th row of inv(B). The
+  weights are updated after every dual pivot, using the Forrest-Goldfarb
+  update formulas. They start out as 1, which is exact for a basis made
+  of auxiliary variables.
+*/
+class DualSteepestEdgeRule
+{
+public:
+    DualSteepestEdgeRule();
+    ~DualSteepestEdgeRule();
+
+    /*
+      Allocate the weights according to the size of the tableau, and
+      reset them to 1.
+    */
+    void initialize( const ITableau &tableau );
+
+    /*
+      Pick the leaving variable and set it in the tableau. Return
+      false if no basic variable is out of bounds.
+    */
+    bool select( ITableau &tableau );
+
+    /*
+      Update the weights for the pivot that is about to be performed.
+      This requires the entering and leaving variables and the change
+      column to have been set in the tableau.
+    */
+    void prePivotHook( const ITableau &tableau );
+
+    /*
+      Adjust the weights to a change in the number of rows. Weights of
+      existing rows are kept, and new rows get a weight of 1.
+    */
+    void resizeHook( const ITableau &tableau );
+
+    /*
+      For debugging purposes.
+    */
+    double getWeight( unsigned basicIndex ) const;
+
+private:
+    double *_weights;
+
+    /*
+      Work space for the pivot row of inv(B), and its product with inv(B)
+    */
+    double *_work1;
+    double *_work2;
+
+    unsigned _m;
+
+    void freeIfNeeded();
+    void allocate( unsigned m );
+};
+
+#endif // __DualSteepestEdge_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
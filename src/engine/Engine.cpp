@@ -28,9 +28,12 @@
 #include "Options.h"
 #include "PiecewiseLinearConstraint.h"
 #include "Preprocessor.h"
+#include "SparseUnsortedArrays.h"
 #include "TableauRow.h"
 #include "TimeUtils.h"
 
+#include <algorithm>
+
 Engine::Engine()
     : _rowBoundTightener( *_tableau )
     , _smtCore( this )
@@ -52,18 +55,35 @@ Engine::Engine()
     , _splittingStrategy( Options::get()->getDivideStrategy() )
     , _symbolicBoundTighteningType( Options::get()->getSymbolicBoundTighteningType() )
     , _solveWithMILP( Options::get()->getBool( Options::SOLVE_WITH_MILP ) )
+    , _useDualSimplex( Options::get()->getBool( Options::DUAL_SIMPLEX ) )
+    , _dualRatioTestType( Options::get()->getDualRatioTestType() )
+    , _dualSimplexStepsLeft( 0 )
+    , _restoringFeasibilityAfterSplit( false )
+    , _numPivotsBeforeRestoringFeasibility( 0 )
     , _gurobi( nullptr )
     , _milpEncoder( nullptr )
+    , _threadPool( nullptr )
 {
     _smtCore.setStatistics( &_statistics );
     _tableau->setStatistics( &_statistics );
+    _tableau->setPrimalRatioTestType( Options::get()->getPrimalRatioTestType() );
     _rowBoundTightener->setStatistics( &_statistics );
     _constraintBoundTightener->setStatistics( &_statistics );
     _preprocessor.setStatistics( &_statistics );
 
-    _activeEntryStrategy = _projectedSteepestEdgeRule;
+    if ( Options::get()->getBool( Options::PARTIAL_PRICING ) )
+        _activeEntryStrategy = &_partialPricingRule;
+    else
+        _activeEntryStrategy = _projectedSteepestEdgeRule;
     _activeEntryStrategy->setStatistics( &_statistics );
 
+    unsigned numTighteningThreads = Options::get()->getInt( Options::NUM_TIGHTENING_THREADS );
+    if ( numTighteningThreads > 1 )
+    {
+        _threadPool = std::unique_ptr<ThreadPool>( new ThreadPool( numTighteningThreads ) );
+        _preprocessor.setThreadPool( _threadPool.get() );
+    }
+
     _statistics.stampStartingTime();
 }
 
@@ -224,6 +244,8 @@ bool Engine::solve( unsigned timeoutInSeconds )
 
             if ( allVarsWithinBounds() )
             {
+                feasibilityRestored();
+
                 // The linear portion of the problem has been solved.
                 // Check the status of the PL constraints
                 collectViolatedPlConstraints();
@@ -302,6 +324,8 @@ bool Engine::solve( unsigned timeoutInSeconds )
         {
             // The current query is unsat, and we need to pop.
             // If we're at level 0, the whole query is unsat.
+            _restoringFeasibilityAfterSplit = false;
+            _dualSimplexStepsLeft = 0;
             if ( !_smtCore.popSplit() )
             {
                 if ( _verbosity > 0 )
@@ -372,6 +396,20 @@ void Engine::performSimplexStep()
     _statistics.incNumSimplexSteps();
     struct timespec start = TimeUtils::sampleMicro();
 
+    if ( _dualSimplexStepsLeft > 0 )
+    {
+        --_dualSimplexStepsLeft;
+        if ( performDualSimplexStep() )
+        {
+            struct timespec end = TimeUtils::sampleMicro();
+            _statistics.addTimeSimplexSteps( TimeUtils::timePassed( start, end ) );
+            return;
+        }
+
+        // The dual simplex is stuck, continue with the primal simplex
+        _dualSimplexStepsLeft = 0;
+    }
+
     /*
       In order to increase numerical stability, we attempt to pick a
       "good" entering/leaving combination, by trying to avoid tiny pivot
@@ -417,9 +455,11 @@ void Engine::performSimplexStep()
             }
         });
 
-    // Obtain all eligible entering varaibles
+    // Obtain all eligible entering varaibles, unless the entry
+    // strategy keeps track of its own candidates
     List<unsigned> enteringVariableCandidates;
-    _tableau->getEntryCandidates( enteringVariableCandidates );
+    if ( _activeEntryStrategy->needsEntryCandidates() )
+        _tableau->getEntryCandidates( enteringVariableCandidates );
 
     unsigned bestLeaving = 0;
     double bestChangeRatio = 0.0;
@@ -546,6 +586,8 @@ void Engine::performSimplexStep()
 
     // Perform the actual pivot
     _activeEntryStrategy->prePivotHook( _tableau, fakePivot );
+    if ( _useDualSimplex && !fakePivot )
+        _dualSteepestEdgeRule.prePivotHook( _tableau );
     _tableau->performPivot();
     _activeEntryStrategy->postPivotHook( _tableau, fakePivot );
 
@@ -553,6 +595,56 @@ void Engine::performSimplexStep()
     _statistics.addTimeSimplexSteps( TimeUtils::timePassed( start, end ) );
 }
 
+bool Engine::performDualSimplexStep()
+{
+    if ( !_dualSteepestEdgeRule.select( _tableau ) )
+        return false;
+
+    _tableau->computePivotRow();
+
+    /*
+      If no entering variable can be found, the pivot row shows that
+      the leaving variable cannot be brought within its bounds. The
+      primal simplex will discover this, too.
+    */
+    if ( !_tableau->dualRatioTest( _dualRatioTestType ) )
+        return false;
+
+    _tableau->computeChangeColumn();
+    unsigned leavingIndex = _tableau->getLeavingVariableIndex();
+    if ( FloatUtils::abs( _tableau->getChangeColumn()[leavingIndex] ) <
+         GlobalConfiguration::ACCEPTABLE_SIMPLEX_PIVOT_THRESHOLD )
+        return false;
+
+    _statistics.incNumDualSimplexSteps();
+    _rowBoundTightener->examinePivotRow();
+
+    _activeEntryStrategy->prePivotHook( _tableau, false );
+    _dualSteepestEdgeRule.prePivotHook( _tableau );
+    _tableau->performPivot();
+    _activeEntryStrategy->postPivotHook( _tableau, false );
+
+    /*
+      The cost function update assumes that the entering variable ends
+      up within its bounds, which is not the case in a dual pivot.
+    */
+    _costFunctionManager->invalidateCostFunction();
+
+    return true;
+}
+
+void Engine::feasibilityRestored()
+{
+    _dualSimplexStepsLeft = 0;
+
+    if ( !_restoringFeasibilityAfterSplit )
+        return;
+
+    _statistics.addPivotsToRestoreFeasibility( _statistics.getNumTableauPivots() -
+                                               _numPivotsBeforeRestoringFeasibility );
+    _restoringFeasibilityAfterSplit = false;
+}
+
 void Engine::fixViolatedPlConstraintIfPossible()
 {
     List<PiecewiseLinearConstraint::Fix> fixes;
@@ -639,6 +731,8 @@ void Engine::fixViolatedPlConstraintIfPossible()
     _tableau->computePivotRow();
 
     _activeEntryStrategy->prePivotHook( _tableau, false );
+    if ( _useDualSimplex )
+        _dualSteepestEdgeRule.prePivotHook( _tableau );
     _tableau->performDegeneratePivot();
     _activeEntryStrategy->postPivotHook( _tableau, false );
 
@@ -742,17 +836,17 @@ void Engine::storeEquationsInDegradationChecker()
     _degradationChecker.storeEquations( _preprocessedQuery );
 }
 
-double *Engine::createConstraintMatrix()
+void Engine::createConstraintMatrix( SparseUnsortedArrays &constraintMatrix )
 {
     const List<Equation> &equations( _preprocessedQuery.getEquations() );
     unsigned m = equations.size();
     unsigned n = _preprocessedQuery.getNumberOfVariables();
 
-    // Step 1: create a constraint matrix from the equations
-    double *constraintMatrix = new double[n*m];
-    if ( !constraintMatrix )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Engine::constraintMatrix" );
-    std::fill_n( constraintMatrix, n*m, 0.0 );
+    // Create a sparse constraint matrix from the equations. A variable that
+    // appears more than once in an equation takes its last coefficient.
+    constraintMatrix.initializeToEmpty( m, n );
+
+    Vector<unsigned> lastRowOfVariable( n, m );
 
     unsigned equationIndex = 0;
     for ( const auto &equation : equations )
@@ -764,15 +858,23 @@ double *Engine::createConstraintMatrix()
         }
 
         for ( const auto &addend : equation._addends )
-            constraintMatrix[equationIndex*n + addend._variable] = addend._coefficient;
+        {
+            if ( lastRowOfVariable[addend._variable] == equationIndex )
+            {
+                constraintMatrix.set( equationIndex, addend._variable, addend._coefficient );
+            }
+            else if ( !FloatUtils::isZero( addend._coefficient ) )
+            {
+                constraintMatrix.append( equationIndex, addend._variable, addend._coefficient );
+                lastRowOfVariable[addend._variable] = equationIndex;
+            }
+        }
 
         ++equationIndex;
     }
-
-    return constraintMatrix;
 }
 
-void Engine::removeRedundantEquations( const double *constraintMatrix )
+void Engine::removeRedundantEquations( const SparseUnsortedArrays &constraintMatrix )
 {
     const List<Equation> &equations( _preprocessedQuery.getEquations() );
     unsigned m = equations.size();
@@ -795,7 +897,7 @@ void Engine::removeRedundantEquations( const double *constraintMatrix )
     }
 }
 
-void Engine::selectInitialVariablesForBasis( const double *constraintMatrix, List<unsigned> &initialBasis, List<unsigned> &basicRows )
+void Engine::selectInitialVariablesForBasis( const SparseUnsortedArrays &constraintMatrix, List<unsigned> &initialBasis, List<unsigned> &basicRows )
 {
     /*
       This method permutes rows and columns in the constraint matrix (prior
@@ -805,6 +907,10 @@ void Engine::selectInitialVariablesForBasis( const double *constraintMatrix, Lis
 
       (It is possible that not enough variables are obtained this way, in which
       case the initial basis will have to be augmented later).
+
+      Rows that become singletons are kept on a worklist, and when there are
+      none the densest remaining column is excluded. Each entry of the
+      matrix is visited a constant number of times.
     */
 
     const List<Equation> &equations( _preprocessedQuery.getEquations() );
@@ -821,149 +927,99 @@ void Engine::selectInitialVariablesForBasis( const double *constraintMatrix, Lis
         return;
     }
 
-    unsigned *nnzInRow = new unsigned[m];
-    unsigned *nnzInColumn = new unsigned[n];
-
-    std::fill_n( nnzInRow, m, 0 );
-    std::fill_n( nnzInColumn, n, 0 );
-
-    unsigned *columnOrdering = new unsigned[n];
-    unsigned *rowOrdering = new unsigned[m];
+    SparseUnsortedArrays transposed;
+    constraintMatrix.transposeIntoOther( &transposed );
 
-    for ( unsigned i = 0; i < m; ++i )
-        rowOrdering[i] = i;
-
-    for ( unsigned i = 0; i < n; ++i )
-        columnOrdering[i] = i;
-
-    // Initialize the counters
+    // The number of entries of each row in the remaining columns
+    Vector<unsigned> nnzInRow( m, 0 );
+    Vector<unsigned> singletonRows;
     for ( unsigned i = 0; i < m; ++i )
     {
-        for ( unsigned j = 0; j < n; ++j )
-        {
-            if ( !FloatUtils::isZero( constraintMatrix[i*n + j] ) )
-            {
-                ++nnzInRow[i];
-                ++nnzInColumn[j];
-            }
-        }
+        nnzInRow[i] = constraintMatrix.getRow( i )->getNnz();
+        ASSERT( nnzInRow[i] > 0 );
+        if ( nnzInRow[i] == 1 )
+            singletonRows.append( i );
     }
 
-    DEBUG({
-            for ( unsigned i = 0; i < m; ++i )
-            {
-                ASSERT( nnzInRow[i] > 0 );
-            }
-        });
-
-    unsigned numExcluded = 0;
-    unsigned numTriangularRows = 0;
-    unsigned temp;
-
-    while ( numExcluded + numTriangularRows < n )
+    // Candidates for exclusion, densest first
+    Vector<unsigned> columnsByDensity( n, 0 );
+    for ( unsigned i = 0; i < n; ++i )
+        columnsByDensity[i] = i;
+    std::stable_sort( columnsByDensity.begin(),
+                      columnsByDensity.end(),
+                      [&transposed]( unsigned a, unsigned b )
+                      {
+                          return transposed.getRow( a )->getNnz() > transposed.getRow( b )->getNnz();
+                      } );
+    unsigned nextExclusionCandidate = 0;
+
+    Vector<char> rowIsActive( m, true );
+    Vector<char> columnIsActive( n, true );
+    unsigned numActiveColumns = n;
+
+    while ( numActiveColumns > 0 )
     {
         // Do we have a singleton row?
         unsigned singletonRow = m;
-        for ( unsigned i = numTriangularRows; i < m; ++i )
+        while ( !singletonRows.empty() && singletonRow == m )
         {
-            if ( nnzInRow[i] == 1 )
-            {
-                singletonRow = i;
-                break;
-            }
+            unsigned row = singletonRows.pop();
+            if ( rowIsActive[row] && nnzInRow[row] == 1 )
+                singletonRow = row;
         }
 
+        unsigned column = n;
         if ( singletonRow < m )
         {
-            // Have a singleton row! Swap it to the top and update counters
-            temp = rowOrdering[singletonRow];
-            rowOrdering[singletonRow] = rowOrdering[numTriangularRows];
-            rowOrdering[numTriangularRows] = temp;
-
-            temp = nnzInRow[numTriangularRows];
-            nnzInRow[numTriangularRows] = nnzInRow[singletonRow];
-            nnzInRow[singletonRow] = temp;
-
-            // Find the non-zero entry in the row and swap it to the diagonal
-            DEBUG( bool foundNonZero = false );
-            for ( unsigned i = numTriangularRows; i < n - numExcluded; ++i )
+            // Have a singleton row! Its remaining entry joins the basis
+            const SparseUnsortedArray *row = constraintMatrix.getRow( singletonRow );
+            for ( unsigned i = 0; i < row->getNnz(); ++i )
             {
-                if ( !FloatUtils::isZero( constraintMatrix[rowOrdering[numTriangularRows] * n + columnOrdering[i]] ) )
+                unsigned candidate = row->getByArrayIndex( i )._index;
+                if ( columnIsActive[candidate] )
                 {
-                    temp = columnOrdering[i];
-                    columnOrdering[i] = columnOrdering[numTriangularRows];
-                    columnOrdering[numTriangularRows] = temp;
-
-                    temp = nnzInColumn[numTriangularRows];
-                    nnzInColumn[numTriangularRows] = nnzInColumn[i];
-                    nnzInColumn[i] = temp;
-
-                    DEBUG( foundNonZero = true );
+                    column = candidate;
                     break;
                 }
             }
 
-            ASSERT( foundNonZero );
-
-            // Remove all entries under the diagonal entry from the row counters
-            for ( unsigned i = numTriangularRows + 1; i < m; ++i )
-            {
-                if ( !FloatUtils::isZero( constraintMatrix[rowOrdering[i] * n + columnOrdering[numTriangularRows]] ) )
-                    --nnzInRow[i];
-            }
+            ASSERT( column < n );
 
-            ++numTriangularRows;
+            rowIsActive[singletonRow] = false;
+            initialBasis.append( column );
         }
         else
         {
             // No singleton rows. Exclude the densest column
-            unsigned maxDensity = nnzInColumn[numTriangularRows];
-            unsigned column = numTriangularRows;
+            while ( !columnIsActive[columnsByDensity[nextExclusionCandidate]] )
+                ++nextExclusionCandidate;
+            column = columnsByDensity[nextExclusionCandidate];
+        }
 
-            for ( unsigned i = numTriangularRows; i < n - numExcluded; ++i )
-            {
-                if ( nnzInColumn[i] > maxDensity )
-                {
-                    maxDensity = nnzInColumn[i];
-                    column = i;
-                }
-            }
+        // Update the row counters to account for the removed column
+        columnIsActive[column] = false;
+        --numActiveColumns;
 
-            // Update the row counters to account for the excluded column
-            for ( unsigned i = numTriangularRows; i < m; ++i )
-            {
-                double element = constraintMatrix[rowOrdering[i]*n + columnOrdering[column]];
-                if ( !FloatUtils::isZero( element ) )
-                {
-                    ASSERT( nnzInRow[i] > 1 );
-                    --nnzInRow[i];
-                }
-            }
+        const SparseUnsortedArray *entries = transposed.getRow( column );
+        for ( unsigned i = 0; i < entries->getNnz(); ++i )
+        {
+            unsigned row = entries->getByArrayIndex( i )._index;
+            if ( !rowIsActive[row] )
+                continue;
 
-            columnOrdering[column] = columnOrdering[n - 1 - numExcluded];
-            nnzInColumn[column] = nnzInColumn[n - 1 - numExcluded];
-            ++numExcluded;
+            ASSERT( singletonRow < m || nnzInRow[row] > 1 );
+            --nnzInRow[row];
+            if ( nnzInRow[row] == 1 )
+                singletonRows.append( row );
         }
     }
 
     // Final basis: diagonalized columns + non-diagonalized rows
-    List<unsigned> result;
-
-    for ( unsigned i = 0; i < numTriangularRows; ++i )
-    {
-        initialBasis.append( columnOrdering[i] );
-    }
-
-    for ( unsigned i = numTriangularRows; i < m; ++i )
+    for ( unsigned i = 0; i < m; ++i )
     {
-        basicRows.append( rowOrdering[i] );
+        if ( rowIsActive[i] )
+            basicRows.append( i );
     }
-
-    // Cleanup
-    delete[] nnzInRow;
-    delete[] nnzInColumn;
-    delete[] columnOrdering;
-    delete[] rowOrdering;
 }
 
 void Engine::addAuxiliaryVariables()
@@ -1003,7 +1059,7 @@ void Engine::augmentInitialBasisIfNeeded( List<unsigned> &initialBasis, const Li
     }
 }
 
-void Engine::initializeTableau( const double *constraintMatrix, const List<unsigned> &initialBasis )
+void Engine::initializeTableau( const SparseUnsortedArrays &constraintMatrix, const List<unsigned> &initialBasis )
 {
     const List<Equation> &equations( _preprocessedQuery.getEquations() );
     unsigned m = equations.size();
@@ -1043,8 +1099,10 @@ void Engine::initializeTableau( const double *constraintMatrix, const List<unsig
         plConstraint->registerConstraintBoundTightener( _constraintBoundTightener );
 
     _plConstraints = _preprocessedQuery.getPiecewiseLinearConstraints();
+    _plConstraintStates.clear();
     for ( const auto &constraint : _plConstraints )
     {
+        constraint->attachToStateStore( &_plConstraintStates );
         constraint->registerAsWatcher( _tableau );
         constraint->setStatistics( &_statistics );
     }
@@ -1054,6 +1112,8 @@ void Engine::initializeTableau( const double *constraintMatrix, const List<unsig
     _costFunctionManager->initialize();
     _tableau->registerCostFunctionManager( _costFunctionManager );
     _activeEntryStrategy->initialize( _tableau );
+    if ( _useDualSimplex )
+        _dualSteepestEdgeRule.initialize( _tableau );
 
     _statistics.setNumPlConstraints( _plConstraints.size() );
 }
@@ -1063,7 +1123,11 @@ void Engine::initializeNetworkLevelReasoning()
     _networkLevelReasoner = _preprocessedQuery.getNetworkLevelReasoner();
 
     if ( _networkLevelReasoner )
+    {
         _networkLevelReasoner->setTableau( _tableau );
+        _networkLevelReasoner->setThreadPool( _threadPool.get() );
+        _networkLevelReasoner->setStatistics( &_statistics );
+    }
 }
 
 bool Engine::processInputQuery( InputQuery &inputQuery, bool preprocess )
@@ -1079,12 +1143,12 @@ bool Engine::processInputQuery( InputQuery &inputQuery, bool preprocess )
         if ( _verbosity > 0 )
             printInputBounds( inputQuery );
 
-        double *constraintMatrix = createConstraintMatrix();
+        SparseUnsortedArrays constraintMatrix;
+        createConstraintMatrix( constraintMatrix );
         removeRedundantEquations( constraintMatrix );
 
         // The equations have changed, recreate the constraint matrix
-        delete[] constraintMatrix;
-        constraintMatrix = createConstraintMatrix();
+        createConstraintMatrix( constraintMatrix );
 
         List<unsigned> initialBasis;
         List<unsigned> basicRows;
@@ -1095,17 +1159,15 @@ bool Engine::processInputQuery( InputQuery &inputQuery, bool preprocess )
         storeEquationsInDegradationChecker();
 
         // The equations have changed, recreate the constraint matrix
-        delete[] constraintMatrix;
-        constraintMatrix = createConstraintMatrix();
+        createConstraintMatrix( constraintMatrix );
 
         initializeNetworkLevelReasoning();
         initializeTableau( constraintMatrix, initialBasis );
+        _initialBasis = initialBasis;
 
         if ( GlobalConfiguration::WARM_START )
             warmStart();
 
-        delete[] constraintMatrix;
-
         if ( preprocess )
         {
             performSymbolicBoundTightening();
@@ -1151,9 +1213,64 @@ bool Engine::processInputQuery( InputQuery &inputQuery, bool preprocess )
     return true;
 }
 
+bool Engine::processInputQuery( const Engine &processedEngine )
+{
+    ENGINE_LOG( "processInputQuery (from a processed engine) starting\n" );
+
+    struct timespec start = TimeUtils::sampleMicro();
+
+    try
+    {
+        // The other engine has already preprocessed the query, removed the
+        // redundant equations, added the auxiliary variables and selected
+        // an initial basis, so we only copy the results
+        _preprocessingEnabled = false;
+        _preprocessedQuery = processedEngine._preprocessedQuery;
+        _splittingStrategy = processedEngine._splittingStrategy;
+
+        // Start from the tightest bounds known to the other engine
+        for ( unsigned i = 0; i < _preprocessedQuery.getNumberOfVariables(); ++i )
+        {
+            _preprocessedQuery.setLowerBound( i, processedEngine._tableau->getLowerBound( i ) );
+            _preprocessedQuery.setUpperBound( i, processedEngine._tableau->getUpperBound( i ) );
+        }
+        informConstraintsOfInitialBounds( _preprocessedQuery );
+
+        storeEquationsInDegradationChecker();
+
+        SparseUnsortedArrays constraintMatrix;
+        createConstraintMatrix( constraintMatrix );
+
+        initializeNetworkLevelReasoning();
+        initializeTableau( constraintMatrix, processedEngine._initialBasis );
+        _initialBasis = processedEngine._initialBasis;
+
+        if ( GlobalConfiguration::WARM_START )
+            warmStart();
+
+        struct timespec end = TimeUtils::sampleMicro();
+        _statistics.setPreprocessingTime( TimeUtils::timePassed( start, end ) );
+    }
+    catch ( const InfeasibleQueryException & )
+    {
+        ENGINE_LOG( "processInputQuery (from a processed engine) done\n" );
+
+        struct timespec end = TimeUtils::sampleMicro();
+        _statistics.setPreprocessingTime( TimeUtils::timePassed( start, end ) );
+
+        _exitCode = Engine::UNSAT;
+        return false;
+    }
+
+    ENGINE_LOG( "processInputQuery (from a processed engine) done\n" );
+
+    _smtCore.storeDebuggingSolution( _preprocessedQuery._debuggingSolution );
+    return true;
+}
+
 void Engine::performMILPSolverBoundedTightening()
 {
-    if ( _networkLevelReasoner && Options::get()->gurobiEnabled() )
+    if ( _networkLevelReasoner )
     {
         _networkLevelReasoner->obtainCurrentBounds();
 
@@ -1277,35 +1394,58 @@ void Engine::restoreTableauState( const TableauState &state )
     _tableau->restoreState( state );
 }
 
-void Engine::storeState( EngineState &state, bool storeAlsoTableauState ) const
+void Engine::storeState( EngineState &state, TableauStateStorageLevel level )
 {
-    if ( storeAlsoTableauState )
-    {
+    state._stateStorageLevel = level;
+
+    if ( level == TableauStateStorageLevel::STORE_ENTIRE_TABLEAU_STATE )
         _tableau->storeState( state._tableauState );
-        state._tableauStateIsStored = true;
-    }
-    else
-        state._tableauStateIsStored = false;
+    else if ( level == TableauStateStorageLevel::STORE_TABLEAU_TRAIL )
+        state._tableauTrailLevel = _tableau->pushTrailLevel();
 
+    state._plConstraintStates = _plConstraintStates;
     for ( const auto &constraint : _plConstraints )
-        state._plConstraintToState[constraint] = constraint->duplicateConstraint();
+    {
+        if ( constraint->hasStateOutsideStore() )
+            state._plConstraintToState[constraint] = constraint->duplicateConstraint();
+    }
 
     state._numPlConstraintsDisabledByValidSplits = _numPlConstraintsDisabledByValidSplits;
 }
 
+void Engine::restorePlConstraintActivity( const EngineState &state )
+{
+    unsigned index = 0;
+    for ( auto &constraint : _plConstraints )
+    {
+        constraint->setActiveConstraint( state._plConstraintStates.isActive( index ) );
+        ++index;
+    }
+}
+
 void Engine::restoreState( const EngineState &state )
 {
     ENGINE_LOG( "Restore state starting" );
 
-    if ( !state._tableauStateIsStored )
+    if ( state._stateStorageLevel == TableauStateStorageLevel::STORE_NO_TABLEAU_STATE )
         throw MarabouError( MarabouError::RESTORING_ENGINE_FROM_INVALID_STATE );
 
     ENGINE_LOG( "\tRestoring tableau state" );
-    _tableau->restoreState( state._tableauState );
+    if ( state._stateStorageLevel == TableauStateStorageLevel::STORE_ENTIRE_TABLEAU_STATE )
+        _tableau->restoreState( state._tableauState );
+    else
+        _tableau->backtrackTrail( state._tableauTrailLevel );
 
     ENGINE_LOG( "\tRestoring constraint states" );
+    if ( state._plConstraintStates.getNumConstraints() != _plConstraintStates.getNumConstraints() )
+        throw MarabouError( MarabouError::MISSING_PL_CONSTRAINT_STATE );
+
+    _plConstraintStates = state._plConstraintStates;
     for ( auto &constraint : _plConstraints )
     {
+        if ( !constraint->hasStateOutsideStore() )
+            continue;
+
         if ( !state._plConstraintToState.exists( constraint ) )
             throw MarabouError( MarabouError::MISSING_PL_CONSTRAINT_STATE );
 
@@ -1319,6 +1459,8 @@ void Engine::restoreState( const EngineState &state )
     _constraintBoundTightener->setDimensions();
     adjustWorkMemorySize();
     _activeEntryStrategy->resizeHook( _tableau );
+    if ( _useDualSimplex )
+        _dualSteepestEdgeRule.initialize( _tableau );
     _costFunctionManager->initialize();
 
     // Reset the violation counts in the SMT core
@@ -1421,10 +1563,50 @@ bool Engine::attemptToMergeVariables( unsigned x1, unsigned x2 )
 
     // Reset the entry strategy
     _activeEntryStrategy->initialize( _tableau );
+    if ( _useDualSimplex )
+        _dualSteepestEdgeRule.initialize( _tableau );
 
     return true;
 }
 
+void Engine::addEquationsToTableau( List<Equation> &equations, List<Tightening> &bounds )
+{
+    if ( equations.empty() )
+        return;
+
+    unsigned auxVariable = _tableau->addEquations( equations );
+    _activeEntryStrategy->resizeHook( _tableau );
+    if ( _useDualSimplex )
+        _dualSteepestEdgeRule.resizeHook( _tableau );
+
+    for ( const auto &equation : equations )
+    {
+        switch ( equation._type )
+        {
+        case Equation::GE:
+            bounds.append( Tightening( auxVariable, 0.0, Tightening::UB ) );
+            break;
+
+        case Equation::LE:
+            bounds.append( Tightening( auxVariable, 0.0, Tightening::LB ) );
+            break;
+
+        case Equation::EQ:
+            bounds.append( Tightening( auxVariable, 0.0, Tightening::LB ) );
+            bounds.append( Tightening( auxVariable, 0.0, Tightening::UB ) );
+            break;
+
+        default:
+            ASSERT( false );
+            break;
+        }
+
+        ++auxVariable;
+    }
+
+    equations.clear();
+}
+
 void Engine::applySplit( const PiecewiseLinearCaseSplit &split )
 {
     ENGINE_LOG( "" );
@@ -1434,6 +1616,7 @@ void Engine::applySplit( const PiecewiseLinearCaseSplit &split )
 
     List<Tightening> bounds = split.getBoundTightenings();
     List<Equation> equations = split.getEquations();
+    List<Equation> equationsToAdd;
     for ( auto &equation : equations )
     {
         /*
@@ -1475,52 +1658,38 @@ void Engine::applySplit( const PiecewiseLinearCaseSplit &split )
           However, we also support a very common case: equations of the form
           x1 = x2, which are common, e.g., with ReLUs. For these equations we
           may be able to merge two columns of the tableau.
+
+          Equations that are added are collected and added together, so
+          that the tableau is resized and its basis refactorized once. A
+          merge changes the tableau's columns, so the equations collected
+          so far are added before attempting it.
         */
         unsigned x1, x2;
-        bool canMergeColumns =
-            // Only if the flag is on
-            GlobalConfiguration::USE_COLUMN_MERGING_EQUATIONS &&
-            // Only if the equation has the correct form
-            equation.isVariableMergingEquation( x1, x2 ) &&
-            // And only if the variables are not out of bounds
-            ( !_tableau->isBasic( x1 ) ||
-              !_tableau->basicOutOfBounds( _tableau->variableToIndex( x1 ) ) )
-            &&
-            ( !_tableau->isBasic( x2 ) ||
-              !_tableau->basicOutOfBounds( _tableau->variableToIndex( x2 ) ) );
-
         bool columnsSuccessfullyMerged = false;
-        if ( canMergeColumns )
-            columnsSuccessfullyMerged = attemptToMergeVariables( x1, x2 );
-
-        if ( !columnsSuccessfullyMerged )
+        if ( GlobalConfiguration::USE_COLUMN_MERGING_EQUATIONS &&
+             equation.isVariableMergingEquation( x1, x2 ) )
         {
-            // General case: add a new equation to the tableau
-            unsigned auxVariable = _tableau->addEquation( equation );
-            _activeEntryStrategy->resizeHook( _tableau );
-
-            switch ( equation._type )
-            {
-            case Equation::GE:
-                bounds.append( Tightening( auxVariable, 0.0, Tightening::UB ) );
-                break;
-
-            case Equation::LE:
-                bounds.append( Tightening( auxVariable, 0.0, Tightening::LB ) );
-                break;
-
-            case Equation::EQ:
-                bounds.append( Tightening( auxVariable, 0.0, Tightening::LB ) );
-                bounds.append( Tightening( auxVariable, 0.0, Tightening::UB ) );
-                break;
-
-            default:
-                ASSERT( false );
-                break;
-            }
+            addEquationsToTableau( equationsToAdd, bounds );
+
+            bool canMergeColumns =
+                // Only if the variables are not out of bounds
+                ( !_tableau->isBasic( x1 ) ||
+                  !_tableau->basicOutOfBounds( _tableau->variableToIndex( x1 ) ) )
+                &&
+                ( !_tableau->isBasic( x2 ) ||
+                  !_tableau->basicOutOfBounds( _tableau->variableToIndex( x2 ) ) );
+
+            if ( canMergeColumns )
+                columnsSuccessfullyMerged = attemptToMergeVariables( x1, x2 );
         }
+
+        if ( !columnsSuccessfullyMerged )
+            equationsToAdd.append( equation );
     }
 
+    // General case: add the remaining equations to the tableau
+    addEquationsToTableau( equationsToAdd, bounds );
+
     adjustWorkMemorySize();
 
     _rowBoundTightener->resetBounds();
@@ -1542,6 +1711,15 @@ void Engine::applySplit( const PiecewiseLinearCaseSplit &split )
         }
     }
 
+    if ( !_restoringFeasibilityAfterSplit )
+    {
+        _restoringFeasibilityAfterSplit = true;
+        _numPivotsBeforeRestoringFeasibility = _statistics.getNumTableauPivots();
+    }
+
+    if ( _useDualSimplex )
+        _dualSimplexStepsLeft = GlobalConfiguration::DUAL_SIMPLEX_MAX_STEPS_AFTER_SPLIT;
+
     DEBUG( _tableau->verifyInvariants() );
     ENGINE_LOG( "Done with split\n" );
 }
@@ -1683,6 +1861,10 @@ void Engine::explicitBasisBoundTightening()
         _rowBoundTightener->examineImplicitInvertedBasisMatrix( saturation );
         break;
 
+    case GlobalConfiguration::COMPUTE_INVERTED_BASIS_ROWS_ON_DEMAND:
+        _rowBoundTightener->examineInvertedBasisRowsOnDemand( saturation );
+        break;
+
     case GlobalConfiguration::DISABLE_EXPLICIT_BASIS_TIGHTENING:
         break;
     }
@@ -1842,6 +2024,11 @@ void Engine::performSymbolicBoundTightening()
          SymbolicBoundTighteningType::DEEP_POLY )
         _networkLevelReasoner->deepPolyPropagation();
 
+    unsigned numLayers = _networkLevelReasoner->getNumberOfLayers();
+    unsigned numReusedLayers = _networkLevelReasoner->getNumLayersReusedByLastPropagation();
+    _statistics.incNumLayersBySymbolicBoundTightening( numLayers - numReusedLayers,
+                                                       numReusedLayers );
+
     // Step 3: Extract the bounds
     List<Tightening> tightenings;
     _networkLevelReasoner->getConstraintTightenings( tightenings );
@@ -1914,6 +2101,7 @@ void Engine::clearViolatedPLConstraints()
 void Engine::resetSmtCore()
 {
     _smtCore.reset();
+    _tableau->clearTrail();
 }
 
 void Engine::resetExitCode()
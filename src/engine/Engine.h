@@ -25,6 +25,7 @@
 #include "DantzigsRule.h"
 #include "DegradationChecker.h"
 #include "DivideStrategy.h"
+#include "DualSteepestEdge.h"
 #include "SnCDivideStrategy.h"
 #include "GlobalConfiguration.h"
 #include "GurobiWrapper.h"
@@ -32,12 +33,14 @@
 #include "InputQuery.h"
 #include "Map.h"
 #include "MILPEncoder.h"
+#include "PartialPricingRule.h"
 #include "PrecisionRestorer.h"
 #include "Preprocessor.h"
 #include "SignalHandler.h"
 #include "SmtCore.h"
 #include "Statistics.h"
 #include "SymbolicBoundTighteningType.h"
+#include "ThreadPool.h"
 
 #include <atomic>
 
@@ -50,6 +53,7 @@
 class EngineState;
 class InputQuery;
 class PiecewiseLinearConstraint;
+class SparseUnsortedArrays;
 class String;
 
 class Engine : public IEngine, public SignalHandler::Signalable
@@ -72,6 +76,15 @@ public:
     bool processInputQuery( InputQuery &inputQuery );
     bool processInputQuery( InputQuery &inputQuery, bool preprocess );
 
+    /*
+      Initialize this engine from an engine that has already processed
+      its input query: the preprocessed query, the bounds derived so far
+      and the initial basis are taken from the other engine instead of
+      being recomputed. The network weights are shared with the other
+      engine. Return false if the query is found to be infeasible.
+     */
+    bool processInputQuery( const Engine &processedEngine );
+
     /*
       If the query is feasiable and has been successfully solved, this
       method can be used to extract the solution.
@@ -83,8 +96,9 @@ public:
     */
     void storeTableauState( TableauState &state ) const;
     void restoreTableauState( const TableauState &state );
-    void storeState( EngineState &state, bool storeAlsoTableauState ) const;
+    void storeState( EngineState &state, TableauStateStorageLevel level );
     void restoreState( const EngineState &state );
+    void restorePlConstraintActivity( const EngineState &state );
     void setNumPlConstraintsDisabledByValidSplits( unsigned numConstraints );
 
     /*
@@ -202,6 +216,13 @@ private:
     */
     List<PiecewiseLinearConstraint *> _plConstraints;
 
+    /*
+      The state of the piecewise-linear constraints, kept contiguously
+      so that it can be stored and restored quickly. The i'th
+      constraint in _plConstraints has index i in the store.
+    */
+    ConstraintStateStore _plConstraintStates;
+
     /*
       Piecewise linear constraints that are currently violated.
     */
@@ -217,11 +238,17 @@ private:
 	*/
 	InputQuery _preprocessedQuery;
 
+    /*
+      The initial basis that the tableau was initialized with
+    */
+    List<unsigned> _initialBasis;
+
     /*
       Pivot selection strategies.
     */
     BlandsRule _blandsRule;
     DantzigsRule _dantzigsRule;
+    PartialPricingRule _partialPricingRule;
     AutoProjectedSteepestEdgeRule _projectedSteepestEdgeRule;
     EntrySelectionStrategy *_activeEntryStrategy;
 
@@ -349,6 +376,24 @@ private:
     */
     bool _solveWithMILP;
 
+    /*
+      Dual simplex mode: after a split, feasibility is first restored
+      using dual simplex steps, up to a fixed number of steps. The
+      leaving variables are picked by the dual steepest edge rule, and
+      the entering variables by the selected dual ratio test.
+    */
+    bool _useDualSimplex;
+    DualRatioTestType _dualRatioTestType;
+    unsigned _dualSimplexStepsLeft;
+    DualSteepestEdgeRule _dualSteepestEdgeRule;
+
+    /*
+      For collecting statistics on the number of pivots it takes to
+      restore feasibility after a split
+    */
+    bool _restoringFeasibilityAfterSplit;
+    unsigned long long _numPivotsBeforeRestoringFeasibility;
+
     /*
       GurobiWrapper object
     */
@@ -359,12 +404,32 @@ private:
     */
     std::unique_ptr<MILPEncoder> _milpEncoder;
 
+    /*
+      Threads shared by the bound tightening passes, if more than one
+      thread was requested
+    */
+    std::unique_ptr<ThreadPool> _threadPool;
+
     /*
       Perform a simplex step: compute the cost function, pick the
       entering and leaving variables and perform a pivot.
     */
     void performSimplexStep();
 
+    /*
+      Perform a dual simplex step: pick an out-of-bounds basic variable
+      as the leaving variable, pick the entering variable using the
+      dual ratio test, and perform a pivot. Return false if no step
+      could be performed.
+    */
+    bool performDualSimplexStep();
+
+    /*
+      Record that feasibility has been restored after a split, for
+      statistics, and end the dual simplex phase.
+    */
+    void feasibilityRestored();
+
     /*
       Perform a constraint-fixing step: select a violated piece-wise
       linear constraint and attempt to fix it.
@@ -468,6 +533,12 @@ private:
     */
     bool attemptToMergeVariables( unsigned x1, unsigned x2 );
 
+    /*
+      Add a batch of equations from a split to the tableau, and record
+      the bounds of their auxiliary variables. The batch is cleared.
+    */
+    void addEquationsToTableau( List<Equation> &equations, List<Tightening> &bounds );
+
     void performDeepPolyAnalysis();
 
     /*
@@ -501,11 +572,11 @@ private:
     void invokePreprocessor( const InputQuery &inputQuery, bool preprocess );
     void printInputBounds( const InputQuery &inputQuery ) const;
     void storeEquationsInDegradationChecker();
-    void removeRedundantEquations( const double *constraintMatrix );
-    void selectInitialVariablesForBasis( const double *constraintMatrix, List<unsigned> &initialBasis, List<unsigned> &basicRows );
-    void initializeTableau( const double *constraintMatrix, const List<unsigned> &initialBasis );
+    void removeRedundantEquations( const SparseUnsortedArrays &constraintMatrix );
+    void selectInitialVariablesForBasis( const SparseUnsortedArrays &constraintMatrix, List<unsigned> &initialBasis, List<unsigned> &basicRows );
+    void initializeTableau( const SparseUnsortedArrays &constraintMatrix, const List<unsigned> &initialBasis );
     void initializeNetworkLevelReasoning();
-    double *createConstraintMatrix();
+    void createConstraintMatrix( SparseUnsortedArrays &constraintMatrix );
     void addAuxiliaryVariables();
     void augmentInitialBasisIfNeeded( List<unsigned> &initialBasis, const List<unsigned> &basicRows );
     void performMILPSolverBoundedTightening();
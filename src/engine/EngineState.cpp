@@ -16,6 +16,10 @@
 #include "EngineState.h"
 
 EngineState::EngineState()
+    : _stateStorageLevel( TableauStateStorageLevel::STORE_NO_TABLEAU_STATE )
+    , _tableauTrailLevel( 0 )
+    , _numPlConstraintsDisabledByValidSplits( 0 )
+    , _stateId( 0 )
 {
 }
 
@@ -16,10 +16,12 @@
 #ifndef __EngineState_h__
 #define __EngineState_h__
 
+#include "ConstraintStateStore.h"
 #include "List.h"
 #include "Map.h"
 #include "PiecewiseLinearConstraint.h"
 #include "TableauState.h"
+#include "TableauStateStorageLevel.h"
 
 class EngineState
 {
@@ -28,14 +30,20 @@ public:
     ~EngineState();
 
     /*
-      The state of the tableau
+      The state of the tableau. Depending on the storage level, this
+      is either a complete copy of the tableau, or the level opened on
+      the tableau's trail when the state was stored.
     */
-    bool _tableauStateIsStored;
+    TableauStateStorageLevel _stateStorageLevel;
     TableauState _tableauState;
+    unsigned _tableauTrailLevel;
 
     /*
-      The state of each of the PL constraints
+      The state of the PL constraints: a copy of the engine's
+      constraint state store, and clones of the constraints whose
+      state is not entirely kept in that store
     */
+    ConstraintStateStore _plConstraintStates;
     Map<PiecewiseLinearConstraint *, PiecewiseLinearConstraint *> _plConstraintToState;
     unsigned _numPlConstraintsDisabledByValidSplits;
 
@@ -58,6 +58,13 @@ public:
     */
     virtual void resizeHook( const ITableau &/* tableau */ ) {};
 
+    /*
+      Whether select() needs the list of all the eligible candidates.
+      Strategies that keep track of their own candidates return false,
+      and the engine then passes an empty list.
+    */
+    virtual bool needsEntryCandidates() const { return true; };
+
     /*
       For reporting statistics
     */
@@ -18,6 +18,7 @@
 
 #include "DivideStrategy.h"
 #include "SnCDivideStrategy.h"
+#include "TableauStateStorageLevel.h"
 #include "List.h"
 
 #ifdef _WIN32
@@ -53,8 +54,14 @@ public:
     /*
       Methods for storing and restoring the state of the engine.
     */
-    virtual void storeState( EngineState &state, bool storeAlsoTableauState ) const = 0;
+    virtual void storeState( EngineState &state, TableauStateStorageLevel level ) = 0;
     virtual void restoreState( const EngineState &state ) = 0;
+
+    /*
+      Restore only whether each PL constraint is active, from a stored
+      state.
+    */
+    virtual void restorePlConstraintActivity( const EngineState &state ) = 0;
     virtual void setNumPlConstraintsDisabledByValidSplits( unsigned numConstraints ) = 0;
 
     /*
@@ -56,6 +56,14 @@ public:
     */
     virtual void examineImplicitInvertedBasisMatrix( bool untilSaturation ) = 0;
 
+    /*
+      Derive and enqueue new bounds for all varaibles, using the rows of
+      inv(B0) * A. The rows are computed one at a time, via a BTRAN of a
+      unit vector, and are not stored. Rows that cannot lead to tighter
+      bounds are skipped. Can also do this until saturation.
+    */
+    virtual void examineInvertedBasisRowsOnDemand( bool untilSaturation ) = 0;
+
     /*
       Derive and enqueue new bounds for all varaibles, using the
       original constraint matrix A and right hands side vector b. Can
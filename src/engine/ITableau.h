@@ -16,7 +16,9 @@
 #ifndef __ITableau_h__
 #define __ITableau_h__
 
+#include "DualRatioTestType.h"
 #include "List.h"
+#include "PrimalRatioTestType.h"
 #include "Set.h"
 
 class EntrySelectionStrategy;
@@ -24,6 +26,7 @@ class Equation;
 class ICostFunctionManager;
 class PiecewiseLinearCaseSplit;
 class SparseMatrix;
+class SparseUnsortedArrays;
 class SparseUnsortedList;
 class SparseVector;
 class Statistics;
@@ -95,6 +98,7 @@ public:
 
     virtual void setDimensions( unsigned m, unsigned n ) = 0;
     virtual void setConstraintMatrix( const double *A ) = 0;
+    virtual void setConstraintMatrix( const SparseUnsortedArrays &A ) = 0;
     virtual void setRightHandSide( const double *b ) = 0;
     virtual void setRightHandSide( unsigned index, double value ) = 0;
     virtual void markAsBasic( unsigned variable ) = 0;
@@ -122,6 +126,8 @@ public:
     virtual unsigned getEnteringVariableIndex() const = 0;
     virtual void pickLeavingVariable() = 0;
     virtual void pickLeavingVariable( double *d ) = 0;
+    virtual void setPrimalRatioTestType( PrimalRatioTestType type ) = 0;
+    virtual bool dualRatioTest( DualRatioTestType type ) = 0;
     virtual unsigned getLeavingVariable() const = 0;
     virtual unsigned getLeavingVariableIndex() const = 0;
     virtual double getChangeRatio() const = 0;
@@ -149,10 +155,11 @@ public:
     virtual void assignIndexToBasicVariable( unsigned variable, unsigned index ) = 0;
     virtual unsigned variableToIndex( unsigned index ) const = 0;
     virtual unsigned addEquation( const Equation &equation ) = 0;
+    virtual unsigned addEquations( const List<Equation> &equations ) = 0;
     virtual unsigned getM() const = 0;
     virtual unsigned getN() const = 0;
     virtual void getTableauRow( unsigned index, TableauRow *row ) = 0;
-    virtual const double *getAColumn( unsigned variable ) const = 0;
+    virtual void getAColumn( unsigned variable, double *result ) const = 0;
     virtual void getSparseAColumn( unsigned variable, SparseUnsortedList *result ) const = 0;
     virtual void getSparseARow( unsigned row, SparseUnsortedList *result ) const = 0;
     virtual const SparseUnsortedList *getSparseAColumn( unsigned variable ) const = 0;
@@ -161,10 +168,14 @@ public:
     virtual void performDegeneratePivot() = 0;
     virtual void storeState( TableauState &state ) const = 0;
     virtual void restoreState( const TableauState &state ) = 0;
+    virtual unsigned pushTrailLevel() = 0;
+    virtual void backtrackTrail( unsigned level ) = 0;
+    virtual void clearTrail() = 0;
     virtual void setStatistics( Statistics *statistics ) = 0;
     virtual const double *getRightHandSide() const = 0;
     virtual void forwardTransformation( const double *y, double *x ) const = 0;
     virtual void backwardTransformation( const double *y, double *x ) const = 0;
+    virtual void sparseBackwardTransformation( const SparseUnsortedList &y, double *x ) const = 0;
     virtual double getSumOfInfeasibilities() const = 0;
     virtual BasicAssignmentStatus getBasicAssignmentStatus() const = 0;
     virtual double getBasicAssignment( unsigned basicIndex ) const = 0;
@@ -604,7 +604,8 @@ bool InputQuery::constructNetworkLevelReasoner()
     INPUT_QUERY_LOG( "PP: constructing an NLR... " );
 
     if ( _networkLevelReasoner )
-        delete _networkLevelReasoner;
+        return extendNetworkLevelReasoner();
+
     NLR::NetworkLevelReasoner *nlr = new NLR::NetworkLevelReasoner;
 
     Map<unsigned, unsigned> handledVariableToLayer;
@@ -664,6 +665,45 @@ bool InputQuery::constructNetworkLevelReasoner()
     return success;
 }
 
+bool InputQuery::extendNetworkLevelReasoner()
+{
+    NLR::NetworkLevelReasoner *nlr = _networkLevelReasoner;
+    Map<unsigned, unsigned> handledVariableToLayer;
+
+    // All the neurons of the existing layers have been handled. Update
+    // their bounds, which may have changed since the layers were built
+    unsigned numberOfLayers = nlr->getNumberOfLayers();
+    for ( unsigned i = 0; i < numberOfLayers; ++i )
+    {
+        NLR::Layer *layer = nlr->getLayer( i );
+        for ( unsigned j = 0; j < layer->getSize(); ++j )
+        {
+            unsigned variable = layer->neuronToVariable( j );
+            handledVariableToLayer[variable] = i;
+
+            layer->setLb( j, getLowerBound( variable ) );
+            layer->setUb( j, getUpperBound( variable ) );
+        }
+    }
+
+    unsigned newLayerIndex = numberOfLayers;
+    while ( constructWeighedSumLayer( nlr, handledVariableToLayer, newLayerIndex ) ||
+            constructReluLayer( nlr, handledVariableToLayer, newLayerIndex ) ||
+            constructAbsoluteValueLayer( nlr, handledVariableToLayer, newLayerIndex ) ||
+            constructSignLayer( nlr, handledVariableToLayer, newLayerIndex ) ||
+            constructMaxLayer( nlr, handledVariableToLayer, newLayerIndex )
+            )
+    {
+        ++newLayerIndex;
+    }
+
+    INPUT_QUERY_LOG( Stringf( "successful. Extended the existing %u layers with %u layers\n",
+                              numberOfLayers,
+                              newLayerIndex - numberOfLayers ).ascii() );
+
+    return true;
+}
+
 bool InputQuery::constructWeighedSumLayer( NLR::NetworkLevelReasoner *nlr,
                                            Map<unsigned, unsigned> &handledVariableToLayer,
                                            unsigned newLayerIndex )
@@ -124,7 +124,12 @@ public:
     /*
       Attempt to figure out the network topology and construct a
       network level reasoner. Return true iff the construction was
-      successful
+      successful.
+
+      If the query already has a network level reasoner (e.g., one
+      handed over by the parser), it is kept, and only extended with
+      neurons for equations and constraints that it does not cover
+      (e.g., those added by a property file).
     */
     bool constructNetworkLevelReasoner();
 
@@ -151,6 +156,7 @@ private:
     /*
       Methods called by constructNetworkLevelReasoner
     */
+    bool extendNetworkLevelReasoner();
     bool constructWeighedSumLayer( NLR::NetworkLevelReasoner *nlr,
                                    Map<unsigned, unsigned> &handledVariableToLayer,
                                    unsigned newLayerIndex );
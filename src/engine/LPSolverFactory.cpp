@@ -0,0 +1,35 @@
+/*********************                                                        */
+/*! \file LPSolverFactory.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "GurobiWrapper.h"
+#include "LPSolverFactory.h"
+#include "NativeLPSolver.h"
+#include "Options.h"
+
+ILPSolver *LPSolverFactory::createLPSolver()
+{
+    if ( Options::get()->getLPSolverType() == LPSolverType::GUROBI )
+        return new GurobiWrapper();
+
+    return new NativeLPSolver();
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
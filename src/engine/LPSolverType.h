@@ -0,0 +1,30 @@
+/*********************                                                        */
+/*! \file LPSolverType.h
+** \verbatim
+** Top contributors (to current version):
+**   Guy Katz
+** This file is part of the Marabou project.
+** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved. See the file COPYING in the top-level source
+** directory for licensing information.\endverbatim
+**
+** [[ Add lengthier description here ]]
+
+**/
+
+#ifndef __LPSolverType_h__
+#define __LPSolverType_h__
+
+/*
+  The LP solver used for LP/MILP-based bound tightening
+*/
+enum class LPSolverType
+{
+     // Marabou's own simplex-based LP solver
+     NATIVE = 0,
+     // Gurobi, if Marabou is compiled with it
+     GUROBI = 1,
+};
+
+#endif // __LPSolverType_h__
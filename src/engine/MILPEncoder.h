@@ -16,7 +16,7 @@
 #ifndef __MILPEncoder_h__
 #define __MILPEncoder_h__
 
-#include "GurobiWrapper.h"
+#include "ILPSolver.h"
 #include "InputQuery.h"
 #include "ITableau.h"
 #include "MStringf.h"
@@ -32,7 +32,7 @@ public:
       Encode the input query as a Gurobi query, variables and inequalities
       are from inputQuery, and latest variable bounds are from tableau
     */
-    void encodeInputQuery( GurobiWrapper &gurobi, const InputQuery &inputQuery );
+    void encodeInputQuery( ILPSolver &gurobi, const InputQuery &inputQuery );
 
     /*
       get variable name from a variable in the encoded inputquery
@@ -59,7 +59,7 @@ private:
     /*
       Encode an (in)equality into Gurobi.
     */
-    void encodeEquation( GurobiWrapper &gurobi, const Equation &Equation );
+    void encodeEquation( ILPSolver &gurobi, const Equation &Equation );
 
     /*
       Encode a ReLU constraint f = ReLU(b) into Gurobi using the same encoding in
@@ -74,7 +74,7 @@ private:
       The other two constraints f >= b and f >= 0 are encoded already when
       preprocessing
     */
-    void encodeReLUConstraint( GurobiWrapper &gurobi, ReluConstraint *relu );
+    void encodeReLUConstraint( ILPSolver &gurobi, ReluConstraint *relu );
 
     /*
       Encode a MAX constraint y = max(x_1, x_2, ... ,x_m) into Gurobi using the same encoding in
@@ -86,7 +86,7 @@ private:
       a_1 + a_2 + ... + a_m = 1
       a_i \in {0, 1} (i = 1 ~ m)
     */
-    void encodeMaxConstraint( GurobiWrapper &gurobi, MaxConstraint *max );
+    void encodeMaxConstraint( ILPSolver &gurobi, MaxConstraint *max );
 };
 
 #endif // __MILPEncoder_h__
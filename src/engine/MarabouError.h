@@ -53,6 +53,8 @@ public:
         FILE_DOES_NOT_EXIST = 100,
         INVALID_EQUATION_TYPE = 101,
         UNSUPPORTED_PIECEWISE_LINEAR_CONSTRAINT = 102,
+        INVALID_BINARY_QUERY = 103,
+        UNSUPPORTED_BINARY_QUERY_VERSION = 104,
 
         FEATURE_NOT_YET_SUPPORTED = 900,
 
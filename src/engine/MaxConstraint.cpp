@@ -106,12 +106,12 @@ void MaxConstraint::notifyVariableValue( unsigned variable, double value )
 {
     if ( ( _elements.exists( _f ) || variable != _f )
          &&
-         ( !_maxIndexSet || _assignment.get( _maxIndex ) < value ) )
+         ( !_maxIndexSet || getAssignment( _maxIndex ) < value ) )
     {
         _maxIndex = variable;
         _maxIndexSet = true;
     }
-    _assignment[variable] = value;
+    setAssignment( variable, value );
 }
 
 void MaxConstraint::notifyLowerBound( unsigned variable, double value )
@@ -119,10 +119,10 @@ void MaxConstraint::notifyLowerBound( unsigned variable, double value )
     if ( _statistics )
         _statistics->incNumBoundNotificationsPlConstraints();
 
-    if ( _lowerBounds.exists( variable ) && !FloatUtils::gt( value, _lowerBounds[variable] ) )
+    if ( existsLowerBound( variable ) && !FloatUtils::gt( value, getLowerBound( variable ) ) )
         return;
 
-    _lowerBounds[variable] = value;
+    setLowerBound( variable, value );
 
     bool maxErased = false;
 
@@ -134,8 +134,8 @@ void MaxConstraint::notifyLowerBound( unsigned variable, double value )
         {
 			if ( element == variable || element == _f )
 				continue;
-            if ( _upperBounds.exists( element ) &&
-                 FloatUtils::lt( _upperBounds[element], value ) )
+            if ( existsUpperBound( element ) &&
+                 FloatUtils::lt( getUpperBound( element ), value ) )
             {
                 toRemove.append( element );
             }
@@ -172,10 +172,10 @@ void MaxConstraint::notifyUpperBound( unsigned variable, double value )
     if ( _statistics )
         _statistics->incNumBoundNotificationsPlConstraints();
 
-    if ( _upperBounds.exists( variable ) && !FloatUtils::lt( value, _upperBounds[variable] ) )
+    if ( existsUpperBound( variable ) && !FloatUtils::lt( value, getUpperBound( variable ) ) )
         return;
 
-    _upperBounds[variable] = value;
+    setUpperBound( variable, value );
 
     if ( _elements.exists( variable ) && _f != variable && FloatUtils::lt( value, _maxLowerBound ) )
     {
@@ -203,8 +203,8 @@ void MaxConstraint::notifyUpperBound( unsigned variable, double value )
 void MaxConstraint::getEntailedTightenings( List<Tightening> &tightenings ) const
 {
     // Lower and upper bounds for the f variable
-    double fLB = _lowerBounds.exists( _f ) ? _lowerBounds.get( _f ) : FloatUtils::negativeInfinity();
-    double fUB = _upperBounds.exists( _f ) ? _upperBounds.get( _f ) : FloatUtils::infinity();
+    double fLB = existsLowerBound( _f ) ? getLowerBound( _f ) : FloatUtils::negativeInfinity();
+    double fUB = existsUpperBound( _f ) ? getUpperBound( _f ) : FloatUtils::infinity();
 
     // Compute the maximal bounds (lower and upper) for the elements
     double maxElementLB = FloatUtils::negativeInfinity();
@@ -212,13 +212,13 @@ void MaxConstraint::getEntailedTightenings( List<Tightening> &tightenings ) cons
 
     for ( const auto &element : _elements )
     {
-        if ( _lowerBounds.exists( element ) )
-            maxElementLB = FloatUtils::max( _lowerBounds[element], maxElementLB );
+        if ( existsLowerBound( element ) )
+            maxElementLB = FloatUtils::max( getLowerBound( element ), maxElementLB );
 
-        if ( !_upperBounds.exists( element ) )
+        if ( !existsUpperBound( element ) )
             maxElementUB = FloatUtils::infinity();
         else
-            maxElementUB = FloatUtils::max( _upperBounds[element], maxElementUB );
+            maxElementUB = FloatUtils::max( getUpperBound( element ), maxElementUB );
 	}
 
     // fUB and maxElementUB need to be equal. If not, the lower of the two wins.
@@ -232,7 +232,7 @@ void MaxConstraint::getEntailedTightenings( List<Tightening> &tightenings ) cons
 		{
 		    for ( const auto &element : _elements )
 			{
-			    if ( !_upperBounds.exists( element ) || FloatUtils::gt( _upperBounds[element], fUB ) )
+			    if ( !existsUpperBound( element ) || FloatUtils::gt( getUpperBound( element ), fUB ) )
                     tightenings.append( Tightening( element, fUB, Tightening::UB ) );
 			}
 		}
@@ -282,11 +282,11 @@ unsigned MaxConstraint::getF() const
 
 bool MaxConstraint::satisfied() const
 {
-    if ( !( _assignment.exists( _f ) && _assignment.size() > 1 ) )
+    if ( !( existsAssignment( _f ) && numAssignedVariables() > 1 ) )
         throw MarabouError( MarabouError::PARTICIPATING_VARIABLES_ABSENT );
 
-    double fValue = _assignment.get( _f );
-    return FloatUtils::areEqual( _assignment.get( _maxIndex ), fValue );
+    double fValue = getAssignment( _f );
+    return FloatUtils::areEqual( getAssignment( _maxIndex ), fValue );
 }
 
 void MaxConstraint::resetMaxIndex()
@@ -294,8 +294,8 @@ void MaxConstraint::resetMaxIndex()
     double maxValue = FloatUtils::negativeInfinity();
     _maxIndexSet = false;
 
-    if ( _assignment.empty() ||
-         ( _assignment.size() == 1 && !_elements.exists( _f ) && _assignment.begin()->first == _f ) )
+    if ( numAssignedVariables() == 0 ||
+         ( numAssignedVariables() == 1 && !_elements.exists( _f ) && existsAssignment( _f ) ) )
     {
         // If none of the variables has been assigned, the max index is
         // not set
@@ -305,9 +305,9 @@ void MaxConstraint::resetMaxIndex()
     {
         for ( auto element : _elements )
         {
-            if ( _assignment.exists( element ) )
+            if ( existsAssignment( element ) )
             {
-                double elementValue = _assignment[element];
+                double elementValue = getAssignment( element );
 
                 if ( !_maxIndexSet )
                 {
@@ -332,10 +332,10 @@ void MaxConstraint::resetMaxIndex()
 List<PiecewiseLinearConstraint::Fix> MaxConstraint::getPossibleFixes() const
 {
     ASSERT( !satisfied() );
-    ASSERT( _assignment.exists( _f ) && _assignment.size() > 1 );
+    ASSERT( existsAssignment( _f ) && numAssignedVariables() > 1 );
 
-    double fValue = _assignment.get( _f );
-    double maxVal = _assignment.get( _maxIndex );
+    double fValue = getAssignment( _f );
+    double maxVal = getAssignment( _maxIndex );
 
     List<PiecewiseLinearConstraint::Fix> fixes;
 
@@ -360,7 +360,7 @@ List<PiecewiseLinearConstraint::Fix> MaxConstraint::getPossibleFixes() const
         unsigned numGreater = 0;
         for ( auto elem : _elements )
         {
-            if ( _assignment.exists( elem ) && FloatUtils::gt( _assignment[elem], fValue ) )
+            if ( existsAssignment( elem ) && FloatUtils::gt( getAssignment( elem ), fValue ) )
             {
                 numGreater++;
                 greaterVar = elem;
@@ -378,7 +378,7 @@ List<PiecewiseLinearConstraint::Fix> MaxConstraint::getPossibleFixes() const
 List<PiecewiseLinearConstraint::Fix> MaxConstraint::getSmartFixes( ITableau * ) const
 {
     ASSERT( !satisfied() );
-    ASSERT( _assignment.exists( _f ) && _assignment.size() > 1 );
+    ASSERT( existsAssignment( _f ) && numAssignedVariables() > 1 );
 
     // TODO
     return getPossibleFixes();
@@ -389,7 +389,7 @@ List<PiecewiseLinearCaseSplit> MaxConstraint::getCaseSplits() const
     if ( phaseFixed() && !_elements.exists( _f ) )
         throw MarabouError( MarabouError::REQUESTED_CASE_SPLITS_FROM_FIXED_CONSTRAINT );
 
-    ASSERT(	_assignment.exists( _f ) );
+    ASSERT(	existsAssignment( _f ) );
 
     List<PiecewiseLinearCaseSplit> splits;
 
@@ -432,7 +432,7 @@ PiecewiseLinearCaseSplit MaxConstraint::getValidCaseSplit() const
 
 PiecewiseLinearCaseSplit MaxConstraint::getSplit( unsigned argMax ) const
 {
-    ASSERT( _assignment.exists( argMax ) );
+    ASSERT( existsAssignment( argMax ) );
     PiecewiseLinearCaseSplit maxPhase;
 
     if ( argMax != _f )
@@ -461,11 +461,11 @@ PiecewiseLinearCaseSplit MaxConstraint::getSplit( unsigned argMax ) const
         gtEquation.setScalar( 0 );
         maxPhase.addEquation( gtEquation );
 
-        if ( _upperBounds.exists( argMax ) )
+        if ( existsUpperBound( argMax ) )
         {
-            if ( !_upperBounds.exists( other ) ||
-                FloatUtils::gt( _upperBounds[other], _upperBounds[argMax] ) )
-                maxPhase.storeBoundTightening( Tightening( other, _upperBounds[argMax], Tightening::UB ) );
+            if ( !existsUpperBound( other ) ||
+                FloatUtils::gt( getUpperBound( other ), getUpperBound( argMax ) ) )
+                maxPhase.storeBoundTightening( Tightening( other, getUpperBound( argMax ), Tightening::UB ) );
         }
     }
 
@@ -474,8 +474,7 @@ PiecewiseLinearCaseSplit MaxConstraint::getSplit( unsigned argMax ) const
 
 void MaxConstraint::updateVariableIndex( unsigned oldIndex, unsigned newIndex )
 {
-    _lowerBounds[newIndex] = _lowerBounds[oldIndex];
-    _upperBounds[newIndex] = _upperBounds[oldIndex];
+    renameVariableValues( oldIndex, newIndex );
 
     if ( oldIndex == _f )
         _f = newIndex;
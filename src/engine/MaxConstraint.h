@@ -46,6 +46,15 @@ class MaxConstraint : public PiecewiseLinearConstraint
     */
     void restoreState( const PiecewiseLinearConstraint *state );
 
+    /*
+      The set of elements that can still be the maximum, and the
+      current maximal element, are not kept in the state store.
+    */
+    bool hasStateOutsideStore() const
+    {
+        return true;
+    }
+
     /*
       Register/unregister the constraint with a talbeau.
     */
@@ -0,0 +1,1012 @@
+/*********************                                                        */
+/*! \file NativeLPSolver.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "BasisFactorizationFactory.h"
+#include "Debug.h"
+#include "File.h"
+#include "FloatUtils.h"
+#include "GlobalConfiguration.h"
+#include "MStringf.h"
+#include "MalformedBasisException.h"
+#include "MarabouError.h"
+#include "NativeLPSolver.h"
+#include "Options.h"
+#include "SparseColumnsOfBasis.h"
+#include "TimeUtils.h"
+
+NativeLPSolver::NativeLPSolver()
+    : _columnsUpToDate( true )
+    , _m( 0 )
+    , _factorization( NULL )
+    , _factorizationSize( 0 )
+    , _maximize( false )
+    , _perturbed( false )
+    , _cutoffInUse( false )
+    , _cutoffValue( 0 )
+    , _timeoutInSeconds( Options::get()->getFloat( Options::MILP_SOLVER_TIMEOUT ) )
+    , _status( UNSOLVED )
+    , _objectiveValue( 0 )
+    , _numIterations( 0 )
+    , _basicCosts( NULL )
+    , _multipliers( NULL )
+    , _changeColumn( NULL )
+    , _denseColumn( NULL )
+    , _rhs( NULL )
+    , _workMemorySize( 0 )
+{
+}
+
+NativeLPSolver::~NativeLPSolver()
+{
+    resetModel();
+}
+
+void NativeLPSolver::resetModel()
+{
+    freeColumns();
+    freeWorkMemory();
+
+    if ( _factorization )
+    {
+        delete _factorization;
+        _factorization = NULL;
+    }
+    _factorizationSize = 0;
+
+    _nameToVariable.clear();
+    _variableNames.clear();
+    _rowToSlack.clear();
+    _lowerBounds.clear();
+    _upperBounds.clear();
+    _assignment.clear();
+    _originalLowerBounds.clear();
+    _originalUpperBounds.clear();
+    _perturbed = false;
+    _columnEntries.clear();
+    _columnsUpToDate = true;
+    _m = 0;
+
+    _basicIndexToVariable.clear();
+    _variableToBasicIndex.clear();
+
+    _cost.clear();
+    _maximize = false;
+    _cutoffInUse = false;
+
+    reset();
+}
+
+void NativeLPSolver::reset()
+{
+    _status = UNSOLVED;
+    _objectiveValue = 0;
+    _numIterations = 0;
+}
+
+void NativeLPSolver::addVariable( String name, double lb, double ub, VariableType type )
+{
+    ASSERT( !_nameToVariable.exists( name ) );
+
+    if ( type == BINARY )
+    {
+        lb = FloatUtils::max( lb, 0 );
+        ub = FloatUtils::min( ub, 1 );
+    }
+
+    unsigned variable = _variableNames.size();
+    _nameToVariable[name] = variable;
+    _variableNames.append( name );
+    _lowerBounds.append( lb );
+    _upperBounds.append( ub );
+    _assignment.append( 0 );
+    _columnEntries.append( List<SparseUnsortedList::Entry>() );
+    _variableToBasicIndex.append( -1 );
+    _cost.append( 0 );
+
+    _columnsUpToDate = false;
+}
+
+unsigned NativeLPSolver::getVariable( const String &name ) const
+{
+    if ( !_nameToVariable.exists( name ) )
+        throw MarabouError( MarabouError::VARIABLE_DOESNT_EXIST_IN_SOLUTION,
+                            Stringf( "NativeLPSolver: unknown variable %s",
+                                     name.ascii() ).ascii() );
+    return _nameToVariable[name];
+}
+
+void NativeLPSolver::setLowerBound( String name, double lb )
+{
+    _lowerBounds[getVariable( name )] = lb;
+}
+
+void NativeLPSolver::setUpperBound( String name, double ub )
+{
+    _upperBounds[getVariable( name )] = ub;
+}
+
+void NativeLPSolver::addLeqConstraint( const List<Term> &terms, double scalar )
+{
+    addConstraint( terms, FloatUtils::negativeInfinity(), scalar );
+}
+
+void NativeLPSolver::addGeqConstraint( const List<Term> &terms, double scalar )
+{
+    addConstraint( terms, scalar, FloatUtils::infinity() );
+}
+
+void NativeLPSolver::addEqConstraint( const List<Term> &terms, double scalar )
+{
+    addConstraint( terms, scalar, scalar );
+}
+
+void NativeLPSolver::addConstraint( const List<Term> &terms, double lb, double ub )
+{
+    unsigned row = _m;
+
+    // Merge repeated variables
+    Map<unsigned, double> coefficients;
+    for ( const auto &term : terms )
+    {
+        unsigned variable = getVariable( term._variable );
+        if ( !coefficients.exists( variable ) )
+            coefficients[variable] = 0;
+        coefficients[variable] += term._coefficient;
+    }
+
+    for ( const auto &coefficient : coefficients )
+    {
+        if ( coefficient.second != 0 )
+            _columnEntries[coefficient.first].append
+                ( SparseUnsortedList::Entry( row, coefficient.second ) );
+    }
+
+    // The slack variable: sum - slack = 0, with the slack within the bounds
+    unsigned slack = _variableNames.size();
+    _variableNames.append( "" );
+    _rowToSlack.append( slack );
+    _lowerBounds.append( lb );
+    _upperBounds.append( ub );
+    _assignment.append( 0 );
+    _columnEntries.append( List<SparseUnsortedList::Entry>() );
+    _columnEntries[slack].append( SparseUnsortedList::Entry( row, -1 ) );
+    _cost.append( 0 );
+
+    // The slack variable joins the basis
+    _variableToBasicIndex.append( row );
+    _basicIndexToVariable.append( slack );
+
+    ++_m;
+    _columnsUpToDate = false;
+}
+
+void NativeLPSolver::setCost( const List<Term> &terms )
+{
+    setCostFunction( terms, false );
+}
+
+void NativeLPSolver::setObjective( const List<Term> &terms )
+{
+    setCostFunction( terms, true );
+}
+
+void NativeLPSolver::setCostFunction( const List<Term> &terms, bool maximize )
+{
+    _maximize = maximize;
+    std::fill( _cost.begin(), _cost.end(), 0 );
+
+    for ( const auto &term : terms )
+        _cost[getVariable( term._variable )] +=
+            maximize ? -term._coefficient : term._coefficient;
+}
+
+void NativeLPSolver::setCutoff( double cutoff )
+{
+    _cutoffInUse = true;
+    _cutoffValue = cutoff;
+}
+
+void NativeLPSolver::setTimeLimit( double seconds )
+{
+    _timeoutInSeconds = seconds;
+}
+
+bool NativeLPSolver::optimal()
+{
+    return _status == OPTIMAL;
+}
+
+bool NativeLPSolver::cutoffOccurred()
+{
+    return _status == CUTOFF;
+}
+
+bool NativeLPSolver::infeasbile()
+{
+    return _status == INFEASIBLE;
+}
+
+bool NativeLPSolver::timeout()
+{
+    return _status == TIMEOUT;
+}
+
+bool NativeLPSolver::haveFeasibleSolution()
+{
+    return _status == OPTIMAL;
+}
+
+unsigned NativeLPSolver::getNumIterations() const
+{
+    return _numIterations;
+}
+
+void NativeLPSolver::solve()
+{
+    struct timespec start = TimeUtils::sampleMicro();
+    unsigned long long timeoutInMicroSeconds =
+        ( _timeoutInSeconds <= 0 || !FloatUtils::isFinite( _timeoutInSeconds ) ) ? 0 :
+        (unsigned long long)( _timeoutInSeconds * 1000000 );
+
+    reset();
+
+    updateColumns();
+    moveNonBasicVariablesToBounds();
+    computeBasicAssignment();
+
+    unsigned degeneratePivots = 0;
+    bool recomputedBeforeTermination = false;
+    bool perturbationApplied = false;
+    while ( true )
+    {
+        if ( timeoutInMicroSeconds > 0 &&
+             TimeUtils::timePassed( start, TimeUtils::sampleMicro() ) > timeoutInMicroSeconds )
+        {
+            removePerturbation();
+            _status = TIMEOUT;
+            return;
+        }
+
+        /*
+          Stalling on degenerate pivots is first handled by perturbing the
+          bounds, and if that has already been done, by Bland's rule,
+          which guarantees termination
+        */
+        bool useBlandsRule = false;
+        if ( degeneratePivots >= GlobalConfiguration::NATIVE_LP_MAX_DEGENERATE_PIVOTS )
+        {
+            if ( !perturbationApplied )
+            {
+                perturbationApplied = true;
+                degeneratePivots = 0;
+                applyPerturbation();
+            }
+            else
+                useBlandsRule = true;
+        }
+
+        bool phaseOne = !basicVariablesFeasible();
+        computeMultipliers( phaseOne );
+
+        unsigned entering = 0;
+        bool increase = false;
+        if ( !selectEnteringVariable( phaseOne, useBlandsRule, entering, increase ) )
+        {
+            // Before concluding, make sure that the assignment is accurate,
+            // and is with respect to the original bounds
+            if ( _perturbed )
+            {
+                removePerturbation();
+                moveNonBasicVariablesToBounds();
+                computeBasicAssignment();
+                continue;
+            }
+
+            if ( !recomputedBeforeTermination )
+            {
+                recomputedBeforeTermination = true;
+                computeBasicAssignment();
+                continue;
+            }
+
+            if ( !phaseOne )
+            {
+                _status = OPTIMAL;
+            }
+            else if ( infeasibilityProven() )
+            {
+                _status = INFEASIBLE;
+                return;
+            }
+            else
+            {
+                // Phase one is stuck on numerical noise: give up, but the
+                // objective bound is still valid
+                _status = TIMEOUT;
+                return;
+            }
+
+            break;
+        }
+
+        bool degenerate = false;
+        if ( !pivot( entering, increase, phaseOne, useBlandsRule, degenerate ) )
+        {
+            // Only phase two can be unbounded, as the phase one cost is
+            // bounded from below. The perturbation does not affect
+            // unboundedness, as infinite bounds are not perturbed.
+            removePerturbation();
+            _status = UNBOUNDED;
+            return;
+        }
+
+        recomputedBeforeTermination = false;
+        degeneratePivots = degenerate ? degeneratePivots + 1 : 0;
+
+        ++_numIterations;
+        if ( _numIterations % GlobalConfiguration::NATIVE_LP_RECOMPUTE_ASSIGNMENT_FREQUENCY == 0 )
+            computeBasicAssignment();
+    }
+
+    _objectiveValue = computeObjectiveValue();
+
+    if ( _cutoffInUse )
+    {
+        if ( ( _maximize && FloatUtils::lt( _objectiveValue, _cutoffValue ) ) ||
+             ( !_maximize && FloatUtils::gt( _objectiveValue, _cutoffValue ) ) )
+            _status = CUTOFF;
+    }
+}
+
+void NativeLPSolver::updateColumns()
+{
+    if ( !_columnsUpToDate )
+    {
+        freeColumns();
+
+        for ( unsigned i = 0; i < _columnEntries.size(); ++i )
+        {
+            SparseUnsortedList *column = new SparseUnsortedList( _m );
+            if ( !column )
+                throw MarabouError( MarabouError::ALLOCATION_FAILED,
+                                    "NativeLPSolver::column" );
+
+            for ( const auto &entry : _columnEntries[i] )
+                column->append( entry._index, entry._value );
+            _columns.append( column );
+        }
+
+        _columnsUpToDate = true;
+
+        if ( _m != _workMemorySize )
+            allocateWorkMemory();
+
+        if ( _m != _factorizationSize )
+        {
+            if ( _factorization )
+            {
+                delete _factorization;
+                _factorization = NULL;
+            }
+
+            if ( _m > 0 )
+                _factorization = BasisFactorizationFactory::createBasisFactorization( _m, *this );
+            _factorizationSize = _m;
+        }
+
+        initializeFactorization();
+    }
+}
+
+void NativeLPSolver::allocateWorkMemory()
+{
+    freeWorkMemory();
+
+    _basicCosts = new double[_m];
+    _multipliers = new double[_m];
+    _changeColumn = new double[_m];
+    _denseColumn = new double[_m];
+    _rhs = new double[_m];
+
+    if ( !_basicCosts || !_multipliers || !_changeColumn || !_denseColumn || !_rhs )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "NativeLPSolver::workMemory" );
+
+    _workMemorySize = _m;
+}
+
+void NativeLPSolver::freeWorkMemory()
+{
+    if ( _basicCosts )
+    {
+        delete[] _basicCosts;
+        _basicCosts = NULL;
+    }
+
+    if ( _multipliers )
+    {
+        delete[] _multipliers;
+        _multipliers = NULL;
+    }
+
+    if ( _changeColumn )
+    {
+        delete[] _changeColumn;
+        _changeColumn = NULL;
+    }
+
+    if ( _denseColumn )
+    {
+        delete[] _denseColumn;
+        _denseColumn = NULL;
+    }
+
+    if ( _rhs )
+    {
+        delete[] _rhs;
+        _rhs = NULL;
+    }
+
+    _workMemorySize = 0;
+}
+
+void NativeLPSolver::freeColumns()
+{
+    for ( auto &column : _columns )
+    {
+        delete column;
+        column = NULL;
+    }
+    _columns.clear();
+}
+
+void NativeLPSolver::initializeFactorization()
+{
+    if ( _m == 0 )
+        return;
+
+    try
+    {
+        _factorization->obtainFreshBasis();
+    }
+    catch ( const MalformedBasisException & )
+    {
+        // The basis of the slack variables is always valid
+        resetToSlackBasis();
+        _factorization->obtainFreshBasis();
+    }
+}
+
+void NativeLPSolver::resetToSlackBasis()
+{
+    for ( auto &basicIndex : _variableToBasicIndex )
+        basicIndex = -1;
+
+    for ( unsigned i = 0; i < _m; ++i )
+    {
+        _basicIndexToVariable[i] = _rowToSlack[i];
+        _variableToBasicIndex[_rowToSlack[i]] = i;
+    }
+}
+
+void NativeLPSolver::moveNonBasicVariablesToBounds()
+{
+    for ( unsigned i = 0; i < _assignment.size(); ++i )
+    {
+        if ( _variableToBasicIndex[i] >= 0 )
+            continue;
+
+        double lb = _lowerBounds[i];
+        double ub = _upperBounds[i];
+        double value = _assignment[i];
+
+        if ( value == lb || value == ub )
+            continue;
+
+        // Move to the nearest finite bound, or to zero if there is none
+        bool lbFinite = FloatUtils::isFinite( lb );
+        bool ubFinite = FloatUtils::isFinite( ub );
+        if ( lbFinite && ubFinite )
+            _assignment[i] = ( value - lb <= ub - value ) ? lb : ub;
+        else if ( lbFinite )
+            _assignment[i] = lb;
+        else if ( ubFinite )
+            _assignment[i] = ub;
+        else
+            _assignment[i] = 0;
+    }
+}
+
+void NativeLPSolver::computeBasicAssignment()
+{
+    if ( _m == 0 )
+        return;
+
+    // B * xB = - sum( column_j * x_j ) over the non-basic variables
+    std::fill_n( _rhs, _m, 0 );
+    for ( unsigned i = 0; i < _assignment.size(); ++i )
+    {
+        if ( _variableToBasicIndex[i] >= 0 || _assignment[i] == 0 )
+            continue;
+
+        for ( const auto &entry : _columnEntries[i] )
+            _rhs[entry._index] -= entry._value * _assignment[i];
+    }
+
+    _factorization->forwardTransformation( _rhs, _changeColumn );
+
+    for ( unsigned i = 0; i < _m; ++i )
+        _assignment[_basicIndexToVariable[i]] = _changeColumn[i];
+}
+
+bool NativeLPSolver::withinBound( double value, double bound, bool lower )
+{
+    double tolerance = GlobalConfiguration::NATIVE_LP_FEASIBILITY_TOLERANCE;
+    if ( FloatUtils::isFinite( bound ) )
+        tolerance *= ( 1 + FloatUtils::abs( bound ) );
+
+    return lower ? value >= bound - tolerance : value <= bound + tolerance;
+}
+
+bool NativeLPSolver::basicVariablesFeasible()
+{
+    for ( unsigned i = 0; i < _m; ++i )
+    {
+        unsigned variable = _basicIndexToVariable[i];
+        if ( !withinBound( _assignment[variable], _lowerBounds[variable], true ) ||
+             !withinBound( _assignment[variable], _upperBounds[variable], false ) )
+            return false;
+    }
+
+    return true;
+}
+
+void NativeLPSolver::computeMultipliers( bool phaseOne )
+{
+    if ( _m == 0 )
+        return;
+
+    for ( unsigned i = 0; i < _m; ++i )
+    {
+        unsigned variable = _basicIndexToVariable[i];
+        if ( !phaseOne )
+        {
+            _basicCosts[i] = _cost[variable];
+        }
+        else
+        {
+            double value = _assignment[variable];
+            if ( !withinBound( value, _lowerBounds[variable], true ) )
+                _basicCosts[i] = -1;
+            else if ( !withinBound( value, _upperBounds[variable], false ) )
+                _basicCosts[i] = 1;
+            else
+                _basicCosts[i] = 0;
+        }
+    }
+
+    _factorization->backwardTransformation( _basicCosts, _multipliers );
+}
+
+double NativeLPSolver::computeReducedCost( unsigned variable, bool phaseOne )
+{
+    double reducedCost = phaseOne ? 0 : _cost[variable];
+    for ( const auto &entry : _columnEntries[variable] )
+        reducedCost -= _multipliers[entry._index] * entry._value;
+    return reducedCost;
+}
+
+bool NativeLPSolver::selectEnteringVariable( bool phaseOne, bool useBlandsRule,
+                                             unsigned &entering, bool &increase )
+{
+    double bestScore = 0;
+    bool found = false;
+
+    for ( unsigned i = 0; i < _assignment.size(); ++i )
+    {
+        if ( _variableToBasicIndex[i] >= 0 || _lowerBounds[i] == _upperBounds[i] )
+            continue;
+
+        double reducedCost = computeReducedCost( i, phaseOne );
+        bool canIncrease = _assignment[i] < _upperBounds[i];
+        bool canDecrease = _assignment[i] > _lowerBounds[i];
+
+        bool eligible = false;
+        bool increaseVariable = false;
+        if ( reducedCost < -GlobalConfiguration::NATIVE_LP_OPTIMALITY_TOLERANCE && canIncrease )
+        {
+            eligible = true;
+            increaseVariable = true;
+        }
+        else if ( reducedCost > GlobalConfiguration::NATIVE_LP_OPTIMALITY_TOLERANCE && canDecrease )
+        {
+            eligible = true;
+            increaseVariable = false;
+        }
+
+        if ( !eligible )
+            continue;
+
+        // Bland's rule picks the first eligible variable, Dantzig's rule
+        // the one with the largest reduced cost
+        if ( useBlandsRule )
+        {
+            entering = i;
+            increase = increaseVariable;
+            return true;
+        }
+
+        if ( FloatUtils::abs( reducedCost ) > bestScore )
+        {
+            bestScore = FloatUtils::abs( reducedCost );
+            entering = i;
+            increase = increaseVariable;
+            found = true;
+        }
+    }
+
+    return found;
+}
+
+bool NativeLPSolver::pivot( unsigned entering, bool increase, bool phaseOne,
+                            bool useBlandsRule, bool &degenerate )
+{
+    // The change column: the change in the basic variables per unit
+    // change of the entering variable is -inv(B) * column
+    if ( _m > 0 )
+    {
+        std::fill_n( _denseColumn, _m, 0 );
+        for ( const auto &entry : _columnEntries[entering] )
+            _denseColumn[entry._index] = entry._value;
+        _factorization->forwardTransformation( _denseColumn, _changeColumn );
+    }
+
+    double direction = increase ? 1 : -1;
+
+    // The entering variable may reach its other bound first
+    double step = FloatUtils::infinity();
+    if ( increase && FloatUtils::isFinite( _upperBounds[entering] ) )
+        step = _upperBounds[entering] - _assignment[entering];
+    else if ( !increase && FloatUtils::isFinite( _lowerBounds[entering] ) )
+        step = _assignment[entering] - _lowerBounds[entering];
+
+    unsigned leavingIndex = _m;
+    bool leavingToUpperBound = false;
+    double leavingPivot = 0;
+
+    for ( unsigned i = 0; i < _m; ++i )
+    {
+        double pivotEntry = _changeColumn[i];
+        if ( FloatUtils::abs( pivotEntry ) < GlobalConfiguration::PIVOT_CHANGE_COLUMN_TOLERANCE )
+            continue;
+
+        unsigned variable = _basicIndexToVariable[i];
+        double value = _assignment[variable];
+        double lb = _lowerBounds[variable];
+        double ub = _upperBounds[variable];
+        double rate = -direction * pivotEntry;
+
+        double limit;
+        bool toUpperBound;
+        if ( rate < 0 )
+        {
+            if ( phaseOne && !withinBound( value, ub, false ) )
+            {
+                // Decreasing towards the violated upper bound
+                limit = ( value - ub ) / -rate;
+                toUpperBound = true;
+            }
+            else if ( !withinBound( value, lb, true ) || !FloatUtils::isFinite( lb ) )
+                continue;
+            else
+            {
+                limit = FloatUtils::max( value - lb, 0 ) / -rate;
+                toUpperBound = false;
+            }
+        }
+        else
+        {
+            if ( phaseOne && !withinBound( value, lb, true ) )
+            {
+                // Increasing towards the violated lower bound
+                limit = ( lb - value ) / rate;
+                toUpperBound = false;
+            }
+            else if ( !withinBound( value, ub, false ) || !FloatUtils::isFinite( ub ) )
+                continue;
+            else
+            {
+                limit = FloatUtils::max( ub - value, 0 ) / rate;
+                toUpperBound = true;
+            }
+        }
+
+        // Among equal steps, prefer the larger pivot entry for stability,
+        // or the smaller variable under Bland's rule
+        bool better = limit < step;
+        if ( !better && limit == step && leavingIndex < _m )
+        {
+            if ( useBlandsRule )
+                better = variable < _basicIndexToVariable[leavingIndex];
+            else
+                better = FloatUtils::abs( pivotEntry ) > FloatUtils::abs( leavingPivot );
+        }
+
+        if ( better )
+        {
+            step = limit;
+            leavingIndex = i;
+            leavingToUpperBound = toUpperBound;
+            leavingPivot = pivotEntry;
+        }
+    }
+
+    if ( !FloatUtils::isFinite( step ) )
+        return false;
+
+    // Fixed variables leaving the basis never return to it, so these
+    // pivots make progress even if they are degenerate
+    degenerate = ( step == 0 ) && ( leavingIndex == _m ||
+                                    _lowerBounds[_basicIndexToVariable[leavingIndex]] !=
+                                    _upperBounds[_basicIndexToVariable[leavingIndex]] );
+
+    // Update the assignment
+    _assignment[entering] += direction * step;
+    for ( unsigned i = 0; i < _m; ++i )
+        _assignment[_basicIndexToVariable[i]] -= direction * step * _changeColumn[i];
+
+    if ( leavingIndex == _m )
+    {
+        // The entering variable jumps to its other bound
+        _assignment[entering] = increase ? _upperBounds[entering] : _lowerBounds[entering];
+        return true;
+    }
+
+    unsigned leaving = _basicIndexToVariable[leavingIndex];
+    _assignment[leaving] = leavingToUpperBound ? _upperBounds[leaving] : _lowerBounds[leaving];
+
+    _basicIndexToVariable[leavingIndex] = entering;
+    _variableToBasicIndex[entering] = leavingIndex;
+    _variableToBasicIndex[leaving] = -1;
+
+    try
+    {
+        _factorization->updateToAdjacentBasis( leavingIndex, _changeColumn, _denseColumn );
+    }
+    catch ( const MalformedBasisException & )
+    {
+        initializeFactorization();
+        computeBasicAssignment();
+    }
+
+    return true;
+}
+
+void NativeLPSolver::applyPerturbation()
+{
+    /*
+      Widen the finite bounds of the variables that are not fixed by
+      small, distinct amounts, so that ties in the ratio test become
+      rare. The current assignment stays within the widened bounds.
+    */
+    _originalLowerBounds = _lowerBounds;
+    _originalUpperBounds = _upperBounds;
+    _perturbed = true;
+
+    for ( unsigned i = 0; i < _assignment.size(); ++i )
+    {
+        if ( _lowerBounds[i] == _upperBounds[i] )
+            continue;
+
+        double scale = GlobalConfiguration::NATIVE_LP_BOUND_PERTURBATION *
+            ( 1 + ( ( i * 7919 ) % 1000 ) / 1000.0 );
+
+        if ( FloatUtils::isFinite( _lowerBounds[i] ) )
+            _lowerBounds[i] -= scale * ( 1 + FloatUtils::abs( _lowerBounds[i] ) );
+        if ( FloatUtils::isFinite( _upperBounds[i] ) )
+            _upperBounds[i] += scale * ( 1 + FloatUtils::abs( _upperBounds[i] ) );
+    }
+}
+
+void NativeLPSolver::removePerturbation()
+{
+    if ( !_perturbed )
+        return;
+
+    _lowerBounds = _originalLowerBounds;
+    _upperBounds = _originalUpperBounds;
+    _perturbed = false;
+}
+
+bool NativeLPSolver::infeasibilityProven()
+{
+    /*
+      Every assignment satisfies y * A * x = 0 for the phase one
+      multipliers y. If the range of y * A * x over the bounds excludes
+      zero, no assignment satisfies the constraints.
+    */
+    double minimum = 0;
+    double maximum = 0;
+    double magnitude = 0;
+
+    for ( unsigned i = 0; i < _assignment.size(); ++i )
+    {
+        double coefficient = -computeReducedCost( i, true );
+        if ( coefficient == 0 )
+            continue;
+
+        double lb = _lowerBounds[i];
+        double ub = _upperBounds[i];
+
+        minimum += coefficient > 0 ? coefficient * lb : coefficient * ub;
+        maximum += coefficient > 0 ? coefficient * ub : coefficient * lb;
+
+        if ( FloatUtils::isFinite( lb ) )
+            magnitude += FloatUtils::abs( coefficient * lb );
+        if ( FloatUtils::isFinite( ub ) )
+            magnitude += FloatUtils::abs( coefficient * ub );
+    }
+
+    double tolerance = GlobalConfiguration::NATIVE_LP_FEASIBILITY_TOLERANCE * ( 1 + magnitude );
+    return minimum > tolerance || maximum < -tolerance;
+}
+
+double NativeLPSolver::computeObjectiveValue()
+{
+    double value = 0;
+    for ( unsigned i = 0; i < _assignment.size(); ++i )
+    {
+        if ( _cost[i] != 0 )
+            value += _cost[i] * _assignment[i];
+    }
+
+    return _maximize ? -value : value;
+}
+
+double NativeLPSolver::computeDualBound()
+{
+    /*
+      For any multipliers y, cost * x = ( cost - y * A ) * x for every
+      assignment that satisfies A * x = 0, so minimizing each term
+      separately over the bounds gives a lower bound on the cost. The
+      reduced costs of the basic variables are zero by the choice of y.
+    */
+    if ( _columnsUpToDate == false )
+        return _maximize ? FloatUtils::infinity() : FloatUtils::negativeInfinity();
+
+    computeMultipliers( false );
+
+    double bound = 0;
+    for ( unsigned i = 0; i < _assignment.size(); ++i )
+    {
+        if ( _variableToBasicIndex[i] >= 0 )
+            continue;
+
+        double reducedCost = computeReducedCost( i, false );
+        if ( reducedCost == 0 )
+            continue;
+
+        double value = reducedCost > 0 ? _lowerBounds[i] : _upperBounds[i];
+        if ( !FloatUtils::isFinite( value ) )
+        {
+            bound = FloatUtils::negativeInfinity();
+            break;
+        }
+
+        bound += reducedCost * value;
+    }
+
+    return _maximize ? -bound : bound;
+}
+
+double NativeLPSolver::getObjectiveBound()
+{
+    if ( _status == OPTIMAL )
+        return _objectiveValue;
+
+    return computeDualBound();
+}
+
+void NativeLPSolver::extractSolution( Map<String, double> &values, double &costOrObjective )
+{
+    values.clear();
+
+    for ( const auto &variable : _nameToVariable )
+        values[variable.first] = _assignment[variable.second];
+
+    costOrObjective = _objectiveValue;
+}
+
+void NativeLPSolver::getColumnOfBasis( unsigned column, double *result ) const
+{
+    ASSERT( column < _m );
+    _columns.get( _basicIndexToVariable.get( column ) )->toDense( result );
+}
+
+void NativeLPSolver::getColumnOfBasis( unsigned column, SparseUnsortedList *result ) const
+{
+    ASSERT( column < _m );
+    _columns.get( _basicIndexToVariable.get( column ) )->storeIntoOther( result );
+}
+
+void NativeLPSolver::getSparseBasis( SparseColumnsOfBasis &basis ) const
+{
+    for ( unsigned i = 0; i < _m; ++i )
+        basis._columns[i] = _columns.get( _basicIndexToVariable.get( i ) );
+}
+
+void NativeLPSolver::dumpModel( String name )
+{
+    // Collect the rows of the constraint matrix, without the slacks
+    Vector<List<SparseUnsortedList::Entry>> rows( _m );
+    for ( unsigned i = 0; i < _columnEntries.size(); ++i )
+    {
+        if ( _variableNames[i].length() == 0 )
+            continue;
+
+        for ( const auto &entry : _columnEntries[i] )
+            rows[entry._index].append( SparseUnsortedList::Entry( i, entry._value ) );
+    }
+
+    File file( name );
+    file.open( File::MODE_WRITE_TRUNCATE );
+
+    file.write( _maximize ? "Maximize\n obj:" : "Minimize\n obj:" );
+    for ( unsigned i = 0; i < _cost.size(); ++i )
+    {
+        if ( _cost[i] != 0 )
+            file.write( Stringf( " %+.15g %s", _maximize ? -_cost[i] : _cost[i],
+                                 _variableNames[i].ascii() ) );
+    }
+
+    file.write( "\nSubject To\n" );
+    for ( unsigned i = 0; i < _m; ++i )
+    {
+        file.write( Stringf( " c%u:", i ) );
+        for ( const auto &entry : rows[i] )
+            file.write( Stringf( " %+.15g %s", entry._value,
+                                 _variableNames[entry._index].ascii() ) );
+
+        unsigned slack = _rowToSlack[i];
+        if ( _lowerBounds[slack] == _upperBounds[slack] )
+            file.write( Stringf( " = %.15g\n", _lowerBounds[slack] ) );
+        else if ( FloatUtils::isFinite( _upperBounds[slack] ) )
+            file.write( Stringf( " <= %.15g\n", _upperBounds[slack] ) );
+        else
+            file.write( Stringf( " >= %.15g\n", _lowerBounds[slack] ) );
+    }
+
+    file.write( "Bounds\n" );
+    for ( const auto &variable : _nameToVariable )
+    {
+        double lb = _lowerBounds[variable.second];
+        double ub = _upperBounds[variable.second];
+        file.write( Stringf( " %s <= %s <= %s\n",
+                             FloatUtils::isFinite( lb ) ?
+                             Stringf( "%.15g", lb ).ascii() : "-inf",
+                             variable.first.ascii(),
+                             FloatUtils::isFinite( ub ) ?
+                             Stringf( "%.15g", ub ).ascii() : "+inf" ) );
+    }
+
+    file.write( "End\n" );
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
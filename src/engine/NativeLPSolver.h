@@ -0,0 +1,226 @@
+/*********************                                                        */
+/*! \file NativeLPSolver.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#ifndef __NativeLPSolver_h__
+#define __NativeLPSolver_h__
+
+#include "IBasisFactorization.h"
+#include "ILPSolver.h"
+#include "SparseUnsortedList.h"
+#include "Vector.h"
+
+/*
+  An LP solver that does not depend on an external library: a
+  bounded-variable primal simplex, over one of Marabou's basis
+  factorizations.
+
+  Every constraint gets a slack variable, so that the model has the
+  form A x - s = 0, with bounds on x and s. The basis is kept between
+  calls to solve(): after a change of the cost function, the last
+  basis is still feasible and only phase 2 is run, and after a change
+  of bounds or the addition of variables and constraints the solver
+  starts phase 1 from the last basis rather than from scratch. Only
+  resetModel() discards the basis.
+
+  Binary variables are relaxed to continuous variables in [0, 1], so
+  MILP models are solved as their LP relaxation. The bounds obtained
+  this way are sound, but can be weaker than those of a MILP solver.
+*/
+class NativeLPSolver : public ILPSolver, public IBasisFactorization::BasisColumnOracle
+{
+public:
+    NativeLPSolver();
+    ~NativeLPSolver();
+
+    void addVariable( String name, double lb, double ub, VariableType type = CONTINUOUS );
+    void setLowerBound( String name, double lb );
+    void setUpperBound( String name, double ub );
+
+    void addLeqConstraint( const List<Term> &terms, double scalar );
+    void addGeqConstraint( const List<Term> &terms, double scalar );
+    void addEqConstraint( const List<Term> &terms, double scalar );
+
+    void setCost( const List<Term> &terms );
+    void setObjective( const List<Term> &terms );
+    void setCutoff( double cutoff );
+
+    bool optimal();
+    bool cutoffOccurred();
+    bool infeasbile();
+    bool timeout();
+    bool haveFeasibleSolution();
+
+    void setTimeLimit( double seconds );
+
+    void solve();
+    void extractSolution( Map<String, double> &values, double &costOrObjective );
+
+    /*
+      A bound on the optimal value that holds even if the solver did
+      not reach an optimal basis: the dual bound obtained from the
+      simplex multipliers of the current basis
+    */
+    double getObjectiveBound();
+
+    void reset();
+    void resetModel();
+
+    /*
+      Write the model to a file, in the LP format
+    */
+    void dumpModel( String name );
+
+    /*
+      The number of simplex iterations performed by the last solve()
+    */
+    unsigned getNumIterations() const;
+
+    /*
+      BasisColumnOracle methods
+    */
+    void getColumnOfBasis( unsigned column, double *result ) const;
+    void getColumnOfBasis( unsigned column, SparseUnsortedList *result ) const;
+    void getSparseBasis( SparseColumnsOfBasis &basis ) const;
+
+private:
+    enum Status {
+        UNSOLVED = 0,
+        OPTIMAL,
+        INFEASIBLE,
+        UNBOUNDED,
+        CUTOFF,
+        TIMEOUT,
+    };
+
+    /*
+      The variables of the model are the named variables and the slack
+      variables of the constraints, indexed by order of creation. Slack
+      variables have no name.
+    */
+    Map<String, unsigned> _nameToVariable;
+    Vector<String> _variableNames;
+    Vector<unsigned> _rowToSlack;
+    Vector<double> _lowerBounds;
+    Vector<double> _upperBounds;
+    Vector<double> _assignment;
+
+    /*
+      The entries of every column of A, including the -1 entry of each
+      slack variable; and the same columns in the format that the basis
+      factorization reads, rebuilt whenever constraints are added
+    */
+    Vector<List<SparseUnsortedList::Entry>> _columnEntries;
+    Vector<SparseUnsortedList *> _columns;
+    bool _columnsUpToDate;
+    unsigned _m;
+
+    /*
+      The basis. The slack variable of every new constraint is added to
+      the basis, so the basis always has one variable per constraint.
+    */
+    Vector<unsigned> _basicIndexToVariable;
+    Vector<int> _variableToBasicIndex;
+    IBasisFactorization *_factorization;
+    unsigned _factorizationSize;
+
+    /*
+      The cost of every variable, for minimization. An objective
+      function to maximize is stored negated.
+    */
+    Vector<double> _cost;
+    bool _maximize;
+
+    /*
+      The original bounds, while the bounds are perturbed to escape
+      from degenerate pivots
+    */
+    Vector<double> _originalLowerBounds;
+    Vector<double> _originalUpperBounds;
+    bool _perturbed;
+
+    bool _cutoffInUse;
+    double _cutoffValue;
+    double _timeoutInSeconds;
+
+    Status _status;
+    double _objectiveValue;
+    unsigned _numIterations;
+
+    /*
+      Work memory of size m
+    */
+    double *_basicCosts;
+    double *_multipliers;
+    double *_changeColumn;
+    double *_denseColumn;
+    double *_rhs;
+    unsigned _workMemorySize;
+
+    void addConstraint( const List<Term> &terms, double lb, double ub );
+    void setCostFunction( const List<Term> &terms, bool maximize );
+    unsigned getVariable( const String &name ) const;
+
+    /*
+      Preparations for a solve: rebuild the columns and the basis
+      factorization if the model has changed, and move every non-basic
+      variable to one of its bounds
+    */
+    void updateColumns();
+    void allocateWorkMemory();
+    void freeWorkMemory();
+    void freeColumns();
+    void initializeFactorization();
+    void resetToSlackBasis();
+    void moveNonBasicVariablesToBounds();
+    void computeBasicAssignment();
+
+    /*
+      The simplex iterations. Phase one minimizes the sum of the bound
+      violations of the basic variables, and phase two the cost
+      function. The pivot returns false if the entering variable can
+      change without limit.
+    */
+    bool basicVariablesFeasible();
+    void computeMultipliers( bool phaseOne );
+    double computeReducedCost( unsigned variable, bool phaseOne );
+    bool selectEnteringVariable( bool phaseOne, bool useBlandsRule,
+                                 unsigned &entering, bool &increase );
+    bool pivot( unsigned entering, bool increase, bool phaseOne,
+                bool useBlandsRule, bool &degenerate );
+    void applyPerturbation();
+    void removePerturbation();
+
+    /*
+      The multipliers of phase one prove that the model is infeasible
+      if no assignment within the bounds satisfies their combination
+      of the constraints
+    */
+    bool infeasibilityProven();
+
+    double computeObjectiveValue();
+    double computeDualBound();
+
+    static bool withinBound( double value, double bound, bool lower );
+};
+
+#endif // __NativeLPSolver_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,163 @@
+/*********************                                                        */
+/*! \file PartialPricingRule.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "FloatUtils.h"
+#include "GlobalConfiguration.h"
+#include "ITableau.h"
+#include "PartialPricingRule.h"
+
+#include <algorithm>
+#include <functional>
+
+PartialPricingRule::PartialPricingRule()
+    : _numNonBasics( 0 )
+    , _nextScanStart( 0 )
+    , _pivotsUntilRefill( 0 )
+{
+}
+
+void PartialPricingRule::initialize( const ITableau &tableau )
+{
+    _numNonBasics = tableau.getN() - tableau.getM();
+    _nextScanStart = 0;
+    _pivotsUntilRefill = 0;
+    _pool.clear();
+}
+
+void PartialPricingRule::resizeHook( const ITableau &tableau )
+{
+    initialize( tableau );
+}
+
+bool PartialPricingRule::needsEntryCandidates() const
+{
+    return false;
+}
+
+const std::vector<unsigned> &PartialPricingRule::getPool() const
+{
+    return _pool;
+}
+
+bool PartialPricingRule::select( ITableau &tableau,
+                                 const List<unsigned> &/* candidates */,
+                                 const Set<unsigned> &excluded )
+{
+    const double *costFunction = tableau.getCostFunction();
+
+    if ( _pivotsUntilRefill == 0 )
+        _pool.clear();
+
+    if ( selectFromPool( tableau, costFunction, excluded ) )
+        return true;
+
+    refillPool( tableau, costFunction, excluded );
+    _pivotsUntilRefill = GlobalConfiguration::PARTIAL_PRICING_PIVOTS_BEFORE_REFILL;
+
+    return selectFromPool( tableau, costFunction, excluded );
+}
+
+bool PartialPricingRule::selectFromPool( ITableau &tableau,
+                                         const double *costFunction,
+                                         const Set<unsigned> &excluded )
+{
+    bool found = false;
+    unsigned bestCandidate = 0;
+    double bestValue = 0;
+
+    unsigned numKept = 0;
+    for ( unsigned i = 0; i < _pool.size(); ++i )
+    {
+        unsigned candidate = _pool[i];
+        if ( !tableau.eligibleForEntry( candidate, costFunction ) )
+            continue;
+
+        _pool[numKept++] = candidate;
+
+        if ( excluded.exists( candidate ) )
+            continue;
+
+        double contenderValue = FloatUtils::abs( costFunction[candidate] );
+        if ( !found || contenderValue > bestValue )
+        {
+            found = true;
+            bestCandidate = candidate;
+            bestValue = contenderValue;
+        }
+    }
+    _pool.resize( numKept );
+
+    if ( found )
+        tableau.setEnteringVariableIndex( bestCandidate );
+
+    return found;
+}
+
+void PartialPricingRule::refillPool( const ITableau &tableau,
+                                     const double *costFunction,
+                                     const Set<unsigned> &excluded )
+{
+    _pool.clear();
+    if ( _numNonBasics == 0 )
+        return;
+
+    unsigned segmentSize = std::max( _numNonBasics / GlobalConfiguration::PARTIAL_PRICING_NUM_SEGMENTS,
+                                     GlobalConfiguration::PARTIAL_PRICING_POOL_SIZE );
+
+    _segmentCandidates.clear();
+    unsigned numScanned = 0;
+    while ( numScanned < _numNonBasics && _segmentCandidates.empty() )
+    {
+        unsigned segmentEnd = numScanned + std::min( segmentSize, _numNonBasics - numScanned );
+        for ( ; numScanned < segmentEnd; ++numScanned )
+        {
+            unsigned nonBasic = _nextScanStart;
+            _nextScanStart = ( _nextScanStart + 1 == _numNonBasics ) ? 0 : _nextScanStart + 1;
+
+            if ( tableau.eligibleForEntry( nonBasic, costFunction ) && !excluded.exists( nonBasic ) )
+            {
+                _segmentCandidates.push_back(
+                    std::make_pair( FloatUtils::abs( costFunction[nonBasic] ), nonBasic ) );
+            }
+        }
+    }
+
+    // Keep the candidates with the largest reduced costs
+    if ( _segmentCandidates.size() > GlobalConfiguration::PARTIAL_PRICING_POOL_SIZE )
+    {
+        std::nth_element( _segmentCandidates.begin(),
+                          _segmentCandidates.begin() + GlobalConfiguration::PARTIAL_PRICING_POOL_SIZE,
+                          _segmentCandidates.end(),
+                          std::greater<std::pair<double, unsigned>>() );
+        _segmentCandidates.resize( GlobalConfiguration::PARTIAL_PRICING_POOL_SIZE );
+    }
+
+    for ( const auto &candidate : _segmentCandidates )
+        _pool.push_back( candidate.second );
+}
+
+void PartialPricingRule::postPivotHook( const ITableau &/* tableau */, bool /* fakePivot */ )
+{
+    if ( _pivotsUntilRefill > 0 )
+        --_pivotsUntilRefill;
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
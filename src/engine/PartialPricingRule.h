@@ -0,0 +1,109 @@
+/*********************                                                        */
+/*! \file PartialPricingRule.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#ifndef __PartialPricingRule_h__
+#define __PartialPricingRule_h__
+
+#include "EntrySelectionStrategy.h"
+
+#include <utility>
+#include <vector>
+
+/*
+  Partial and multiple pricing. The rule keeps a small pool of eligible
+  non-basic variables, and picks the entering variable from the pool
+  using Dantzig's rule. The pool is refilled by scanning the non-basic
+  variables segment by segment, starting where the previous scan
+  stopped, until some eligible variables are found.
+
+  The cost function manager updates the reduced costs of all
+  non-basics after every pivot, so the scores of the pool members stay
+  current without rescanning; members that are no longer eligible are
+  dropped when they are encountered. The pool is refilled when it runs
+  dry, and every few pivots so that it does not go stale.
+
+  The rule does not need the list of all the eligible candidates, which
+  saves the engine a scan of all the non-basic variables per iteration.
+*/
+class PartialPricingRule : public EntrySelectionStrategy
+{
+public:
+    PartialPricingRule();
+
+    void initialize( const ITableau &tableau );
+
+    /*
+      Pick the candidate from the pool with the largest coefficient (in
+      absolute value) in the cost function. The given list of
+      candidates is ignored.
+    */
+    bool select( ITableau &tableau,
+                 const List<unsigned> &candidates,
+                 const Set<unsigned> &excluded );
+
+    void postPivotHook( const ITableau &tableau, bool fakePivot );
+    void resizeHook( const ITableau &tableau );
+
+    bool needsEntryCandidates() const;
+
+    /*
+      For testing purposes
+    */
+    const std::vector<unsigned> &getPool() const;
+
+private:
+    /*
+      The pool of candidates, by non-basic index
+    */
+    std::vector<unsigned> _pool;
+
+    /*
+      Eligible variables found when scanning a segment, and the
+      absolute values of their reduced costs
+    */
+    std::vector<std::pair<double, unsigned>> _segmentCandidates;
+
+    /*
+      The number of non-basic variables, and where the next scan starts
+    */
+    unsigned _numNonBasics;
+    unsigned _nextScanStart;
+
+    unsigned _pivotsUntilRefill;
+
+    /*
+      Pick the best eligible candidate from the pool, dropping
+      candidates that are no longer eligible. Return false if there
+      is none.
+    */
+    bool selectFromPool( ITableau &tableau, const double *costFunction, const Set<unsigned> &excluded );
+
+    /*
+      Scan segments of the non-basic variables until eligible
+      variables are found or all variables have been scanned, and
+      put the best ones in the pool.
+    */
+    void refillPool( const ITableau &tableau, const double *costFunction, const Set<unsigned> &excluded );
+};
+
+#endif // __PartialPricingRule_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
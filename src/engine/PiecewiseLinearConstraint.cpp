@@ -17,14 +17,86 @@
 #include "Statistics.h"
 
 PiecewiseLinearConstraint::PiecewiseLinearConstraint()
-    : _constraintActive( true )
-    , _phaseStatus( PHASE_NOT_FIXED )
-    , _score( FloatUtils::negativeInfinity() )
+    : _ownedStateStore( new ConstraintStateStore )
+    , _stateStore( _ownedStateStore )
+    , _stateIndex( _ownedStateStore->addConstraint() )
     , _constraintBoundTightener( NULL )
     , _statistics( NULL )
 {
 }
 
+PiecewiseLinearConstraint::PiecewiseLinearConstraint( const PiecewiseLinearConstraint &other )
+    : ITableau::VariableWatcher( other )
+    , _ownedStateStore( new ConstraintStateStore )
+    , _stateStore( _ownedStateStore )
+    , _stateIndex( _ownedStateStore->addConstraint( *other._stateStore, other._stateIndex ) )
+    , _constraintBoundTightener( other._constraintBoundTightener )
+    , _statistics( other._statistics )
+{
+}
+
+PiecewiseLinearConstraint::~PiecewiseLinearConstraint()
+{
+    if ( _ownedStateStore )
+    {
+        delete _ownedStateStore;
+        _ownedStateStore = NULL;
+    }
+}
+
+PiecewiseLinearConstraint &PiecewiseLinearConstraint::operator=( const PiecewiseLinearConstraint &other )
+{
+    if ( this == &other )
+        return *this;
+
+    _stateStore->copyConstraint( _stateIndex, *other._stateStore, other._stateIndex );
+    _constraintBoundTightener = other._constraintBoundTightener;
+    _statistics = other._statistics;
+
+    return *this;
+}
+
+unsigned PiecewiseLinearConstraint::attachToStateStore( ConstraintStateStore *store )
+{
+    if ( store == _stateStore )
+        return _stateIndex;
+
+    _stateIndex = store->addConstraint( *_stateStore, _stateIndex );
+    _stateStore = store;
+
+    // The constraint is at the end of the store, so reserving a slot per
+    // participating variable is cheap, and later values do not move it
+    _stateStore->reserveSlots( _stateIndex, getParticipatingVariables().size() );
+
+    if ( _ownedStateStore )
+    {
+        delete _ownedStateStore;
+        _ownedStateStore = NULL;
+    }
+
+    return _stateIndex;
+}
+
+void PiecewiseLinearConstraint::renameVariableValues( unsigned oldIndex, unsigned newIndex )
+{
+    for ( unsigned type = 0; type < ConstraintStateStore::NUM_VALUE_TYPES; ++type )
+    {
+        ConstraintStateStore::ValueType valueType = (ConstraintStateStore::ValueType)type;
+        if ( _stateStore->exists( _stateIndex, valueType, oldIndex ) )
+        {
+            _stateStore->set( _stateIndex, valueType, newIndex,
+                              _stateStore->get( _stateIndex, valueType, oldIndex ) );
+            _stateStore->erase( _stateIndex, valueType, oldIndex );
+        }
+    }
+}
+
+void PiecewiseLinearConstraint::eraseVariableValues( unsigned variable )
+{
+    for ( unsigned type = 0; type < ConstraintStateStore::NUM_VALUE_TYPES; ++type )
+        _stateStore->erase( _stateIndex, (ConstraintStateStore::ValueType)type, variable );
+}
+
 void PiecewiseLinearConstraint::setStatistics( Statistics *statistics )
 {
     _statistics = statistics;
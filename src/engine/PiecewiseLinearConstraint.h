@@ -16,10 +16,12 @@
 #ifndef __PiecewiseLinearConstraint_h__
 #define __PiecewiseLinearConstraint_h__
 
+#include "ConstraintStateStore.h"
 #include "FloatUtils.h"
 #include "ITableau.h"
 #include "List.h"
 #include "Map.h"
+#include "PhaseStatus.h"
 #include "PiecewiseLinearCaseSplit.h"
 #include "PiecewiseLinearFunctionType.h"
 #include "Queue.h"
@@ -31,16 +33,6 @@ class ITableau;
 class InputQuery;
 class String;
 
-enum PhaseStatus : unsigned {
-    PHASE_NOT_FIXED = 0,
-    RELU_PHASE_ACTIVE = 1,
-    RELU_PHASE_INACTIVE = 2,
-    ABS_PHASE_POSITIVE = 3,
-    ABS_PHASE_NEGATIVE = 4,
-    SIGN_PHASE_POSITIVE = 5,
-    SIGN_PHASE_NEGATIVE = 6
-};
-
 class PiecewiseLinearConstraint : public ITableau::VariableWatcher
 {
 public:
@@ -69,11 +61,19 @@ public:
     };
 
     PiecewiseLinearConstraint();
-    virtual ~PiecewiseLinearConstraint() {}
+    virtual ~PiecewiseLinearConstraint();
+
+    /*
+      Copies of a constraint keep their state in a store of their own,
+      even if the original is attached to a shared store. Assignment
+      copies the state into the store of the assigned-to constraint.
+    */
+    PiecewiseLinearConstraint( const PiecewiseLinearConstraint &other );
+    PiecewiseLinearConstraint &operator=( const PiecewiseLinearConstraint &other );
 
     bool operator<( const PiecewiseLinearConstraint &other ) const
     {
-        return _score < other._score;
+        return getScore() < other.getScore();
     }
 
     /*
@@ -93,6 +93,22 @@ public:
     */
     virtual void restoreState( const PiecewiseLinearConstraint *state ) = 0;
 
+    /*
+      Move the state of this constraint into the given store, where it
+      will be kept from now on. Returns the constraint's index there.
+    */
+    unsigned attachToStateStore( ConstraintStateStore *store );
+
+    /*
+      Returns true iff the constraint has search state beyond what is
+      kept in its state store, so that storing and restoring its state
+      requires duplicateConstraint() and restoreState().
+    */
+    virtual bool hasStateOutsideStore() const
+    {
+        return false;
+    }
+
     /*
       Register/unregister the constraint with a talbeau.
     */
@@ -111,12 +127,12 @@ public:
     */
     virtual void setActiveConstraint( bool active )
     {
-        _constraintActive = active;
+        _stateStore->setActive( _stateIndex, active );
     }
 
     virtual bool isActive() const
     {
-        return _constraintActive;
+        return _stateStore->isActive( _stateIndex );
     }
 
     /*
@@ -231,9 +247,14 @@ public:
     {
     }
 
+    PhaseStatus getDirection() const
+    {
+        return _stateStore->getDirection( _stateIndex );
+    }
+
     double getScore() const
     {
-        return _score;
+        return _stateStore->getScore( _stateIndex );
     }
 
 
@@ -242,11 +263,11 @@ public:
     }
 
     /*
-      Update _score with score
+      Update the score
     */
     void setScore( double score )
     {
-        _score = score;
+        _stateStore->setScore( _stateIndex, score );
     }
 
     /*
@@ -254,27 +275,30 @@ public:
     */
     double getLowerBound( unsigned i ) const
     {
-        return _lowerBounds[i];
+        return _stateStore->get( _stateIndex, ConstraintStateStore::LOWER_BOUND, i );
     }
 
     double getUpperBound( unsigned i ) const
     {
-        return _upperBounds[i];
+        return _stateStore->get( _stateIndex, ConstraintStateStore::UPPER_BOUND, i );
     }
 
 protected:
-    bool _constraintActive;
-    PhaseStatus _phaseStatus;
-    Map<unsigned, double> _assignment;
-    Map<unsigned, double> _lowerBounds;
-    Map<unsigned, double> _upperBounds;
-
     /*
+      The state of the constraint: its phase status, whether it is
+      active, its score and direction, and the last assignment and
+      bounds it was notified of. The state is kept at index
+      _stateIndex of _stateStore, which is either owned by the
+      constraint or shared with other constraints (e.g., all those of
+      an engine).
+
       The score denotes priority for splitting. When score is negative, the PL constraint
       is not being considered for splitting.
       We pick the PL constraint with the highest score to branch.
-     */
-    double _score;
+    */
+    ConstraintStateStore *_ownedStateStore;
+    ConstraintStateStore *_stateStore;
+    unsigned _stateIndex;
 
     IConstraintBoundTightener *_constraintBoundTightener;
 
@@ -289,13 +313,68 @@ protected:
      */
     void setPhaseStatus( PhaseStatus phase )
     {
-        _phaseStatus = phase;
+        _stateStore->setPhaseStatus( _stateIndex, phase );
     };
 
     PhaseStatus getPhaseStatus() const
     {
-        return _phaseStatus;
+        return _stateStore->getPhaseStatus( _stateIndex );
     };
+
+    void setDirection( PhaseStatus direction )
+    {
+        _stateStore->setDirection( _stateIndex, direction );
+    }
+
+    /*
+      The last assignment and bounds the constraint was notified of
+    */
+    bool existsAssignment( unsigned variable ) const
+    {
+        return _stateStore->exists( _stateIndex, ConstraintStateStore::ASSIGNMENT, variable );
+    }
+
+    double getAssignment( unsigned variable ) const
+    {
+        return _stateStore->get( _stateIndex, ConstraintStateStore::ASSIGNMENT, variable );
+    }
+
+    void setAssignment( unsigned variable, double value )
+    {
+        _stateStore->set( _stateIndex, ConstraintStateStore::ASSIGNMENT, variable, value );
+    }
+
+    unsigned numAssignedVariables() const
+    {
+        return _stateStore->count( _stateIndex, ConstraintStateStore::ASSIGNMENT );
+    }
+
+    bool existsLowerBound( unsigned variable ) const
+    {
+        return _stateStore->exists( _stateIndex, ConstraintStateStore::LOWER_BOUND, variable );
+    }
+
+    void setLowerBound( unsigned variable, double bound )
+    {
+        _stateStore->set( _stateIndex, ConstraintStateStore::LOWER_BOUND, variable, bound );
+    }
+
+    bool existsUpperBound( unsigned variable ) const
+    {
+        return _stateStore->exists( _stateIndex, ConstraintStateStore::UPPER_BOUND, variable );
+    }
+
+    void setUpperBound( unsigned variable, double bound )
+    {
+        _stateStore->set( _stateIndex, ConstraintStateStore::UPPER_BOUND, variable, bound );
+    }
+
+    /*
+      For preprocessing: move the values of a renamed variable to its
+      new index, or forget the values of an eliminated variable.
+    */
+    void renameVariableValues( unsigned oldIndex, unsigned newIndex );
+    void eraseVariableValues( unsigned variable );
 };
 
 #endif // __PiecewiseLinearConstraint_h__
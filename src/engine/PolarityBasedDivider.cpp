@@ -95,7 +95,7 @@ PiecewiseLinearConstraint *PolarityBasedDivider::getPLConstraintToSplit
 ( const PiecewiseLinearCaseSplit &split )
 {
     EngineState *engineStateBeforeSplit = new EngineState();
-    _engine->storeState( *engineStateBeforeSplit, true );
+    _engine->storeState( *engineStateBeforeSplit, TableauStateStorageLevel::STORE_ENTIRE_TABLEAU_STATE );
     _engine->applySplit( split );
 
     PiecewiseLinearConstraint *constraintToSplit = NULL;
@@ -20,9 +20,9 @@
 #include "MarabouError.h"
 #include "SmtCore.h"
 
-void PrecisionRestorer::storeInitialEngineState( const IEngine &engine )
+void PrecisionRestorer::storeInitialEngineState( IEngine &engine )
 {
-    engine.storeState( _initialEngineState, true );
+    engine.storeState( _initialEngineState, TableauStateStorageLevel::STORE_ENTIRE_TABLEAU_STATE );
 }
 
 void PrecisionRestorer::restorePrecision( IEngine &engine,
@@ -44,7 +44,7 @@ void PrecisionRestorer::restorePrecision( IEngine &engine,
     try
     {
         EngineState targetEngineState;
-        engine.storeState( targetEngineState, false );
+        engine.storeState( targetEngineState, TableauStateStorageLevel::STORE_NO_TABLEAU_STATE );
 
         // Store the case splits performed so far
         List<PiecewiseLinearCaseSplit> targetSplits;
@@ -114,8 +114,7 @@ void PrecisionRestorer::restorePrecision( IEngine &engine,
         }
 
         // Restore constraint status
-        for ( const auto &pair : targetEngineState._plConstraintToState )
-            pair.first->setActiveConstraint( pair.second->isActive() );
+        engine.restorePlConstraintActivity( targetEngineState );
 
         engine.setNumPlConstraintsDisabledByValidSplits
             ( targetEngineState._numPlConstraintsDisabledByValidSplits );
@@ -125,17 +124,19 @@ void PrecisionRestorer::restorePrecision( IEngine &engine,
                 ASSERT( GlobalConfiguration::USE_COLUMN_MERGING_EQUATIONS || tableau.getN() == targetN );
                 ASSERT( GlobalConfiguration::USE_COLUMN_MERGING_EQUATIONS || tableau.getM() == targetM );
 
+                EngineState currentEngineState;
+                engine.storeState( currentEngineState, TableauStateStorageLevel::STORE_NO_TABLEAU_STATE );
+
                 // Constraints should be in the same state before and after restoration
-                for ( const auto &pair : targetEngineState._plConstraintToState )
+                const ConstraintStateStore &targetStates = targetEngineState._plConstraintStates;
+                const ConstraintStateStore &currentStates = currentEngineState._plConstraintStates;
+                ASSERT( targetStates.getNumConstraints() == currentStates.getNumConstraints() );
+                for ( unsigned i = 0; i < targetStates.getNumConstraints(); ++i )
                 {
-                    ASSERT( pair.second->isActive() == pair.first->isActive() );
-                    ASSERT( pair.second->phaseFixed() == pair.first->phaseFixed() );
-                    ASSERT( pair.second->constraintObsolete() == pair.first->constraintObsolete() );
+                    ASSERT( targetStates.isActive( i ) == currentStates.isActive( i ) );
+                    ASSERT( targetStates.getPhaseStatus( i ) == currentStates.getPhaseStatus( i ) );
                 }
 
-                EngineState currentEngineState;
-                engine.storeState( currentEngineState, false );
-
                 ASSERT( currentEngineState._numPlConstraintsDisabledByValidSplits ==
                         targetEngineState._numPlConstraintsDisabledByValidSplits );
 
@@ -23,7 +23,11 @@
 #include "Preprocessor.h"
 #include "MarabouError.h"
 #include "Statistics.h"
+#include "ThreadPool.h"
 #include "Tightening.h"
+#include "TimeUtils.h"
+
+#include <algorithm>
 
 #ifdef _WIN32
 #undef INFINITE
@@ -31,6 +35,10 @@
 
 Preprocessor::Preprocessor()
     : _statistics( NULL )
+    , _threadPool( NULL )
+    , _numBoundChanges( 0 )
+    , _roundStart( 0 )
+    , _previousRoundStart( 0 )
 {
 }
 
@@ -50,17 +58,13 @@ InputQuery Preprocessor::preprocess( const InputQuery &query, bool attemptVariab
     _preprocessed.constructNetworkLevelReasoner();
 
     /*
-      Merge consecutive WS layers
+      Merge consecutive WS layers. The equations of the merged neurons
+      are updated in place, and the rest of the query is kept.
     */
     if ( GlobalConfiguration::PREPROCESSOR_MERGE_CONSECUTIVE_WEIGHTED_SUMS )
     {
-        if ( query._networkLevelReasoner )
-        {
-            unsigned oldNumberOfVariables = _preprocessed.getNumberOfVariables();
-            _preprocessed._networkLevelReasoner->mergeConsecutiveWSLayers();
-            _preprocessed = _preprocessed._networkLevelReasoner->generateInputQuery();
-            _preprocessed.setNumberOfVariables( oldNumberOfVariables );
-        }
+        if ( _preprocessed._networkLevelReasoner )
+            _preprocessed._networkLevelReasoner->mergeConsecutiveWSLayers( _preprocessed );
     }
 
     /*
@@ -93,13 +97,36 @@ InputQuery Preprocessor::preprocess( const InputQuery &query, bool attemptVariab
       Then, eliminate fixed variables.
     */
 
+    // Initially, all variables are considered to have changed
+    _lastBoundChange.assign( _preprocessed.getNumberOfVariables(), 1 );
+    _numBoundChanges = 1;
+    _roundStart = 0;
+
     bool continueTightening = true;
     while ( continueTightening )
     {
+        startTighteningRound();
+
+        struct timespec start = TimeUtils::sampleMicro();
         continueTightening = processEquations();
+        struct timespec end = TimeUtils::sampleMicro();
+        if ( _statistics )
+            _statistics->ppAddTimeForEquations( TimeUtils::timePassed( start, end ) );
+
+        start = end;
         continueTightening = processConstraints() || continueTightening;
+        end = TimeUtils::sampleMicro();
+        if ( _statistics )
+            _statistics->ppAddTimeForConstraints( TimeUtils::timePassed( start, end ) );
+
         if ( attemptVariableElimination )
+        {
+            start = end;
             continueTightening = processIdenticalVariables() || continueTightening;
+            end = TimeUtils::sampleMicro();
+            if ( _statistics )
+                _statistics->ppAddTimeForIdenticalVariables( TimeUtils::timePassed( start, end ) );
+        }
 
         if ( _statistics )
             _statistics->ppIncNumTighteningIterations();
@@ -109,7 +136,13 @@ InputQuery Preprocessor::preprocess( const InputQuery &query, bool attemptVariab
     separateMergedAndFixed();
 
     if ( attemptVariableElimination )
+    {
+        struct timespec start = TimeUtils::sampleMicro();
         eliminateVariables();
+        struct timespec end = TimeUtils::sampleMicro();
+        if ( _statistics )
+            _statistics->ppAddTimeForVariableElimination( TimeUtils::timePassed( start, end ) );
+    }
 
     return _preprocessed;
 }
@@ -168,277 +201,347 @@ void Preprocessor::makeAllEquationsEqualities()
 
 bool Preprocessor::processEquations()
 {
-    enum {
-        ZERO = 0,
-        POSITIVE = 1,
-        NEGATIVE = 2,
-        INFINITE = 3,
-    };
-
     bool tighterBoundFound = false;
+    double epsilon = Options::get()->getFloat( Options::PREPROCESSOR_BOUND_TOLERANCE );
 
     List<Equation> &equations( _preprocessed.getEquations() );
-    List<Equation>::iterator equation = equations.begin();
 
-    while ( equation != equations.end() )
+    // Collect the equations that touch variables that have changed
+    _equationsToProcess.clear();
+    for ( auto equation = equations.begin(); equation != equations.end(); ++equation )
+    {
+        if ( equationNeedsProcessing( *equation ) )
+            _equationsToProcess.push_back( equation );
+    }
+
+    unsigned numEquations = _equationsToProcess.size();
+    if ( _statistics )
+        _statistics->ppAddNumEquationsExamined( numEquations );
+
+    if ( _equationTightenings.size() < numEquations )
+        _equationTightenings.resize( numEquations );
+
+    /*
+      With a thread pool, the bounds are derived from all the equations
+      first, using the bounds from the start of the round. Otherwise,
+      each equation sees the bounds derived from the previous ones.
+    */
+    if ( _threadPool )
     {
-        // The equation is of the form sum (ci * xi) - b ? 0
-        Equation::EquationType type = equation->_type;
+        unsigned rangeSize = GlobalConfiguration::PREPROCESSOR_EQUATIONS_PER_JOB;
+        unsigned numJobs = ( numEquations + rangeSize - 1 ) / rangeSize;
+
+        ThreadPool::Job job = [&]( unsigned jobIndex, unsigned /* threadIndex */ )
+            {
+                unsigned begin = jobIndex * rangeSize;
+                unsigned end = std::min( begin + rangeSize, numEquations );
+                for ( unsigned i = begin; i < end; ++i )
+                {
+                    _equationTightenings[i].clear();
+                    deriveBoundsFromEquation( *_equationsToProcess[i], epsilon, _equationTightenings[i] );
+                }
+            };
+
+        _threadPool->parallelFor( numJobs, job );
+    }
 
-        unsigned maxVar = equation->_addends.begin()->_variable;
-        for ( const auto &addend : equation->_addends )
+    for ( unsigned i = 0; i < numEquations; ++i )
+    {
+        List<Equation>::iterator equation = _equationsToProcess[i];
+
+        if ( !_threadPool )
         {
-            if ( addend._variable > maxVar )
-                maxVar = addend._variable;
+            _equationTightenings[i].clear();
+            deriveBoundsFromEquation( *equation, epsilon, _equationTightenings[i] );
         }
 
-        ++maxVar;
-
-        double *ciTimesLb = new double[maxVar];
-        double *ciTimesUb = new double[maxVar];
-        char *ciSign = new char[maxVar];
-
-        Set<unsigned> excludedFromLB;
-        Set<unsigned> excludedFromUB;
-
-        unsigned xi;
-        double xiLB;
-        double xiUB;
-        double ci;
-        double lowerBound;
-        double upperBound;
-        bool validLb;
-        bool validUb;
-
-        // The first goal is to compute the LB and UB of: sum (ci * xi) - b
-        // For this we first identify unbounded variables
-        double auxLb = -equation->_scalar;
-        double auxUb = -equation->_scalar;
-        for ( const auto &addend : equation->_addends )
+        if ( applyEquationTightenings( _equationTightenings[i], epsilon ) )
+            tighterBoundFound = true;
+
+        /*
+          Next, do another sweep over the equation.
+          Look for almost-fixed variables and fix them, and remove the equation
+          entirely if it has nothing left to contribute.
+        */
+        if ( fixAlmostFixedVariables( *equation ) )
         {
-            ci = addend._coefficient;
-            xi = addend._variable;
+            double sum = 0;
+            for ( const auto &addend : equation->_addends )
+                sum += addend._coefficient * _preprocessed.getLowerBound( addend._variable );
 
-            if ( FloatUtils::isZero( ci ) )
+            if ( FloatUtils::areDisequal( sum, equation->_scalar, GlobalConfiguration::PREPROCESSOR_ALMOST_FIXED_THRESHOLD ) )
             {
-                ciSign[xi] = ZERO;
-                ciTimesLb[xi] = 0;
-                ciTimesUb[xi] = 0;
-                continue;
+                throw InfeasibleQueryException();
             }
+            equations.erase( equation );
+        }
+    }
 
-            ciSign[xi] = ci > 0 ? POSITIVE : NEGATIVE;
+    return tighterBoundFound;
+}
 
-            xiLB = _preprocessed.getLowerBound( xi );
-            xiUB = _preprocessed.getUpperBound( xi );
+void Preprocessor::deriveBoundsFromEquation( const Equation &equation,
+                                             double epsilon,
+                                             List<Tightening> &tightenings ) const
+{
+    enum {
+        ZERO = 0,
+        POSITIVE = 1,
+        NEGATIVE = 2,
+        INFINITE = 3,
+    };
 
-            if ( FloatUtils::isFinite( xiLB ) )
-            {
-                ciTimesLb[xi] = ci * xiLB;
-                if ( ciSign[xi] == POSITIVE )
-                    auxLb += ciTimesLb[xi];
-                else
-                    auxUb += ciTimesLb[xi];
-            }
+    // The equation is of the form sum (ci * xi) - b ? 0
+    Equation::EquationType type = equation._type;
+
+    // The work space is indexed by the position of the addend in the
+    // equation
+    unsigned numAddends = equation._addends.size();
+    std::vector<double> ciTimesLb( numAddends, 0 );
+    std::vector<double> ciTimesUb( numAddends, 0 );
+    std::vector<char> ciSign( numAddends, ZERO );
+
+    Set<unsigned> excludedFromLB;
+    Set<unsigned> excludedFromUB;
+
+    unsigned xi;
+    double xiLB;
+    double xiUB;
+    double ci;
+    double lowerBound;
+    double upperBound;
+    bool validLb;
+    bool validUb;
+
+    // The first goal is to compute the LB and UB of: sum (ci * xi) - b
+    // For this we first identify unbounded variables
+    double auxLb = -equation._scalar;
+    double auxUb = -equation._scalar;
+    unsigned i = 0;
+    for ( const auto &addend : equation._addends )
+    {
+        ci = addend._coefficient;
+        xi = addend._variable;
+
+        if ( FloatUtils::isZero( ci ) )
+        {
+            ++i;
+            continue;
+        }
+
+        ciSign[i] = ci > 0 ? POSITIVE : NEGATIVE;
+
+        xiLB = _preprocessed.getLowerBound( xi );
+        xiUB = _preprocessed.getUpperBound( xi );
+
+        if ( FloatUtils::isFinite( xiLB ) )
+        {
+            ciTimesLb[i] = ci * xiLB;
+            if ( ciSign[i] == POSITIVE )
+                auxLb += ciTimesLb[i];
             else
-            {
-                if ( ci > 0 )
-                    excludedFromLB.insert( xi );
-                else
-                    excludedFromUB.insert( xi );
-            }
+                auxUb += ciTimesLb[i];
+        }
+        else
+        {
+            if ( ci > 0 )
+                excludedFromLB.insert( xi );
+            else
+                excludedFromUB.insert( xi );
+        }
 
-            if ( FloatUtils::isFinite( xiUB ) )
-            {
-                ciTimesUb[xi] = ci * xiUB;
-                if ( ciSign[xi] == POSITIVE )
-                    auxUb += ciTimesUb[xi];
-                else
-                    auxLb += ciTimesUb[xi];
-            }
+        if ( FloatUtils::isFinite( xiUB ) )
+        {
+            ciTimesUb[i] = ci * xiUB;
+            if ( ciSign[i] == POSITIVE )
+                auxUb += ciTimesUb[i];
             else
-            {
-                if ( ci > 0 )
-                    excludedFromUB.insert( xi );
-                else
-                    excludedFromLB.insert( xi );
-            }
+                auxLb += ciTimesUb[i];
+        }
+        else
+        {
+            if ( ci > 0 )
+                excludedFromUB.insert( xi );
+            else
+                excludedFromLB.insert( xi );
         }
 
-        // Now, go over each addend in sum (ci * xi) - b ? 0, and see what can be done
-        for ( const auto &addend : equation->_addends )
+        ++i;
+    }
+
+    // Now, go over each addend in sum (ci * xi) - b ? 0, and see what can be done
+    i = 0;
+    for ( const auto &addend : equation._addends )
+    {
+        ci = addend._coefficient;
+        xi = addend._variable;
+
+        // If ci = 0, nothing to do.
+        if ( ciSign[i] == ZERO )
         {
-            ci = addend._coefficient;
-            xi = addend._variable;
+            ++i;
+            continue;
+        }
 
-            // If ci = 0, nothing to do.
-            if ( ciSign[xi] == ZERO )
-                continue;
+        /*
+          The expression for xi is:
 
-            /*
-              The expression for xi is:
+               xi ? ( -1/ci ) * ( sum_{j\neqi} ( cj * xj ) - b )
 
-                   xi ? ( -1/ci ) * ( sum_{j\neqi} ( cj * xj ) - b )
+          We use the previously computed auxLb and auxUb and adjust them because
+          xi is removed from the sum. We also need to pay attention to the sign of ci,
+          and to the presence of infinite bounds.
 
-              We use the previously computed auxLb and auxUb and adjust them because
-              xi is removed from the sum. We also need to pay attention to the sign of ci,
-              and to the presence of infinite bounds.
+          Assuming "?" stands for equality, we can compute a LB if:
+            1. ci is negative, and no vars except xi were excluded from the auxLb
+            2. ci is positive, and no vars except xi were excluded from the auxUb
 
-              Assuming "?" stands for equality, we can compute a LB if:
-                1. ci is negative, and no vars except xi were excluded from the auxLb
-                2. ci is positive, and no vars except xi were excluded from the auxUb
+          And vice-versa for UB.
 
-              And vice-versa for UB.
+          In case "?" is GE or LE, only one direction can be computed.
+        */
+        if ( ciSign[i] == NEGATIVE )
+        {
+            validLb =
+                ( ( type == Equation::LE ) || ( type == Equation::EQ ) )
+                &&
+                ( excludedFromLB.empty() ||
+                  ( excludedFromLB.size() == 1 && excludedFromLB.exists( xi ) ) );
+            validUb =
+                ( ( type == Equation::GE ) || ( type == Equation::EQ ) )
+                &&
+                ( excludedFromUB.empty() ||
+                  ( excludedFromUB.size() == 1 && excludedFromUB.exists( xi ) ) );
+        }
+        else
+        {
+            validLb =
+                ( ( type == Equation::GE ) || ( type == Equation::EQ ) )
+                &&
+                ( excludedFromUB.empty() ||
+                  ( excludedFromUB.size() == 1 && excludedFromUB.exists( xi ) ) );
+            validUb =
+                ( ( type == Equation::LE ) || ( type == Equation::EQ ) )
+                &&
+                ( excludedFromLB.empty() ||
+                  ( excludedFromLB.size() == 1 && excludedFromLB.exists( xi ) ) );
+        }
 
-              In case "?" is GE or LE, only one direction can be computed.
-            */
-            if ( ciSign[xi] == NEGATIVE )
+        // Now compute the actual bounds and see if they are tighter
+        if ( validLb )
+        {
+            if ( ciSign[i] == NEGATIVE )
             {
-                validLb =
-                    ( ( type == Equation::LE ) || ( type == Equation::EQ ) )
-                    &&
-                    ( excludedFromLB.empty() ||
-                      ( excludedFromLB.size() == 1 && excludedFromLB.exists( xi ) ) );
-                validUb =
-                    ( ( type == Equation::GE ) || ( type == Equation::EQ ) )
-                    &&
-                    ( excludedFromUB.empty() ||
-                      ( excludedFromUB.size() == 1 && excludedFromUB.exists( xi ) ) );
+                lowerBound = auxLb;
+                if ( !excludedFromLB.exists( xi ) )
+                    lowerBound -= ciTimesUb[i];
             }
             else
             {
-                validLb =
-                    ( ( type == Equation::GE ) || ( type == Equation::EQ ) )
-                    &&
-                    ( excludedFromUB.empty() ||
-                      ( excludedFromUB.size() == 1 && excludedFromUB.exists( xi ) ) );
-                validUb =
-                    ( ( type == Equation::LE ) || ( type == Equation::EQ ) )
-                    &&
-                    ( excludedFromLB.empty() ||
-                      ( excludedFromLB.size() == 1 && excludedFromLB.exists( xi ) ) );
+                lowerBound = auxUb;
+                if ( !excludedFromUB.exists( xi ) )
+                    lowerBound -= ciTimesUb[i];
             }
 
-            // Now compute the actual bounds and see if they are tighter
-            double epsilon = Options::get()->getFloat( Options::PREPROCESSOR_BOUND_TOLERANCE );
+            lowerBound /= -ci;
 
-            if ( validLb )
-            {
-                if ( ciSign[xi] == NEGATIVE )
-                {
-                    lowerBound = auxLb;
-                    if ( !excludedFromLB.exists( xi ) )
-                        lowerBound -= ciTimesUb[xi];
-                }
-                else
-                {
-                    lowerBound = auxUb;
-                    if ( !excludedFromUB.exists( xi ) )
-                        lowerBound -= ciTimesUb[xi];
-                }
-
-                lowerBound /= -ci;
+            if ( FloatUtils::gt( lowerBound, _preprocessed.getLowerBound( xi ), epsilon ) )
+                tightenings.append( Tightening( xi, lowerBound, Tightening::LB ) );
+        }
 
-                if (
-                    FloatUtils::gt(
-                        lowerBound, _preprocessed.getLowerBound( xi ), epsilon
-                    )
-                )
-                {
-                    tighterBoundFound = true;
-                    _preprocessed.setLowerBound( xi, lowerBound );
-                }
+        if ( validUb )
+        {
+            if ( ciSign[i] == NEGATIVE )
+            {
+                upperBound = auxUb;
+                if ( !excludedFromUB.exists( xi ) )
+                    upperBound -= ciTimesLb[i];
             }
-
-            if ( validUb )
+            else
             {
-                if ( ciSign[xi] == NEGATIVE )
-                {
-                    upperBound = auxUb;
-                    if ( !excludedFromUB.exists( xi ) )
-                        upperBound -= ciTimesLb[xi];
-                }
-                else
-                {
-                    upperBound = auxLb;
-                    if ( !excludedFromLB.exists( xi ) )
-                        upperBound -= ciTimesLb[xi];
-                }
-
-                upperBound /= -ci;
-
-                if (
-                    FloatUtils::lt(
-                        upperBound, _preprocessed.getUpperBound( xi ), epsilon
-                    )
-                )
-                {
-                    tighterBoundFound = true;
-                    _preprocessed.setUpperBound( xi, upperBound );
-                }
+                upperBound = auxLb;
+                if ( !excludedFromLB.exists( xi ) )
+                    upperBound -= ciTimesLb[i];
             }
 
-            if ( FloatUtils::gt( _preprocessed.getLowerBound( xi ),
-                                 _preprocessed.getUpperBound( xi ),
-                                 GlobalConfiguration::PREPROCESSOR_ALMOST_FIXED_THRESHOLD ) )
-            {
-                delete[] ciTimesLb;
-                delete[] ciTimesUb;
-                delete[] ciSign;
+            upperBound /= -ci;
 
-                throw InfeasibleQueryException();
-            }
+            if ( FloatUtils::lt( upperBound, _preprocessed.getUpperBound( xi ), epsilon ) )
+                tightenings.append( Tightening( xi, upperBound, Tightening::UB ) );
         }
 
-        delete[] ciTimesLb;
-        delete[] ciTimesUb;
-        delete[] ciSign;
+        ++i;
+    }
+}
 
-        /*
-          Next, do another sweep over the equation.
-          Look for almost-fixed variables and fix them, and remove the equation
-          entirely if it has nothing left to contribute.
-        */
-        bool allFixed = true;
-        for ( const auto &addend : equation->_addends )
-        {
-            unsigned var = addend._variable;
-            double lb = _preprocessed.getLowerBound( var );
-            double ub = _preprocessed.getUpperBound( var );
+bool Preprocessor::applyEquationTightenings( const List<Tightening> &tightenings, double epsilon )
+{
+    bool tighterBoundFound = false;
 
-            if ( FloatUtils::areEqual( lb, ub, GlobalConfiguration::PREPROCESSOR_ALMOST_FIXED_THRESHOLD ) )
-                _preprocessed.setUpperBound( var, _preprocessed.getLowerBound( var ) );
-            else
-                allFixed = false;
-        }
+    for ( const auto &tightening : tightenings )
+    {
+        unsigned variable = tightening._variable;
 
-        if ( !allFixed )
+        // Bounds derived in parallel may have been overtaken by others
+        if ( tightening._type == Tightening::LB )
         {
-            ++equation;
+            if ( FloatUtils::gt( tightening._value, _preprocessed.getLowerBound( variable ), epsilon ) )
+            {
+                tighterBoundFound = true;
+                setLowerBound( variable, tightening._value );
+            }
         }
         else
         {
-            double sum = 0;
-            for ( const auto &addend : equation->_addends )
-                sum += addend._coefficient * _preprocessed.getLowerBound( addend._variable );
-
-            if ( FloatUtils::areDisequal( sum, equation->_scalar, GlobalConfiguration::PREPROCESSOR_ALMOST_FIXED_THRESHOLD ) )
+            if ( FloatUtils::lt( tightening._value, _preprocessed.getUpperBound( variable ), epsilon ) )
             {
-                throw InfeasibleQueryException();
+                tighterBoundFound = true;
+                setUpperBound( variable, tightening._value );
             }
-            equation = equations.erase( equation );
         }
+
+        if ( FloatUtils::gt( _preprocessed.getLowerBound( variable ),
+                             _preprocessed.getUpperBound( variable ),
+                             GlobalConfiguration::PREPROCESSOR_ALMOST_FIXED_THRESHOLD ) )
+            throw InfeasibleQueryException();
     }
 
     return tighterBoundFound;
 }
 
+bool Preprocessor::fixAlmostFixedVariables( const Equation &equation )
+{
+    bool allFixed = true;
+    for ( const auto &addend : equation._addends )
+    {
+        unsigned var = addend._variable;
+        double lb = _preprocessed.getLowerBound( var );
+        double ub = _preprocessed.getUpperBound( var );
+
+        if ( FloatUtils::gt( lb, ub, GlobalConfiguration::PREPROCESSOR_ALMOST_FIXED_THRESHOLD ) )
+            throw InfeasibleQueryException();
+
+        if ( FloatUtils::areEqual( lb, ub, GlobalConfiguration::PREPROCESSOR_ALMOST_FIXED_THRESHOLD ) )
+        {
+            if ( lb != ub )
+                setUpperBound( var, lb );
+        }
+        else
+            allFixed = false;
+    }
+
+    return allFixed;
+}
+
 bool Preprocessor::processConstraints()
 {
     bool tighterBoundFound = false;
 
 	for ( auto &constraint : _preprocessed.getPiecewiseLinearConstraints() )
 	{
+        if ( !constraintNeedsProcessing( *constraint ) )
+            continue;
+
 		for ( unsigned variable : constraint->getParticipatingVariables() )
 		{
 			constraint->notifyLowerBound( variable, _preprocessed.getLowerBound( variable ) );
@@ -454,21 +557,23 @@ bool Preprocessor::processConstraints()
                  ( FloatUtils::gt( tightening._value, _preprocessed.getLowerBound( tightening._variable ) ) ) )
             {
                 tighterBoundFound = true;
-                _preprocessed.setLowerBound( tightening._variable, tightening._value );
+                setLowerBound( tightening._variable, tightening._value );
             }
 
             else if ( ( tightening._type == Tightening::UB ) &&
                       ( FloatUtils::lt( tightening._value, _preprocessed.getUpperBound( tightening._variable ) ) ) )
             {
                 tighterBoundFound = true;
-                _preprocessed.setUpperBound( tightening._variable, tightening._value );
+                setUpperBound( tightening._variable, tightening._value );
             }
 
             if ( FloatUtils::areEqual( _preprocessed.getLowerBound( tightening._variable ),
                                        _preprocessed.getUpperBound( tightening._variable ),
-                                       GlobalConfiguration::PREPROCESSOR_ALMOST_FIXED_THRESHOLD ) )
-                _preprocessed.setUpperBound( tightening._variable,
-                                             _preprocessed.getLowerBound( tightening._variable ) );
+                                       GlobalConfiguration::PREPROCESSOR_ALMOST_FIXED_THRESHOLD ) &&
+                 _preprocessed.getLowerBound( tightening._variable ) !=
+                 _preprocessed.getUpperBound( tightening._variable ) )
+                setUpperBound( tightening._variable,
+                               _preprocessed.getLowerBound( tightening._variable ) );
 
             if ( FloatUtils::gt( _preprocessed.getLowerBound( tightening._variable ),
                                  _preprocessed.getUpperBound( tightening._variable ),
@@ -536,8 +641,9 @@ bool Preprocessor::processIdenticalVariables()
 
         equation = equations.erase( equation );
 
-        _preprocessed.setLowerBound( v2, bestLowerBound );
-        _preprocessed.setUpperBound( v2, bestUpperBound );
+        // The equations and constraints of v1 now involve v2
+        setLowerBound( v2, bestLowerBound );
+        setUpperBound( v2, bestUpperBound );
 
         _preprocessed.mergeIdenticalVariables( v1, v2 );
 
@@ -846,6 +952,56 @@ void Preprocessor::setStatistics( Statistics *statistics )
     _statistics = statistics;
 }
 
+void Preprocessor::setThreadPool( ThreadPool *threadPool )
+{
+    _threadPool = threadPool;
+}
+
+void Preprocessor::setLowerBound( unsigned variable, double bound )
+{
+    _preprocessed.setLowerBound( variable, bound );
+    _lastBoundChange[variable] = ++_numBoundChanges;
+}
+
+void Preprocessor::setUpperBound( unsigned variable, double bound )
+{
+    _preprocessed.setUpperBound( variable, bound );
+    _lastBoundChange[variable] = ++_numBoundChanges;
+}
+
+void Preprocessor::startTighteningRound()
+{
+    _previousRoundStart = _roundStart;
+    _roundStart = _numBoundChanges;
+}
+
+bool Preprocessor::changedSincePreviousRound( unsigned variable ) const
+{
+    return _lastBoundChange[variable] > _previousRoundStart;
+}
+
+bool Preprocessor::equationNeedsProcessing( const Equation &equation ) const
+{
+    for ( const auto &addend : equation._addends )
+    {
+        if ( changedSincePreviousRound( addend._variable ) )
+            return true;
+    }
+
+    return false;
+}
+
+bool Preprocessor::constraintNeedsProcessing( const PiecewiseLinearConstraint &constraint ) const
+{
+    for ( unsigned variable : constraint.getParticipatingVariables() )
+    {
+        if ( changedSincePreviousRound( variable ) )
+            return true;
+    }
+
+    return false;
+}
+
 void Preprocessor::setMissingBoundsToInfinity()
 {
     for ( unsigned i = 0; i < _preprocessed.getNumberOfVariables(); ++i )
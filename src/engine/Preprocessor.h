@@ -22,6 +22,11 @@
 #include "Map.h"
 #include "PiecewiseLinearConstraint.h"
 #include "Set.h"
+#include "Tightening.h"
+
+#include <vector>
+
+class ThreadPool;
 
 class Preprocessor
 {
@@ -38,6 +43,13 @@ public:
     */
     void setStatistics( Statistics *statistics );
 
+    /*
+      Derive bounds from the equations on the threads of the pool. The
+      bounds derived from all the equations of a round are then applied
+      together, so the result does not depend on the number of threads.
+    */
+    void setThreadPool( ThreadPool *threadPool );
+
     /*
       Obtain the values of variabels that have become fixed.
     */
@@ -72,11 +84,50 @@ private:
 	*/
 	bool processEquations();
 
+    /*
+      Compute the bounds entailed by a single equation that are tighter
+      than the current ones. Only reads the bounds of the query.
+    */
+    void deriveBoundsFromEquation( const Equation &equation,
+                                   double epsilon,
+                                   List<Tightening> &tightenings ) const;
+
+    /*
+      Apply the tighter bounds derived from an equation. Return true if
+      any bound was tightened.
+    */
+    bool applyEquationTightenings( const List<Tightening> &tightenings, double epsilon );
+
+    /*
+      Fix the almost-fixed variables of the equation. Return true if all
+      of its variables are fixed, in which case the equation can be
+      removed.
+    */
+    bool fixAlmostFixedVariables( const Equation &equation );
+
     /*
       Tighten the bounds using the piecewise linear constraints
 	*/
 	bool processConstraints();
 
+    /*
+      Set the bounds of a variable during the bound-tightening loop,
+      recording that the variable has changed.
+    */
+    void setLowerBound( unsigned variable, double bound );
+    void setUpperBound( unsigned variable, double bound );
+
+    /*
+      Start a round of the bound-tightening loop. An equation or a
+      constraint is processed in a round only if one of its variables
+      has changed since the start of the previous round: otherwise, it
+      has been examined since its variables last changed.
+    */
+    void startTighteningRound();
+    bool changedSincePreviousRound( unsigned variable ) const;
+    bool equationNeedsProcessing( const Equation &equation ) const;
+    bool constraintNeedsProcessing( const PiecewiseLinearConstraint &constraint ) const;
+
     /*
       If there exists an equation x = x', replace all instances of x with x'
     */
@@ -120,6 +171,28 @@ private:
     */
     Statistics *_statistics;
 
+    /*
+      Threads for deriving bounds from the equations, if any
+    */
+    ThreadPool *_threadPool;
+
+    /*
+      Every bound change in the bound-tightening loop gets a new stamp,
+      which is recorded for the variable, and the stamps at the start of
+      the current and previous rounds.
+    */
+    std::vector<unsigned> _lastBoundChange;
+    unsigned _numBoundChanges;
+    unsigned _roundStart;
+    unsigned _previousRoundStart;
+
+    /*
+      Work space for processing the equations: the equations to process
+      in the current round, and the bounds derived from each of them.
+    */
+    std::vector<List<Equation>::iterator> _equationsToProcess;
+    std::vector<List<Tightening>> _equationTightenings;
+
     /*
       Variables that have become fixed during preprocessing, and the
       values that they have been fixed to.
@@ -0,0 +1,34 @@
+/*********************                                                        */
+/*! \file PrimalRatioTestType.h
+** \verbatim
+** Top contributors (to current version):
+**   Guy Katz
+** This file is part of the Marabou project.
+** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved. See the file COPYING in the top-level source
+** directory for licensing information.\endverbatim
+**
+** [[ Add lengthier description here ]]
+
+**/
+
+#ifndef __PrimalRatioTestType_h__
+#define __PrimalRatioTestType_h__
+
+/*
+  Ratio test options for primal simplex steps
+*/
+enum class PrimalRatioTestType
+{
+     // Stop at the first basic variable to reach its bound
+     TEXTBOOK = 0,
+     // Relax the bounds slightly, and among the basic variables that
+     // reach them first, pick the one with the largest pivot element
+     HARRIS = 1,
+     // Move past the bounds of basic variables as long as the sum of
+     // infeasibilities keeps decreasing
+     LONG_STEP = 2,
+};
+
+#endif // __PrimalRatioTestType_h__
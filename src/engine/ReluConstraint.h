@@ -178,8 +178,6 @@ public:
     */
     void updateDirection();
 
-    PhaseStatus getDirection() const;
-
     void updateScoreBasedOnPolarity();
 
 private:
@@ -187,12 +185,6 @@ private:
     bool _auxVarInUse;
     unsigned _aux;
 
-    /*
-      Denotes which case split to handle first.
-      And which phase status to repair a relu into.
-    */
-    PhaseStatus _direction;
-
     PiecewiseLinearCaseSplit getInactiveSplit() const;
     PiecewiseLinearCaseSplit getActiveSplit() const;
 
@@ -20,66 +20,145 @@
 #include "SparseUnsortedList.h"
 #include "Statistics.h"
 
+#include <algorithm>
+
 RowBoundTightener::RowBoundTightener( const ITableau &tableau )
     : _tableau( tableau )
+    , _n( 0 )
+    , _m( 0 )
+    , _nCapacity( 0 )
+    , _mCapacity( 0 )
     , _lowerBounds( NULL )
     , _upperBounds( NULL )
     , _tightenedLower( NULL )
     , _tightenedUpper( NULL )
     , _rows( NULL )
     , _z( NULL )
+    , _ANColumn( NULL )
     , _ciTimesLb( NULL )
     , _ciTimesUb( NULL )
     , _ciSign( NULL )
+    , _rowOnDemand( NULL )
+    , _rho( NULL )
+    , _rowCoefficients( NULL )
+    , _inRowSupport( NULL )
+    , _examineAllRows( true )
+    , _variableChanged( NULL )
+    , _rowQueued( NULL )
+    , _numBoundChanges( 0 )
+    , _lastBoundChange( NULL )
+    , _rowLastExamined( NULL )
     , _statistics( NULL )
 {
 }
 
 void RowBoundTightener::setDimensions()
 {
-    freeMemoryIfNeeded();
+    unsigned n = _tableau.getN();
+    unsigned m = _tableau.getM();
+
+    /*
+      The tableau grows by adding rows (and their auxiliary variables),
+      which keeps the number of non-basic variables. In that case the work
+      memory is reused while it fits, and otherwise grows geometrically.
+    */
+    if ( !_lowerBounds || n - m != _n - _m )
+    {
+        freeMemoryIfNeeded();
+        _nCapacity = n;
+        _mCapacity = m;
+        allocateMemory();
+    }
+    else if ( n > _nCapacity || m > _mCapacity )
+    {
+        unsigned growth = std::max( m - _m, _mCapacity );
+        freeMemoryIfNeeded();
+        _nCapacity = _n + growth;
+        _mCapacity = _m + growth;
+        allocateMemory();
+    }
+
+    _n = n;
+    _m = m;
+
+    std::fill_n( _rowQueued, _m, false );
+    std::fill_n( _rowCoefficients, _n, 0.0 );
+    std::fill_n( _inRowSupport, _n, false );
 
-    _n = _tableau.getN();
-    _m = _tableau.getM();
+    resetBounds();
+}
 
-    _lowerBounds = new double[_n];
+void RowBoundTightener::allocateMemory()
+{
+    _lowerBounds = new double[_nCapacity];
     if ( !_lowerBounds )
         throw MarabouError( MarabouError::ALLOCATION_FAILED, "RowBoundTightener::lowerBounds" );
 
-    _upperBounds = new double[_n];
+    _upperBounds = new double[_nCapacity];
     if ( !_upperBounds )
         throw MarabouError( MarabouError::ALLOCATION_FAILED, "RowBoundTightener::upperBounds" );
 
-    _tightenedLower = new bool[_n];
+    _tightenedLower = new bool[_nCapacity];
     if ( !_tightenedLower )
         throw MarabouError( MarabouError::ALLOCATION_FAILED, "RowBoundTightener::tightenedLower" );
 
-    _tightenedUpper = new bool[_n];
+    _tightenedUpper = new bool[_nCapacity];
     if ( !_tightenedUpper )
         throw MarabouError( MarabouError::ALLOCATION_FAILED, "RowBoundTightener::tightenedUpper" );
 
-    resetBounds();
+    _variableChanged = new bool[_nCapacity];
+    if ( !_variableChanged )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "RowBoundTightener::variableChanged" );
+
+    _rowQueued = new bool[_mCapacity];
+    if ( !_rowQueued )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "RowBoundTightener::rowQueued" );
+
+    _lastBoundChange = new unsigned[_nCapacity];
+    if ( !_lastBoundChange )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "RowBoundTightener::lastBoundChange" );
+
+    _rowLastExamined = new unsigned[_mCapacity];
+    if ( !_rowLastExamined )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "RowBoundTightener::rowLastExamined" );
 
     if ( GlobalConfiguration::EXPLICIT_BASIS_BOUND_TIGHTENING_TYPE ==
          GlobalConfiguration::COMPUTE_INVERTED_BASIS_MATRIX )
     {
-        _rows = new TableauRow *[_m];
-        for ( unsigned i = 0; i < _m; ++i )
-            _rows[i] = new TableauRow( _n - _m );
+        _rows = new TableauRow *[_mCapacity];
+        for ( unsigned i = 0; i < _mCapacity; ++i )
+            _rows[i] = new TableauRow( _nCapacity - _mCapacity );
     }
     else if ( GlobalConfiguration::EXPLICIT_BASIS_BOUND_TIGHTENING_TYPE ==
               GlobalConfiguration::USE_IMPLICIT_INVERTED_BASIS_MATRIX )
     {
-        _rows = new TableauRow *[_m];
-        for ( unsigned i = 0; i < _m; ++i )
-            _rows[i] = new TableauRow( _n - _m );
+        _rows = new TableauRow *[_mCapacity];
+        for ( unsigned i = 0; i < _mCapacity; ++i )
+            _rows[i] = new TableauRow( _nCapacity - _mCapacity );
 
-        _z = new double[_m];
+        _z = new double[_mCapacity];
+        _ANColumn = new double[_mCapacity];
     }
 
-    _ciTimesLb = new double[_n];
-    _ciTimesUb = new double[_n];
-    _ciSign = new char[_n];
+    // The work memory for computing rows on demand is linear in the size
+    // of the tableau, and is always allocated
+    _rowOnDemand = new TableauRow( _nCapacity - _mCapacity );
+
+    _rho = new double[_mCapacity];
+    if ( !_rho )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "RowBoundTightener::rho" );
+
+    _rowCoefficients = new double[_nCapacity];
+    if ( !_rowCoefficients )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "RowBoundTightener::rowCoefficients" );
+
+    _inRowSupport = new bool[_nCapacity];
+    if ( !_inRowSupport )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "RowBoundTightener::inRowSupport" );
+
+    _ciTimesLb = new double[_nCapacity];
+    _ciTimesUb = new double[_nCapacity];
+    _ciSign = new char[_nCapacity];
 }
 
 void RowBoundTightener::resetBounds()
@@ -92,6 +171,10 @@ void RowBoundTightener::resetBounds()
         _lowerBounds[i] = _tableau.getLowerBound( i );
         _upperBounds[i] = _tableau.getUpperBound( i );
     }
+
+    _examineAllRows = true;
+    _changedVariables.clear();
+    std::fill_n( _variableChanged, _n, false );
 }
 
 void RowBoundTightener::clear()
@@ -104,6 +187,10 @@ void RowBoundTightener::clear()
         _lowerBounds[i] = _tableau.getLowerBound( i );
         _upperBounds[i] = _tableau.getUpperBound( i );
     }
+
+    _examineAllRows = true;
+    _changedVariables.clear();
+    std::fill_n( _variableChanged, _n, false );
 }
 
 RowBoundTightener::~RowBoundTightener()
@@ -137,20 +224,74 @@ void RowBoundTightener::freeMemoryIfNeeded()
         _tightenedUpper = NULL;
     }
 
+    if ( _variableChanged )
+    {
+        delete[] _variableChanged;
+        _variableChanged = NULL;
+    }
+
+    if ( _rowQueued )
+    {
+        delete[] _rowQueued;
+        _rowQueued = NULL;
+    }
+
+    if ( _lastBoundChange )
+    {
+        delete[] _lastBoundChange;
+        _lastBoundChange = NULL;
+    }
+
+    if ( _rowLastExamined )
+    {
+        delete[] _rowLastExamined;
+        _rowLastExamined = NULL;
+    }
+
     if ( _rows )
     {
-        for ( unsigned i = 0; i < _m; ++i )
+        for ( unsigned i = 0; i < _mCapacity; ++i )
             delete _rows[i];
         delete[] _rows;
         _rows = NULL;
     }
 
+    if ( _rowOnDemand )
+    {
+        delete _rowOnDemand;
+        _rowOnDemand = NULL;
+    }
+
+    if ( _rho )
+    {
+        delete[] _rho;
+        _rho = NULL;
+    }
+
+    if ( _rowCoefficients )
+    {
+        delete[] _rowCoefficients;
+        _rowCoefficients = NULL;
+    }
+
+    if ( _inRowSupport )
+    {
+        delete[] _inRowSupport;
+        _inRowSupport = NULL;
+    }
+
     if ( _z )
     {
         delete[] _z;
         _z = NULL;
     }
 
+    if ( _ANColumn )
+    {
+        delete[] _ANColumn;
+        _ANColumn = NULL;
+    }
+
     if ( _ciTimesLb )
     {
         delete[] _ciTimesLb;
@@ -191,8 +332,8 @@ void RowBoundTightener::examineImplicitInvertedBasisMatrix( bool untilSaturation
     for ( unsigned i = 0; i < _n - _m; ++i )
     {
         unsigned nonBasic = _tableau.nonBasicIndexToVariable( i );
-        const double *ANColumn = _tableau.getAColumn( nonBasic );
-        _tableau.forwardTransformation( ANColumn, _z );
+        _tableau.getAColumn( nonBasic, _ANColumn );
+        _tableau.forwardTransformation( _ANColumn, _z );
 
         for ( unsigned j = 0; j < _m; ++j )
         {
@@ -202,21 +343,7 @@ void RowBoundTightener::examineImplicitInvertedBasisMatrix( bool untilSaturation
     }
 
     // We now have all the rows, can use them for tightening.
-    // The tightening procedure may throw an exception, in which case we need
-    // to release the rows.
-    unsigned newBoundsLearned;
-    unsigned maxNumberOfIterations = untilSaturation ?
-        GlobalConfiguration::ROW_BOUND_TIGHTENER_SATURATION_ITERATIONS : 1;
-    do
-    {
-        newBoundsLearned = onePassOverInvertedBasisRows();
-
-        if ( _statistics && ( newBoundsLearned > 0 ) )
-            _statistics->incNumTighteningsFromExplicitBasis( newBoundsLearned );
-
-        --maxNumberOfIterations;
-    }
-    while ( ( maxNumberOfIterations != 0 ) && ( newBoundsLearned > 0 ) );
+    examineInvertedBasisRowsUntilSaturation( untilSaturation );
 }
 
 void RowBoundTightener::examineInvertedBasisMatrix( bool untilSaturation )
@@ -264,40 +391,212 @@ void RowBoundTightener::examineInvertedBasisMatrix( bool untilSaturation )
         // We now have all the rows, can use them for tightening.
         // The tightening procedure may throw an exception, in which case we need
         // to release the rows.
+        examineInvertedBasisRowsUntilSaturation( untilSaturation );
+    }
+    catch ( ... )
+    {
+        delete[] invB;
+        throw;
+    }
+
+    delete[] invB;
+}
 
-        unsigned newBoundsLearned;
-        unsigned maxNumberOfIterations = untilSaturation ?
-            GlobalConfiguration::ROW_BOUND_TIGHTENER_SATURATION_ITERATIONS : 1;
-        do
+void RowBoundTightener::examineInvertedBasisRowsOnDemand( bool untilSaturation )
+{
+    unsigned newBoundsLearned;
+    unsigned maxNumberOfIterations = untilSaturation ?
+        GlobalConfiguration::ROW_BOUND_TIGHTENER_SATURATION_ITERATIONS : 1;
+    do
+    {
+        newBoundsLearned = 0;
+        for ( unsigned i = 0; i < _m; ++i )
         {
-            newBoundsLearned = onePassOverInvertedBasisRows();
+            computeInvertedBasisRow( i, *_rowOnDemand );
 
-            if ( _statistics && ( newBoundsLearned > 0 ) )
-                _statistics->incNumTighteningsFromExplicitBasis( newBoundsLearned );
+            if ( !hasTighteningPotential( *_rowOnDemand ) )
+            {
+                if ( _statistics )
+                    _statistics->incNumExplicitBasisRowsSkipped();
+                continue;
+            }
 
-            --maxNumberOfIterations;
+            newBoundsLearned += tightenOnSingleInvertedBasisRow( *_rowOnDemand );
         }
-        while ( ( maxNumberOfIterations != 0 ) && ( newBoundsLearned > 0 ) );
+
+        if ( _statistics && ( newBoundsLearned > 0 ) )
+            _statistics->incNumTighteningsFromExplicitBasis( newBoundsLearned );
+
+        --maxNumberOfIterations;
     }
-    catch ( ... )
+    while ( ( maxNumberOfIterations != 0 ) && ( newBoundsLearned > 0 ) );
+}
+
+void RowBoundTightener::computeInvertedBasisRow( unsigned index, TableauRow &row )
+{
+    /*
+      The row is e * inv(B) * ( b - AN xN ), where e is the unit vector
+      with 1 in entry index. First find rho = e * inv(B) by BTRAN, and
+      then accumulate rho * A over the rows of A in which rho is not
+      zero.
+    */
+    SparseUnsortedList unitVector( _m );
+    unitVector.append( index, 1 );
+    _tableau.sparseBackwardTransformation( unitVector, _rho );
+
+    const double *b = _tableau.getRightHandSide();
+    double scalar = 0;
+
+    for ( unsigned i = 0; i < _m; ++i )
     {
-        delete[] invB;
-        throw;
+        double rho = _rho[i];
+        if ( FloatUtils::isZero( rho ) )
+            continue;
+
+        scalar += rho * b[i];
+
+        for ( const auto &entry : *_tableau.getSparseARow( i ) )
+        {
+            unsigned variable = entry._index;
+            if ( !_inRowSupport[variable] )
+            {
+                _inRowSupport[variable] = true;
+                _rowSupport.push_back( variable );
+            }
+
+            _rowCoefficients[variable] += rho * entry._value;
+        }
     }
 
-    delete[] invB;
+    // Keep the non-zero coefficients of the non-basic variables, and
+    // clear the accumulator for the next row
+    unsigned size = 0;
+    for ( const auto &variable : _rowSupport )
+    {
+        double coefficient = _rowCoefficients[variable];
+        _rowCoefficients[variable] = 0;
+        _inRowSupport[variable] = false;
+
+        if ( _tableau.isBasic( variable ) || FloatUtils::isZero( coefficient ) )
+            continue;
+
+        row._row[size]._var = variable;
+        row._row[size]._coefficient = -coefficient;
+        ++size;
+    }
+    _rowSupport.clear();
+
+    row._size = size;
+    row._scalar = scalar;
+    row._lhs = _tableau.basicIndexToVariable( index );
+}
+
+bool RowBoundTightener::hasTighteningPotential( const TableauRow &row ) const
+{
+    /*
+      The row y = scalar + sum ci xi is written as
+
+         sum ci xi - y = -scalar
+    */
+    unsigned y = row._lhs;
+    if ( !FloatUtils::isFinite( _lowerBounds[y] ) || !FloatUtils::isFinite( _upperBounds[y] ) )
+        return true;
+
+    double minActivity = -_upperBounds[y];
+    double maxActivity = -_lowerBounds[y];
+    double maxWidth = _upperBounds[y] - _lowerBounds[y];
+
+    for ( unsigned i = 0; i < row._size; ++i )
+    {
+        unsigned xi = row._row[i]._var;
+        double ci = row._row[i]._coefficient;
+
+        if ( !FloatUtils::isFinite( _lowerBounds[xi] ) || !FloatUtils::isFinite( _upperBounds[xi] ) )
+            return true;
+
+        double ciTimesLb = ci * _lowerBounds[xi];
+        double ciTimesUb = ci * _upperBounds[xi];
+
+        if ( ci > 0 )
+        {
+            minActivity += ciTimesLb;
+            maxActivity += ciTimesUb;
+        }
+        else
+        {
+            minActivity += ciTimesUb;
+            maxActivity += ciTimesLb;
+        }
+
+        double width = FloatUtils::abs( ciTimesUb - ciTimesLb );
+        if ( width > maxWidth )
+            maxWidth = width;
+    }
+
+    double slack = FloatUtils::min( -row._scalar - minActivity, maxActivity + row._scalar );
+    return FloatUtils::gt( maxWidth, slack );
 }
 
-unsigned RowBoundTightener::onePassOverInvertedBasisRows()
+void RowBoundTightener::examineInvertedBasisRowsUntilSaturation( bool untilSaturation )
+{
+    _numBoundChanges = 0;
+    std::fill_n( _lastBoundChange, _n, 0 );
+
+    unsigned newBoundsLearned;
+    unsigned maxNumberOfIterations = untilSaturation ?
+        GlobalConfiguration::ROW_BOUND_TIGHTENER_SATURATION_ITERATIONS : 1;
+    bool firstPass = true;
+    do
+    {
+        newBoundsLearned = onePassOverInvertedBasisRows( firstPass );
+        firstPass = false;
+
+        if ( _statistics && ( newBoundsLearned > 0 ) )
+            _statistics->incNumTighteningsFromExplicitBasis( newBoundsLearned );
+
+        --maxNumberOfIterations;
+    }
+    while ( ( maxNumberOfIterations != 0 ) && ( newBoundsLearned > 0 ) );
+}
+
+unsigned RowBoundTightener::onePassOverInvertedBasisRows( bool firstPass )
 {
     unsigned newBounds = 0;
 
     for ( unsigned i = 0; i < _m; ++i )
+    {
+        if ( !firstPass && !invertedBasisRowChanged( i ) )
+            continue;
+
         newBounds += tightenOnSingleInvertedBasisRow( *( _rows[i] ) );
 
+        // Bounds derived from the row itself do not trigger its
+        // re-examination: another pass over the same row learns
+        // nothing new
+        _rowLastExamined[i] = _numBoundChanges;
+    }
+
     return newBounds;
 }
 
+bool RowBoundTightener::invertedBasisRowChanged( unsigned i ) const
+{
+    const TableauRow &row( *_rows[i] );
+    unsigned lastExamined = _rowLastExamined[i];
+
+    if ( _lastBoundChange[row._lhs] > lastExamined )
+        return true;
+
+    for ( unsigned j = 0; j < row._size; ++j )
+    {
+        if ( ( _lastBoundChange[row._row[j]._var] > lastExamined ) &&
+             !FloatUtils::isZero( row._row[j]._coefficient ) )
+            return true;
+    }
+
+    return false;
+}
+
 unsigned RowBoundTightener::tightenOnSingleInvertedBasisRow( const TableauRow &row )
 {
 	/*
@@ -307,9 +606,6 @@ unsigned RowBoundTightener::tightenOnSingleInvertedBasisRow( const TableauRow &r
 
       We wish to tighten once for y, but also once for every x.
     */
-    unsigned n = _tableau.getN();
-    unsigned m = _tableau.getM();
-
     unsigned result = 0;
 
     // Compute ci * lb, ci * ub, flag signs for all entries
@@ -319,7 +615,7 @@ unsigned RowBoundTightener::tightenOnSingleInvertedBasisRow( const TableauRow &r
         NEGATIVE = 2,
     };
 
-    for ( unsigned i = 0; i < n - m; ++i )
+    for ( unsigned i = 0; i < row._size; ++i )
     {
         double ci = row[i];
 
@@ -346,7 +642,7 @@ unsigned RowBoundTightener::tightenOnSingleInvertedBasisRow( const TableauRow &r
     unsigned xi;
     double ci;
 
-    for ( unsigned i = 0; i < n - m; ++i )
+    for ( unsigned i = 0; i < row._size; ++i )
     {
         if ( _ciSign[i] == POSITIVE )
         {
@@ -364,6 +660,7 @@ unsigned RowBoundTightener::tightenOnSingleInvertedBasisRow( const TableauRow &r
     {
         _lowerBounds[y] = lowerBound;
         _tightenedLower[y] = true;
+        recordBoundChange( y );
         ++result;
     }
 
@@ -371,6 +668,7 @@ unsigned RowBoundTightener::tightenOnSingleInvertedBasisRow( const TableauRow &r
     {
         _upperBounds[y] = upperBound;
         _tightenedUpper[y] = true;
+        recordBoundChange( y );
         ++result;
     }
 
@@ -396,7 +694,7 @@ unsigned RowBoundTightener::tightenOnSingleInvertedBasisRow( const TableauRow &r
     double auxUb = _upperBounds[y] - row._scalar;
 
     // Now add ALL xi's
-    for ( unsigned i = 0; i < n - m; ++i )
+    for ( unsigned i = 0; i < row._size; ++i )
     {
         if ( _ciSign[i] == NEGATIVE )
         {
@@ -411,7 +709,7 @@ unsigned RowBoundTightener::tightenOnSingleInvertedBasisRow( const TableauRow &r
     }
 
     // Now consider each individual xi
-    for ( unsigned i = 0; i < n - m; ++i )
+    for ( unsigned i = 0; i < row._size; ++i )
     {
         // If ci = 0, nothing to do.
         if ( _ciSign[i] == ZERO )
@@ -450,6 +748,7 @@ unsigned RowBoundTightener::tightenOnSingleInvertedBasisRow( const TableauRow &r
         {
             _lowerBounds[xi] = lowerBound;
             _tightenedLower[xi] = true;
+            recordBoundChange( xi );
             ++result;
         }
 
@@ -457,6 +756,7 @@ unsigned RowBoundTightener::tightenOnSingleInvertedBasisRow( const TableauRow &r
         {
             _upperBounds[xi] = upperBound;
             _tightenedUpper[xi] = true;
+            recordBoundChange( xi );
             ++result;
         }
 
@@ -493,14 +793,56 @@ unsigned RowBoundTightener::onePassOverConstraintMatrix()
 {
     unsigned result = 0;
 
-    unsigned m = _tableau.getM();
+    if ( _examineAllRows )
+    {
+        // Changes made during this pass are recorded for the next one
+        _examineAllRows = false;
 
-    for ( unsigned i = 0; i < m; ++i )
-        result += tightenOnSingleConstraintRow( i );
+        unsigned m = _tableau.getM();
+        for ( unsigned i = 0; i < m; ++i )
+            result += tightenOnSingleConstraintRow( i );
+
+        return result;
+    }
+
+    // Collect the rows in which the changed variables appear
+    for ( const auto &variable : _changedVariables )
+    {
+        _variableChanged[variable] = false;
+
+        const SparseUnsortedList *column = _tableau.getSparseAColumn( variable );
+        for ( const auto &entry : *column )
+        {
+            if ( !_rowQueued[entry._index] )
+            {
+                _rowQueued[entry._index] = true;
+                _rowsToExamine.push_back( entry._index );
+            }
+        }
+    }
+    _changedVariables.clear();
+
+    for ( const auto &row : _rowsToExamine )
+        _rowQueued[row] = false;
+
+    for ( const auto &row : _rowsToExamine )
+        result += tightenOnSingleConstraintRow( row );
+    _rowsToExamine.clear();
 
     return result;
 }
 
+void RowBoundTightener::recordBoundChange( unsigned variable )
+{
+    _lastBoundChange[variable] = ++_numBoundChanges;
+
+    if ( !_examineAllRows && !_variableChanged[variable] )
+    {
+        _variableChanged[variable] = true;
+        _changedVariables.push_back( variable );
+    }
+}
+
 unsigned RowBoundTightener::tightenOnSingleConstraintRow( unsigned row )
 {
     /*
@@ -513,8 +855,6 @@ unsigned RowBoundTightener::tightenOnSingleConstraintRow( unsigned row )
 
           sum ci xi - b
     */
-    unsigned n = _tableau.getN();
-
     unsigned result = 0;
 
     const SparseUnsortedList *sparseRow = _tableau.getSparseARow( row );
@@ -523,17 +863,14 @@ unsigned RowBoundTightener::tightenOnSingleConstraintRow( unsigned row )
     double ci;
     unsigned index;
 
-    // Compute ci * lb, ci * ub, flag signs for all entries
+    // Compute ci * lb, ci * ub, flag signs for the row's entries. Only
+    // the entries of the row are read afterwards, so the rest of the
+    // work arrays need not be cleared.
     enum {
-        ZERO = 0,
         POSITIVE = 1,
         NEGATIVE = 2,
     };
 
-    std::fill_n( _ciSign, n, ZERO );
-    std::fill_n( _ciTimesLb, n, 0 );
-    std::fill_n( _ciTimesUb, n, 0 );
-
     for ( const auto &entry : *sparseRow )
     {
         index = entry._index;
@@ -565,17 +902,18 @@ unsigned RowBoundTightener::tightenOnSingleConstraintRow( unsigned row )
     double auxUb = b[row];
 
     // Now add ALL xi's
-    for ( unsigned i = 0; i < n; ++i )
+    for ( const auto &entry : *sparseRow )
     {
-        if ( _ciSign[i] == NEGATIVE )
+        index = entry._index;
+        if ( _ciSign[index] == NEGATIVE )
         {
-            auxLb -= _ciTimesLb[i];
-            auxUb -= _ciTimesUb[i];
+            auxLb -= _ciTimesLb[index];
+            auxUb -= _ciTimesUb[index];
         }
         else
         {
-            auxLb -= _ciTimesUb[i];
-            auxUb -= _ciTimesLb[i];
+            auxLb -= _ciTimesUb[index];
+            auxUb -= _ciTimesLb[index];
         }
     }
 
@@ -620,6 +958,7 @@ unsigned RowBoundTightener::tightenOnSingleConstraintRow( unsigned row )
         {
             _lowerBounds[index] = lowerBound;
             _tightenedLower[index] = true;
+            recordBoundChange( index );
             ++result;
         }
 
@@ -627,6 +966,7 @@ unsigned RowBoundTightener::tightenOnSingleConstraintRow( unsigned row )
         {
             _upperBounds[index] = upperBound;
             _tightenedUpper[index] = true;
+            recordBoundChange( index );
             ++result;
         }
 
@@ -678,6 +1018,7 @@ void RowBoundTightener::notifyLowerBound( unsigned variable, double bound )
     {
         _lowerBounds[variable] = bound;
         _tightenedLower[variable] = false;
+        recordBoundChange( variable );
     }
 }
 
@@ -687,6 +1028,7 @@ void RowBoundTightener::notifyUpperBound( unsigned variable, double bound )
     {
         _upperBounds[variable] = bound;
         _tightenedUpper[variable] = false;
+        recordBoundChange( variable );
     }
 }
 
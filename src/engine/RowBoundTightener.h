@@ -23,6 +23,8 @@
 #include "TableauRow.h"
 #include "Tightening.h"
 
+#include <vector>
+
 class RowBoundTightener : public IRowBoundTightener
 {
 public:
@@ -73,11 +75,25 @@ public:
      */
     void examineImplicitInvertedBasisMatrix( bool untilSaturation );
 
+    /*
+      Derive and enqueue new bounds for all varaibles, using the rows of
+      inv(B0) * A. The rows are computed one at a time, via a BTRAN of a
+      unit vector, and are not stored, so memory remains linear in the
+      size of the tableau. Rows that cannot lead to tighter bounds, as
+      judged by hasTighteningPotential(), are skipped. Can also do this
+      until saturation.
+    */
+    void examineInvertedBasisRowsOnDemand( bool untilSaturation );
+
     /*
       Derive and enqueue new bounds for all varaibles, using the
       original constraint matrix A and right hands side vector b. Can
       also do this until saturation, meaning that we continue until no
       new bounds are learned.
+
+      Only rows that contain a variable whose bound has changed since
+      the row was last examined are processed, except for the first
+      call after the bounds have been reset, which examines all rows.
     */
     void examineConstraintMatrix( bool untilSaturation );
 
@@ -103,6 +119,12 @@ private:
     unsigned _n;
     unsigned _m;
 
+    /*
+      The dimensions for which the work memory is allocated.
+    */
+    unsigned _nCapacity;
+    unsigned _mCapacity;
+
     /*
       Work space for the tightener to derive tighter bounds. These
       represent the tightest bounds currently known, either taken
@@ -119,23 +141,68 @@ private:
     */
     TableauRow **_rows;
     double *_z;
+    double *_ANColumn;
     double *_ciTimesLb;
     double *_ciTimesUb;
     char *_ciSign;
 
+    /*
+      Work space for computing the inverted basis rows on demand: the
+      row itself, the result of the BTRAN, and the dense accumulator
+      for its coefficients with the list (and flags) of its non-zero
+      entries.
+    */
+    TableauRow *_rowOnDemand;
+    double *_rho;
+    double *_rowCoefficients;
+    bool *_inRowSupport;
+    std::vector<unsigned> _rowSupport;
+
+    /*
+      The propagation queue for the constraint matrix: the variables
+      whose bounds have changed since the rows containing them were
+      last examined. If the flag is set, all rows are examined next,
+      and changes are not recorded.
+    */
+    bool _examineAllRows;
+    std::vector<unsigned> _changedVariables;
+    bool *_variableChanged;
+    std::vector<unsigned> _rowsToExamine;
+    bool *_rowQueued;
+
+    /*
+      For the inverted basis rows, which are recomputed on every call:
+      a counter of the bound changes, the value of the counter at the
+      last change of each variable, and its value when each row was
+      last examined. A row is revisited in a later pass only if one of
+      its variables has changed since.
+    */
+    unsigned _numBoundChanges;
+    unsigned *_lastBoundChange;
+    unsigned *_rowLastExamined;
+
     /*
       Statistics collection
     */
     Statistics *_statistics;
 
     /*
-      Free internal work memory.
+      Allocate or free internal work memory. Allocation uses the current
+      capacities.
     */
+    void allocateMemory();
     void freeMemoryIfNeeded();
 
     /*
-      Do a single pass over the constraint matrix and derive any
-      tighter bounds. Return the number of new bounds learned.
+      Record that the bound of a variable has changed, so that the
+      rows containing it are examined again.
+    */
+    void recordBoundChange( unsigned variable );
+
+    /*
+      Do a single pass over the rows of the constraint matrix that
+      contain changed variables and derive any tighter bounds. Return
+      the number of new bounds learned.
     */
     unsigned onePassOverConstraintMatrix();
 
@@ -148,9 +215,13 @@ private:
 
     /*
       Do a single pass over the inverted basis rows and derive any
-      tighter bounds. Return the number of new bounds learned.
+      tighter bounds. Return the number of new bounds learned. If the
+      pass is not the first one, rows none of whose variables have
+      changed since they were last examined are skipped.
     */
-    unsigned onePassOverInvertedBasisRows();
+    unsigned onePassOverInvertedBasisRows( bool firstPass );
+    void examineInvertedBasisRowsUntilSaturation( bool untilSaturation );
+    bool invertedBasisRowChanged( unsigned i ) const;
 
     /*
       Process the inverted basis row and attempt to derive tighter
@@ -158,6 +229,23 @@ private:
       of tighter bounds found.
     */
     unsigned tightenOnSingleInvertedBasisRow( const TableauRow &row );
+
+    /*
+      Compute the row of the basic variable with the given index,
+      keeping only its non-zero entries. The row is obtained by a BTRAN
+      of the unit vector, followed by a product with the sparse rows of
+      the constraint matrix.
+    */
+    void computeInvertedBasisRow( unsigned index, TableauRow &row );
+
+    /*
+      Write the row as sum ai xi = s, and let w denote the largest
+      |ai| * ( ub(xi) - lb(xi) ). A bound of some xi can be tightened
+      only if w exceeds s - sum min( ai xi ) or sum max( ai xi ) - s,
+      i.e. the slack of the row. Rows with infinite bounds are always
+      considered to have potential.
+    */
+    bool hasTighteningPotential( const TableauRow &row ) const;
 };
 
 #endif // __RowBoundTightener_h__
@@ -29,7 +29,6 @@
 SignConstraint::SignConstraint( unsigned b, unsigned f )
     : _b( b )
     , _f( f )
-    , _direction( PHASE_NOT_FIXED )
     , _haveEliminatedVariables( false )
 {
 }
@@ -94,11 +93,11 @@ List<unsigned> SignConstraint::getParticipatingVariables() const
 
 bool SignConstraint::satisfied() const
 {
-    if ( !( _assignment.exists( _b ) && _assignment.exists( _f ) ) )
+    if ( !( existsAssignment( _b ) && existsAssignment( _f ) ) )
         throw MarabouError( MarabouError::PARTICIPATING_VARIABLES_ABSENT );
 
-    double bValue = _assignment.get( _b );
-    double fValue = _assignment.get( _f );
+    double bValue = getAssignment( _b );
+    double fValue = getAssignment( _f );
 
     // if bValue is negative, f should be -1
     if ( FloatUtils::isNegative( bValue ) )
@@ -110,18 +109,18 @@ bool SignConstraint::satisfied() const
 
 List<PiecewiseLinearCaseSplit> SignConstraint::getCaseSplits() const
 {
-    if ( _phaseStatus != PHASE_NOT_FIXED )
+    if ( getPhaseStatus() != PHASE_NOT_FIXED )
         throw MarabouError( MarabouError::REQUESTED_CASE_SPLITS_FROM_FIXED_CONSTRAINT );
 
     List <PiecewiseLinearCaseSplit> splits;
 
-    if ( _direction == SIGN_PHASE_NEGATIVE )
+    if ( getDirection() == SIGN_PHASE_NEGATIVE )
     {
       splits.append( getNegativeSplit() );
       splits.append( getPositiveSplit() );
       return splits;
     }
-    if ( _direction == SIGN_PHASE_POSITIVE )
+    if ( getDirection() == SIGN_PHASE_POSITIVE )
     {
       splits.append( getPositiveSplit() );
       splits.append( getNegativeSplit() );
@@ -130,9 +129,9 @@ List<PiecewiseLinearCaseSplit> SignConstraint::getCaseSplits() const
 
     // If we have existing knowledge about the assignment, use it to
     // influence the order of splits
-    if ( _assignment.exists( _f ) )
+    if ( existsAssignment( _f ) )
     {
-        if ( FloatUtils::isPositive( _assignment[_f] ) )
+        if ( FloatUtils::isPositive( getAssignment( _f ) ) )
         {
             splits.append( getPositiveSplit() );
             splits.append( getNegativeSplit() );
@@ -173,14 +172,14 @@ PiecewiseLinearCaseSplit SignConstraint::getPositiveSplit() const
 
 bool SignConstraint::phaseFixed() const
 {
-    return _phaseStatus != PHASE_NOT_FIXED;
+    return getPhaseStatus() != PHASE_NOT_FIXED;
 }
 
 PiecewiseLinearCaseSplit SignConstraint::getValidCaseSplit() const
 {
-    ASSERT( _phaseStatus != PHASE_NOT_FIXED );
+    ASSERT( getPhaseStatus() != PHASE_NOT_FIXED );
 
-    if ( _phaseStatus == PhaseStatus::SIGN_PHASE_POSITIVE )
+    if ( getPhaseStatus() == PhaseStatus::SIGN_PHASE_POSITIVE )
         return getPositiveSplit();
 
     return getNegativeSplit();
@@ -199,13 +198,13 @@ String SignConstraint::serializeToString() const
 
 bool SignConstraint::haveOutOfBoundVariables() const
 {
-    double bValue = _assignment.get( _b );
-    double fValue = _assignment.get( _f );
+    double bValue = getAssignment( _b );
+    double fValue = getAssignment( _f );
 
-    if ( FloatUtils::gt( _lowerBounds[_b], bValue ) || FloatUtils::lt( _upperBounds[_b], bValue ) )
+    if ( FloatUtils::gt( getLowerBound( _b ), bValue ) || FloatUtils::lt( getUpperBound( _b ), bValue ) )
         return true;
 
-    if ( FloatUtils::gt( _lowerBounds[_f], fValue ) || FloatUtils::lt( _upperBounds[_f], fValue ) )
+    if ( FloatUtils::gt( getLowerBound( _f ), fValue ) || FloatUtils::lt( getUpperBound( _f ), fValue ) )
         return true;
 
     return false;
@@ -234,7 +233,7 @@ void SignConstraint::notifyVariableValue( unsigned variable, double value )
     if ( FloatUtils::isZero( value ) )
         value = 0.0;
 
-    _assignment[variable] = value;
+    setAssignment( variable, value );
 }
 
 void SignConstraint::notifyLowerBound( unsigned variable, double bound )
@@ -243,11 +242,11 @@ void SignConstraint::notifyLowerBound( unsigned variable, double bound )
         _statistics->incNumBoundNotificationsPlConstraints();
 
     // If there's an already-stored tighter bound, return
-    if ( _lowerBounds.exists( variable ) && !FloatUtils::gt( bound, _lowerBounds[variable] ) )
+    if ( existsLowerBound( variable ) && !FloatUtils::gt( bound, getLowerBound( variable ) ) )
         return;
 
     // Otherwise - update bound
-    _lowerBounds[variable] = bound;
+    setLowerBound( variable, bound );
 
     if ( variable == _f && FloatUtils::gt( bound, -1 ) )
     {
@@ -274,11 +273,11 @@ void SignConstraint::notifyUpperBound( unsigned variable, double bound )
         _statistics->incNumBoundNotificationsPlConstraints();
 
     // If there's an already-stored tighter bound, return
-    if ( _upperBounds.exists( variable ) && !FloatUtils::lt( bound, _upperBounds[variable] ) )
+    if ( existsUpperBound( variable ) && !FloatUtils::lt( bound, getUpperBound( variable ) ) )
         return;
 
     // Otherwise - update bound
-    _upperBounds[variable] = bound;
+    setUpperBound( variable, bound );
 
     if ( variable == _f && FloatUtils::lt( bound, 1 ) )
     {
@@ -302,10 +301,10 @@ void SignConstraint::notifyUpperBound( unsigned variable, double bound )
 List<PiecewiseLinearConstraint::Fix> SignConstraint::getPossibleFixes() const
 {
     ASSERT( !satisfied() );
-    ASSERT( _assignment.exists( _b ) );
-    ASSERT( _assignment.exists( _f ) );
+    ASSERT( existsAssignment( _b ) );
+    ASSERT( existsAssignment( _f ) );
 
-    double bValue = _assignment.get( _b );
+    double bValue = getAssignment( _b );
     double newFValue = FloatUtils::isNegative( bValue ) ? -1 : 1;
 
     List<PiecewiseLinearConstraint::Fix> fixes;
@@ -320,14 +319,14 @@ List<PiecewiseLinearConstraint::Fix> SignConstraint::getSmartFixes( ITableau * )
 
 void SignConstraint::getEntailedTightenings( List<Tightening> &tightenings ) const
 {
-    ASSERT( _lowerBounds.exists( _b ) && _lowerBounds.exists( _f ) &&
-            _upperBounds.exists( _b ) && _upperBounds.exists( _f ) );
+    ASSERT( existsLowerBound( _b ) && existsLowerBound( _f ) &&
+            existsUpperBound( _b ) && existsUpperBound( _f ) );
 
-    double bLowerBound = _lowerBounds[_b];
-    double fLowerBound = _lowerBounds[_f];
+    double bLowerBound = getLowerBound( _b );
+    double fLowerBound = getLowerBound( _f );
 
-    double bUpperBound = _upperBounds[_b];
-    double fUpperBound = _upperBounds[_f];
+    double bUpperBound = getUpperBound( _b );
+    double fUpperBound = getUpperBound( _f );
 
     // Always make f between -1 and 1
     tightenings.append( Tightening( _f, -1, Tightening::LB ) );
@@ -350,36 +349,15 @@ void SignConstraint::getEntailedTightenings( List<Tightening> &tightenings ) con
     }
 }
 
-void SignConstraint::setPhaseStatus( PhaseStatus phaseStatus )
-{
-    _phaseStatus = phaseStatus;
-}
-
 void SignConstraint::updateVariableIndex( unsigned oldIndex, unsigned newIndex )
 {
     ASSERT( oldIndex == _b || oldIndex == _f  );
-    ASSERT( !_assignment.exists( newIndex ) &&
-            !_lowerBounds.exists( newIndex ) &&
-            !_upperBounds.exists( newIndex ) &&
+    ASSERT( !existsAssignment( newIndex ) &&
+            !existsLowerBound( newIndex ) &&
+            !existsUpperBound( newIndex ) &&
             newIndex != _b && newIndex != _f );
 
-    if ( _assignment.exists( oldIndex ) )
-    {
-        _assignment[newIndex] = _assignment.get( oldIndex );
-        _assignment.erase( oldIndex );
-    }
-
-    if ( _lowerBounds.exists( oldIndex ) )
-    {
-        _lowerBounds[newIndex] = _lowerBounds.get( oldIndex );
-        _lowerBounds.erase( oldIndex );
-    }
-
-    if ( _upperBounds.exists( oldIndex ) )
-    {
-        _upperBounds[newIndex] = _upperBounds.get( oldIndex );
-        _upperBounds.erase( oldIndex );
-    }
+    renameVariableValues( oldIndex, newIndex );
 
     if ( oldIndex == _b )
         _b = newIndex;
@@ -400,22 +378,22 @@ void SignConstraint::eliminateVariable( __attribute__((unused)) unsigned variabl
 
                   if ( FloatUtils::areEqual( fixedValue, 1 ) )
                   {
-                      ASSERT( _phaseStatus != SIGN_PHASE_NEGATIVE );
+                      ASSERT( getPhaseStatus() != SIGN_PHASE_NEGATIVE );
                   }
                   else if (FloatUtils::areEqual( fixedValue, -1 ) )
                   {
-                      ASSERT( _phaseStatus != SIGN_PHASE_POSITIVE );
+                      ASSERT( getPhaseStatus() != SIGN_PHASE_POSITIVE );
                   }
               }
               else if ( variable == _b )
               {
                   if ( FloatUtils::gte( fixedValue, 0 ) )
                   {
-                      ASSERT( _phaseStatus != SIGN_PHASE_NEGATIVE );
+                      ASSERT( getPhaseStatus() != SIGN_PHASE_NEGATIVE );
                   }
                   else if ( FloatUtils::lt( fixedValue, 0 ) )
                   {
-                      ASSERT( _phaseStatus != SIGN_PHASE_POSITIVE );
+                      ASSERT( getPhaseStatus() != SIGN_PHASE_POSITIVE );
                   }
               }
         });
@@ -438,23 +416,23 @@ void SignConstraint::dump( String &output ) const
 {
     output = Stringf( "SignConstraint: x%u = Sign( x%u ). Active? %s. PhaseStatus = %u (%s). ",
                       _f, _b,
-                      _constraintActive ? "Yes" : "No",
-                      _phaseStatus, phaseToString( _phaseStatus ).ascii()
+                      isActive() ? "Yes" : "No",
+                      getPhaseStatus(), phaseToString( getPhaseStatus() ).ascii()
                       );
 
     output += Stringf( "b in [%s, %s], ",
-                       _lowerBounds.exists( _b ) ? Stringf( "%lf", _lowerBounds[_b] ).ascii() : "-inf",
-                       _upperBounds.exists( _b ) ? Stringf( "%lf", _upperBounds[_b] ).ascii() : "inf" );
+                       existsLowerBound( _b ) ? Stringf( "%lf", getLowerBound( _b ) ).ascii() : "-inf",
+                       existsUpperBound( _b ) ? Stringf( "%lf", getUpperBound( _b ) ).ascii() : "inf" );
 
     output += Stringf( "f in [%s, %s]\n",
-                       _lowerBounds.exists( _f ) ? Stringf( "%lf", _lowerBounds[_f] ).ascii() : "-inf",
-                       _upperBounds.exists( _f ) ? Stringf( "%lf", _upperBounds[_f] ).ascii() : "inf" );
+                       existsLowerBound( _f ) ? Stringf( "%lf", getLowerBound( _f ) ).ascii() : "-inf",
+                       existsUpperBound( _f ) ? Stringf( "%lf", getUpperBound( _f ) ).ascii() : "inf" );
 }
 
 double SignConstraint::computePolarity() const
 {
-  double currentLb = _lowerBounds[_b];
-  double currentUb = _upperBounds[_b];
+  double currentLb = getLowerBound( _b );
+  double currentUb = getUpperBound( _b );
   if ( !FloatUtils::isNegative( currentLb ) ) return 1;
   if ( FloatUtils::isNegative( currentUb ) ) return -1;
   double width = currentUb - currentLb;
@@ -464,18 +442,13 @@ double SignConstraint::computePolarity() const
 
 void SignConstraint::updateDirection()
 {
-    _direction = ( FloatUtils::isNegative( computePolarity() ) ) ?
-        SIGN_PHASE_NEGATIVE : SIGN_PHASE_POSITIVE;
-}
-
-PhaseStatus SignConstraint::getDirection() const
-{
-  return _direction;
+    setDirection( ( FloatUtils::isNegative( computePolarity() ) ) ?
+        SIGN_PHASE_NEGATIVE : SIGN_PHASE_POSITIVE );
 }
 
 void SignConstraint::updateScoreBasedOnPolarity()
 {
-  _score = std::abs( computePolarity() );
+  setScore( std::abs( computePolarity() ) );
 }
 
 bool SignConstraint::supportPolarity() const
@@ -165,28 +165,16 @@ public:
   */
   void updateDirection();
 
-  PhaseStatus getDirection() const;
-
   void updateScoreBasedOnPolarity();
 
 private:
     unsigned _b, _f;
 
-    /*
-      Denotes which case split to handle first.
-      And which phase status to repair a constraint into.
-    */
-    PhaseStatus _direction;
-
     PiecewiseLinearCaseSplit getNegativeSplit() const;
     PiecewiseLinearCaseSplit getPositiveSplit() const;
 
     bool _haveEliminatedVariables;
 
-    /*
-      Set the phase status.
-    */
-    void setPhaseStatus( PhaseStatus phaseStatus );
     static String phaseToString( PhaseStatus phase );
 
     /*
@@ -32,6 +32,9 @@ SmtCore::SmtCore( IEngine *engine )
     , _constraintForSplitting( NULL )
     , _stateId( 0 )
     , _constraintViolationThreshold( Options::get()->getInt( Options::CONSTRAINT_VIOLATION_THRESHOLD ) )
+    , _tableauStateStorageLevel( Options::get()->getBool( Options::TRAIL_BACKTRACKING ) ?
+                                 TableauStateStorageLevel::STORE_TABLEAU_TRAIL :
+                                 TableauStateStorageLevel::STORE_ENTIRE_TABLEAU_STATE )
 {
 }
 
@@ -128,7 +131,7 @@ void SmtCore::performSplit()
     EngineState *stateBeforeSplits = new EngineState;
     stateBeforeSplits->_stateId = _stateId;
     ++_stateId;
-    _engine->storeState( *stateBeforeSplits, true );
+    _engine->storeState( *stateBeforeSplits, _tableauStateStorageLevel );
 
     SmtStackEntry *stackEntry = new SmtStackEntry;
     // Perform the first split: add bounds and equations
@@ -417,7 +420,7 @@ void SmtCore::replaySmtStackEntry( SmtStackEntry *stackEntry )
     EngineState *stateBeforeSplits = new EngineState;
     stateBeforeSplits->_stateId = _stateId;
     ++_stateId;
-    _engine->storeState( *stateBeforeSplits, true );
+    _engine->storeState( *stateBeforeSplits, _tableauStateStorageLevel );
     stackEntry->_engineState = stateBeforeSplits;
 
     // Apply all the splits
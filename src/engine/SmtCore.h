@@ -22,6 +22,7 @@
 #include "Stack.h"
 #include "SmtStackEntry.h"
 #include "Statistics.h"
+#include "TableauStateStorageLevel.h"
 
 #include <memory>
 
@@ -179,6 +180,12 @@ private:
       Split when some relu has been violated for this many times
     */
     unsigned _constraintViolationThreshold;
+
+    /*
+      How the tableau is saved before each split: either a complete
+      copy, or a level on the tableau's trail.
+    */
+    TableauStateStorageLevel _tableauStateStorageLevel;
 };
 
 #endif // __SmtCore_h__
@@ -0,0 +1,536 @@
+/*********************                                                        */
+/*! \file SparseConstraintMatrixAnalyzer.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "Debug.h"
+#include "FloatUtils.h"
+#include "GlobalConfiguration.h"
+#include "SparseConstraintMatrixAnalyzer.h"
+
+SparseConstraintMatrixAnalyzer::SparseConstraintMatrixAnalyzer()
+    : _m( 0 )
+    , _n( 0 )
+    , _eliminationStep( 0 )
+    , _numRowElements( NULL )
+    , _numColumnElements( NULL )
+    , _workRow( NULL )
+    , _rowHeaders( NULL )
+    , _columnHeaders( NULL )
+    , _rowHeadersInverse( NULL )
+    , _columnHeadersInverse( NULL )
+{
+}
+
+SparseConstraintMatrixAnalyzer::~SparseConstraintMatrixAnalyzer()
+{
+    freeMemoryIfNeeded();
+}
+
+void SparseConstraintMatrixAnalyzer::freeMemoryIfNeeded()
+{
+    if ( _rowHeaders )
+    {
+        delete[] _rowHeaders;
+        _rowHeaders = NULL;
+    }
+
+    if ( _columnHeaders )
+    {
+        delete[] _columnHeaders;
+        _columnHeaders = NULL;
+    }
+
+    if ( _rowHeadersInverse )
+    {
+        delete[] _rowHeadersInverse;
+        _rowHeadersInverse = NULL;
+    }
+
+    if ( _columnHeadersInverse )
+    {
+        delete[] _columnHeadersInverse;
+        _columnHeadersInverse = NULL;
+    }
+
+    if ( _workRow )
+    {
+        delete[] _workRow;
+        _workRow = NULL;
+    }
+
+    if ( _numRowElements )
+    {
+        delete[] _numRowElements;
+        _numRowElements = NULL;
+    }
+
+    if ( _numColumnElements )
+    {
+        delete[] _numColumnElements;
+        _numColumnElements = NULL;
+    }
+
+    _singletonRows.clear();
+    _singletonColumns.clear();
+}
+
+void SparseConstraintMatrixAnalyzer::analyze( const double *matrix, unsigned m, unsigned n )
+{
+    SparseUnsortedArrays sparseMatrix;
+    sparseMatrix.initialize( matrix, m, n );
+    analyze( sparseMatrix, m, n );
+}
+
+void SparseConstraintMatrixAnalyzer::analyze( const SparseUnsortedList **matrix,
+                                              unsigned m,
+                                              unsigned n )
+{
+    SparseUnsortedArrays sparseMatrix;
+    sparseMatrix.initialize( matrix, m, n );
+    analyze( sparseMatrix, m, n );
+}
+
+void SparseConstraintMatrixAnalyzer::analyze( const SparseUnsortedArrays &matrix,
+                                              unsigned m,
+                                              unsigned n )
+{
+    freeMemoryIfNeeded();
+
+    _m = m;
+    _n = n;
+
+    matrix.storeIntoOther( &_A );
+    _A.transposeIntoOther( &_At );
+
+    allocateMemory();
+
+    // Perform the actual Gaussian elimination
+    gaussianElimination();
+}
+
+void SparseConstraintMatrixAnalyzer::allocateMemory()
+{
+    // Initialize the row and column headers
+    _rowHeaders = new unsigned[_m];
+    _columnHeaders = new unsigned[_n];
+    _rowHeadersInverse = new unsigned[_m];
+    _columnHeadersInverse = new unsigned[_n];
+
+    for ( unsigned i = 0; i < _m; ++i )
+    {
+        _rowHeaders[i] = i;
+        _rowHeadersInverse[i] = i;
+    }
+
+    for ( unsigned i = 0; i < _n; ++i )
+    {
+        _columnHeaders[i] = i;
+        _columnHeadersInverse[i] = i;
+    }
+
+    // Initialize the row and column counters
+    _numRowElements = new unsigned[_m];
+    _numColumnElements = new unsigned[_n];
+
+    for ( unsigned i = 0; i < _m; ++i )
+    {
+        _numRowElements[i] = _A.getRow( i )->getNnz();
+        if ( _numRowElements[i] == 1 )
+            _singletonRows.insert( i );
+    }
+
+    for ( unsigned i = 0; i < _n; ++i )
+    {
+        _numColumnElements[i] = _At.getRow( i )->getNnz();
+        if ( _numColumnElements[i] == 1 )
+            _singletonColumns.insert( i );
+    }
+
+    // Work memory
+    _workRow = new double[_n];
+    std::fill_n( _workRow, _n, 0 );
+}
+
+void SparseConstraintMatrixAnalyzer::setNumRowElements( unsigned row, unsigned count )
+{
+    _numRowElements[row] = count;
+    if ( count == 1 )
+        _singletonRows.insert( row );
+    else
+        _singletonRows.erase( row );
+}
+
+void SparseConstraintMatrixAnalyzer::setNumColumnElements( unsigned column, unsigned count )
+{
+    _numColumnElements[column] = count;
+    if ( count == 1 )
+        _singletonColumns.insert( column );
+    else
+        _singletonColumns.erase( column );
+}
+
+void SparseConstraintMatrixAnalyzer::gaussianElimination()
+{
+    /*
+      We work column-by-column, until m columns are found
+      that are non-zeroes, or until we run out of columns.
+    */
+    for ( _eliminationStep = 0; _eliminationStep < _m; ++_eliminationStep )
+    {
+        /*
+          Step 1:
+          -------
+          Choose a pivot element from the active submatrix of U. This
+          can be any non-zero entry. If no pivot exists, we are done.
+        */
+        if ( !choosePivot() )
+            return;
+
+        /*
+          Step 2:
+          -------
+          Element <p,q> has been selected as the pivot. Move it to
+          position [k,k], where k is the current elimination step.
+        */
+        permute();
+
+        /*
+          Step 3:
+          -------
+          Perform the actual elimination of lower rows in the active
+          submatrix.
+        */
+        eliminate();
+    }
+}
+
+bool SparseConstraintMatrixAnalyzer::choosePivot()
+{
+    /*
+      Apply the Markowitz rule: in the active sub-matrix,
+      let p_i denote the number of non-zero elements in the i'th
+      equation, and let q_j denote the number of non-zero elements
+      in the q'th column.
+
+      We pick a pivot a_ij \neq 0 that minimizes (p_i - 1)(q_i - 1).
+    */
+
+    const SparseUnsortedArray *sparseRow;
+    const SparseUnsortedArray *sparseColumn;
+    const SparseUnsortedArray::Entry *entry;
+    unsigned nnz;
+
+    // If there's a singleton row, use it as the pivot row
+    auto singletonRow = _singletonRows.lower_bound( _eliminationStep );
+    if ( singletonRow != _singletonRows.end() )
+    {
+        _pivotRow = *singletonRow;
+
+        // Get the singleton element
+        sparseRow = _A.getRow( _rowHeaders[_pivotRow] );
+        ASSERT( sparseRow->getNnz() == 1U );
+        entry = sparseRow->getArray();
+
+        _pivotColumn = _columnHeadersInverse[entry->_index];
+        _pivotElement = entry->_value;
+
+        return true;
+    }
+
+    // If there's a singleton column, use it as the pivot column
+    auto singletonColumn = _singletonColumns.lower_bound( _eliminationStep );
+    if ( singletonColumn != _singletonColumns.end() )
+    {
+        _pivotColumn = *singletonColumn;
+
+        // Get the singleton element
+        sparseColumn = _At.getRow( _columnHeaders[_pivotColumn] );
+        entry = sparseColumn->getArray();
+        nnz = sparseColumn->getNnz();
+
+        // There may be some elements in higher rows - we need just the one
+        // in the active submatrix.
+
+        DEBUG( bool found = false; );
+
+        for ( unsigned i = 0; i < nnz; ++i )
+        {
+            unsigned row = _rowHeadersInverse[entry[i]._index];
+
+            if ( row >= _eliminationStep )
+            {
+                DEBUG( found = true; );
+
+                _pivotRow = row;
+                _pivotElement = entry[i]._value;
+                break;
+            }
+        }
+
+        ASSERT( found );
+
+        return true;
+    }
+
+    // No singletons, apply the Markowitz rule. Find the element with
+    // acceptable magnitude that has the smallet Markowitz value.
+    // Fail if no elements exists that are within acceptable magnitude
+
+    unsigned minimalCost = _m * _n;
+    _pivotElement = 0.0;
+    double absPivotElement = 0.0;
+
+    bool found = false;
+    for ( unsigned column = _eliminationStep; column < _n; ++column )
+    {
+        if ( _numColumnElements[column] == 0 )
+            continue;
+
+        sparseColumn = _At.getRow( _columnHeaders[column] );
+
+        double maxInColumn = 0;
+        nnz = sparseColumn->getNnz();
+        entry = sparseColumn->getArray();
+
+        for ( unsigned i = 0; i < nnz; ++i )
+        {
+            // Ignore entries that are not in the active submatrix
+            unsigned row = _rowHeadersInverse[entry[i]._index];
+            if ( row < _eliminationStep )
+                continue;
+
+            double contender = FloatUtils::abs( entry[i]._value );
+            if ( contender > maxInColumn )
+                maxInColumn = contender;
+        }
+
+        if ( FloatUtils::isZero( maxInColumn ) )
+        {
+            // This is a zero column, not useful to us
+            continue;
+        }
+
+        for ( unsigned i = 0; i < nnz; ++i )
+        {
+            unsigned row = _rowHeadersInverse[entry[i]._index];
+
+            // Ignore entries that are not in the active submatrix
+            if ( row < _eliminationStep )
+                continue;
+
+            double contender = entry[i]._value;
+            double absContender = FloatUtils::abs( contender );
+
+            // Only consider large-enough elements
+            if ( absContender >
+                 maxInColumn * GlobalConfiguration::GAUSSIAN_ELIMINATION_PIVOT_SCALE_THRESHOLD )
+            {
+                unsigned cost = ( _numRowElements[row] - 1 ) * ( _numColumnElements[column] - 1 );
+
+                ASSERT( ( cost != minimalCost ) || found );
+
+                if ( ( cost < minimalCost ) ||
+                     ( ( cost == minimalCost ) && ( absContender > absPivotElement ) ) )
+                {
+                    minimalCost = cost;
+                    _pivotRow = row;
+                    _pivotColumn = column;
+                    _pivotElement = contender;
+                    absPivotElement = absContender;
+
+                    found = true;
+                }
+            }
+        }
+    }
+
+    return found;
+}
+
+void SparseConstraintMatrixAnalyzer::permute()
+{
+    // Permute the rows
+    unsigned temp = _rowHeaders[_eliminationStep];
+    _rowHeaders[_eliminationStep] = _rowHeaders[_pivotRow];
+    _rowHeaders[_pivotRow] = temp;
+
+    _rowHeadersInverse[_rowHeaders[_eliminationStep]] = _eliminationStep;
+    _rowHeadersInverse[_rowHeaders[_pivotRow]] = _pivotRow;
+
+    // Permute the columns
+    temp = _columnHeaders[_eliminationStep];
+    _columnHeaders[_eliminationStep] = _columnHeaders[_pivotColumn];
+    _columnHeaders[_pivotColumn] = temp;
+
+    _columnHeadersInverse[_columnHeaders[_eliminationStep]] = _eliminationStep;
+    _columnHeadersInverse[_columnHeaders[_pivotColumn]] = _pivotColumn;
+
+    // Permute the element counters
+    temp = _numRowElements[_eliminationStep];
+    setNumRowElements( _eliminationStep, _numRowElements[_pivotRow] );
+    setNumRowElements( _pivotRow, temp );
+
+    temp = _numColumnElements[_eliminationStep];
+    setNumColumnElements( _eliminationStep, _numColumnElements[_pivotColumn] );
+    setNumColumnElements( _pivotColumn, temp );
+}
+
+void SparseConstraintMatrixAnalyzer::eliminate()
+{
+    /*
+      Eliminate all entries below the pivot element A[k,k]
+    */
+    unsigned pivotColumnLocation = _columnHeaders[_eliminationStep];
+
+    /*
+      The pivot row is not eliminated per se, but it is excluded
+      from the active submatrix, so we adjust the element counters.
+      Its remaining entries are stored for the elimination.
+    */
+    setNumRowElements( _eliminationStep, 0 );
+
+    _pivotRowEntries.clear();
+    const SparseUnsortedArray *pivotRow = _A.getRow( _rowHeaders[_eliminationStep] );
+    const SparseUnsortedArray::Entry *pivotRowEntry = pivotRow->getArray();
+    for ( unsigned i = 0; i < pivotRow->getNnz(); ++i )
+    {
+        if ( FloatUtils::isZero( pivotRowEntry[i]._value ) )
+            continue;
+
+        unsigned column = _columnHeadersInverse[pivotRowEntry[i]._index];
+        if ( column < _eliminationStep )
+            continue;
+
+        setNumColumnElements( column, _numColumnElements[column] - 1 );
+
+        if ( column > _eliminationStep )
+            _pivotRowEntries.push_back( pivotRowEntry[i] );
+    }
+
+    // Process all rows below the pivot row
+    SparseUnsortedArray *sparseColumn = _At.getRow( pivotColumnLocation );
+    unsigned index = 0;
+
+    const SparseUnsortedArray::Entry *entry = sparseColumn->getArray();
+
+    while ( index < sparseColumn->getNnz() )
+    {
+        unsigned rowLocation = entry[index]._index;
+        unsigned row = _rowHeadersInverse[rowLocation];
+        if ( row <= _eliminationStep )
+        {
+            ++index;
+            continue;
+        }
+
+        /*
+          Compute the Gaussian row multiplier for this row.
+          The multiplier is: - U[row,k] / pivotElement
+        */
+        double rowMultiplier = -entry[index]._value / _pivotElement;
+
+        // Scatter the row being eliminated into the work row
+        SparseUnsortedArray *sparseRow = _A.getRow( rowLocation );
+        const SparseUnsortedArray::Entry *rowEntry = sparseRow->getArray();
+        _rowIndices.clear();
+        for ( unsigned i = 0; i < sparseRow->getNnz(); ++i )
+        {
+            _workRow[rowEntry[i]._index] = rowEntry[i]._value;
+            _rowIndices.push_back( rowEntry[i]._index );
+        }
+
+        // Eliminate the sub-diagonal entry
+        setNumColumnElements( _eliminationStep, _numColumnElements[_eliminationStep] - 1 );
+        setNumRowElements( row, _numRowElements[row] - 1 );
+        sparseColumn->erase( index );
+        _workRow[pivotColumnLocation] = 0;
+
+        // Handle the rest of the row, which only changes where the pivot
+        // row has entries
+        _fillIn.clear();
+        for ( const auto &pivotEntry : _pivotRowEntries )
+        {
+            unsigned columnLocation = pivotEntry._index;
+            unsigned column = _columnHeadersInverse[columnLocation];
+
+            // Value will change
+            double oldValue = _workRow[columnLocation];
+            bool wasZero = FloatUtils::isZero( oldValue );
+            double newValue = oldValue + ( rowMultiplier * pivotEntry._value );
+            bool isZero = FloatUtils::isZero( newValue );
+
+            if ( !wasZero && isZero )
+            {
+                newValue = 0;
+                setNumColumnElements( column, _numColumnElements[column] - 1 );
+                setNumRowElements( row, _numRowElements[row] - 1 );
+            }
+            else if ( wasZero && !isZero )
+            {
+                setNumColumnElements( column, _numColumnElements[column] + 1 );
+                setNumRowElements( row, _numRowElements[row] + 1 );
+                _fillIn.push_back( columnLocation );
+            }
+
+            _workRow[columnLocation] = newValue;
+
+            // Transposed matrix is updated immediately, regular matrix will
+            // be updated when entire row has been processed
+            if ( !FloatUtils::areEqual( newValue, oldValue ) )
+                _At.set( columnLocation, rowLocation, newValue );
+        }
+
+        // Gather the row back into sparse form, and zero the work row
+        sparseRow->clear();
+        for ( const auto &columnLocation : _rowIndices )
+        {
+            if ( !FloatUtils::isZero( _workRow[columnLocation] ) )
+                sparseRow->append( columnLocation, _workRow[columnLocation] );
+            _workRow[columnLocation] = 0;
+        }
+
+        for ( const auto &columnLocation : _fillIn )
+        {
+            sparseRow->append( columnLocation, _workRow[columnLocation] );
+            _workRow[columnLocation] = 0;
+        }
+
+        for ( const auto &pivotEntry : _pivotRowEntries )
+            _workRow[pivotEntry._index] = 0;
+    }
+}
+
+List<unsigned> SparseConstraintMatrixAnalyzer::getIndependentColumns() const
+{
+    List<unsigned> result;
+    for ( unsigned i = 0; i < _eliminationStep; ++i )
+        result.append( _columnHeaders[i] );
+    return result;
+}
+
+Set<unsigned> SparseConstraintMatrixAnalyzer::getRedundantRows() const
+{
+    Set<unsigned> result;
+    for ( unsigned i = _eliminationStep; i < _m; ++i )
+        result.insert( _rowHeaders[i] );
+    return result;
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,125 @@
+/*********************                                                        */
+/*! \file SparseConstraintMatrixAnalyzer.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#ifndef __SparseConstraintMatrixAnalyzer_h__
+#define __SparseConstraintMatrixAnalyzer_h__
+
+#include "IConstraintMatrixAnalyzer.h"
+#include "List.h"
+#include "Set.h"
+#include "SparseUnsortedArrays.h"
+
+#include <set>
+#include <vector>
+
+/*
+  A rank-revealing sparse LU factorization of a (rectangular) constraint
+  matrix, used for finding its redundant rows and a set of independent
+  columns. Pivots are selected using the same Markowitz rules as the
+  SparseGaussianEliminator, and in the same order as the
+  ConstraintMatrixAnalyzer, so the two analyzers agree on the result.
+  However, the work per elimination step is proportional to the number
+  of non-zero entries involved, and not to the dimensions of the matrix:
+  singleton rows and columns are tracked incrementally, and rows are
+  updated in sparse form.
+*/
+class SparseConstraintMatrixAnalyzer : public IConstraintMatrixAnalyzer
+{
+public:
+    SparseConstraintMatrixAnalyzer();
+    ~SparseConstraintMatrixAnalyzer();
+
+    /*
+      Analyze the input matrix in order to find its sets of
+      (in)dependent columns and rows
+    */
+    void analyze( const double *matrix, unsigned m, unsigned n );
+    void analyze( const SparseUnsortedList **matrix, unsigned m, unsigned n );
+    void analyze( const SparseUnsortedArrays &matrix, unsigned m, unsigned n );
+    List<unsigned> getIndependentColumns() const;
+    Set<unsigned> getRedundantRows() const;
+
+private:
+    unsigned _m;
+    unsigned _n;
+    unsigned _eliminationStep;
+
+    SparseUnsortedArrays _A;
+    SparseUnsortedArrays _At;
+
+    /*
+      The number of non-zero elements of every (permuted) row and column
+      of the active submatrix, and the permuted indices of the rows and
+      columns that have exactly one such element
+    */
+    unsigned *_numRowElements;
+    unsigned *_numColumnElements;
+    std::set<unsigned> _singletonRows;
+    std::set<unsigned> _singletonColumns;
+
+    unsigned _pivotRow;
+    unsigned _pivotColumn;
+    double _pivotElement;
+
+    /*
+      Work memory: a dense row that is kept zeroed between uses, the
+      entries of the current pivot row, and the entries of a row being
+      eliminated
+    */
+    double *_workRow;
+    std::vector<SparseUnsortedArray::Entry> _pivotRowEntries;
+    std::vector<unsigned> _rowIndices;
+    std::vector<unsigned> _fillIn;
+
+    /*
+      The i'th (permuted) row of the matrix is stored in memory
+      location _rowHeaders[i]. Likewise for columns.
+    */
+    unsigned *_rowHeaders;
+    unsigned *_columnHeaders;
+    unsigned *_rowHeadersInverse;
+    unsigned *_columnHeadersInverse;
+
+    /*
+      Memory management
+    */
+    void freeMemoryIfNeeded();
+    void allocateMemory();
+
+    /*
+      Helper functions for performing Gaussian elimination.
+    */
+    void gaussianElimination();
+    bool choosePivot();
+    void permute();
+    void eliminate();
+
+    /*
+      Update the element counters of a (permuted) row or column,
+      and the singleton sets accordingly
+    */
+    void setNumRowElements( unsigned row, unsigned count );
+    void setNumColumnElements( unsigned column, unsigned count );
+};
+
+#endif // __SparseConstraintMatrixAnalyzer_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -20,8 +20,8 @@
 #include "MString.h"
 #include "PiecewiseLinearCaseSplit.h"
 #include "SmtState.h"
+#include "WorkerQueue.h"
 
-#include <boost/lockfree/queue.hpp>
 #include <utility>
 
 // Struct representing a subquery
@@ -38,10 +38,6 @@ struct SubQuery
     unsigned _depth;
 };
 
-// Synchronized Queue containing the Sub-Queries shared by workers
-typedef boost::lockfree::queue<SubQuery *, boost::lockfree::
-  fixed_sized<false>>WorkerQueue;
-
 // A vector of Sub-Queries
 
 // Guy: consider using our wrapper class Vector instead of std::vector
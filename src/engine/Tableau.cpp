@@ -15,7 +15,6 @@
 
 #include "BasisFactorizationFactory.h"
 #include "CSRMatrix.h"
-#include "ConstraintMatrixAnalyzer.h"
 #include "Debug.h"
 #include "EntrySelectionStrategy.h"
 #include "Equation.h"
@@ -25,25 +24,31 @@
 #include "MalformedBasisException.h"
 #include "MarabouError.h"
 #include "PiecewiseLinearCaseSplit.h"
+#include "SparseConstraintMatrixAnalyzer.h"
 #include "Tableau.h"
 #include "TableauRow.h"
 #include "TableauState.h"
 
+#include <algorithm>
 #include <string.h>
 
 Tableau::Tableau()
     : _n ( 0 )
     , _m ( 0 )
+    , _mCapacity( 0 )
+    , _nCapacity( 0 )
     , _A( NULL )
     , _sparseColumnsOfA( NULL )
     , _sparseRowsOfA( NULL )
-    , _denseA( NULL )
+    , _denseAColumn( NULL )
     , _changeColumn( NULL )
     , _pivotRow( NULL )
+    , _primalRatioTestType( GlobalConfiguration::USE_HARRIS_RATIO_TEST ?
+                            PrimalRatioTestType::HARRIS : PrimalRatioTestType::TEXTBOOK )
+    , _numBasicsPassedBound( 0 )
     , _b( NULL )
     , _workM( NULL )
     , _workN( NULL )
-    , _unitVector( NULL )
     , _basisFactorization( NULL )
     , _multipliers( NULL )
     , _basicIndexToVariable( NULL )
@@ -64,6 +69,7 @@ Tableau::Tableau()
 
 Tableau::~Tableau()
 {
+    clearTrail();
     freeMemoryIfNeeded();
 }
 
@@ -77,7 +83,7 @@ void Tableau::freeMemoryIfNeeded()
 
     if ( _sparseColumnsOfA )
     {
-        for ( unsigned i = 0; i < _n; ++i )
+        for ( unsigned i = 0; i < _nCapacity; ++i )
         {
             if ( _sparseColumnsOfA[i] )
             {
@@ -92,7 +98,7 @@ void Tableau::freeMemoryIfNeeded()
 
     if ( _sparseRowsOfA )
     {
-        for ( unsigned i = 0; i < _m; ++i )
+        for ( unsigned i = 0; i < _mCapacity; ++i )
         {
             if ( _sparseRowsOfA[i] )
             {
@@ -105,10 +111,10 @@ void Tableau::freeMemoryIfNeeded()
         _sparseRowsOfA = NULL;
     }
 
-    if ( _denseA )
+    if ( _denseAColumn )
     {
-        delete[] _denseA;
-        _denseA = NULL;
+        delete[] _denseAColumn;
+        _denseAColumn = NULL;
     }
 
     if ( _changeColumn )
@@ -129,12 +135,6 @@ void Tableau::freeMemoryIfNeeded()
         _b = NULL;
     }
 
-    if ( _unitVector )
-    {
-        delete[] _unitVector;
-        _unitVector = NULL;
-    }
-
     if ( _multipliers )
     {
         delete[] _multipliers;
@@ -212,6 +212,8 @@ void Tableau::setDimensions( unsigned m, unsigned n )
 {
     _m = m;
     _n = n;
+    _mCapacity = m;
+    _nCapacity = n;
 
     _A = new CSRMatrix();
     if ( !_A )
@@ -239,9 +241,9 @@ void Tableau::setDimensions( unsigned m, unsigned n )
             throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::sparseRowOfA[i]" );
     }
 
-    _denseA = new double[m*n];
-    if ( !_denseA )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::denseA" );
+    _denseAColumn = new double[m];
+    if ( !_denseAColumn )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::denseAColumn" );
 
     _changeColumn = new double[m];
     if ( !_changeColumn )
@@ -255,10 +257,6 @@ void Tableau::setDimensions( unsigned m, unsigned n )
     if ( !_b )
         throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::b" );
 
-    _unitVector = new double[m];
-    if ( !_unitVector )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::unitVector" );
-
     _multipliers = new double[m];
     if ( !_multipliers )
         throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::multipliers" );
@@ -316,18 +314,33 @@ void Tableau::setDimensions( unsigned m, unsigned n )
 
 void Tableau::setConstraintMatrix( const double *A )
 {
-    _A->initialize( A, _m, _n );
+    SparseUnsortedArrays sparseA;
+    sparseA.initialize( A, _m, _n );
+    setConstraintMatrix( sparseA );
+}
 
+void Tableau::setConstraintMatrix( const SparseUnsortedArrays &A )
+{
     for ( unsigned column = 0; column < _n; ++column )
+        _sparseColumnsOfA[column]->clear();
+
+    for ( unsigned row = 0; row < _m; ++row )
     {
-        for ( unsigned row = 0; row < _m; ++row )
-            _denseA[column*_m + row] = A[row*_n + column];
+        _sparseRowsOfA[row]->clear();
+
+        const SparseUnsortedArray *sparseRow = A.getRow( row );
+        const SparseUnsortedArray::Entry *entries = sparseRow->getArray();
+        for ( unsigned i = 0; i < sparseRow->getNnz(); ++i )
+        {
+            if ( FloatUtils::isZero( entries[i]._value ) )
+                continue;
 
-        _sparseColumnsOfA[column]->initialize( _denseA + ( column * _m ), _m );
+            _sparseRowsOfA[row]->append( entries[i]._index, entries[i]._value );
+            _sparseColumnsOfA[entries[i]._index]->append( row, entries[i]._value );
+        }
     }
 
-    for ( unsigned row = 0; row < _m; ++row )
-        _sparseRowsOfA[row]->initialize( A + ( row * _n ), _n );
+    _A->initialize( (const SparseUnsortedList **)_sparseRowsOfA, _m, _n );
 }
 
 void Tableau::markAsBasic( unsigned variable )
@@ -469,6 +482,13 @@ void Tableau::computeBasicStatus( unsigned basicIndex )
 void Tableau::setLowerBound( unsigned variable, double value )
 {
     ASSERT( variable < _n );
+    if ( !_trailLevelStart.empty() )
+    {
+        _trail.push_back( TrailEntry( variable, true, _lowerBounds[variable] ) );
+        if ( _statistics )
+            _statistics->setCurrentTrailSize( _trail.size() );
+    }
+
     _lowerBounds[variable] = value;
     notifyLowerBound( variable, value );
     checkBoundsValid( variable );
@@ -477,6 +497,13 @@ void Tableau::setLowerBound( unsigned variable, double value )
 void Tableau::setUpperBound( unsigned variable, double value )
 {
     ASSERT( variable < _n );
+    if ( !_trailLevelStart.empty() )
+    {
+        _trail.push_back( TrailEntry( variable, false, _upperBounds[variable] ) );
+        if ( _statistics )
+            _statistics->setCurrentTrailSize( _trail.size() );
+    }
+
     _upperBounds[variable] = value;
     notifyUpperBound( variable, value );
     checkBoundsValid( variable );
@@ -739,6 +766,7 @@ void Tableau::performPivot()
                       _lowerBounds[nonBasic], _upperBounds[nonBasic] ).ascii() );
 
         updateAssignmentForPivot();
+        updateCostFunctionForPivot();
 
         return;
     }
@@ -797,9 +825,10 @@ void Tableau::performPivot()
 
     // Update the basis factorization. The column corresponding to the
     // leaving variable is the one that has changed
+    getAColumn( currentNonBasic, _denseAColumn );
     _basisFactorization->updateToAdjacentBasis( _leavingVariable,
                                                 _changeColumn,
-                                                getAColumn( currentNonBasic ) );
+                                                _denseAColumn );
 
     if ( _statistics )
     {
@@ -839,9 +868,10 @@ void Tableau::performDegeneratePivot()
     _variableToIndex[currentNonBasic] = _leavingVariable;
 
     // Update the basis factorization
+    getAColumn( currentNonBasic, _denseAColumn );
     _basisFactorization->updateToAdjacentBasis( _leavingVariable,
                                                 _changeColumn,
-                                                getAColumn( currentNonBasic ) );
+                                                _denseAColumn );
 
     // Switch assignment values. No call to notify is required,
     // because values haven't changed.
@@ -951,10 +981,25 @@ void Tableau::pickLeavingVariable()
 
 void Tableau::pickLeavingVariable( double *changeColumn )
 {
-    if ( GlobalConfiguration::USE_HARRIS_RATIO_TEST )
-        harrisRatioTest( changeColumn );
-    else
+    switch ( _primalRatioTestType )
+    {
+    case PrimalRatioTestType::TEXTBOOK:
         standardRatioTest( changeColumn );
+        break;
+
+    case PrimalRatioTestType::HARRIS:
+        harrisRatioTest( changeColumn );
+        break;
+
+    case PrimalRatioTestType::LONG_STEP:
+        longStepRatioTest( changeColumn );
+        break;
+    }
+}
+
+void Tableau::setPrimalRatioTestType( PrimalRatioTestType type )
+{
+    _primalRatioTestType = type;
 }
 
 void Tableau::standardRatioTest( double *changeColumn )
@@ -1374,6 +1419,341 @@ void Tableau::harrisRatioTest( double *changeColumn )
     ASSERT( _leavingVariable != _m );
 }
 
+void Tableau::longStepRatioTest( double *changeColumn )
+{
+    /*
+      The long-step ratio test lets the entering variable move past
+      the points where out-of-bounds basic variables reach their
+      violated bounds, as long as the sum of infeasibilities keeps
+      decreasing. At each such breakpoint, the basic stops
+      contributing to the cost, so the rate of decrease drops by the
+      basic's entry in the change column.
+
+      The entering variable stops at the first breakpoint where the
+      rate is no longer positive, and before any basic variable leaves
+      its bounds or crosses them entirely. The basic that stops it
+      leaves the basis. If the pivot element at a breakpoint is too
+      small, an earlier breakpoint is picked.
+    */
+    double reducedCost = _costFunctionManager->getCostFunction()[_enteringVariable];
+    ASSERT( !FloatUtils::isZero( reducedCost ) );
+    bool decrease = FloatUtils::isPositive( reducedCost );
+
+    unsigned enteringVariable = _nonBasicIndexToVariable[_enteringVariable];
+    double currentValue = _nonBasicAssignment[_enteringVariable];
+
+    // The largest step, and the basic that imposes it (_m for the
+    // entering variable's own bound)
+    double maxStep = decrease ?
+        currentValue - _lowerBounds[enteringVariable] :
+        _upperBounds[enteringVariable] - currentValue;
+    unsigned maxStepBasic = _m;
+
+    _longStepBreakpoints.clear();
+    for ( unsigned i = 0; i < _m; ++i )
+    {
+        if ( changeColumn[i] < +GlobalConfiguration::PIVOT_CHANGE_COLUMN_TOLERANCE &&
+             changeColumn[i] > -GlobalConfiguration::PIVOT_CHANGE_COLUMN_TOLERANCE )
+            continue;
+
+        // The basic changes by -changeColumn[i] per unit of the entering variable
+        bool basicIncreases = decrease ? ( changeColumn[i] > 0 ) : ( changeColumn[i] < 0 );
+        unsigned variable = _basicIndexToVariable[i];
+        double rate = FloatUtils::abs( changeColumn[i] );
+        double value = _basicAssignment[i];
+
+        double step;
+        if ( ( basicIncreases && _basicStatus[i] == Tableau::BELOW_LB ) ||
+             ( !basicIncreases && _basicStatus[i] == Tableau::ABOVE_UB ) )
+        {
+            // A breakpoint at the violated bound, and a limit at the other
+            double violatedBound = basicIncreases ? _lowerBounds[variable] : _upperBounds[variable];
+            _longStepBreakpoints.push_back( std::make_pair( FloatUtils::abs( violatedBound - value ) / rate, i ) );
+            step = FloatUtils::abs( ( basicIncreases ? _upperBounds[variable] : _lowerBounds[variable] ) - value ) / rate;
+        }
+        else if ( _basicStatus[i] == Tableau::BETWEEN )
+        {
+            double bound = basicIncreases ? _upperBounds[variable] : _lowerBounds[variable];
+            step = FloatUtils::max( basicIncreases ? bound - value : value - bound, 0 ) / rate;
+        }
+        else
+        {
+            // Moving away from its violated bound
+            continue;
+        }
+
+        if ( step < maxStep )
+        {
+            maxStep = step;
+            maxStepBasic = i;
+        }
+    }
+
+    std::sort( _longStepBreakpoints.begin(), _longStepBreakpoints.end() );
+
+    double slope = FloatUtils::abs( reducedCost );
+    unsigned numPassed = 0;
+    bool slopeExhausted = false;
+    while ( !slopeExhausted &&
+            numPassed < _longStepBreakpoints.size() &&
+            _longStepBreakpoints[numPassed].first <= maxStep )
+    {
+        slope -= FloatUtils::abs( changeColumn[_longStepBreakpoints[numPassed].second] );
+        slopeExhausted = !FloatUtils::isPositive( slope );
+        ++numPassed;
+    }
+
+    // Nothing to pass: this is the textbook ratio test
+    if ( numPassed == 0 )
+    {
+        standardRatioTest( changeColumn );
+        return;
+    }
+
+    if ( !slopeExhausted )
+    {
+        if ( maxStepBasic == _m && FloatUtils::isFinite( maxStep ) )
+        {
+            // The entering variable hops to its other bound
+            _leavingVariable = _m;
+            _changeRatio = decrease ? -maxStep : maxStep;
+            return;
+        }
+
+        bool betweenBounds = ( maxStepBasic < _m && _basicStatus[maxStepBasic] == Tableau::BETWEEN );
+        if ( betweenBounds &&
+             FloatUtils::abs( changeColumn[maxStepBasic] ) >= GlobalConfiguration::ACCEPTABLE_SIMPLEX_PIVOT_THRESHOLD )
+        {
+            // A basic within its bounds reaches one of them
+            _leavingVariable = maxStepBasic;
+            _changeRatio = decrease ? -maxStep : maxStep;
+            _leavingVariableIncreases = decrease ?
+                FloatUtils::isPositive( changeColumn[_leavingVariable] ) :
+                FloatUtils::isNegative( changeColumn[_leavingVariable] );
+            return;
+        }
+    }
+
+    // Otherwise, a basic leaves at its violated bound: the last one
+    // passed, or the latest one with an acceptable pivot element
+    unsigned chosen = numPassed - 1;
+    while ( chosen > 0 &&
+            FloatUtils::abs( changeColumn[_longStepBreakpoints[chosen].second] ) <
+            GlobalConfiguration::ACCEPTABLE_SIMPLEX_PIVOT_THRESHOLD )
+        --chosen;
+
+    if ( FloatUtils::abs( changeColumn[_longStepBreakpoints[chosen].second] ) <
+         GlobalConfiguration::ACCEPTABLE_SIMPLEX_PIVOT_THRESHOLD )
+    {
+        // No acceptable pivot element: take the largest one
+        for ( unsigned i = 1; i < numPassed; ++i )
+        {
+            if ( FloatUtils::abs( changeColumn[_longStepBreakpoints[i].second] ) >
+                 FloatUtils::abs( changeColumn[_longStepBreakpoints[chosen].second] ) )
+                chosen = i;
+        }
+    }
+
+    _leavingVariable = _longStepBreakpoints[chosen].second;
+    _changeRatio = decrease ? -_longStepBreakpoints[chosen].first : _longStepBreakpoints[chosen].first;
+    _leavingVariableIncreases = decrease ?
+        FloatUtils::isPositive( changeColumn[_leavingVariable] ) :
+        FloatUtils::isNegative( changeColumn[_leavingVariable] );
+}
+
+bool Tableau::dualRatioTest( DualRatioTestType type )
+{
+    /*
+      Marabou solves feasibility problems, so the objective is zero:
+      every basis is dual feasible, and every eligible non-basic
+      variable has a dual ratio of zero. Among these, we pick the one
+      with the largest pivot element, for numerical stability.
+
+      The pivot row is of the form basic = sum( coefficient * nonBasic ).
+      A non-basic variable is eligible if it can move in the direction
+      that moves the leaving variable towards its violated bound.
+    */
+    ASSERT( _leavingVariable < _m );
+    ASSERT( basicOutOfBounds( _leavingVariable ) );
+
+    _leavingVariableIncreases = basicTooLow( _leavingVariable );
+
+    bool found = false;
+    double largestPivot = 0;
+    for ( unsigned i = 0; i < _n - _m; ++i )
+    {
+        double coefficient = (*_pivotRow)[i];
+        double absCoefficient = FloatUtils::abs( coefficient );
+        if ( absCoefficient < GlobalConfiguration::PIVOT_CHANGE_COLUMN_TOLERANCE ||
+             absCoefficient <= largestPivot )
+            continue;
+
+        bool nonBasicIncreases = ( coefficient > 0 ) == _leavingVariableIncreases;
+        if ( nonBasicIncreases ? !nonBasicCanIncrease( i ) : !nonBasicCanDecrease( i ) )
+            continue;
+
+        found = true;
+        largestPivot = absCoefficient;
+        _enteringVariable = i;
+    }
+
+    if ( !found )
+        return false;
+
+    if ( type == DualRatioTestType::BOUND_FLIPPING && !flipBoundsForDualRatioTest() )
+        return false;
+
+    // The change in the entering variable
+    unsigned leaving = _basicIndexToVariable[_leavingVariable];
+    double violatedBound = _leavingVariableIncreases ? _lowerBounds[leaving] : _upperBounds[leaving];
+    _changeRatio =
+        ( violatedBound - _basicAssignment[_leavingVariable] ) / (*_pivotRow)[_enteringVariable];
+
+    return true;
+}
+
+bool Tableau::flipBoundsForDualRatioTest()
+{
+    /*
+      All eligible non-basics have a dual ratio of zero, so instead of
+      entering the basis, any of them may be passed over by flipping
+      it to its opposite bound. For a boxed non-basic, this reduces
+      the infeasibility of the leaving variable by |coefficient *
+      range|, and the entering variable then has less far to go.
+
+      The flip set is chosen from the pivot row alone: we consider the
+      non-basics starting with the smallest pivot elements, and flip
+      one as long as the leaving variable stays infeasible. The
+      change to the basic assignment is then computed with a single
+      forward transformation of the sum of the flipped columns. If
+      this makes another basic variable more infeasible, only the
+      first half of the flips is tried, and so on. The basis does not
+      change.
+    */
+    unsigned leaving = _basicIndexToVariable[_leavingVariable];
+    double violatedBound = _leavingVariableIncreases ? _lowerBounds[leaving] : _upperBounds[leaving];
+    double infeasibility = FloatUtils::abs( violatedBound - _basicAssignment[_leavingVariable] );
+    double minInfeasibility = 2 *
+        ( GlobalConfiguration::BOUND_COMPARISON_ADDITIVE_TOLERANCE +
+          GlobalConfiguration::BOUND_COMPARISON_MULTIPLICATIVE_TOLERANCE * FloatUtils::abs( violatedBound ) );
+
+    _boundFlipCandidates.clear();
+    for ( unsigned i = 0; i < _n - _m; ++i )
+    {
+        if ( i == _enteringVariable )
+            continue;
+
+        double coefficient = (*_pivotRow)[i];
+        double absCoefficient = FloatUtils::abs( coefficient );
+        if ( absCoefficient < GlobalConfiguration::PIVOT_CHANGE_COLUMN_TOLERANCE )
+            continue;
+
+        unsigned variable = _nonBasicIndexToVariable[i];
+        if ( !FloatUtils::isFinite( _lowerBounds[variable] ) ||
+             !FloatUtils::isFinite( _upperBounds[variable] ) )
+            continue;
+
+        bool nonBasicIncreases = ( coefficient > 0 ) == _leavingVariableIncreases;
+        if ( nonBasicIncreases ? !nonBasicCanIncrease( i ) : !nonBasicCanDecrease( i ) )
+            continue;
+
+        _boundFlipCandidates.push_back( std::make_pair( absCoefficient, i ) );
+    }
+
+    std::sort( _boundFlipCandidates.begin(), _boundFlipCandidates.end() );
+
+    // Select the flips
+    unsigned numFlips = 0;
+    for ( const auto &candidate : _boundFlipCandidates )
+    {
+        unsigned nonBasic = candidate.second;
+        unsigned variable = _nonBasicIndexToVariable[nonBasic];
+        bool nonBasicIncreases = ( (*_pivotRow)[nonBasic] > 0 ) == _leavingVariableIncreases;
+        double newValue = nonBasicIncreases ? _upperBounds[variable] : _lowerBounds[variable];
+        double delta = newValue - _nonBasicAssignment[nonBasic];
+
+        double reduction = candidate.first * FloatUtils::abs( delta );
+        if ( infeasibility - reduction <= minInfeasibility )
+            continue;
+
+        // The chosen flips overwrite the candidates already considered
+        _boundFlipCandidates[numFlips] = std::make_pair( newValue, nonBasic );
+        infeasibility -= reduction;
+        ++numFlips;
+    }
+
+    while ( numFlips > 0 )
+    {
+        // The change to the basic assignment, as in a fake pivot
+        std::fill_n( _workN, _m, 0.0 );
+        for ( unsigned i = 0; i < numFlips; ++i )
+        {
+            unsigned nonBasic = _boundFlipCandidates[i].second;
+            unsigned variable = _nonBasicIndexToVariable[nonBasic];
+            double delta = _boundFlipCandidates[i].first - _nonBasicAssignment[nonBasic];
+            for ( const auto &entry : *_sparseColumnsOfA[variable] )
+                _workN[entry._index] += entry._value * delta;
+        }
+
+        _basisFactorization->forwardTransformation( _workN, _workM );
+        if ( boundFlipKeepsBasicsFeasible() )
+            break;
+
+        numFlips /= 2;
+    }
+
+    if ( numFlips == 0 )
+        return true;
+
+    for ( unsigned i = 0; i < _m; ++i )
+    {
+        if ( FloatUtils::isZero( _workM[i] ) )
+            continue;
+
+        _basicAssignment[i] -= _workM[i];
+        notifyVariableValue( _basicIndexToVariable[i], _basicAssignment[i] );
+        computeBasicStatus( i );
+    }
+
+    for ( unsigned i = 0; i < numFlips; ++i )
+    {
+        unsigned nonBasic = _boundFlipCandidates[i].second;
+        _nonBasicAssignment[nonBasic] = _boundFlipCandidates[i].first;
+        notifyVariableValue( _nonBasicIndexToVariable[nonBasic], _boundFlipCandidates[i].first );
+    }
+
+    if ( _statistics )
+        _statistics->addNumBoundFlips( numFlips );
+
+    _basicAssignmentStatus = ITableau::BASIC_ASSIGNMENT_UPDATED;
+    _costFunctionManager->invalidateCostFunction();
+
+    // Guard against numerical errors
+    return basicOutOfBounds( _leavingVariable );
+}
+
+bool Tableau::boundFlipKeepsBasicsFeasible() const
+{
+    for ( unsigned i = 0; i < _m; ++i )
+    {
+        if ( i == _leavingVariable || FloatUtils::isZero( _workM[i] ) )
+            continue;
+
+        unsigned variable = _basicIndexToVariable[i];
+        double lb = _lowerBounds[variable];
+        double ub = _upperBounds[variable];
+        double oldValue = _basicAssignment[i];
+        double newValue = oldValue - _workM[i];
+
+        double oldInfeasibility = FloatUtils::max( FloatUtils::max( lb - oldValue, oldValue - ub ), 0 );
+        double newInfeasibility = FloatUtils::max( FloatUtils::max( lb - newValue, newValue - ub ), 0 );
+        if ( newInfeasibility > oldInfeasibility + GlobalConfiguration::BOUND_COMPARISON_ADDITIVE_TOLERANCE )
+            return false;
+    }
+
+    return true;
+}
+
 double Tableau::getChangeRatio() const
 {
     return _changeRatio;
@@ -1386,9 +1766,10 @@ void Tableau::setChangeRatio( double changeRatio )
 
 void Tableau::computeChangeColumn()
 {
-    // Compute d = inv(B) * a using the basis factorization
-    const double *a = getAColumn( _nonBasicIndexToVariable[_enteringVariable] );
-    _basisFactorization->forwardTransformation( a, _changeColumn );
+    // Compute d = inv(B) * a using the basis factorization. The column
+    // a is sparse, which the factorization can exploit
+    unsigned variable = _nonBasicIndexToVariable[_enteringVariable];
+    _basisFactorization->sparseForwardTransformation( *_sparseColumnsOfA[variable], _changeColumn );
 }
 
 const double *Tableau::getChangeColumn() const
@@ -1509,9 +1890,9 @@ void Tableau::getTableauRow( unsigned index, TableauRow *row )
 
     ASSERT( index < _m );
 
-    std::fill( _unitVector, _unitVector + _m, 0.0 );
-    _unitVector[index] = 1;
-    computeMultipliers( _unitVector );
+    SparseUnsortedList unitVector( _m );
+    unitVector.append( index, 1 );
+    _basisFactorization->sparseBackwardTransformation( unitVector, _multipliers );
 
     for ( unsigned i = 0; i < _n - _m; ++i )
     {
@@ -1545,9 +1926,9 @@ const SparseMatrix *Tableau::getSparseA() const
     return _A;
 }
 
-const double *Tableau::getAColumn( unsigned variable ) const
+void Tableau::getAColumn( unsigned variable, double *result ) const
 {
-    return _denseA + ( variable * _m );
+    _sparseColumnsOfA[variable]->toDense( result );
 }
 
 void Tableau::getSparseAColumn( unsigned variable, SparseUnsortedList *result ) const
@@ -1595,7 +1976,6 @@ void Tableau::storeState( TableauState &state ) const
         _sparseColumnsOfA[i]->storeIntoOther( state._sparseColumnsOfA[i] );
     for ( unsigned i = 0; i < _m; ++i )
         _sparseRowsOfA[i]->storeIntoOther( state._sparseRowsOfA[i] );
-    memcpy( state._denseA, _denseA, sizeof(double) * _m * _n );
 
     // Store right hand side vector _b
     memcpy( state._b, _b, sizeof(double) * _m );
@@ -1625,12 +2005,28 @@ void Tableau::storeState( TableauState &state ) const
 
     // Store the merged variables
     state._mergedVariables = _mergedVariables;
+
+    if ( _statistics )
+        _statistics->incNumStoredTableauStates( getStateSizeInBytes() );
 }
 
 void Tableau::restoreState( const TableauState &state )
 {
-    freeMemoryIfNeeded();
-    setDimensions( state._m, state._n );
+    checkpointTrailIfNeeded();
+    restoreStateWithoutCheckpoint( state );
+}
+
+void Tableau::restoreStateWithoutCheckpoint( const TableauState &state )
+{
+    // Keep the allocated memory, unless the number of non-basic
+    // variables differs
+    if ( _sparseColumnsOfA && state._n - state._m == _n - _m )
+        resize( state._m, state._n );
+    else
+    {
+        freeMemoryIfNeeded();
+        setDimensions( state._m, state._n );
+    }
 
     // Restore matrix A
     state._A->storeIntoOther( _A );
@@ -1638,7 +2034,6 @@ void Tableau::restoreState( const TableauState &state )
         state._sparseColumnsOfA[i]->storeIntoOther( _sparseColumnsOfA[i] );
     for ( unsigned i = 0; i < _m; ++i )
         state._sparseRowsOfA[i]->storeIntoOther( _sparseRowsOfA[i] );
-    memcpy( _denseA, state._denseA, sizeof(double) * _m * _n );
 
     // Restore right hand side vector _b
     memcpy( _b, state._b, sizeof(double) * _m );
@@ -1678,6 +2073,147 @@ void Tableau::restoreState( const TableauState &state )
         _statistics->setCurrentTableauDimension( _m, _n );
 }
 
+unsigned long long Tableau::getStateSizeInBytes() const
+{
+    // b, bounds and assignments
+    unsigned long long result = sizeof(double) * ( _m + ( 2 * _n ) + _n );
+
+    // Sparse A is stored three times: as a matrix, by columns and by rows
+    result += 3 * ( sizeof(double) + sizeof(unsigned) ) * _A->getNnz();
+
+    // Indices
+    result += sizeof(unsigned) * ( _m + _n + _n );
+
+    return result;
+}
+
+unsigned Tableau::pushTrailLevel()
+{
+    _trailLevelStart.push_back( _trail.size() );
+    return _trailLevelStart.size();
+}
+
+void Tableau::checkpointTrailIfNeeded()
+{
+    if ( _trailLevelStart.empty() )
+        return;
+
+    unsigned level = _trailLevelStart.size();
+    if ( !_trailCheckpoints.empty() && _trailCheckpoints.back()._level == level )
+        return;
+
+    TableauState *state = new TableauState;
+    storeState( *state );
+
+    TrailCheckpoint checkpoint;
+    checkpoint._level = level;
+    checkpoint._trailSize = _trail.size();
+    checkpoint._state = state;
+    _trailCheckpoints.append( checkpoint );
+}
+
+void Tableau::backtrackTrail( unsigned level )
+{
+    ASSERT( level > 0 && level <= _trailLevelStart.size() );
+
+    unsigned start = _trailLevelStart[level - 1];
+    unsigned end = _trail.size();
+
+    /*
+      If the structure of the tableau has changed since the level was
+      pushed, begin from the first checkpoint taken on this level or
+      any level above it. The structure at that point is still the
+      structure of the level, and only the bound changes recorded
+      before the checkpoint need to be undone.
+    */
+    TableauState *checkpoint = NULL;
+    auto it = _trailCheckpoints.begin();
+    while ( it != _trailCheckpoints.end() )
+    {
+        if ( it->_level >= level )
+        {
+            if ( !checkpoint )
+            {
+                checkpoint = it->_state;
+                end = it->_trailSize;
+            }
+            else
+                delete it->_state;
+
+            it = _trailCheckpoints.erase( it );
+        }
+        else
+            ++it;
+    }
+
+    if ( checkpoint )
+    {
+        restoreStateWithoutCheckpoint( *checkpoint );
+        delete checkpoint;
+    }
+
+    // Undo the bound changes, most recent first
+    for ( unsigned i = end; i > start; --i )
+    {
+        const TrailEntry &entry = _trail[i - 1];
+        if ( entry._isLowerBound )
+            _lowerBounds[entry._variable] = entry._oldValue;
+        else
+            _upperBounds[entry._variable] = entry._oldValue;
+    }
+
+    /*
+      The restored bounds are normally looser than the current ones,
+      but keep the non-basic assignment within bounds regardless.
+    */
+    for ( unsigned i = end; i > start; --i )
+    {
+        unsigned variable = _trail[i - 1]._variable;
+        if ( _basicVariables.exists( variable ) )
+            continue;
+
+        unsigned index = _variableToIndex[variable];
+        if ( FloatUtils::lt( _nonBasicAssignment[index], _lowerBounds[variable] ) )
+            setNonBasicAssignment( variable, _lowerBounds[variable], false );
+        else if ( FloatUtils::gt( _nonBasicAssignment[index], _upperBounds[variable] ) )
+            setNonBasicAssignment( variable, _upperBounds[variable], false );
+    }
+
+    _trail.erase( _trail.begin() + start, _trail.end() );
+    _trailLevelStart.resize( level );
+
+    checkBoundsValid();
+    computeAssignment();
+    _costFunctionManager->initialize();
+    computeCostFunction();
+
+    if ( _statistics )
+        _statistics->setCurrentTrailSize( _trail.size() );
+}
+
+void Tableau::clearTrail()
+{
+    for ( const auto &checkpoint : _trailCheckpoints )
+        delete checkpoint._state;
+
+    _trailCheckpoints.clear();
+    _trail.clear();
+    _trailLevelStart.clear();
+
+    if ( _statistics )
+        _statistics->setCurrentTrailSize( 0 );
+}
+
+unsigned Tableau::getTrailLevel() const
+{
+    return _trailLevelStart.size();
+}
+
+unsigned Tableau::getTrailSize() const
+{
+    return _trail.size();
+}
+
 void Tableau::checkBoundsValid()
 {
     _boundsValid = true;
@@ -1766,74 +2302,95 @@ void Tableau::tightenUpperBound( unsigned variable, double value )
 
 unsigned Tableau::addEquation( const Equation &equation )
 {
-    // The fresh auxiliary variable assigned to the equation is _n.
-    // This variable is implicitly added to the equation, with
+    List<Equation> equations;
+    equations.append( equation );
+    return addEquations( equations );
+}
+
+unsigned Tableau::addEquations( const List<Equation> &equations )
+{
+    // The fresh auxiliary variables assigned to the equations are _n,
+    // _n + 1, etc. Each is implicitly added to its equation, with
     // coefficient 1.
-    unsigned auxVariable = _n;
+    unsigned firstAuxVariable = _n;
+    if ( equations.empty() )
+        return firstAuxVariable;
+
+    // The trail cannot undo new rows
+    checkpointTrailIfNeeded();
 
     // Adjust the data structures
-    addRow();
+    unsigned firstRow = _m;
+    addRows( equations.size() );
 
     // Adjust the constraint matrix
-    _A->addEmptyColumn();
-    std::fill_n( _workN, _n, 0.0 );
-    for ( const auto &addend : equation._addends )
-    {
-        _workN[addend._variable] = addend._coefficient;
-        _sparseColumnsOfA[addend._variable]->set( _m - 1, addend._coefficient );
-        _sparseRowsOfA[_m - 1]->set( addend._variable, addend._coefficient );
-        _denseA[(addend._variable * _m) + _m - 1] = addend._coefficient;
-    }
-
-    _workN[auxVariable] = 1;
-    _sparseColumnsOfA[auxVariable]->set( _m - 1, 1 );
-    _sparseRowsOfA[_m - 1]->set( auxVariable, 1 );
-    _denseA[(auxVariable * _m) + _m - 1] = 1;
-    _A->addLastRow( _workN );
-
-    // Invalidate the cost function, so that it is recomputed in the next iteration.
-    _costFunctionManager->invalidateCostFunction();
+    for ( unsigned i = 0; i < equations.size(); ++i )
+        _A->addEmptyColumn();
 
-    // All variables except the new one have finite bounds. Use this to compute
-    // finite bounds for the new variable.
-    double lb = equation._scalar;
-    double ub = equation._scalar;
-
-    for ( const auto &addend : equation._addends )
+    unsigned row = firstRow;
+    unsigned auxVariable = firstAuxVariable;
+    for ( const auto &equation : equations )
     {
-        double coefficient = addend._coefficient;
-        unsigned variable = addend._variable;
-
-        if ( FloatUtils::isPositive( coefficient ) )
+        std::fill_n( _workN, _n, 0.0 );
+        for ( const auto &addend : equation._addends )
         {
-            lb -= coefficient * _upperBounds[variable];
-            ub -= coefficient * _lowerBounds[variable];
+            _workN[addend._variable] = addend._coefficient;
+            _sparseColumnsOfA[addend._variable]->set( row, addend._coefficient );
+            _sparseRowsOfA[row]->set( addend._variable, addend._coefficient );
         }
-        else
+
+        _workN[auxVariable] = 1;
+        _sparseColumnsOfA[auxVariable]->set( row, 1 );
+        _sparseRowsOfA[row]->set( auxVariable, 1 );
+        _A->addLastRow( _workN );
+
+        // All variables except the new ones have finite bounds. Use
+        // this to compute finite bounds for the new variable.
+        double lb = equation._scalar;
+        double ub = equation._scalar;
+
+        for ( const auto &addend : equation._addends )
         {
-            lb -= coefficient * _lowerBounds[variable];
-            ub -= coefficient * _upperBounds[variable];
+            double coefficient = addend._coefficient;
+            unsigned variable = addend._variable;
+
+            if ( FloatUtils::isPositive( coefficient ) )
+            {
+                lb -= coefficient * _upperBounds[variable];
+                ub -= coefficient * _lowerBounds[variable];
+            }
+            else
+            {
+                lb -= coefficient * _lowerBounds[variable];
+                ub -= coefficient * _upperBounds[variable];
+            }
         }
-    }
 
-    setLowerBound( auxVariable, lb );
-    setUpperBound( auxVariable, ub );
+        setLowerBound( auxVariable, lb );
+        setUpperBound( auxVariable, ub );
 
-    // Populate the new row of b
-    _b[_m - 1] = equation._scalar;
+        // Populate the new row of b
+        _b[row] = equation._scalar;
 
-    if ( !FloatUtils::isZero( _b[_m - 1] ) )
-        _rhsIsAllZeros = false;
+        if ( !FloatUtils::isZero( _b[row] ) )
+            _rhsIsAllZeros = false;
 
-    /*
-      Attempt to make the auxiliary variable the new basic variable.
-      This usually works.
-      If it doesn't, compute a new set of basic variables and re-initialize
-      the tableau (which is more computationally expensive)
-    */
-    _basicIndexToVariable[_m - 1] = auxVariable;
-    _variableToIndex[auxVariable] = _m - 1;
-    _basicVariables.insert( auxVariable );
+        /*
+          Attempt to make the auxiliary variable the new basic variable.
+          This usually works.
+          If it doesn't, compute a new set of basic variables and re-initialize
+          the tableau (which is more computationally expensive)
+        */
+        _basicIndexToVariable[row] = auxVariable;
+        _variableToIndex[auxVariable] = row;
+        _basicVariables.insert( auxVariable );
+
+        ++row;
+        ++auxVariable;
+    }
+
+    // Invalidate the cost function, so that it is recomputed in the next iteration.
+    _costFunctionManager->invalidateCostFunction();
 
     // Attempt to refactorize the basis
     bool factorizationSuccessful = true;
@@ -1848,25 +2405,30 @@ unsigned Tableau::addEquation( const Equation &equation )
 
     if ( factorizationSuccessful )
     {
-        // Compute the assignment for the new basic variable
-        _basicAssignment[_m - 1] = equation._scalar;
-        for ( const auto &addend : equation._addends )
+        // Compute the assignments for the new basic variables
+        row = firstRow;
+        for ( const auto &equation : equations )
         {
-            _basicAssignment[_m - 1] -= addend._coefficient * getValue( addend._variable );
-        }
+            _basicAssignment[row] = equation._scalar;
+            for ( const auto &addend : equation._addends )
+            {
+                _basicAssignment[row] -= addend._coefficient * getValue( addend._variable );
+            }
 
-        ASSERT( FloatUtils::wellFormed( _basicAssignment[_m - 1] ) );
+            ASSERT( FloatUtils::wellFormed( _basicAssignment[row] ) );
 
-        if ( FloatUtils::isZero( _basicAssignment[_m - 1] ) )
-            _basicAssignment[_m - 1] = 0.0;
+            if ( FloatUtils::isZero( _basicAssignment[row] ) )
+                _basicAssignment[row] = 0.0;
 
-        // Notify about the new variable's assignment and compute its status
-        notifyVariableValue( _basicIndexToVariable[_m - 1], _basicAssignment[_m - 1] );
-        computeBasicStatus( _m - 1 );
+            // Notify about the new variable's assignment and compute its status
+            notifyVariableValue( _basicIndexToVariable[row], _basicAssignment[row] );
+            computeBasicStatus( row );
+            ++row;
+        }
     }
     else
     {
-        ConstraintMatrixAnalyzer analyzer;
+        SparseConstraintMatrixAnalyzer analyzer;
         analyzer.analyze( (const SparseUnsortedList **)_sparseRowsOfA, _m, _n );
         List<unsigned> independentColumns = analyzer.getIndependentColumns();
 
@@ -1883,185 +2445,152 @@ unsigned Tableau::addEquation( const Equation &equation )
         computeCostFunction();
     }
 
-    return auxVariable;
+    return firstAuxVariable;
 }
 
-void Tableau::addRow()
+void Tableau::addRows( unsigned numRows )
 {
-    unsigned newM = _m + 1;
-    unsigned newN = _n + 1;
+    unsigned oldN = _n;
+    resize( _m + numRows, _n + numRows );
+
+    // Mark the new variables as unbounded
+    std::fill( _lowerBounds + oldN, _lowerBounds + _n, FloatUtils::negativeInfinity() );
+    std::fill( _upperBounds + oldN, _upperBounds + _n, FloatUtils::infinity() );
+
+    _costFunctionManager->initialize();
 
+    for ( const auto &watcher : _resizeWatchers )
+        watcher->notifyDimensionChange( _m, _n );
+
+    if ( _statistics )
+    {
+        for ( unsigned i = 0; i < numRows; ++i )
+            _statistics->incNumAddedRows();
+    }
+}
+
+void Tableau::resize( unsigned m, unsigned n )
+{
     /*
-      This function increases the sizes of the data structures used by
-      the tableau to match newM and newN. Notice that newM = _m + 1 and
-      newN = _n + 1, and so newN - newM = _n - _m. Consequently, structures
-      that are of size _n - _m are left as is.
+      Notice that n - m = _n - _m, so structures that are of size
+      _n - _m are left as is.
     */
+    ASSERT( n - m == _n - _m );
 
-    // Allocate a larger _sparseColumnsOfA, keep old ones
-    SparseUnsortedList **newSparseColumnsOfA = new SparseUnsortedList *[newN];
-    if ( !newSparseColumnsOfA )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newSparseColumnsOfA" );
+    if ( m > _mCapacity )
+        increaseRowCapacity( std::max( m, 2 * _mCapacity ) );
+    if ( n > _nCapacity )
+        increaseColumnCapacity( std::max( n, 2 * _nCapacity ) );
 
-    for ( unsigned i = 0; i < _n; ++i )
+    /*
+      Sparse columns and rows beyond the new dimensions are kept, to be
+      reused when the tableau grows again. Existing columns and rows
+      keep their entries, and reused ones are emptied.
+    */
+    for ( unsigned i = 0; i < n; ++i )
     {
-        newSparseColumnsOfA[i] = _sparseColumnsOfA[i];
-        newSparseColumnsOfA[i]->incrementSize();
-    }
+        if ( !_sparseColumnsOfA[i] )
+        {
+            _sparseColumnsOfA[i] = new SparseUnsortedList( m );
+            if ( !_sparseColumnsOfA[i] )
+                throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newSparseColumnsOfA[i]" );
+            continue;
+        }
 
-    newSparseColumnsOfA[newN - 1] = new SparseUnsortedList( newM );
-    if ( !newSparseColumnsOfA[newN - 1] )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newSparseColumnsOfA[newN-1]" );
+        if ( i >= _n )
+            _sparseColumnsOfA[i]->clear();
+        _sparseColumnsOfA[i]->setSize( m );
+    }
 
-    delete[] _sparseColumnsOfA;
-    _sparseColumnsOfA = newSparseColumnsOfA;
+    for ( unsigned i = 0; i < m; ++i )
+    {
+        if ( !_sparseRowsOfA[i] )
+        {
+            _sparseRowsOfA[i] = new SparseUnsortedList( n );
+            if ( !_sparseRowsOfA[i] )
+                throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newSparseRowsOfA[i]" );
+            continue;
+        }
 
-    // Allocate a larger _sparseRowsOfA, keep old ones
-    SparseUnsortedList **newSparseRowsOfA = new SparseUnsortedList *[newM];
-    if ( !newSparseRowsOfA )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newSparseRowsOfA" );
+        if ( i >= _m )
+            _sparseRowsOfA[i]->clear();
+        _sparseRowsOfA[i]->setSize( n );
+    }
 
-    for ( unsigned i = 0; i < _m; ++i )
+    // The basis factorizations are sized at construction, so a new one is
+    // needed when the number of rows changes. It is factorized by the
+    // caller.
+    if ( m != _m )
     {
-        newSparseRowsOfA[i] = _sparseRowsOfA[i];
-        newSparseRowsOfA[i]->incrementSize();
+        IBasisFactorization *newBasisFactorization =
+            BasisFactorizationFactory::createBasisFactorization( m, *this );
+        if ( !newBasisFactorization )
+            throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newBasisFactorization" );
+        delete _basisFactorization;
+        _basisFactorization = newBasisFactorization;
+        _basisFactorization->setStatistics( _statistics );
     }
 
-    newSparseRowsOfA[newM - 1] = new SparseUnsortedList( newN );
-    if ( !newSparseRowsOfA[newM - 1] )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newSparseRowsOfA[newN-1]" );
+    _m = m;
+    _n = n;
 
-    delete[] _sparseRowsOfA;
-    _sparseRowsOfA = newSparseRowsOfA;
+    if ( _statistics )
+        _statistics->setCurrentTableauDimension( _m, _n );
+}
 
-    // Allocate a larger _denseA, keep old entries
-    double *newDenseA = new double[newM * newN];
-    if ( !newDenseA )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newDenseA" );
+/*
+  Replace an array with a larger one, copying the first numToCopy
+  entries (if any) from the old array.
+*/
+template <typename T>
+static void resizeArray( T *&array, unsigned newSize, unsigned numToCopy, const char *name )
+{
+    T *newArray = new T[newSize];
+    if ( !newArray )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, name );
 
-    for ( unsigned column = 0; column < _n; ++column )
-    {
-        memcpy( newDenseA + ( column * newM ), _denseA + ( column * _m ), sizeof(double) * _m );
-        newDenseA[column*newM + newM - 1] = 0.0;
-    }
-    std::fill_n( newDenseA + ( newN - 1 ) * newM, newM, 0.0 );
-
-    delete[] _denseA;
-    _denseA = newDenseA;
-
-    // Allocate a new changeColumn. Don't need to initialize
-    double *newChangeColumn = new double[newM];
-    if ( !newChangeColumn )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newChangeColumn" );
-    delete[] _changeColumn;
-    _changeColumn = newChangeColumn;
-
-    // Allocate a new b and copy the old values
-    double *newB = new double[newM];
-    if ( !newB )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newB" );
-    std::fill( newB + _m, newB + newM, 0.0 );
-    memcpy( newB, _b, _m * sizeof(double) );
-    delete[] _b;
-    _b = newB;
-
-    // Allocate a new unit vector. Don't need to initialize
-    double *newUnitVector = new double[newM];
-    if ( !newUnitVector )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newUnitVector" );
-    delete[] _unitVector;
-    _unitVector = newUnitVector;
-
-    // Allocate new multipliers. Don't need to initialize
-    double *newMultipliers = new double[newM];
-    if ( !newMultipliers )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newMultipliers" );
-    delete[] _multipliers;
-    _multipliers = newMultipliers;
-
-    // Allocate new index arrays. Copy old indices, but don't assign indices to new variables yet.
-    unsigned *newBasicIndexToVariable = new unsigned[newM];
-    if ( !newBasicIndexToVariable )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newBasicIndexToVariable" );
-    memcpy( newBasicIndexToVariable, _basicIndexToVariable, _m * sizeof(unsigned) );
-    delete[] _basicIndexToVariable;
-    _basicIndexToVariable = newBasicIndexToVariable;
-
-    unsigned *newVariableToIndex = new unsigned[newN];
-    if ( !newVariableToIndex )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newVariableToIndex" );
-    memcpy( newVariableToIndex, _variableToIndex, _n * sizeof(unsigned) );
-    delete[] _variableToIndex;
-    _variableToIndex = newVariableToIndex;
-
-    // Allocate a new basic assignment vector, copy old values
-    double *newBasicAssignment = new double[newM];
-    if ( !newBasicAssignment )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newAssignment" );
-    memcpy( newBasicAssignment, _basicAssignment, sizeof(double) * _m );
-    delete[] _basicAssignment;
-    _basicAssignment = newBasicAssignment;
-
-    unsigned *newBasicStatus = new unsigned[newM];
-    if ( !newBasicStatus )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newBasicStatus" );
-    memcpy( newBasicStatus, _basicStatus, sizeof(unsigned) * _m );
-    delete[] _basicStatus;
-    _basicStatus = newBasicStatus;
-
-    // Allocate new lower and upper bound arrays, and copy old values
-    double *newLowerBounds = new double[newN];
-    if ( !newLowerBounds )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newLowerBounds" );
-    memcpy( newLowerBounds, _lowerBounds, _n * sizeof(double) );
-    delete[] _lowerBounds;
-    _lowerBounds = newLowerBounds;
-
-    double *newUpperBounds = new double[newN];
-    if ( !newUpperBounds )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newUpperBounds" );
-    memcpy( newUpperBounds, _upperBounds, _n * sizeof(double) );
-    delete[] _upperBounds;
-    _upperBounds = newUpperBounds;
-
-    // Mark the new variable as unbounded
-    _lowerBounds[_n] = FloatUtils::negativeInfinity();
-    _upperBounds[_n] = FloatUtils::infinity();
-
-    // Allocate a larger basis factorization
-    IBasisFactorization *newBasisFactorization =
-        BasisFactorizationFactory::createBasisFactorization( newM, *this );
-    if ( !newBasisFactorization )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newBasisFactorization" );
-    delete _basisFactorization;
-    _basisFactorization = newBasisFactorization;
-    _basisFactorization->setStatistics( _statistics );
+    if ( numToCopy > 0 )
+        memcpy( newArray, array, numToCopy * sizeof(T) );
 
-    // Allocate a larger _workM and _workN. Don't need to initialize.
-    double *newWorkM = new double[newM];
-    if ( !newWorkM )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newWorkM" );
-    delete[] _workM;
-    _workM = newWorkM;
-
-    double *newWorkN = new double[newN];
-    if ( !newWorkN )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newWorkN" );
-    delete[] _workN;
-    _workN = newWorkN;
-
-    _m = newM;
-    _n = newN;
-    _costFunctionManager->initialize();
+    delete[] array;
+    array = newArray;
+}
 
-    for ( const auto &watcher : _resizeWatchers )
-        watcher->notifyDimensionChange( _m, _n );
+void Tableau::increaseRowCapacity( unsigned newCapacity )
+{
+    ASSERT( newCapacity >= _m );
 
-    if ( _statistics )
-    {
-        _statistics->incNumAddedRows();
-        _statistics->setCurrentTableauDimension( _m, _n );
-    }
+    // Sparse rows beyond the current dimensions are kept for reuse
+    resizeArray( _sparseRowsOfA, newCapacity, _mCapacity, "Tableau::newSparseRowsOfA" );
+    std::fill( _sparseRowsOfA + _mCapacity, _sparseRowsOfA + newCapacity, (SparseUnsortedList *)NULL );
+    resizeArray( _b, newCapacity, _m, "Tableau::newB" );
+    resizeArray( _basicIndexToVariable, newCapacity, _m, "Tableau::newBasicIndexToVariable" );
+    resizeArray( _basicAssignment, newCapacity, _m, "Tableau::newAssignment" );
+    resizeArray( _basicStatus, newCapacity, _m, "Tableau::newBasicStatus" );
+
+    // Work memory. Don't need to copy
+    resizeArray( _denseAColumn, newCapacity, 0, "Tableau::newDenseAColumn" );
+    resizeArray( _changeColumn, newCapacity, 0, "Tableau::newChangeColumn" );
+    resizeArray( _multipliers, newCapacity, 0, "Tableau::newMultipliers" );
+    resizeArray( _workM, newCapacity, 0, "Tableau::newWorkM" );
+
+    _mCapacity = newCapacity;
+}
+
+void Tableau::increaseColumnCapacity( unsigned newCapacity )
+{
+    ASSERT( newCapacity >= _n );
+
+    resizeArray( _sparseColumnsOfA, newCapacity, _nCapacity, "Tableau::newSparseColumnsOfA" );
+    std::fill( _sparseColumnsOfA + _nCapacity, _sparseColumnsOfA + newCapacity, (SparseUnsortedList *)NULL );
+    resizeArray( _variableToIndex, newCapacity, _n, "Tableau::newVariableToIndex" );
+    resizeArray( _lowerBounds, newCapacity, _n, "Tableau::newLowerBounds" );
+    resizeArray( _upperBounds, newCapacity, _n, "Tableau::newUpperBounds" );
+
+    // Work memory. Don't need to copy
+    resizeArray( _workN, newCapacity, 0, "Tableau::newWorkN" );
+
+    _nCapacity = newCapacity;
 }
 
 void Tableau::registerToWatchVariable( VariableWatcher *watcher, unsigned variable )
@@ -2135,6 +2664,11 @@ void Tableau::backwardTransformation( const double *y, double *x ) const
     _basisFactorization->backwardTransformation( y, x );
 }
 
+void Tableau::sparseBackwardTransformation( const SparseUnsortedList &y, double *x ) const
+{
+    _basisFactorization->sparseBackwardTransformation( y, x );
+}
+
 double Tableau::getSumOfInfeasibilities() const
 {
     double result = 0;
@@ -2294,6 +2828,7 @@ void Tableau::updateAssignmentForPivot()
     */
 
     _basicAssignmentStatus = ITableau::BASIC_ASSIGNMENT_UPDATED;
+    _numBasicsPassedBound = 0;
 
     if ( performingFakePivot() )
     {
@@ -2318,7 +2853,7 @@ void Tableau::updateAssignmentForPivot()
 
             _basicAssignment[i] -= _changeColumn[i] * nonBasicDelta;
             notifyVariableValue( _basicIndexToVariable[i], _basicAssignment[i] );
-            computeBasicStatus( i );
+            updateBasicStatusForPivot( i );
         }
 
         // Update the assignment for the non-basic variable
@@ -2368,7 +2903,7 @@ void Tableau::updateAssignmentForPivot()
 
             _basicAssignment[i] -= _changeColumn[i] * nonBasicDelta;
             notifyVariableValue( _basicIndexToVariable[i], _basicAssignment[i] );
-            computeBasicStatus( i );
+            updateBasicStatusForPivot( i );
         }
 
         // Update the assignment for the entering variable
@@ -2382,8 +2917,31 @@ void Tableau::updateAssignmentForPivot()
     }
 }
 
+void Tableau::updateBasicStatusForPivot( unsigned basicIndex )
+{
+    unsigned oldStatus = _basicStatus[basicIndex];
+    computeBasicStatus( basicIndex );
+
+    // Only the long-step ratio test moves basics past their bounds
+    if ( _primalRatioTestType == PrimalRatioTestType::LONG_STEP &&
+         _basicStatus[basicIndex] != oldStatus )
+        ++_numBasicsPassedBound;
+}
+
 void Tableau::updateCostFunctionForPivot()
 {
+    // The cost of a basic that passed a bound has changed, so the
+    // incremental update does not apply
+    if ( _numBasicsPassedBound > 0 )
+    {
+        if ( _statistics )
+            _statistics->addNumLongStepBreakpoints( _numBasicsPassedBound );
+
+        _numBasicsPassedBound = 0;
+        _costFunctionManager->invalidateCostFunction();
+        return;
+    }
+
     // If the pivot is fake, the cost function does not change
     if ( performingFakePivot() )
         return;
@@ -2485,6 +3043,9 @@ void Tableau::mergeColumns( unsigned x1, unsigned x2 )
     ASSERT( !isBasic( x1 ) );
     ASSERT( !isBasic( x2 ) );
 
+    // The trail cannot undo merged columns
+    checkpointTrailIfNeeded();
+
     /*
       If x2 has tighter bounds than x1, adjust the bounds
       for x1.
@@ -2508,11 +3069,6 @@ void Tableau::mergeColumns( unsigned x1, unsigned x2 )
     for ( unsigned i = 0; i < _m; ++i )
         _sparseRowsOfA[i]->mergeEntries( x2, x1 );
 
-    // And the dense ones, too
-    for ( unsigned i = 0; i < _m; ++i )
-        _denseA[x1*_m + i] += _denseA[x2*_m + i];
-    std::fill_n( _denseA + x2 * _m, _m, 0 );
-
     computeAssignment();
     computeCostFunction();
 
@@ -2535,8 +3091,8 @@ bool Tableau::areLinearlyDependent( unsigned x1, unsigned x2, double &coefficien
     unsigned nonBasic = oneIsBasic ? x2 : x1;
 
     // Find the column of the non-basic
-    const double *a = getAColumn( nonBasic );
-    _basisFactorization->forwardTransformation( a, _workM );
+    getAColumn( nonBasic, _denseAColumn );
+    _basisFactorization->forwardTransformation( _denseAColumn, _workM );
 
     // Find the correct entry in the column
     unsigned basicIndex = _variableToIndex[basic];
@@ -23,9 +23,13 @@
 #include "Set.h"
 #include "SparseColumnsOfBasis.h"
 #include "SparseMatrix.h"
+#include "SparseUnsortedArrays.h"
 #include "SparseUnsortedList.h"
 #include "Statistics.h"
 
+#include <utility>
+#include <vector>
+
 #define TABLEAU_LOG( x, ... ) LOG( GlobalConfiguration::TABLEAU_LOGGING, "Tableau: %s\n", x )
 
 class Equation;
@@ -47,9 +51,12 @@ public:
     void setDimensions( unsigned m, unsigned n );
 
     /*
-      Initialize the constraint matrix
+      Initialize the constraint matrix, from its sparse rows or
+      from a dense (row-major) matrix. Only sparse copies of the
+      matrix are kept.
     */
     void setConstraintMatrix( const double *A );
+    void setConstraintMatrix( const SparseUnsortedArrays &A );
 
     /*
       Set which variable will enter the basis. The input is the
@@ -81,6 +88,7 @@ public:
     */
     void forwardTransformation( const double *y, double *x ) const;
     void backwardTransformation( const double *y, double *x ) const;
+    void sparseBackwardTransformation( const SparseUnsortedList &y, double *x ) const;
 
     /*
       Mark a variable as basic in the initial basis
@@ -103,6 +111,14 @@ public:
     */
     unsigned addEquation( const Equation &equation );
 
+    /*
+      Add several equations at once, resizing the tableau and
+      refactorizing the basis only once. The fresh auxiliary variables
+      assigned to the equations are consecutive, in the order of the
+      equations; the method returns the index of the first one.
+    */
+    unsigned addEquations( const List<Equation> &equations );
+
     /*
       Get the Tableau's dimensions.
     */
@@ -219,6 +235,24 @@ public:
     */
     void pickLeavingVariable();
     void pickLeavingVariable( double *d );
+
+    /*
+      Select the ratio test used by pickLeavingVariable()
+    */
+    void setPrimalRatioTestType( PrimalRatioTestType type );
+
+    /*
+      For a dual simplex step: the leaving variable is an out-of-bounds
+      basic variable, and the pivot row has been computed for it. Pick
+      the entering variable, so that the leaving variable leaves the
+      basis at its violated bound. Return false if no non-basic
+      variable can move the leaving variable towards that bound.
+
+      With the bound-flipping ratio test, boxed non-basic variables
+      may also be flipped to their opposite bounds, as long as this
+      does not bring the leaving variable within its bounds.
+    */
+    bool dualRatioTest( DualRatioTestType type );
     unsigned getLeavingVariable() const;
     unsigned getLeavingVariableIndex() const;
     double getChangeRatio() const;
@@ -322,11 +356,11 @@ public:
     void getTableauRow( unsigned index, TableauRow *row );
 
     /*
-      Get the original constraint matrix A or a column thereof,
-      in dense form.
+      Get the original constraint matrix A or a column thereof.
+      getAColumn() scatters the column into a dense vector of size m.
     */
     const SparseMatrix *getSparseA() const;
-    const double *getAColumn( unsigned variable ) const;
+    void getAColumn( unsigned variable, double *result ) const;
     void getSparseAColumn( unsigned variable, SparseUnsortedList *result ) const;
     void getSparseARow( unsigned row, SparseUnsortedList *result ) const;
     const SparseUnsortedList *getSparseAColumn( unsigned variable ) const;
@@ -347,6 +381,30 @@ public:
     void storeState( TableauState &state ) const;
     void restoreState( const TableauState &state );
 
+    /*
+      Trail-based backtracking, as a lightweight alternative to
+      storeState() / restoreState(). Pushing a trail level starts
+      recording every bound change; backtracking to a level undoes
+      all the changes recorded since that level was pushed, and
+      closes any levels pushed after it. The level itself remains
+      open, so that it can be backtracked to again.
+
+      The basis is not restored: any basis of the current matrix A
+      is valid, and the non-basic assignment remains within the
+      (looser) restored bounds. Changes that alter the structure of
+      the tableau (adding equations, merging columns, restoring a
+      stored state) cannot be undone this way. Before the first such
+      change on a given level, a full checkpoint of the tableau is
+      stored, and restored when backtracking to that level.
+
+      pushTrailLevel() returns the new level, starting from 1.
+    */
+    unsigned pushTrailLevel();
+    void backtrackTrail( unsigned level );
+    void clearTrail();
+    unsigned getTrailLevel() const;
+    unsigned getTrailSize() const;
+
     /*
       Register or unregister to watch a variable.
     */
@@ -464,15 +522,28 @@ private:
     unsigned _n;
     unsigned _m;
 
+    /*
+      The number of rows and columns that the per-row and per-column
+      arrays have room for. Adding equations grows these geometrically,
+      and restoring a smaller state keeps them, so that the arrays are
+      only reallocated when the tableau outgrows them.
+    */
+    unsigned _mCapacity;
+    unsigned _nCapacity;
+
     /*
       The constraint matrix A, and a collection of its
-      sparse columns. The matrix is also stored in dense
-      form (column-major).
+      sparse columns and rows.
     */
     SparseMatrix *_A;
     SparseUnsortedList **_sparseColumnsOfA;
     SparseUnsortedList **_sparseRowsOfA;
-    double *_denseA;
+
+    /*
+      A column of A in dense form, as needed by the basis
+      factorization
+    */
+    double *_denseAColumn;
 
     /*
       Used to compute inv(B)*a
@@ -484,6 +555,23 @@ private:
     */
     TableauRow *_pivotRow;
 
+    /*
+      Candidates for the bound-flipping dual ratio test: pivot row
+      coefficient magnitudes, and non-basic indices
+    */
+    std::vector<std::pair<double, unsigned>> _boundFlipCandidates;
+
+    /*
+      The ratio test for primal simplex steps. For the long-step ratio
+      test, the breakpoints (the changes of the entering variable at
+      which basic variables reach their bounds, and the basic indices),
+      and the number of basic variables that the last pivot moved past
+      a bound.
+    */
+    PrimalRatioTestType _primalRatioTestType;
+    std::vector<std::pair<double, unsigned>> _longStepBreakpoints;
+    unsigned _numBasicsPassedBound;
+
     /*
       The right hand side vector of Ax = b
     */
@@ -495,11 +583,6 @@ private:
     double *_workM;
     double *_workN;
 
-    /*
-      A unit vector of size m
-    */
-    double *_unitVector;
-
     /*
       The current factorization of the basis
     */
@@ -605,15 +688,80 @@ private:
      */
     bool _rhsIsAllZeros;
 
+    /*
+      The trail used for backtracking: the old values of all bounds
+      changed since the first trail level was pushed, the trail size
+      at the moment each level was pushed, and the full checkpoints
+      taken before structural changes. Checkpoints are stored in the
+      order in which they were taken.
+    */
+    struct TrailEntry
+    {
+        TrailEntry( unsigned variable, bool isLowerBound, double oldValue )
+            : _variable( variable )
+            , _isLowerBound( isLowerBound )
+            , _oldValue( oldValue )
+        {
+        }
+
+        unsigned _variable;
+        bool _isLowerBound;
+        double _oldValue;
+    };
+
+    struct TrailCheckpoint
+    {
+        unsigned _level;
+        unsigned _trailSize;
+        TableauState *_state;
+    };
+
+    std::vector<TrailEntry> _trail;
+    std::vector<unsigned> _trailLevelStart;
+    List<TrailCheckpoint> _trailCheckpoints;
+
     /*
       Free all allocated memory.
     */
     void freeMemoryIfNeeded();
 
     /*
-      Resize the relevant data structures to add a new row to the tableau.
+      Store a full checkpoint for the current trail level, if there
+      is an open level that does not have one yet. Called before
+      structural changes to the tableau.
+    */
+    void checkpointTrailIfNeeded();
+
+    /*
+      Restore a stored state, without checkpointing the trail.
+    */
+    void restoreStateWithoutCheckpoint( const TableauState &state );
+
+    /*
+      The number of bytes copied into a TableauState by storeState().
+    */
+    unsigned long long getStateSizeInBytes() const;
+
+    /*
+      Resize the relevant data structures to add new rows to the
+      tableau, each with a new (auxiliary) variable.
     */
-    void addRow();
+    void addRows( unsigned numRows );
+
+    /*
+      Change the dimensions of the tableau, keeping the number of
+      non-basic variables. Arrays are reallocated only if their
+      capacity is exceeded. When growing, existing rows and columns
+      keep their entries; when shrinking, the caller overwrites them.
+    */
+    void resize( unsigned m, unsigned n );
+
+    /*
+      Grow the per-row and per-column arrays to the given capacities,
+      keeping their contents.
+    */
+    void increaseRowCapacity( unsigned newCapacity );
+    void increaseColumnCapacity( unsigned newCapacity );
 
     /*
       Update the variable assignment to reflect a pivot operation,
@@ -621,11 +769,32 @@ private:
      */
     void updateAssignmentForPivot();
 
+    /*
+      Recompute the status of a basic variable after its value was
+      updated by a pivot, and count it if it has passed a bound.
+    */
+    void updateBasicStatusForPivot( unsigned basicIndex );
+
     /*
       Ratio tests for determining the leaving variable
     */
     void standardRatioTest( double *changeColumn );
     void harrisRatioTest( double *changeColumn );
+    void longStepRatioTest( double *changeColumn );
+
+    /*
+      The bound flips of the bound-flipping dual ratio test, for the
+      current leaving and entering variables. Return false if the
+      leaving variable is no longer out of bounds afterwards.
+    */
+    bool flipBoundsForDualRatioTest();
+
+    /*
+      Check whether subtracting _workM from the basic assignment keeps
+      every basic variable other than the leaving one at least as
+      feasible as it is.
+    */
+    bool boundFlipKeepsBasicsFeasible() const;
 
     /*
       For debugging purposes only
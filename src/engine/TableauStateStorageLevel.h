@@ -0,0 +1,43 @@
+/*********************                                                        */
+/*! \file TableauStateStorageLevel.h
+** \verbatim
+** Top contributors (to current version):
+**   Guy Katz
+** This file is part of the Marabou project.
+** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved. See the file COPYING in the top-level source
+** directory for licensing information.\endverbatim
+**
+** [[ Add lengthier description here ]]
+
+**/
+
+#ifndef __TableauStateStorageLevel_h__
+#define __TableauStateStorageLevel_h__
+
+/*
+  How much of the tableau is saved when the engine state is stored
+*/
+enum class TableauStateStorageLevel
+{
+    // Store only the states of the piecewise linear constraints
+    STORE_NO_TABLEAU_STATE = 0,
+
+    // Open a new level on the tableau's trail: bound changes are
+    // recorded from this point on, and undone when the state is restored
+    STORE_TABLEAU_TRAIL = 1,
+
+    // Store a complete copy of the tableau
+    STORE_ENTIRE_TABLEAU_STATE = 2,
+};
+
+#endif // __TableauStateStorageLevel_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
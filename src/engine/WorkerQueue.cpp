@@ -0,0 +1,201 @@
+/*********************                                                        */
+/*! \file WorkerQueue.cpp
+** \verbatim
+** Top contributors (to current version):
+**   Haoze Wu
+** This file is part of the Marabou project.
+** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved. See the file COPYING in the top-level source
+** directory for licensing information.\endverbatim
+**
+** [[ Add lengthier description here ]]
+
+**/
+
+#include "Debug.h"
+#include "MarabouError.h"
+#include "TimeUtils.h"
+#include "WorkerQueue.h"
+
+#include <chrono>
+
+WorkerQueue::WorkerQueue( unsigned numWorkers )
+    : _numWorkers( numWorkers )
+    , _statistics( numWorkers )
+    , _size( 0 )
+{
+    if ( numWorkers == 0 )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "WorkerQueue::numWorkers" );
+
+    for ( unsigned i = 0; i < numWorkers; ++i )
+    {
+        WorkerDeque *workerDeque = new WorkerDeque;
+        if ( !workerDeque )
+            throw MarabouError( MarabouError::ALLOCATION_FAILED, "WorkerQueue::workerDeque" );
+        _deques.append( workerDeque );
+    }
+}
+
+WorkerQueue::~WorkerQueue()
+{
+    for ( auto &workerDeque : _deques )
+    {
+        delete workerDeque;
+        workerDeque = NULL;
+    }
+    _deques.clear();
+}
+
+void WorkerQueue::push( unsigned workerId, SubQuery *subQuery )
+{
+    ASSERT( workerId < _numWorkers );
+
+    {
+        std::lock_guard<std::mutex> lock( _deques[workerId]->_mutex );
+        _deques[workerId]->_subQueries.push_back( subQuery );
+        ++_size;
+    }
+
+    // Taking the wait mutex guarantees that a worker that has just found
+    // the queue empty is already waiting, and will receive the notification
+    {
+        std::lock_guard<std::mutex> lock( _waitMutex );
+    }
+    _condition.notify_one();
+}
+
+bool WorkerQueue::pop( unsigned workerId, SubQuery *&subQuery )
+{
+    ASSERT( workerId < _numWorkers );
+
+    if ( popFromOwnDeque( workerId, subQuery ) )
+    {
+        ++_statistics[workerId]._numPopped;
+        return true;
+    }
+
+    if ( stealFromOtherDeque( workerId, subQuery ) )
+    {
+        ++_statistics[workerId]._numPopped;
+        ++_statistics[workerId]._numStolen;
+        return true;
+    }
+
+    return false;
+}
+
+bool WorkerQueue::popFromOwnDeque( unsigned workerId, SubQuery *&subQuery )
+{
+    WorkerDeque *workerDeque = _deques[workerId];
+    std::lock_guard<std::mutex> lock( workerDeque->_mutex );
+    if ( workerDeque->_subQueries.empty() )
+        return false;
+
+    subQuery = workerDeque->_subQueries.back();
+    workerDeque->_subQueries.pop_back();
+    --_size;
+    return true;
+}
+
+bool WorkerQueue::stealFromOtherDeque( unsigned workerId, SubQuery *&subQuery )
+{
+    // Start from the next worker, so that thieves spread over the victims.
+    // The front of a deque holds its oldest, and typically largest, region.
+    for ( unsigned i = 1; i < _numWorkers; ++i )
+    {
+        if ( _size.load() == 0 )
+            return false;
+
+        WorkerDeque *victim = _deques[( workerId + i ) % _numWorkers];
+        std::lock_guard<std::mutex> lock( victim->_mutex );
+        if ( victim->_subQueries.empty() )
+            continue;
+
+        subQuery = victim->_subQueries.front();
+        victim->_subQueries.pop_front();
+        --_size;
+        return true;
+    }
+
+    return false;
+}
+
+bool WorkerQueue::waitAndPop( unsigned workerId, SubQuery *&subQuery,
+                              const std::atomic_bool &shouldQuit )
+{
+    while ( true )
+    {
+        if ( pop( workerId, subQuery ) )
+            return true;
+
+        if ( shouldQuit.load() )
+            return false;
+
+        struct timespec idleStart = TimeUtils::sampleMicro();
+        {
+            std::unique_lock<std::mutex> lock( _waitMutex );
+            _condition.wait( lock, [&]
+                             {
+                                 return _size.load() > 0 || shouldQuit.load();
+                             } );
+        }
+        struct timespec idleEnd = TimeUtils::sampleMicro();
+        _statistics[workerId]._idleTimeMicro +=
+            TimeUtils::timePassed( idleStart, idleEnd );
+    }
+}
+
+void WorkerQueue::waitForQuit( const std::atomic_bool &shouldQuit,
+                               unsigned long long timeoutInMicroSeconds )
+{
+    std::unique_lock<std::mutex> lock( _waitMutex );
+    if ( timeoutInMicroSeconds == 0 )
+    {
+        _quitCondition.wait( lock, [&] { return shouldQuit.load(); } );
+    }
+    else
+    {
+        _quitCondition.wait_for( lock,
+                                 std::chrono::microseconds( timeoutInMicroSeconds ),
+                                 [&] { return shouldQuit.load(); } );
+    }
+}
+
+void WorkerQueue::notifyAll()
+{
+    {
+        std::lock_guard<std::mutex> lock( _waitMutex );
+    }
+    _condition.notify_all();
+    _quitCondition.notify_all();
+}
+
+bool WorkerQueue::empty() const
+{
+    return _size.load() == 0;
+}
+
+unsigned WorkerQueue::size() const
+{
+    return _size.load();
+}
+
+unsigned WorkerQueue::getNumWorkers() const
+{
+    return _numWorkers;
+}
+
+WorkerQueue::WorkerStatistics WorkerQueue::getWorkerStatistics( unsigned workerId ) const
+{
+    ASSERT( workerId < _numWorkers );
+    return _statistics.get( workerId );
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
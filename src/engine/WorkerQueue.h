@@ -0,0 +1,142 @@
+/*********************                                                        */
+/*! \file WorkerQueue.h
+** \verbatim
+** Top contributors (to current version):
+**   Haoze Wu
+** This file is part of the Marabou project.
+** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved. See the file COPYING in the top-level source
+** directory for licensing information.\endverbatim
+**
+** [[ Add lengthier description here ]]
+
+**/
+
+#ifndef __WorkerQueue_h__
+#define __WorkerQueue_h__
+
+#include "Vector.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+struct SubQuery;
+
+/*
+  The set of sub-queries shared by the DnC workers. Every worker owns a
+  deque: it pushes and pops its own sub-queries at the back, so that it
+  keeps working on the most recently divided region, and steals from the
+  front of the other workers' deques when its own deque is empty. Idle
+  workers sleep on a condition variable, and are woken up when new
+  sub-queries are pushed or when solving should stop.
+*/
+class WorkerQueue
+{
+public:
+    /*
+      Per-worker counters. Each entry is only written by its own worker,
+      and should only be read once the workers have been joined.
+    */
+    struct WorkerStatistics
+    {
+        WorkerStatistics()
+            : _numPopped( 0 )
+            , _numStolen( 0 )
+            , _idleTimeMicro( 0 )
+        {
+        }
+
+        unsigned long long _numPopped;
+        unsigned long long _numStolen;
+        unsigned long long _idleTimeMicro;
+    };
+
+    WorkerQueue( unsigned numWorkers );
+    ~WorkerQueue();
+
+    /*
+      Push a sub-query onto the deque of the given worker, and wake up
+      one idle worker
+    */
+    void push( unsigned workerId, SubQuery *subQuery );
+
+    /*
+      Pop a sub-query for the given worker without blocking: first from
+      its own deque, and otherwise by stealing from another worker.
+      Return false if there is no sub-query left.
+    */
+    bool pop( unsigned workerId, SubQuery *&subQuery );
+
+    /*
+      Like pop(), but if there is no sub-query, sleep until one is pushed
+      or until shouldQuit is set. Return false if shouldQuit was set and
+      no sub-query was obtained. The time spent sleeping is counted as
+      idle time of the worker.
+    */
+    bool waitAndPop( unsigned workerId, SubQuery *&subQuery,
+                     const std::atomic_bool &shouldQuit );
+
+    /*
+      Sleep until shouldQuit is set, or until the given number of
+      microseconds has passed (0 means no limit)
+    */
+    void waitForQuit( const std::atomic_bool &shouldQuit,
+                      unsigned long long timeoutInMicroSeconds );
+
+    /*
+      Wake up all waiting threads. Must be called after setting the quit
+      flag that the waiting threads were given.
+    */
+    void notifyAll();
+
+    bool empty() const;
+    unsigned size() const;
+    unsigned getNumWorkers() const;
+
+    WorkerStatistics getWorkerStatistics( unsigned workerId ) const;
+
+private:
+    struct WorkerDeque
+    {
+        std::mutex _mutex;
+        std::deque<SubQuery *> _subQueries;
+    };
+
+    bool popFromOwnDeque( unsigned workerId, SubQuery *&subQuery );
+    bool stealFromOtherDeque( unsigned workerId, SubQuery *&subQuery );
+
+    unsigned _numWorkers;
+    Vector<WorkerDeque *> _deques;
+    Vector<WorkerStatistics> _statistics;
+
+    /*
+      The total number of sub-queries currently in the deques
+    */
+    std::atomic_uint _size;
+
+    /*
+      Used only for sleeping and waking up, never held while a deque is
+      locked
+    */
+    std::mutex _waitMutex;
+    std::condition_variable _condition;
+
+    /*
+      The manager waits on a separate condition variable, so that it
+      never consumes a wakeup meant for an idle worker
+    */
+    std::condition_variable _quitCondition;
+};
+
+#endif // __WorkerQueue_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,145 @@
+/*********************                                                        */
+/*! \file main.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** Compare the time it takes the ConstraintMatrixAnalyzer (given a dense
+ ** matrix) and the SparseConstraintMatrixAnalyzer (given a sparse matrix)
+ ** to find the redundant rows of a query's constraint matrix, and check
+ ** that they agree. The matrix is that of the query as parsed, without
+ ** preprocessing. Invoke with a list of .nnet or .mps files, or with no
+ ** arguments to use networks from the resources directory.
+
+ **/
+
+#include "AcasParser.h"
+#include "ConstraintMatrixAnalyzer.h"
+#include "FloatUtils.h"
+#include "InputQuery.h"
+#include "MarabouError.h"
+#include "MpsParser.h"
+#include "SparseConstraintMatrixAnalyzer.h"
+#include "SparseUnsortedArrays.h"
+#include "TimeUtils.h"
+
+#include <cstdio>
+
+static void loadQuery( const String &path, InputQuery &inputQuery )
+{
+    if ( path.contains( ".mps" ) )
+    {
+        MpsParser mpsParser( path );
+        mpsParser.generateQuery( inputQuery );
+    }
+    else
+    {
+        AcasParser acasParser( path );
+        acasParser.generateQuery( inputQuery );
+    }
+}
+
+static void runBenchmark( const String &path )
+{
+    InputQuery query;
+    loadQuery( path, query );
+
+    const List<Equation> &equations( query.getEquations() );
+    unsigned m = equations.size();
+    unsigned n = query.getNumberOfVariables();
+
+    // The dense analyzer is given a dense matrix, as the engine used to
+    struct timespec start = TimeUtils::sampleMicro();
+    double *denseMatrix = new double[m * n];
+    std::fill_n( denseMatrix, m * n, 0 );
+    unsigned row = 0;
+    for ( const auto &equation : equations )
+    {
+        for ( const auto &addend : equation._addends )
+            denseMatrix[row * n + addend._variable] = addend._coefficient;
+        ++row;
+    }
+
+    ConstraintMatrixAnalyzer denseAnalyzer;
+    denseAnalyzer.analyze( denseMatrix, m, n );
+    delete[] denseMatrix;
+    unsigned long long denseTime = TimeUtils::timePassed( start, TimeUtils::sampleMicro() );
+
+    start = TimeUtils::sampleMicro();
+    SparseUnsortedArrays sparseMatrix;
+    sparseMatrix.initializeToEmpty( m, n );
+    row = 0;
+    for ( const auto &equation : equations )
+    {
+        for ( const auto &addend : equation._addends )
+        {
+            if ( !FloatUtils::isZero( addend._coefficient ) )
+                sparseMatrix.append( row, addend._variable, addend._coefficient );
+        }
+        ++row;
+    }
+
+    SparseConstraintMatrixAnalyzer sparseAnalyzer;
+    sparseAnalyzer.analyze( sparseMatrix, m, n );
+    unsigned long long sparseTime = TimeUtils::timePassed( start, TimeUtils::sampleMicro() );
+
+    bool agree =
+        ( denseAnalyzer.getRedundantRows() == sparseAnalyzer.getRedundantRows() ) &&
+        ( denseAnalyzer.getIndependentColumns() == sparseAnalyzer.getIndependentColumns() );
+
+    printf( "%s\n\t%u x %u, %u non-zeros, %u redundant rows\n"
+            "\tDense analyzer: %llu milli. Sparse analyzer: %llu milli (%.2lfx). Results %s\n",
+            path.ascii(),
+            m,
+            n,
+            sparseMatrix.getNnz(),
+            sparseAnalyzer.getRedundantRows().size(),
+            denseTime / 1000,
+            sparseTime / 1000,
+            sparseTime > 0 ? (double)denseTime / sparseTime : 0.0,
+            agree ? "agree" : "DIFFER" );
+}
+
+int main( int argc, char *argv[] )
+{
+    List<String> paths;
+    for ( int i = 1; i < argc; ++i )
+        paths.append( argv[i] );
+
+    if ( paths.empty() )
+    {
+        paths.append( RESOURCES_DIR "/nnet/acasxu/ACASXU_experimental_v2a_1_1.nnet" );
+        paths.append( RESOURCES_DIR "/nnet/coav/reluBenchmark0.536728143692s_SAT.nnet" );
+        paths.append( RESOURCES_DIR "/nnet/mnist/mnist10x10.nnet" );
+        paths.append( RESOURCES_DIR "/nnet/mnist/mnist10x20.nnet" );
+        paths.append( RESOURCES_DIR "/nnet/mnist/mnist20x20.nnet" );
+        paths.append( RESOURCES_DIR "/nnet/mnist/mnist20x40.nnet" );
+        paths.append( RESOURCES_DIR "/mps/lp_feasible_1.mps" );
+    }
+
+    try
+    {
+        for ( const auto &path : paths )
+            runBenchmark( path );
+    }
+    catch ( const Error &e )
+    {
+        printf( "Caught an error of class %s, code %d\n", e.getErrorClass(), e.getCode() );
+        return 1;
+    }
+
+    return 0;
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../../.. "
+// tags-file-name: "../../../TAGS"
+// c-basic-offset: 4
+// End:
+//
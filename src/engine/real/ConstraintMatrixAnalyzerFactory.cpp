@@ -13,13 +13,13 @@
 
 **/
 
-#include "ConstraintMatrixAnalyzer.h"
+#include "SparseConstraintMatrixAnalyzer.h"
 
 namespace T
 {
 	IConstraintMatrixAnalyzer *createConstraintMatrixAnalyzer()
 	{
-		return new ConstraintMatrixAnalyzer();
+		return new SparseConstraintMatrixAnalyzer();
 	}
 
 	void discardConstraintMatrixAnalyzer( IConstraintMatrixAnalyzer *constraintMatrixAnalyzer )
@@ -0,0 +1,216 @@
+/*********************                                                        */
+/*! \file main.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** Time the tableau operations that go over the sparse rows and columns
+ ** of the constraint matrix: computing tableau rows, pivoting, and
+ ** tightening bounds using the constraint matrix. The tableau is that of
+ ** a query as parsed, without preprocessing, with a slack variable added
+ ** to every equation to form the initial basis. Invoke with a list of
+ ** .nnet files, or with no arguments to use networks from the resources
+ ** directory.
+
+ **/
+
+#include "AcasParser.h"
+#include "CostFunctionManager.h"
+#include "FloatUtils.h"
+#include "InputQuery.h"
+#include "MarabouError.h"
+#include "RowBoundTightener.h"
+#include "SparseUnsortedArrays.h"
+#include "Tableau.h"
+#include "TableauRow.h"
+#include "TimeUtils.h"
+
+#include <cstdio>
+
+static const unsigned NUM_ROW_ROUNDS = 5;
+static const unsigned NUM_PIVOTS = 500;
+static const unsigned NUM_TIGHTENING_ROUNDS = 200;
+
+static void initializeTableau( const InputQuery &query, Tableau &tableau )
+{
+    const List<Equation> &equations( query.getEquations() );
+    unsigned m = equations.size();
+    unsigned numVariables = query.getNumberOfVariables();
+    unsigned n = numVariables + m;
+
+    tableau.setDimensions( m, n );
+
+    SparseUnsortedArrays A;
+    A.initializeToEmpty( m, n );
+    List<unsigned> initialBasis;
+
+    unsigned row = 0;
+    for ( const auto &equation : equations )
+    {
+        for ( const auto &addend : equation._addends )
+        {
+            if ( !FloatUtils::isZero( addend._coefficient ) )
+                A.append( row, addend._variable, addend._coefficient );
+        }
+
+        unsigned slack = numVariables + row;
+        A.append( row, slack, 1 );
+        initialBasis.append( slack );
+        tableau.setRightHandSide( row, equation._scalar );
+        ++row;
+    }
+
+    tableau.setConstraintMatrix( A );
+
+    for ( unsigned i = 0; i < numVariables; ++i )
+    {
+        tableau.setLowerBound( i, query.getLowerBound( i ) );
+        tableau.setUpperBound( i, query.getUpperBound( i ) );
+    }
+
+    for ( unsigned i = numVariables; i < n; ++i )
+    {
+        tableau.setLowerBound( i, FloatUtils::negativeInfinity() );
+        tableau.setUpperBound( i, FloatUtils::infinity() );
+    }
+
+    tableau.initializeTableau( initialBasis );
+}
+
+static unsigned long long timeTableauRows( Tableau &tableau )
+{
+    unsigned m = tableau.getM();
+    TableauRow row( tableau.getN() - m );
+
+    struct timespec start = TimeUtils::sampleMicro();
+    for ( unsigned round = 0; round < NUM_ROW_ROUNDS; ++round )
+    {
+        for ( unsigned i = 0; i < m; ++i )
+            tableau.getTableauRow( i, &row );
+    }
+    return TimeUtils::timePassed( start, TimeUtils::sampleMicro() );
+}
+
+/*
+  Perform degenerate pivots, each preceded by the computation of the
+  change column and the pivot row, as in a simplex step. The leaving
+  variable is the one with the largest entry in the change column.
+*/
+static unsigned long long timePivots( Tableau &tableau, unsigned &numPivots )
+{
+    unsigned m = tableau.getM();
+    unsigned numNonBasics = tableau.getN() - m;
+
+    numPivots = 0;
+    struct timespec start = TimeUtils::sampleMicro();
+    for ( unsigned i = 0; i < NUM_PIVOTS; ++i )
+    {
+        tableau.setEnteringVariableIndex( ( i * 7919 ) % numNonBasics );
+        tableau.computeChangeColumn();
+
+        const double *changeColumn = tableau.getChangeColumn();
+        unsigned leaving = m;
+        double largest = 0.1;
+        for ( unsigned j = 0; j < m; ++j )
+        {
+            if ( FloatUtils::abs( changeColumn[j] ) > largest &&
+                 !tableau.basicOutOfBounds( j ) )
+            {
+                largest = FloatUtils::abs( changeColumn[j] );
+                leaving = j;
+            }
+        }
+
+        if ( leaving == m )
+            continue;
+
+        tableau.setLeavingVariableIndex( leaving );
+        tableau.computePivotRow();
+        tableau.performDegeneratePivot();
+        ++numPivots;
+    }
+    return TimeUtils::timePassed( start, TimeUtils::sampleMicro() );
+}
+
+static unsigned long long timeRowTightening( Tableau &tableau )
+{
+    RowBoundTightener rowBoundTightener( tableau );
+    rowBoundTightener.setDimensions();
+
+    struct timespec start = TimeUtils::sampleMicro();
+    for ( unsigned round = 0; round < NUM_TIGHTENING_ROUNDS; ++round )
+        rowBoundTightener.examineConstraintMatrix( false );
+    return TimeUtils::timePassed( start, TimeUtils::sampleMicro() );
+}
+
+static void runBenchmark( const String &path )
+{
+    InputQuery query;
+    AcasParser acasParser( path );
+    acasParser.generateQuery( query );
+
+    Tableau tableau;
+    CostFunctionManager costFunctionManager( &tableau );
+    initializeTableau( query, tableau );
+    costFunctionManager.initialize();
+    tableau.registerCostFunctionManager( &costFunctionManager );
+
+    unsigned long long rowTime = timeTableauRows( tableau );
+    unsigned numPivots = 0;
+    unsigned long long pivotTime = timePivots( tableau, numPivots );
+    unsigned long long tighteningTime = timeRowTightening( tableau );
+
+    printf( "%s\n\t%u x %u. Tableau rows: %llu milli (%u x %u). Pivots: %llu milli (%u). "
+            "Row tightening: %llu milli (%u rounds)\n",
+            path.ascii(),
+            tableau.getM(),
+            tableau.getN(),
+            rowTime / 1000,
+            NUM_ROW_ROUNDS,
+            tableau.getM(),
+            pivotTime / 1000,
+            numPivots,
+            tighteningTime / 1000,
+            NUM_TIGHTENING_ROUNDS );
+}
+
+int main( int argc, char *argv[] )
+{
+    List<String> paths;
+    for ( int i = 1; i < argc; ++i )
+        paths.append( argv[i] );
+
+    if ( paths.empty() )
+    {
+        paths.append( RESOURCES_DIR "/nnet/acasxu/ACASXU_experimental_v2a_1_1.nnet" );
+        paths.append( RESOURCES_DIR "/nnet/coav/reluBenchmark0.536728143692s_SAT.nnet" );
+        paths.append( RESOURCES_DIR "/nnet/mnist/mnist10x10.nnet" );
+        paths.append( RESOURCES_DIR "/nnet/mnist/mnist20x40.nnet" );
+    }
+
+    try
+    {
+        for ( const auto &path : paths )
+            runBenchmark( path );
+    }
+    catch ( const Error &e )
+    {
+        printf( "Caught an error of class %s, code %d\n", e.getErrorClass(), e.getCode() );
+        return 1;
+    }
+
+    return 0;
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../../.. "
+// tags-file-name: "../../../TAGS"
+// c-basic-offset: 4
+// End:
+//
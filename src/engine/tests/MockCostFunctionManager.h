@@ -33,6 +33,7 @@ public:
         lastTableau = NULL;
         nextCostFunction = NULL;
         computeCoreCostFunctionCalled = false;
+        invalidateCostFunctionCalled = false;
     }
 
     ~MockCostFunctionManager()
@@ -126,8 +127,10 @@ public:
         return false;
     }
 
+    bool invalidateCostFunctionCalled;
     void invalidateCostFunction()
     {
+        invalidateCostFunctionCalled = true;
     }
 };
 
@@ -30,6 +30,7 @@ public:
         wasDiscarded = false;
 
         lastStoredState = NULL;
+        lastStorageLevel = TableauStateStorageLevel::STORE_NO_TABLEAU_STATE;
     }
     
     ~MockEngine()
@@ -89,10 +90,12 @@ public:
         }
     }
 
-    mutable EngineState *lastStoredState;
-    void storeState( EngineState &state, bool /* storeAlsoTableauState */ ) const
+    EngineState *lastStoredState;
+    TableauStateStorageLevel lastStorageLevel;
+    void storeState( EngineState &state, TableauStateStorageLevel level )
     {
         lastStoredState = &state;
+        lastStorageLevel = level;
     }
 
     const EngineState *lastRestoredState;
@@ -101,6 +104,10 @@ public:
         lastRestoredState = &state;
     }
 
+    void restorePlConstraintActivity( const EngineState &/* state */ )
+    {
+    }
+
     void setNumPlConstraintsDisabledByValidSplits( unsigned /* numConstraints */ )
     {
     }
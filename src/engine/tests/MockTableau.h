@@ -19,6 +19,7 @@
 #include "FloatUtils.h"
 #include "ITableau.h"
 #include "Map.h"
+#include "SparseUnsortedArrays.h"
 #include "SparseUnsortedList.h"
 #include "TableauRow.h"
 
@@ -39,6 +40,9 @@ public:
         lastBtranInput = NULL;
         nextBtranOutput = NULL;
 
+        lastFtranInput = NULL;
+        nextFtranOutput = NULL;
+
         lastEntries = NULL;
         nextCostFunction = NULL;
 
@@ -67,6 +71,18 @@ public:
             nextBtranOutput = NULL;
         }
 
+        if ( lastFtranInput )
+        {
+            delete[] lastFtranInput;
+            lastFtranInput = NULL;
+        }
+
+        if ( nextFtranOutput )
+        {
+            delete[] nextFtranOutput;
+            nextFtranOutput = NULL;
+        }
+
         if ( lastEntries )
         {
             delete[] lastEntries;
@@ -126,6 +142,9 @@ public:
 
         lastBtranInput = new double[m];
         nextBtranOutput = new double[m];
+
+        lastFtranInput = new double[m];
+        nextFtranOutput = new double[m];
     }
 
     double *lastEntries;
@@ -135,6 +154,12 @@ public:
         memcpy( lastEntries, A, sizeof(double) * lastM * lastN );
     }
 
+    void setConstraintMatrix( const SparseUnsortedArrays &A )
+    {
+        TS_ASSERT( setDimensionsCalled );
+        A.toDense( lastEntries );
+    }
+
     double *lastRightHandSide;
     void setRightHandSide( const double * b )
     {
@@ -243,6 +268,8 @@ public:
 
     void pickLeavingVariable() {};
     void pickLeavingVariable( double */* d */ ) {}
+    void setPrimalRatioTestType( PrimalRatioTestType /* type */ ) {}
+    bool dualRatioTest( DualRatioTestType /* type */ ) { return false; }
 
     unsigned mockLeavingVariable;
     void setLeavingVariableIndex( unsigned basic )
@@ -385,6 +412,11 @@ public:
         return nextAuxVar;
     }
 
+    unsigned addEquations( const List<Equation> &/* equations */ )
+    {
+        return nextAuxVar;
+    }
+
     unsigned getM() const
     {
         return lastM;
@@ -408,11 +440,11 @@ public:
     }
 
     Map<unsigned, const double *> nextAColumn;
-    const double *getAColumn( unsigned index ) const
+    void getAColumn( unsigned index, double *result ) const
     {
         TS_ASSERT( nextAColumn.exists( index ) );
         TS_ASSERT( nextAColumn.get( index ) );
-        return nextAColumn.get( index );
+        memcpy( result, nextAColumn.get( index ), sizeof(double) * lastM );
     }
 
     void getSparseAColumn( unsigned index, SparseUnsortedList *result ) const
@@ -473,6 +505,19 @@ public:
     {
     }
 
+    unsigned pushTrailLevel()
+    {
+        return 0;
+    }
+
+    void backtrackTrail( unsigned /* level */ )
+    {
+    }
+
+    void clearTrail()
+    {
+    }
+
     Map<unsigned, double> tightenedLowerBounds;
     void tightenLowerBound( unsigned variable, double value )
     {
@@ -532,7 +577,13 @@ public:
         return b;
     }
 
-    void forwardTransformation( const double *, double * ) const {}
+    mutable double *lastFtranInput;
+    double *nextFtranOutput;
+    void forwardTransformation( const double *input, double *output ) const
+    {
+        memcpy( lastFtranInput, input, lastM * sizeof(double) );
+        memcpy( output, nextFtranOutput, lastM * sizeof(double) );
+    }
 
     mutable double *lastBtranInput;
     double *nextBtranOutput;
@@ -542,6 +593,12 @@ public:
         memcpy( output, nextBtranOutput, lastM * sizeof(double) );
     }
 
+    void sparseBackwardTransformation( const SparseUnsortedList &input, double *output ) const
+    {
+        input.toDense( lastBtranInput );
+        memcpy( output, nextBtranOutput, lastM * sizeof(double) );
+    }
+
     double getSumOfInfeasibilities() const
     {
         return 0;
@@ -181,6 +181,36 @@ public:
             TS_ASSERT( !columns.exists( 0 ) );
         }
     }
+
+    void test_analyze_sparse()
+    {
+        ConstraintMatrixAnalyzer analyzer;
+
+        double A1[] = {
+            1, 0, 0, 0, 0,
+            1, 0, 0, 0, 0,
+            0, 1, 0, 2, 0,
+        };
+
+        SparseUnsortedArrays sparseA1;
+        sparseA1.initialize( A1, 3, 5 );
+
+        TS_ASSERT_THROWS_NOTHING( analyzer.analyze( sparseA1, 3, 5 ) );
+
+        Set<unsigned> expectedRows( { 1 } );
+        TS_ASSERT_EQUALS( analyzer.getRedundantRows(), expectedRows );
+
+        Set<unsigned> expectedColumns1( { 0, 1 } );
+        Set<unsigned> expectedColumns2( { 0, 3 } );
+        TS_ASSERT( sameColumns( analyzer.getIndependentColumns(), expectedColumns1 )
+                   ||
+                   sameColumns( analyzer.getIndependentColumns(), expectedColumns2 )
+                   );
+
+        // The input matrix is left untouched
+        TS_ASSERT_EQUALS( sparseA1.getNnz(), 4U );
+        TS_ASSERT_EQUALS( sparseA1.get( 2, 3 ), 2 );
+    }
 };
 
 //
@@ -0,0 +1,235 @@
+/*********************                                                        */
+/*! \file Test_ConstraintStateStore.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+ **/
+
+#include <cxxtest/TestSuite.h>
+
+#include "CommonError.h"
+#include "ConstraintStateStore.h"
+#include "MockErrno.h"
+#include "ReluConstraint.h"
+
+class MockForConstraintStateStore
+    : public MockErrno
+{
+public:
+};
+
+class ConstraintStateStoreTestSuite : public CxxTest::TestSuite
+{
+public:
+	MockForConstraintStateStore *mock;
+
+	void setUp()
+	{
+		TS_ASSERT( mock = new MockForConstraintStateStore );
+	}
+
+	void tearDown()
+	{
+		TS_ASSERT_THROWS_NOTHING( delete mock );
+	}
+
+    void test_per_constraint_state()
+    {
+        ConstraintStateStore store;
+
+        TS_ASSERT_EQUALS( store.addConstraint(), 0U );
+        TS_ASSERT_EQUALS( store.addConstraint(), 1U );
+        TS_ASSERT_EQUALS( store.getNumConstraints(), 2U );
+
+        TS_ASSERT( store.isActive( 0 ) );
+        TS_ASSERT_EQUALS( store.getPhaseStatus( 0 ), PHASE_NOT_FIXED );
+        TS_ASSERT_EQUALS( store.getDirection( 0 ), PHASE_NOT_FIXED );
+        TS_ASSERT_EQUALS( store.getScore( 0 ), FloatUtils::negativeInfinity() );
+
+        store.setActive( 1, false );
+        store.setPhaseStatus( 1, RELU_PHASE_ACTIVE );
+        store.setDirection( 1, RELU_PHASE_INACTIVE );
+        store.setScore( 1, 2.5 );
+
+        TS_ASSERT( store.isActive( 0 ) );
+        TS_ASSERT( !store.isActive( 1 ) );
+        TS_ASSERT_EQUALS( store.getPhaseStatus( 0 ), PHASE_NOT_FIXED );
+        TS_ASSERT_EQUALS( store.getPhaseStatus( 1 ), RELU_PHASE_ACTIVE );
+        TS_ASSERT_EQUALS( store.getDirection( 1 ), RELU_PHASE_INACTIVE );
+        TS_ASSERT_EQUALS( store.getScore( 1 ), 2.5 );
+    }
+
+    void test_variable_values()
+    {
+        ConstraintStateStore store;
+        store.addConstraint();
+        store.addConstraint();
+
+        store.set( 0, ConstraintStateStore::LOWER_BOUND, 3, -1 );
+        store.set( 0, ConstraintStateStore::ASSIGNMENT, 5, 7 );
+        store.set( 1, ConstraintStateStore::LOWER_BOUND, 3, -2 );
+
+        TS_ASSERT( store.exists( 0, ConstraintStateStore::LOWER_BOUND, 3 ) );
+        TS_ASSERT( !store.exists( 0, ConstraintStateStore::UPPER_BOUND, 3 ) );
+        TS_ASSERT( !store.exists( 0, ConstraintStateStore::ASSIGNMENT, 3 ) );
+        TS_ASSERT( store.exists( 0, ConstraintStateStore::ASSIGNMENT, 5 ) );
+        TS_ASSERT( !store.exists( 1, ConstraintStateStore::ASSIGNMENT, 5 ) );
+
+        TS_ASSERT_EQUALS( store.get( 0, ConstraintStateStore::LOWER_BOUND, 3 ), -1 );
+        TS_ASSERT_EQUALS( store.get( 1, ConstraintStateStore::LOWER_BOUND, 3 ), -2 );
+        TS_ASSERT_EQUALS( store.get( 0, ConstraintStateStore::ASSIGNMENT, 5 ), 7 );
+        TS_ASSERT_THROWS_EQUALS( store.get( 0, ConstraintStateStore::UPPER_BOUND, 3 ),
+                                 const CommonError &e,
+                                 e.getCode(),
+                                 CommonError::KEY_DOESNT_EXIST_IN_MAP );
+
+        // Constraint 0 is not the last one, so its slots are moved
+        // when it gets a new variable
+        store.set( 0, ConstraintStateStore::UPPER_BOUND, 8, 4 );
+        TS_ASSERT_EQUALS( store.get( 0, ConstraintStateStore::LOWER_BOUND, 3 ), -1 );
+        TS_ASSERT_EQUALS( store.get( 0, ConstraintStateStore::ASSIGNMENT, 5 ), 7 );
+        TS_ASSERT_EQUALS( store.get( 0, ConstraintStateStore::UPPER_BOUND, 8 ), 4 );
+        TS_ASSERT_EQUALS( store.get( 1, ConstraintStateStore::LOWER_BOUND, 3 ), -2 );
+
+        TS_ASSERT_EQUALS( store.count( 0, ConstraintStateStore::ASSIGNMENT ), 1U );
+        TS_ASSERT_EQUALS( store.count( 0, ConstraintStateStore::LOWER_BOUND ), 1U );
+        TS_ASSERT_EQUALS( store.count( 1, ConstraintStateStore::UPPER_BOUND ), 0U );
+
+        store.erase( 0, ConstraintStateStore::LOWER_BOUND, 3 );
+        TS_ASSERT( !store.exists( 0, ConstraintStateStore::LOWER_BOUND, 3 ) );
+        TS_ASSERT( store.exists( 1, ConstraintStateStore::LOWER_BOUND, 3 ) );
+    }
+
+    void test_copy_and_restore()
+    {
+        ConstraintStateStore store;
+        store.addConstraint();
+        store.set( 0, ConstraintStateStore::UPPER_BOUND, 1, 10 );
+
+        ConstraintStateStore snapshot = store;
+
+        store.setPhaseStatus( 0, RELU_PHASE_INACTIVE );
+        store.set( 0, ConstraintStateStore::UPPER_BOUND, 1, 0 );
+        store.set( 0, ConstraintStateStore::LOWER_BOUND, 2, 0 );
+
+        store = snapshot;
+        TS_ASSERT_EQUALS( store.getPhaseStatus( 0 ), PHASE_NOT_FIXED );
+        TS_ASSERT_EQUALS( store.get( 0, ConstraintStateStore::UPPER_BOUND, 1 ), 10 );
+        TS_ASSERT( !store.exists( 0, ConstraintStateStore::LOWER_BOUND, 2 ) );
+
+        ConstraintStateStore other;
+        other.addConstraint();
+        other.set( 0, ConstraintStateStore::ASSIGNMENT, 4, 1 );
+        other.set( 0, ConstraintStateStore::ASSIGNMENT, 6, 2 );
+        other.setActive( 0, false );
+
+        TS_ASSERT_EQUALS( store.addConstraint( other, 0 ), 1U );
+        TS_ASSERT( !store.isActive( 1 ) );
+        TS_ASSERT_EQUALS( store.get( 1, ConstraintStateStore::ASSIGNMENT, 6 ), 2 );
+
+        store.copyConstraint( 0, other, 0 );
+        TS_ASSERT( !store.isActive( 0 ) );
+        TS_ASSERT_EQUALS( store.get( 0, ConstraintStateStore::ASSIGNMENT, 4 ), 1 );
+        TS_ASSERT( !store.exists( 0, ConstraintStateStore::UPPER_BOUND, 1 ) );
+    }
+
+    void test_slots_are_reused()
+    {
+        ConstraintStateStore store;
+        store.addConstraint();
+        store.addConstraint();
+
+        // With reserved slots, constraints are not moved
+        store.reserveSlots( 0, 2 );
+        store.reserveSlots( 1, 2 );
+        TS_ASSERT_EQUALS( store.getTotalNumSlots(), 4U );
+
+        store.set( 0, ConstraintStateStore::LOWER_BOUND, 1, 1 );
+        store.set( 0, ConstraintStateStore::LOWER_BOUND, 2, 2 );
+        store.set( 1, ConstraintStateStore::LOWER_BOUND, 3, 3 );
+        TS_ASSERT_EQUALS( store.getTotalNumSlots(), 4U );
+
+        // The slot of an erased variable is reused
+        store.erase( 0, ConstraintStateStore::LOWER_BOUND, 1 );
+        store.set( 0, ConstraintStateStore::UPPER_BOUND, 4, 4 );
+        TS_ASSERT_EQUALS( store.getTotalNumSlots(), 4U );
+        TS_ASSERT_EQUALS( store.count( 0, ConstraintStateStore::LOWER_BOUND ), 1U );
+        TS_ASSERT_EQUALS( store.get( 0, ConstraintStateStore::UPPER_BOUND, 4 ), 4 );
+
+        // Outgrowing the reservation moves a constraint to the end
+        store.set( 0, ConstraintStateStore::UPPER_BOUND, 5, 5 );
+        TS_ASSERT_EQUALS( store.getTotalNumSlots(), 7U );
+
+        store.set( 1, ConstraintStateStore::ASSIGNMENT, 6, 6 );
+        store.set( 1, ConstraintStateStore::ASSIGNMENT, 7, 7 );
+        TS_ASSERT_EQUALS( store.getTotalNumSlots(), 10U );
+
+        // The slots left behind are reclaimed once they make up half of
+        // the store
+        store.set( 0, ConstraintStateStore::ASSIGNMENT, 8, 8 );
+        TS_ASSERT_EQUALS( store.getTotalNumSlots(), 7U );
+
+        TS_ASSERT_EQUALS( store.get( 0, ConstraintStateStore::LOWER_BOUND, 2 ), 2 );
+        TS_ASSERT_EQUALS( store.get( 0, ConstraintStateStore::UPPER_BOUND, 4 ), 4 );
+        TS_ASSERT_EQUALS( store.get( 0, ConstraintStateStore::UPPER_BOUND, 5 ), 5 );
+        TS_ASSERT_EQUALS( store.get( 0, ConstraintStateStore::ASSIGNMENT, 8 ), 8 );
+        TS_ASSERT_EQUALS( store.count( 0, ConstraintStateStore::ASSIGNMENT ), 1U );
+        TS_ASSERT_EQUALS( store.get( 1, ConstraintStateStore::LOWER_BOUND, 3 ), 3 );
+        TS_ASSERT_EQUALS( store.get( 1, ConstraintStateStore::ASSIGNMENT, 7 ), 7 );
+        TS_ASSERT_EQUALS( store.count( 1, ConstraintStateStore::ASSIGNMENT ), 2U );
+
+        // New values still go to the compacted slots
+        store.set( 1, ConstraintStateStore::UPPER_BOUND, 9, 9 );
+        TS_ASSERT_EQUALS( store.get( 1, ConstraintStateStore::UPPER_BOUND, 9 ), 9 );
+        TS_ASSERT_EQUALS( store.get( 0, ConstraintStateStore::ASSIGNMENT, 8 ), 8 );
+    }
+
+    void test_attached_constraint()
+    {
+        ReluConstraint relu( 1, 2 );
+        relu.notifyLowerBound( 1, -3 );
+        relu.notifyUpperBound( 1, 5 );
+
+        ConstraintStateStore store;
+        store.addConstraint();
+        TS_ASSERT_EQUALS( relu.attachToStateStore( &store ), 1U );
+        TS_ASSERT_EQUALS( store.get( 1, ConstraintStateStore::UPPER_BOUND, 1 ), 5 );
+
+        // A slot is reserved for each participating variable
+        TS_ASSERT_EQUALS( store.getTotalNumSlots(), 2U );
+        relu.notifyUpperBound( 2, 5 );
+        TS_ASSERT_EQUALS( store.getTotalNumSlots(), 2U );
+
+        ConstraintStateStore snapshot = store;
+
+        relu.notifyLowerBound( 1, 1 );
+        TS_ASSERT( relu.phaseFixed() );
+        TS_ASSERT_EQUALS( store.getPhaseStatus( 1 ), RELU_PHASE_ACTIVE );
+
+        store = snapshot;
+        TS_ASSERT( !relu.phaseFixed() );
+        TS_ASSERT_EQUALS( relu.getLowerBound( 1 ), -3 );
+
+        // Clones keep their state to themselves
+        PiecewiseLinearConstraint *clone = relu.duplicateConstraint();
+        clone->setActiveConstraint( false );
+        TS_ASSERT( relu.isActive() );
+        TS_ASSERT_EQUALS( clone->getUpperBound( 1 ), 5 );
+        delete clone;
+    }
+};
+
+//
+// Local Variables:
+// compile-command: "make -C ../../.. "
+// tags-file-name: "../../../TAGS"
+// c-basic-offset: 4
+// End:
+//
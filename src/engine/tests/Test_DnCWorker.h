@@ -34,7 +34,7 @@ public:
 
     void setUp()
     {
-        _workload = new WorkerQueue( 0 );
+        _workload = new WorkerQueue( 1 );
 
         // Initialize the mockEngine
         _engine = std::make_shared<MockEngine>();
@@ -57,9 +57,8 @@ public:
     {
         unsigned counter = 0;
         SubQuery *subQuery = NULL;
-        while ( !_workload->empty() )
+        while ( _workload->pop( 0, subQuery ) )
         {
-            _workload->pop( subQuery );
             if ( subQuery )
             {
                 delete subQuery;
@@ -97,7 +96,7 @@ public:
         subQuery->_queryId = "";
         subQuery->_split = std::move( split );
         subQuery->_timeoutInSeconds = 5;
-        TS_ASSERT( _workload->push( std::move( subQuery ) ) );
+        TS_ASSERT_THROWS_NOTHING( _workload->push( 0, std::move( subQuery ) ) );
     }
 
     // Test different branches of DnCWorker.popOneSubQueryAndSolve()
@@ -0,0 +1,177 @@
+/*********************                                                        */
+/*! \file Test_DualSteepestEdge.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include <cxxtest/TestSuite.h>
+
+#include "DualSteepestEdge.h"
+#include "GlobalConfiguration.h"
+#include "MockTableau.h"
+
+class MockForDualSteepestEdge
+{
+public:
+};
+
+class DualSteepestEdgeTestSuite : public CxxTest::TestSuite
+{
+public:
+    MockForDualSteepestEdge *mock;
+
+    void setUp()
+    {
+        TS_ASSERT( mock = new MockForDualSteepestEdge );
+    }
+
+    void tearDown()
+    {
+        TS_ASSERT_THROWS_NOTHING( delete mock );
+    }
+
+    void setupTableau( MockTableau &tableau )
+    {
+        tableau.setDimensions( 3, 6 );
+
+        // Basics are {x3, x4, x5}
+        for ( unsigned i = 0; i < 3; ++i )
+        {
+            tableau.nextBasicIndexToVariable[i] = 3 + i;
+            tableau.setLowerBound( 3 + i, 0 );
+        }
+
+        // x3 is 3 above its upper bound, x4 is 4 below its lower bound
+        tableau.setUpperBound( 3, 2 );
+        tableau.nextValues[3] = 5;
+        tableau.nextBasicTooHigh.insert( 0 );
+
+        tableau.setUpperBound( 4, 10 );
+        tableau.nextValues[4] = -4;
+        tableau.nextBasicTooLow.insert( 1 );
+
+        tableau.setUpperBound( 5, 10 );
+        tableau.nextValues[5] = 1;
+    }
+
+    void test_variable_selection_and_weight_update()
+    {
+        MockTableau tableau;
+        setupTableau( tableau );
+
+        DualSteepestEdgeRule dse;
+        TS_ASSERT_THROWS_NOTHING( dse.initialize( tableau ) );
+
+        for ( unsigned i = 0; i < 3; ++i )
+            TS_ASSERT_EQUALS( dse.getWeight( i ), 1.0 );
+
+        // With all weights equal, the largest infeasibility wins
+        TS_ASSERT( dse.select( tableau ) );
+        TS_ASSERT_EQUALS( tableau.mockLeavingVariable, 1U );
+
+        // Pivot on the second row
+        double changeColumn[] = { 2, 4, 0 };
+        tableau.nextChangeColumn = changeColumn;
+
+        double rho[] = { 1, 2, 0 };
+        memcpy( tableau.nextBtranOutput, rho, sizeof(rho) );
+
+        double tau[] = { 0.5, 1, 7 };
+        memcpy( tableau.nextFtranOutput, tau, sizeof(tau) );
+
+        TS_ASSERT_THROWS_NOTHING( dse.prePivotHook( tableau ) );
+
+        // BTRAN is invoked on the unit vector of the leaving row, and
+        // FTRAN on its result
+        TS_ASSERT_EQUALS( tableau.lastBtranInput[0], 0.0 );
+        TS_ASSERT_EQUALS( tableau.lastBtranInput[1], 1.0 );
+        TS_ASSERT_EQUALS( tableau.lastBtranInput[2], 0.0 );
+        for ( unsigned i = 0; i < 3; ++i )
+            TS_ASSERT_EQUALS( tableau.lastFtranInput[i], rho[i] );
+
+        // ||rho||^2 = 5.
+        //   Row 0: 1 - 2 * (2/4) * 0.5 + (2/4)^2 * 5 = 1.75
+        //   Row 1: 5 / 4^2 = 0.3125
+        //   Row 2: not in the change column, unchanged
+        TS_ASSERT( FloatUtils::areEqual( dse.getWeight( 0 ), 1.75 ) );
+        TS_ASSERT( FloatUtils::areEqual( dse.getWeight( 1 ), 0.3125 ) );
+        TS_ASSERT_EQUALS( dse.getWeight( 2 ), 1.0 );
+
+        // Only x3 is now out of bounds
+        tableau.nextBasicTooLow.clear();
+        TS_ASSERT( dse.select( tableau ) );
+        TS_ASSERT_EQUALS( tableau.mockLeavingVariable, 0U );
+
+        tableau.nextBasicTooHigh.clear();
+        TS_ASSERT( !dse.select( tableau ) );
+    }
+
+    void test_weights_are_bounded_from_below()
+    {
+        MockTableau tableau;
+        setupTableau( tableau );
+
+        DualSteepestEdgeRule dse;
+        dse.initialize( tableau );
+        tableau.mockLeavingVariable = 1;
+
+        double changeColumn[] = { 4, 4, 0 };
+        tableau.nextChangeColumn = changeColumn;
+
+        double rho[] = { 1, 0, 0 };
+        memcpy( tableau.nextBtranOutput, rho, sizeof(rho) );
+
+        // 1 - 2 * 1 * 3 + 1 * 1 < 0
+        double tau[] = { 3, 1, 0 };
+        memcpy( tableau.nextFtranOutput, tau, sizeof(tau) );
+
+        TS_ASSERT_THROWS_NOTHING( dse.prePivotHook( tableau ) );
+        TS_ASSERT_EQUALS( dse.getWeight( 0 ), GlobalConfiguration::DUAL_STEEPEST_EDGE_MIN_WEIGHT );
+    }
+
+    void test_resize()
+    {
+        MockTableau tableau;
+        setupTableau( tableau );
+
+        DualSteepestEdgeRule dse;
+        dse.initialize( tableau );
+        tableau.mockLeavingVariable = 1;
+
+        double changeColumn[] = { 0, 2, 0 };
+        tableau.nextChangeColumn = changeColumn;
+
+        double rho[] = { 0, 1, 0 };
+        memcpy( tableau.nextBtranOutput, rho, sizeof(rho) );
+        memcpy( tableau.nextFtranOutput, rho, sizeof(rho) );
+
+        dse.prePivotHook( tableau );
+        TS_ASSERT( FloatUtils::areEqual( dse.getWeight( 1 ), 0.25 ) );
+
+        // A new row is added; existing weights are kept
+        tableau.lastM = 4;
+        TS_ASSERT_THROWS_NOTHING( dse.resizeHook( tableau ) );
+        TS_ASSERT_EQUALS( dse.getWeight( 0 ), 1.0 );
+        TS_ASSERT( FloatUtils::areEqual( dse.getWeight( 1 ), 0.25 ) );
+        TS_ASSERT_EQUALS( dse.getWeight( 2 ), 1.0 );
+        TS_ASSERT_EQUALS( dse.getWeight( 3 ), 1.0 );
+        tableau.lastM = 3;
+    }
+};
+
+//
+// Local Variables:
+// compile-command: "make -C ../../.. "
+// tags-file-name: "../../../TAGS"
+// c-basic-offset: 4
+// End:
+//
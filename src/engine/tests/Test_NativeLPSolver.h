@@ -0,0 +1,234 @@
+/*********************                                                        */
+/*! \file Test_NativeLPSolver.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief [[ Add one-line brief description here ]]
+ **
+ ** [[ Add lengthier description here ]]
+ **/
+
+#include <cxxtest/TestSuite.h>
+
+#include "FloatUtils.h"
+#include "MString.h"
+#include "MockErrno.h"
+#include "NativeLPSolver.h"
+
+class NativeLPSolverTestSuite : public CxxTest::TestSuite
+{
+public:
+    MockErrno *mockErrno;
+
+    void setUp()
+    {
+        TS_ASSERT( mockErrno = new MockErrno );
+    }
+
+    void tearDown()
+    {
+        TS_ASSERT_THROWS_NOTHING( delete mockErrno );
+    }
+
+    void addExampleModel( NativeLPSolver &solver )
+    {
+        solver.addVariable( "x", 0, 3 );
+        solver.addVariable( "y", 0, 3 );
+        solver.addVariable( "z", 0, 3 );
+
+        // x + y + z <= 5
+        List<ILPSolver::Term> constraint = {
+            ILPSolver::Term( 1, "x" ),
+            ILPSolver::Term( 1, "y" ),
+            ILPSolver::Term( 1, "z" ),
+        };
+
+        solver.addLeqConstraint( constraint, 5 );
+    }
+
+    void test_optimize()
+    {
+        NativeLPSolver solver;
+        addExampleModel( solver );
+
+        // Cost: -x - 2y + z
+        List<ILPSolver::Term> cost = {
+            ILPSolver::Term( -1, "x" ),
+            ILPSolver::Term( -2, "y" ),
+            ILPSolver::Term( +1, "z" ),
+        };
+
+        solver.setCost( cost );
+
+        TS_ASSERT_THROWS_NOTHING( solver.solve() );
+        TS_ASSERT( solver.optimal() );
+        TS_ASSERT( solver.haveFeasibleSolution() );
+
+        Map<String, double> solution;
+        double costValue;
+
+        TS_ASSERT_THROWS_NOTHING( solver.extractSolution( solution, costValue ) );
+
+        TS_ASSERT( FloatUtils::areEqual( solution["x"], 2 ) );
+        TS_ASSERT( FloatUtils::areEqual( solution["y"], 3 ) );
+        TS_ASSERT( FloatUtils::areEqual( solution["z"], 0 ) );
+
+        TS_ASSERT( FloatUtils::areEqual( costValue, -8 ) );
+        TS_ASSERT( FloatUtils::areEqual( solver.getObjectiveBound(), -8 ) );
+    }
+
+    void test_objective_and_warm_start()
+    {
+        NativeLPSolver solver;
+        addExampleModel( solver );
+
+        // x - y >= -1, 2x + z = 4
+        solver.addGeqConstraint( { ILPSolver::Term( 1, "x" ), ILPSolver::Term( -1, "y" ) }, -1 );
+        solver.addEqConstraint( { ILPSolver::Term( 2, "x" ), ILPSolver::Term( 1, "z" ) }, 4 );
+
+        Map<String, double> solution;
+        double value;
+
+        // Maximize y: z = 4 - 2x, so x <= 2 and y <= x + 1 <= 3
+        solver.setObjective( { ILPSolver::Term( 1, "y" ) } );
+        TS_ASSERT_THROWS_NOTHING( solver.solve() );
+        TS_ASSERT( solver.optimal() );
+        TS_ASSERT_THROWS_NOTHING( solver.extractSolution( solution, value ) );
+        TS_ASSERT( FloatUtils::areEqual( value, 3 ) );
+        TS_ASSERT( FloatUtils::areEqual( solution["x"] - solution["y"], -1 ) );
+        TS_ASSERT( FloatUtils::areEqual( 2 * solution["x"] + solution["z"], 4 ) );
+
+        // Minimize y: y >= 0
+        solver.setCost( { ILPSolver::Term( 1, "y" ) } );
+        TS_ASSERT_THROWS_NOTHING( solver.solve() );
+        TS_ASSERT( solver.optimal() );
+        TS_ASSERT_THROWS_NOTHING( solver.extractSolution( solution, value ) );
+        TS_ASSERT( FloatUtils::areEqual( value, 0 ) );
+
+        // Solving again from an optimal basis takes no iterations
+        TS_ASSERT_THROWS_NOTHING( solver.solve() );
+        TS_ASSERT( solver.optimal() );
+        TS_ASSERT_EQUALS( solver.getNumIterations(), 0U );
+        TS_ASSERT_THROWS_NOTHING( solver.extractSolution( solution, value ) );
+        TS_ASSERT( FloatUtils::areEqual( value, 0 ) );
+    }
+
+    void test_change_bounds_and_add_constraints()
+    {
+        NativeLPSolver solver;
+        addExampleModel( solver );
+
+        Map<String, double> solution;
+        double value;
+
+        solver.setObjective( { ILPSolver::Term( 1, "x" ), ILPSolver::Term( 1, "y" ) } );
+        TS_ASSERT_THROWS_NOTHING( solver.solve() );
+        TS_ASSERT( solver.optimal() );
+        TS_ASSERT_THROWS_NOTHING( solver.extractSolution( solution, value ) );
+        TS_ASSERT( FloatUtils::areEqual( value, 5 ) );
+
+        // Tighter bounds
+        solver.setUpperBound( "x", 1 );
+        solver.setUpperBound( "y", 2.5 );
+        TS_ASSERT_THROWS_NOTHING( solver.solve() );
+        TS_ASSERT( solver.optimal() );
+        TS_ASSERT_THROWS_NOTHING( solver.extractSolution( solution, value ) );
+        TS_ASSERT( FloatUtils::areEqual( value, 3.5 ) );
+
+        // A new variable and constraint: y + w <= 1, with w >= 0.5
+        solver.addVariable( "w", 0.5, 10 );
+        solver.addLeqConstraint( { ILPSolver::Term( 1, "y" ), ILPSolver::Term( 1, "w" ) }, 1 );
+        TS_ASSERT_THROWS_NOTHING( solver.solve() );
+        TS_ASSERT( solver.optimal() );
+        TS_ASSERT_THROWS_NOTHING( solver.extractSolution( solution, value ) );
+        TS_ASSERT( FloatUtils::areEqual( value, 1.5 ) );
+        TS_ASSERT( FloatUtils::gte( solution["w"], 0.5 ) );
+    }
+
+    void test_infeasible()
+    {
+        NativeLPSolver solver;
+        addExampleModel( solver );
+
+        // x + y >= 7 contradicts x + y + z <= 5 with z >= 0
+        solver.addGeqConstraint( { ILPSolver::Term( 1, "x" ), ILPSolver::Term( 1, "y" ) }, 7 );
+        solver.setCost( { ILPSolver::Term( 1, "x" ) } );
+
+        TS_ASSERT_THROWS_NOTHING( solver.solve() );
+        TS_ASSERT( solver.infeasbile() );
+        TS_ASSERT( !solver.optimal() );
+        TS_ASSERT( !solver.haveFeasibleSolution() );
+    }
+
+    void test_cutoff()
+    {
+        NativeLPSolver solver;
+        addExampleModel( solver );
+
+        solver.setObjective( { ILPSolver::Term( 1, "x" ) } );
+        solver.setCutoff( 4 );
+        TS_ASSERT_THROWS_NOTHING( solver.solve() );
+        TS_ASSERT( solver.cutoffOccurred() );
+        TS_ASSERT( !solver.optimal() );
+
+        solver.setCutoff( 2 );
+        TS_ASSERT_THROWS_NOTHING( solver.solve() );
+        TS_ASSERT( solver.optimal() );
+    }
+
+    void test_binary_variables_are_relaxed()
+    {
+        NativeLPSolver solver;
+
+        solver.addVariable( "x", -1, 1 );
+        solver.addVariable( "a", -5, 5, ILPSolver::BINARY );
+
+        // x <= a
+        solver.addLeqConstraint( { ILPSolver::Term( 1, "x" ), ILPSolver::Term( -1, "a" ) }, 0 );
+
+        Map<String, double> solution;
+        double value;
+
+        solver.setObjective( { ILPSolver::Term( 1, "x" ), ILPSolver::Term( 1, "a" ) } );
+        TS_ASSERT_THROWS_NOTHING( solver.solve() );
+        TS_ASSERT( solver.optimal() );
+        TS_ASSERT_THROWS_NOTHING( solver.extractSolution( solution, value ) );
+        TS_ASSERT( FloatUtils::areEqual( value, 2 ) );
+
+        solver.setCost( { ILPSolver::Term( 1, "a" ) } );
+        TS_ASSERT_THROWS_NOTHING( solver.solve() );
+        TS_ASSERT( solver.optimal() );
+        TS_ASSERT_THROWS_NOTHING( solver.extractSolution( solution, value ) );
+        TS_ASSERT( FloatUtils::areEqual( value, 0 ) );
+    }
+
+    void test_reset_model()
+    {
+        NativeLPSolver solver;
+        addExampleModel( solver );
+
+        solver.setCost( { ILPSolver::Term( 1, "x" ) } );
+        TS_ASSERT_THROWS_NOTHING( solver.solve() );
+        TS_ASSERT( solver.optimal() );
+
+        TS_ASSERT_THROWS_NOTHING( solver.resetModel() );
+        TS_ASSERT( !solver.optimal() );
+
+        solver.addVariable( "x", -2, 2 );
+        solver.setCost( { ILPSolver::Term( 1, "x" ) } );
+        TS_ASSERT_THROWS_NOTHING( solver.solve() );
+        TS_ASSERT( solver.optimal() );
+
+        Map<String, double> solution;
+        double value;
+        TS_ASSERT_THROWS_NOTHING( solver.extractSolution( solution, value ) );
+        TS_ASSERT( FloatUtils::areEqual( value, -2 ) );
+        TS_ASSERT_EQUALS( solution.size(), 1U );
+    }
+};
@@ -0,0 +1,131 @@
+/*********************                                                        */
+/*! \file Test_PartialPricingRule.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include <cxxtest/TestSuite.h>
+
+#include "GlobalConfiguration.h"
+#include "MockTableau.h"
+#include "PartialPricingRule.h"
+
+class MockForPartialPricingRule
+{
+public:
+};
+
+class PartialPricingRuleTestSuite : public CxxTest::TestSuite
+{
+public:
+    MockForPartialPricingRule *mock;
+    MockTableau *tableau;
+
+    void setUp()
+    {
+        TS_ASSERT( mock = new MockForPartialPricingRule );
+        TS_ASSERT( tableau = new MockTableau );
+    }
+
+    void tearDown()
+    {
+        TS_ASSERT_THROWS_NOTHING( delete tableau );
+        TS_ASSERT_THROWS_NOTHING( delete mock );
+    }
+
+    void test_select()
+    {
+        PartialPricingRule partialPricingRule;
+        TS_ASSERT( !partialPricingRule.needsEntryCandidates() );
+
+        Set<unsigned> excluded;
+        List<unsigned> candidates;
+
+        // 400 non-basics, scanned in segments of 50
+        tableau->setDimensions( 10, 410 );
+        partialPricingRule.initialize( *tableau );
+
+        TS_ASSERT( !partialPricingRule.select( *tableau, candidates, excluded ) );
+
+        tableau->mockCandidates = { 2, 10, 51, 300 };
+        tableau->nextCostFunction[2] = -5;
+        tableau->nextCostFunction[10] = -15;
+        tableau->nextCostFunction[51] = 12;
+        tableau->nextCostFunction[300] = 100;
+
+        // Only the first segment is scanned
+        TS_ASSERT( partialPricingRule.select( *tableau, candidates, excluded ) );
+        TS_ASSERT_EQUALS( tableau->mockEnteringVariable, 10U );
+        TS_ASSERT_EQUALS( partialPricingRule.getPool().size(), 2U );
+
+        excluded.insert( 10 );
+        TS_ASSERT( partialPricingRule.select( *tableau, candidates, excluded ) );
+        TS_ASSERT_EQUALS( tableau->mockEnteringVariable, 2U );
+
+        // When all the pool is excluded, the next segment is scanned
+        excluded.insert( 2 );
+        TS_ASSERT( partialPricingRule.select( *tableau, candidates, excluded ) );
+        TS_ASSERT_EQUALS( tableau->mockEnteringVariable, 51U );
+        TS_ASSERT_EQUALS( partialPricingRule.getPool().size(), 1U );
+        excluded.clear();
+
+        // Variables that are no longer eligible are dropped from the pool
+        tableau->mockCandidates = { 2, 300 };
+        TS_ASSERT( partialPricingRule.select( *tableau, candidates, excluded ) );
+        TS_ASSERT_EQUALS( tableau->mockEnteringVariable, 300U );
+        TS_ASSERT_EQUALS( partialPricingRule.getPool().size(), 1U );
+
+        // After enough pivots, the pool is refilled, picking up where
+        // the previous scan stopped and wrapping around
+        for ( unsigned i = 0; i < GlobalConfiguration::PARTIAL_PRICING_PIVOTS_BEFORE_REFILL; ++i )
+            partialPricingRule.postPivotHook( *tableau, false );
+
+        tableau->mockCandidates = { 2 };
+        TS_ASSERT( partialPricingRule.select( *tableau, candidates, excluded ) );
+        TS_ASSERT_EQUALS( tableau->mockEnteringVariable, 2U );
+
+        tableau->mockCandidates.clear();
+        TS_ASSERT( !partialPricingRule.select( *tableau, candidates, excluded ) );
+    }
+
+    void test_pool_size_is_bounded()
+    {
+        PartialPricingRule partialPricingRule;
+
+        Set<unsigned> excluded;
+        List<unsigned> candidates;
+
+        tableau->setDimensions( 10, 110 );
+        partialPricingRule.initialize( *tableau );
+
+        for ( unsigned i = 0; i < 100; ++i )
+        {
+            tableau->mockCandidates.append( i );
+            tableau->nextCostFunction[i] = -1.0 * i;
+        }
+
+        TS_ASSERT( partialPricingRule.select( *tableau, candidates, excluded ) );
+        TS_ASSERT_EQUALS( partialPricingRule.getPool().size(),
+                          GlobalConfiguration::PARTIAL_PRICING_POOL_SIZE );
+
+        // The segment is 0..15, and the best candidate there is picked
+        TS_ASSERT_EQUALS( tableau->mockEnteringVariable, 15U );
+    }
+};
+
+//
+// Local Variables:
+// compile-command: "make -C ../../.. "
+// tags-file-name: "../../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -25,6 +25,8 @@
 #include "Preprocessor.h"
 #include "ReluConstraint.h"
 #include "MarabouError.h"
+#include "Statistics.h"
+#include "ThreadPool.h"
 
 #include <string.h>
 
@@ -424,6 +426,69 @@ public:
         TS_ASSERT_EQUALS( preprocessedEquation._scalar, 12.0 );
 	}
 
+    InputQuery createChainQuery()
+    {
+        InputQuery inputQuery;
+
+        // x1 = 2 * x0, x2 = 2 * x1, x3 = 2 * x2, with the equations
+        // listed in reverse order
+        inputQuery.setNumberOfVariables( 4 );
+        inputQuery.setLowerBound( 0, 1 );
+        inputQuery.setUpperBound( 0, 2 );
+
+        for ( unsigned i = 3; i > 0; --i )
+        {
+            Equation equation;
+            equation.addAddend( 2, i - 1 );
+            equation.addAddend( -1, i );
+            equation.setScalar( 0 );
+            inputQuery.addEquation( equation );
+        }
+
+        return inputQuery;
+    }
+
+    void test_only_equations_with_changed_variables_are_examined()
+    {
+        InputQuery inputQuery = createChainQuery();
+
+        Statistics statistics;
+        Preprocessor preprocessor;
+        preprocessor.setStatistics( &statistics );
+
+        InputQuery processed = preprocessor.preprocess( inputQuery, false );
+
+        TS_ASSERT( FloatUtils::areEqual( processed.getLowerBound( 3 ), 8 ) );
+        TS_ASSERT( FloatUtils::areEqual( processed.getUpperBound( 3 ), 16 ) );
+
+        // Round 1 examines all three equations and tightens x1. Then,
+        // each round examines only the equations of the variable
+        // tightened in the previous one: 3 + 2 + 2 + 1.
+        TS_ASSERT_EQUALS( statistics.ppGetNumEquationsExamined(), 8U );
+    }
+
+    void test_tighten_equation_bounds_in_parallel()
+    {
+        InputQuery inputQuery = createChainQuery();
+
+        ThreadPool threadPool( 2 );
+        Preprocessor preprocessor;
+        preprocessor.setThreadPool( &threadPool );
+
+        InputQuery processed = preprocessor.preprocess( inputQuery, false );
+
+        for ( unsigned i = 0; i < 4; ++i )
+        {
+            TS_ASSERT( FloatUtils::areEqual( processed.getLowerBound( i ), 1 << i ) );
+            TS_ASSERT( FloatUtils::areEqual( processed.getUpperBound( i ), 2 << i ) );
+        }
+
+        // Infeasibility is still detected
+        inputQuery.setUpperBound( 3, 4 );
+        TS_ASSERT_THROWS( preprocessor.preprocess( inputQuery, false ),
+                          const InfeasibleQueryException &e );
+    }
+
     void test_all_equations_become_equalities()
     {
         InputQuery inputQuery;
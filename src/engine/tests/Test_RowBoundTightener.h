@@ -17,6 +17,7 @@
 
 #include "MockTableau.h"
 #include "RowBoundTightener.h"
+#include "Statistics.h"
 
 class MockForRowBoundTightener
 {
@@ -236,6 +237,84 @@ public:
         TS_ASSERT( tightenings.empty() );
     }
 
+    void test_examine_inverted_basis_rows_on_demand()
+    {
+        RowBoundTightener tightener( *tableau );
+
+        tableau->setDimensions( 1, 4 );
+
+        tableau->setLowerBound( 0, 0 );
+        tableau->setUpperBound( 0, 1 );
+        tableau->setLowerBound( 1, 0 );
+        tableau->setUpperBound( 1, 1 );
+        tableau->setLowerBound( 2, 0 );
+        tableau->setUpperBound( 2, 10 );
+        tableau->setLowerBound( 3, -10 );
+        tableau->setUpperBound( 3, 10 );
+
+        /*
+           A = | 2 -2 0 2 | , b = | 4 |, and x3 is basic.
+
+           B = | 2 |, so BTRAN gives rho = 0.5, and the row is
+
+                x3 = 2 - x0 + x1
+
+           which gives us that 1 <= x3 <= 3.
+        */
+
+        tightener.setDimensions();
+
+        double A[] = { 2, -2, 0, 2 };
+        double b[] = { 4 };
+        double rho[] = { 0.5 };
+
+        tableau->A = A;
+        tableau->b = b;
+        tableau->nextIsBasic.insert( 3 );
+        tableau->nextBasicIndexToVariable[0] = 3;
+        memcpy( tableau->nextBtranOutput, rho, sizeof(rho) );
+
+        TS_ASSERT_THROWS_NOTHING( tightener.examineInvertedBasisRowsOnDemand( false ) );
+        TS_ASSERT_EQUALS( tableau->lastBtranInput[0], 1.0 );
+
+        List<Tightening> tightenings;
+        TS_ASSERT_THROWS_NOTHING( tightener.getRowTightenings( tightenings ) );
+        TS_ASSERT_EQUALS( tightenings.size(), 2U );
+
+        auto it = tightenings.begin();
+
+        TS_ASSERT_EQUALS( it->_variable, 3U );
+        TS_ASSERT( FloatUtils::areEqual( it->_value, 1 ) );
+        TS_ASSERT_EQUALS( it->_type, Tightening::LB );
+
+        ++it;
+
+        TS_ASSERT_EQUALS( it->_variable, 3U );
+        TS_ASSERT( FloatUtils::areEqual( it->_value, 3 ) );
+        TS_ASSERT_EQUALS( it->_type, Tightening::UB );
+
+        // The row is now tight: its slack equals the width of x3, so it
+        // is skipped
+        Statistics statistics;
+        tightener.setStatistics( &statistics );
+
+        TS_ASSERT_THROWS_NOTHING( tightener.examineInvertedBasisRowsOnDemand( true ) );
+        tightenings.clear();
+        TS_ASSERT_THROWS_NOTHING( tightener.getRowTightenings( tightenings ) );
+        TS_ASSERT( tightenings.empty() );
+        TS_ASSERT_EQUALS( statistics.getNumExplicitBasisRowsSkipped(), 1U );
+
+        // An upper bound of 0.5 for x0 means x3 >= 1.5
+        tightener.notifyUpperBound( 0, 0.5 );
+        TS_ASSERT_THROWS_NOTHING( tightener.examineInvertedBasisRowsOnDemand( false ) );
+        tightenings.clear();
+        TS_ASSERT_THROWS_NOTHING( tightener.getRowTightenings( tightenings ) );
+        TS_ASSERT_EQUALS( tightenings.size(), 1U );
+        TS_ASSERT_EQUALS( tightenings.begin()->_variable, 3U );
+        TS_ASSERT( FloatUtils::areEqual( tightenings.begin()->_value, 1.5 ) );
+        TS_ASSERT_EQUALS( tightenings.begin()->_type, Tightening::LB );
+    }
+
     void test_examine_constraint_matrix_single_equation()
     {
         RowBoundTightener tightener( *tableau );
@@ -377,6 +456,102 @@ public:
         TS_ASSERT( FloatUtils::areEqual( it->_value, 2 ) );
         TS_ASSERT_EQUALS( it->_type, Tightening::UB );
     }
+
+    void test_examine_constraint_matrix_only_changed_rows()
+    {
+        RowBoundTightener tightener( *tableau );
+
+        tableau->setDimensions( 2, 5 );
+
+        tableau->setLowerBound( 0, 0 );
+        tableau->setUpperBound( 0, 10 );
+        tableau->setLowerBound( 1, 0 );
+        tableau->setUpperBound( 1, 5 );
+        tableau->setLowerBound( 2, 0 );
+        tableau->setUpperBound( 2, 10 );
+        tableau->setLowerBound( 3, 0 );
+        tableau->setUpperBound( 3, 4 );
+        tableau->setLowerBound( 4, 0 );
+        tableau->setUpperBound( 4, 1 );
+
+        /*
+           Equations:
+                x0 - x1 = 0
+                x2 - x3 = 0
+
+           The first examination covers all rows, and gives us that
+           x0 <= 5 and x2 <= 4.
+        */
+
+        tightener.setDimensions();
+
+        double A[] = {
+            1, -1, 0,  0, 0,
+            0,  0, 1, -1, 0,
+        };
+
+        double b[] = { 0, 0 };
+
+        double column0[] = { 1, 0 };
+        double column1[] = { -1, 0 };
+        double column2[] = { 0, 1 };
+        double column3[] = { 0, -1 };
+
+        tableau->A = A;
+        tableau->b = b;
+        tableau->nextAColumn[0] = column0;
+        tableau->nextAColumn[1] = column1;
+        tableau->nextAColumn[2] = column2;
+        tableau->nextAColumn[3] = column3;
+
+        TS_ASSERT_THROWS_NOTHING( tightener.examineConstraintMatrix( true ) );
+
+        List<Tightening> tightenings;
+        TS_ASSERT_THROWS_NOTHING( tightener.getRowTightenings( tightenings ) );
+        TS_ASSERT_EQUALS( tightenings.size(), 2U );
+
+        // Change the first equation to x0 - x1 = -1. Had it been
+        // examined again, it would give x0 <= 4.
+        b[0] = -1;
+
+        // Only the second equation contains x3
+        tightener.notifyUpperBound( 3, 2 );
+        TS_ASSERT_THROWS_NOTHING( tightener.examineConstraintMatrix( false ) );
+
+        tightenings.clear();
+        TS_ASSERT_THROWS_NOTHING( tightener.getRowTightenings( tightenings ) );
+        TS_ASSERT_EQUALS( tightenings.size(), 1U );
+        TS_ASSERT_EQUALS( tightenings.begin()->_variable, 2U );
+        TS_ASSERT( FloatUtils::areEqual( tightenings.begin()->_value, 2 ) );
+        TS_ASSERT_EQUALS( tightenings.begin()->_type, Tightening::UB );
+
+        // Nothing changed, so nothing is examined
+        TS_ASSERT_THROWS_NOTHING( tightener.examineConstraintMatrix( true ) );
+        tightenings.clear();
+        TS_ASSERT_THROWS_NOTHING( tightener.getRowTightenings( tightenings ) );
+        TS_ASSERT( tightenings.empty() );
+
+        // x1 is in the first equation
+        tightener.notifyLowerBound( 1, 1 );
+        TS_ASSERT_THROWS_NOTHING( tightener.examineConstraintMatrix( false ) );
+
+        tightenings.clear();
+        TS_ASSERT_THROWS_NOTHING( tightener.getRowTightenings( tightenings ) );
+        TS_ASSERT_EQUALS( tightenings.size(), 1U );
+        TS_ASSERT_EQUALS( tightenings.begin()->_variable, 0U );
+        TS_ASSERT( FloatUtils::areEqual( tightenings.begin()->_value, 4 ) );
+        TS_ASSERT_EQUALS( tightenings.begin()->_type, Tightening::UB );
+
+        // After the bounds are reset, all rows are examined again:
+        // x0 <= 4 and x1 >= 1 from the first equation, x2 <= 4 from
+        // the second
+        TS_ASSERT_THROWS_NOTHING( tightener.resetBounds() );
+        TS_ASSERT_THROWS_NOTHING( tightener.examineConstraintMatrix( false ) );
+
+        tightenings.clear();
+        TS_ASSERT_THROWS_NOTHING( tightener.getRowTightenings( tightenings ) );
+        TS_ASSERT_EQUALS( tightenings.size(), 3U );
+    }
 };
 
 //
@@ -185,6 +185,41 @@ public:
         TS_ASSERT( smtCore.needToSplit() );
     }
 
+    void test_tableau_state_storage_level()
+    {
+        MockConstraint constraint;
+        PiecewiseLinearCaseSplit split1;
+        split1.storeBoundTightening( Tightening( 1, 3.0, Tightening::LB ) );
+        PiecewiseLinearCaseSplit split2;
+        split2.storeBoundTightening( Tightening( 1, 3.0, Tightening::UB ) );
+
+        // By default, a complete copy of the tableau is stored
+        {
+            SmtCore smtCore( engine );
+            constraint.nextSplits = { split1, split2 };
+            for ( unsigned i = 0; i < ( unsigned ) Options::get()->getInt( Options::CONSTRAINT_VIOLATION_THRESHOLD ); ++i )
+                smtCore.reportViolatedConstraint( &constraint );
+
+            TS_ASSERT_THROWS_NOTHING( smtCore.performSplit() );
+            TS_ASSERT( engine->lastStorageLevel ==
+                       TableauStateStorageLevel::STORE_ENTIRE_TABLEAU_STATE );
+        }
+
+        // With trail backtracking, only a trail level is stored
+        Options::get()->setBool( Options::TRAIL_BACKTRACKING, true );
+        {
+            SmtCore smtCore( engine );
+            constraint.nextSplits = { split1, split2 };
+            for ( unsigned i = 0; i < ( unsigned ) Options::get()->getInt( Options::CONSTRAINT_VIOLATION_THRESHOLD ); ++i )
+                smtCore.reportViolatedConstraint( &constraint );
+
+            TS_ASSERT_THROWS_NOTHING( smtCore.performSplit() );
+            TS_ASSERT( engine->lastStorageLevel ==
+                       TableauStateStorageLevel::STORE_TABLEAU_TRAIL );
+        }
+        Options::get()->setBool( Options::TRAIL_BACKTRACKING, false );
+    }
+
     void test_perform_split()
     {
         SmtCore smtCore( engine );
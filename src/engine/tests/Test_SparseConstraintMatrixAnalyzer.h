@@ -0,0 +1,240 @@
+/*********************                                                        */
+/*! \file Test_SparseConstraintMatrixAnalyzer.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+ **/
+
+#include <cxxtest/TestSuite.h>
+
+#include "ConstraintMatrixAnalyzer.h"
+#include "SparseConstraintMatrixAnalyzer.h"
+#include "SparseUnsortedArrays.h"
+
+#include <cstdlib>
+
+class MockForSparseConstraintMatrixAnalyzer
+{
+public:
+};
+
+class SparseConstraintMatrixAnalyzerTestSuite : public CxxTest::TestSuite
+{
+public:
+	MockForSparseConstraintMatrixAnalyzer *mock;
+
+	void setUp()
+	{
+		TS_ASSERT( mock = new MockForSparseConstraintMatrixAnalyzer );
+	}
+
+	void tearDown()
+	{
+		TS_ASSERT_THROWS_NOTHING( delete mock );
+	}
+
+    bool sameColumns( List<unsigned> a, Set<unsigned> b )
+    {
+        if ( a.size() != b.size() )
+            return false;
+
+        for ( const auto &it : a )
+            if ( !b.exists( it ) )
+                return false;
+
+        return true;
+    }
+
+    void test_analyze__gaussian_eliminiation()
+    {
+        SparseConstraintMatrixAnalyzer analyzer;
+
+        {
+            double A1[] = {
+                1, 0, 0, 0, 0,
+                0, 0, 1, 0, 0,
+                0, 0, 0, 1, 0,
+            };
+
+            TS_ASSERT_THROWS_NOTHING( analyzer.analyze( A1, 3, 5 ) );
+
+            TS_ASSERT( analyzer.getRedundantRows().empty() );
+            Set<unsigned> expectedColumns( { 0, 2, 3 } );
+            TS_ASSERT( sameColumns( analyzer.getIndependentColumns(), expectedColumns ) );
+        }
+
+        {
+            double A1[] = {
+                1, 0, 0, 0, 0,
+                0, 0, 1, 0, 0,
+                0, 1, 0, 1, 0,
+            };
+
+            TS_ASSERT_THROWS_NOTHING( analyzer.analyze( A1, 3, 5 ) );
+
+            TS_ASSERT( analyzer.getRedundantRows().empty() );
+
+            Set<unsigned> expectedColumns1( { 0, 1, 2 } );
+            Set<unsigned> expectedColumns2( { 0, 2, 3 } );
+            TS_ASSERT( sameColumns( analyzer.getIndependentColumns(), expectedColumns1 )
+                       ||
+                       sameColumns( analyzer.getIndependentColumns(), expectedColumns2 )
+                       );
+        }
+
+        {
+            double A1[] = {
+                1, 0, 0, 0, 0,
+                1, 0, 0, 0, 0,
+                0, 1, 0, 2, 0,
+            };
+
+            TS_ASSERT_THROWS_NOTHING( analyzer.analyze( A1, 3, 5 ) );
+
+            Set<unsigned> expectedRows( { 1 } );
+            TS_ASSERT_EQUALS( analyzer.getRedundantRows(), expectedRows );
+
+            Set<unsigned> expectedColumns1( { 0, 1 } );
+            Set<unsigned> expectedColumns2( { 0, 3 } );
+            TS_ASSERT( sameColumns( analyzer.getIndependentColumns(), expectedColumns1 )
+                       ||
+                       sameColumns( analyzer.getIndependentColumns(), expectedColumns2 )
+                       );
+        }
+
+        {
+            double A1[] = {
+                1, 1, 0, 1, 0,
+                0, 0, 3, 0, 0,
+                2, 2, 0, 0, 0,
+            };
+
+            TS_ASSERT_THROWS_NOTHING( analyzer.analyze( A1, 3, 5 ) );
+
+            TS_ASSERT( analyzer.getRedundantRows().empty() );
+
+            Set<unsigned> expectedColumns1( { 0, 2, 3 } );
+            Set<unsigned> expectedColumns2( { 1, 2, 3 } );
+            TS_ASSERT( sameColumns( analyzer.getIndependentColumns(), expectedColumns1 )
+                       ||
+                       sameColumns( analyzer.getIndependentColumns(), expectedColumns2 )
+                       );
+        }
+
+        {
+            double A1[] = {
+                15, 3,  0, 1, 0,
+                0 , 0, -1, 1, 4,
+                15, 3, -1, 2, 4,
+            };
+
+            TS_ASSERT_THROWS_NOTHING( analyzer.analyze( A1, 3, 5 ) );
+
+            TS_ASSERT_EQUALS( analyzer.getRedundantRows().size(), 1U );
+
+            List<unsigned> columns = analyzer.getIndependentColumns();
+            TS_ASSERT_EQUALS( columns.size(), 2U );
+
+            // Can have at most 1 of columns 0 and 1
+            TS_ASSERT( !columns.exists( 0 ) || !columns.exists( 1 ) );
+
+            // Can have at most 1 of columns 2 and 4
+            TS_ASSERT( !columns.exists( 2 ) || !columns.exists( 4 ) );
+        }
+
+        {
+            double A1[] = {
+                0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0,
+            };
+
+            TS_ASSERT_THROWS_NOTHING( analyzer.analyze( A1, 3, 5 ) );
+
+            TS_ASSERT( analyzer.getIndependentColumns().empty() );
+
+            TS_ASSERT_EQUALS( analyzer.getRedundantRows().size(), 3U );
+        }
+
+        {
+            double A1[] = {
+                0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0,
+                0, 2, 3, 14, 1,
+            };
+
+            TS_ASSERT_THROWS_NOTHING( analyzer.analyze( A1, 3, 5 ) );
+
+            TS_ASSERT_EQUALS( analyzer.getRedundantRows(),
+                              Set<unsigned>( { 0, 1 } ) );
+
+            List<unsigned> columns = analyzer.getIndependentColumns();
+            TS_ASSERT_EQUALS( columns.size(), 1U );
+            TS_ASSERT( !columns.exists( 0 ) );
+        }
+    }
+
+    void test_agrees_with_constraint_matrix_analyzer()
+    {
+        /*
+          Sparse matrices in which some rows are copies or sums of
+          others. Both analyzers should select the same pivots.
+        */
+        srand( 7 );
+
+        for ( unsigned trial = 0; trial < 50; ++trial )
+        {
+            unsigned m = 5 + rand() % 20;
+            unsigned n = m + rand() % 20;
+
+            double *A = new double[m * n];
+            std::fill_n( A, m * n, 0 );
+
+            for ( unsigned i = 0; i < m; ++i )
+            {
+                if ( i > 1 && rand() % 4 == 0 )
+                {
+                    // A linear combination of two earlier rows
+                    unsigned first = rand() % i;
+                    unsigned second = rand() % i;
+                    for ( unsigned j = 0; j < n; ++j )
+                        A[i * n + j] = A[first * n + j] - 2 * A[second * n + j];
+                    continue;
+                }
+
+                unsigned numEntries = 1 + rand() % 4;
+                for ( unsigned k = 0; k < numEntries; ++k )
+                    A[i * n + rand() % n] = (double)( rand() % 9 ) - 4;
+            }
+
+            ConstraintMatrixAnalyzer analyzer;
+            TS_ASSERT_THROWS_NOTHING( analyzer.analyze( A, m, n ) );
+
+            SparseUnsortedArrays sparseA;
+            sparseA.initialize( A, m, n );
+
+            SparseConstraintMatrixAnalyzer sparseAnalyzer;
+            TS_ASSERT_THROWS_NOTHING( sparseAnalyzer.analyze( sparseA, m, n ) );
+
+            TS_ASSERT_EQUALS( sparseAnalyzer.getRedundantRows(), analyzer.getRedundantRows() );
+            TS_ASSERT_EQUALS( sparseAnalyzer.getIndependentColumns(), analyzer.getIndependentColumns() );
+
+            delete[] A;
+        }
+    }
+};
+
+//
+// Local Variables:
+// compile-command: "make -C ../../.. "
+// tags-file-name: "../../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -442,6 +442,202 @@ public:
         TS_ASSERT_THROWS_NOTHING( delete tableau );
     }
 
+    void test_long_step_ratio_test()
+    {
+        Tableau *tableau = NULL;
+        MockCostFunctionManager costFunctionManager;
+
+        TS_ASSERT( tableau = new Tableau );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setDimensions( 3, 7 ) );
+        tableau->registerCostFunctionManager( &costFunctionManager );
+        initializeTableauValues( *tableau );
+        tableau->setPrimalRatioTestType( PrimalRatioTestType::LONG_STEP );
+
+        for ( unsigned i = 0; i < 4; ++i )
+        {
+            TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( i, 1 ) );
+            TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( i, 10 ) );
+        }
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 4, 219 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 4, 228 ) );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 5, 112 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 5, 114 ) );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 6, 400 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 6, 402 ) );
+
+        List<unsigned> basics = { 4, 5, 6 };
+        TS_ASSERT_THROWS_NOTHING( tableau->initializeTableau( basics ) );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->computeCostFunction() );
+
+        costFunctionManager.nextCostFunction = new double[4];
+        costFunctionManager.nextCostFunction[0] = -1;
+        costFunctionManager.nextCostFunction[1] = -1;
+        costFunctionManager.nextCostFunction[2] = -1;
+        costFunctionManager.nextCostFunction[3] = -1;
+
+        costFunctionManager.nextBasicCost[0] = -1;
+        costFunctionManager.nextBasicCost[1] =  0;
+        costFunctionManager.nextBasicCost[2] = +1;
+
+        // Entering variable is 2, and it needs to increase, with a
+        // reduced cost of 1. Current basic values are: 217, 113, 406
+        tableau->setEnteringVariableIndex( 2u );
+
+        double d1[] = { -0.5, 0, 0.8 };
+        // Var 4 will hit its lower bound at 4: the slope drops to 0.5
+        // Var 6 will hit its upper bound at 5: the slope drops to -0.3
+        TS_ASSERT_THROWS_NOTHING( tableau->pickLeavingVariable( d1 ) );
+        TS_ASSERT_EQUALS( tableau->getLeavingVariable(), 6u );
+        TS_ASSERT( FloatUtils::areEqual( tableau->getChangeRatio(), 5.0 ) );
+
+        double d2[] = { -0.5, -0.2, 0 };
+        // Var 4 will hit its lower bound at 4: the slope drops to 0.5
+        // Var 5 will hit its upper bound at 5, and may not pass it
+        TS_ASSERT_THROWS_NOTHING( tableau->pickLeavingVariable( d2 ) );
+        TS_ASSERT_EQUALS( tableau->getLeavingVariable(), 5u );
+        TS_ASSERT( FloatUtils::areEqual( tableau->getChangeRatio(), 5.0 ) );
+
+        double d3[] = { 0, 0, 0.00001 };
+        // No bound is reached before the entering variable's bound
+        TS_ASSERT_THROWS_NOTHING( tableau->pickLeavingVariable( d3 ) );
+        TS_ASSERT( tableau->performingFakePivot() );
+        TS_ASSERT_EQUALS( tableau->getChangeRatio(), 9.0 );
+
+        double d4[] = { -0.5, -0.1, 0 };
+        // Var 4 will hit its lower bound at 4: the slope drops to 0.5
+        // Var 5 would hit its upper bound at 10, after the entering
+        // variable reaches its upper bound at 9
+        TS_ASSERT_THROWS_NOTHING( tableau->pickLeavingVariable( d4 ) );
+        TS_ASSERT( tableau->performingFakePivot() );
+        TS_ASSERT_EQUALS( tableau->getChangeRatio(), 9.0 );
+
+        // Var 4 has passed its lower bound, so the cost function is
+        // recomputed instead of updated
+        tableau->setChangeColumn( d4 );
+        TS_ASSERT( !costFunctionManager.invalidateCostFunctionCalled );
+        TS_ASSERT_THROWS_NOTHING( tableau->performPivot() );
+        TS_ASSERT( costFunctionManager.invalidateCostFunctionCalled );
+
+        TS_ASSERT_EQUALS( tableau->getValue( 2u ), 10.0 );
+        TS_ASSERT( FloatUtils::areEqual( tableau->getValue( 4u ), 221.5 ) );
+        TS_ASSERT( FloatUtils::areEqual( tableau->getValue( 5u ), 113.9 ) );
+        TS_ASSERT_EQUALS( tableau->getBasicStatus( 4 ), Tableau::BETWEEN );
+
+        TS_ASSERT_THROWS_NOTHING( delete tableau );
+    }
+
+    void test_dual_ratio_test()
+    {
+        Tableau *tableau = NULL;
+        MockCostFunctionManager costFunctionManager;
+
+        TS_ASSERT( tableau = new Tableau );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setDimensions( 3, 7 ) );
+        tableau->registerCostFunctionManager( &costFunctionManager );
+        initializeTableauValues( *tableau );
+
+        for ( unsigned i = 0; i < 4; ++i )
+        {
+            TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( i, 1 ) );
+            TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( i, 10 ) );
+        }
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 4, 219 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 4, 228 ) );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 5, 112 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 5, 114 ) );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 6, 400 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 6, 402 ) );
+
+        List<unsigned> basics = { 4, 5, 6 };
+        TS_ASSERT_THROWS_NOTHING( tableau->initializeTableau( basics ) );
+
+        // x4 = 217 is below its lower bound. Its row is
+        //   x4 = 225 - 3x0 - 2x1 - x2 - 2x3
+        // and all non-basics are at their lower bounds, so none of
+        // them can increase x4.
+        tableau->setLeavingVariableIndex( 0 );
+        TS_ASSERT_THROWS_NOTHING( tableau->computePivotRow() );
+        TS_ASSERT( !tableau->dualRatioTest( DualRatioTestType::TEXTBOOK ) );
+
+        // x6 = 406 is above its upper bound. Its row is
+        //   x6 = 420 - 4x0 - 3x1 - 3x2 - 4x3
+        // and all non-basics can increase. The first largest pivot
+        // element is picked, and x0 needs to increase by 1.
+        tableau->setLeavingVariableIndex( 2 );
+        TS_ASSERT_THROWS_NOTHING( tableau->computePivotRow() );
+        TS_ASSERT( tableau->dualRatioTest( DualRatioTestType::TEXTBOOK ) );
+        TS_ASSERT_EQUALS( tableau->getEnteringVariableIndex(), 0U );
+        TS_ASSERT( FloatUtils::areEqual( tableau->getChangeRatio(), 1.0 ) );
+
+        TS_ASSERT_THROWS_NOTHING( delete tableau );
+    }
+
+    void test_bound_flipping_dual_ratio_test()
+    {
+        Tableau *tableau = NULL;
+        MockCostFunctionManager costFunctionManager;
+
+        TS_ASSERT( tableau = new Tableau );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setDimensions( 3, 7 ) );
+        tableau->registerCostFunctionManager( &costFunctionManager );
+        initializeTableauValues( *tableau );
+
+        for ( unsigned i = 0; i < 4; ++i )
+        {
+            TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( i, 1 ) );
+            TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( i, 10 ) );
+        }
+
+        // x1 and x3 have narrow ranges
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 1, 1.5 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 3, 1.5 ) );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 4, 210 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 4, 228 ) );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 5, 112.2 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 5, 114 ) );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 6, 400 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 6, 402 ) );
+
+        List<unsigned> basics = { 4, 5, 6 };
+        TS_ASSERT_THROWS_NOTHING( tableau->initializeTableau( basics ) );
+
+        // x6 = 406 is above its upper bound by 4. Its row is
+        //   x6 = 420 - 4x0 - 3x1 - 3x2 - 4x3
+        // x0 enters. Flipping x1 to its upper bound reduces x6 by 1.5.
+        // Flipping x2 would bring x6 within its bounds, and flipping
+        // x3 as well would bring x5 below its lower bound.
+        tableau->setLeavingVariableIndex( 2 );
+        TS_ASSERT_THROWS_NOTHING( tableau->computePivotRow() );
+        TS_ASSERT( tableau->dualRatioTest( DualRatioTestType::BOUND_FLIPPING ) );
+        TS_ASSERT_EQUALS( tableau->getEnteringVariableIndex(), 0U );
+
+        TS_ASSERT_EQUALS( tableau->getValue( 1 ), 1.5 );
+        TS_ASSERT_EQUALS( tableau->getValue( 2 ), 1.0 );
+        TS_ASSERT_EQUALS( tableau->getValue( 3 ), 1.0 );
+
+        TS_ASSERT( FloatUtils::areEqual( tableau->getValue( 4 ), 216 ) );
+        TS_ASSERT( FloatUtils::areEqual( tableau->getValue( 5 ), 112.5 ) );
+        TS_ASSERT( FloatUtils::areEqual( tableau->getValue( 6 ), 404.5 ) );
+
+        // x0 needs to increase by (404.5 - 402) / 4
+        TS_ASSERT( FloatUtils::areEqual( tableau->getChangeRatio(), 0.625 ) );
+
+        TS_ASSERT_THROWS_NOTHING( delete tableau );
+    }
+
     void test_perform_pivot_nonbasic_goes_to_opposite_bound()
     {
         Tableau *tableau = NULL;
@@ -1122,6 +1318,111 @@ public:
         TS_ASSERT_THROWS_NOTHING( delete tableau );
     }
 
+    void test_trail_backtracking()
+    {
+        Tableau *tableau = NULL;
+        MockCostFunctionManager costFunctionManager;
+
+        TS_ASSERT( tableau = new Tableau );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setDimensions( 3, 7 ) );
+        tableau->registerCostFunctionManager( &costFunctionManager );
+        initializeTableauValues( *tableau );
+
+        for ( unsigned i = 0; i < 4; ++i )
+        {
+            TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( i, 1 ) );
+            TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( i, 10 ) );
+        }
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 4, 200 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 4, 228 ) );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 5, 80 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 5, 114 ) );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 6, 300 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 6, 402 ) );
+
+        List<unsigned> basics = { 4, 5, 6 };
+        TS_ASSERT_THROWS_NOTHING( tableau->initializeTableau( basics ) );
+
+        // Nothing is recorded before the first level is pushed
+        TS_ASSERT_EQUALS( tableau->getTrailLevel(), 0U );
+        TS_ASSERT_EQUALS( tableau->getTrailSize(), 0U );
+
+        TS_ASSERT_EQUALS( tableau->pushTrailLevel(), 1U );
+        TS_ASSERT_THROWS_NOTHING( tableau->tightenLowerBound( 0, 3 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->tightenUpperBound( 5, 110 ) );
+        TS_ASSERT_EQUALS( tableau->getTrailSize(), 2U );
+
+        // The non-basic x1 was pushed up to its new lower bound
+        TS_ASSERT_EQUALS( tableau->getValue( 0 ), 3.0 );
+
+        TS_ASSERT_EQUALS( tableau->pushTrailLevel(), 2U );
+        TS_ASSERT_THROWS_NOTHING( tableau->tightenUpperBound( 0, 5 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->tightenUpperBound( 1, 2 ) );
+        TS_ASSERT_EQUALS( tableau->getTrailSize(), 4U );
+
+        // Backtrack to the second level: only its changes are undone
+        TS_ASSERT_THROWS_NOTHING( tableau->backtrackTrail( 2 ) );
+        TS_ASSERT_EQUALS( tableau->getTrailLevel(), 2U );
+        TS_ASSERT_EQUALS( tableau->getTrailSize(), 2U );
+        TS_ASSERT_EQUALS( tableau->getUpperBound( 0 ), 10.0 );
+        TS_ASSERT_EQUALS( tableau->getUpperBound( 1 ), 10.0 );
+        TS_ASSERT_EQUALS( tableau->getLowerBound( 0 ), 3.0 );
+        TS_ASSERT_EQUALS( tableau->getUpperBound( 5 ), 110.0 );
+
+        // Adding an equation requires a checkpoint, which is restored on backtracking
+        Equation equation;
+        equation.addAddend( 1, 0 );
+        equation.addAddend( -1, 1 );
+        equation.setScalar( 0 );
+        TS_ASSERT_THROWS_NOTHING( tableau->addEquation( equation ) );
+        TS_ASSERT_EQUALS( tableau->getM(), 4U );
+        TS_ASSERT_EQUALS( tableau->getN(), 8U );
+        TS_ASSERT_THROWS_NOTHING( tableau->tightenLowerBound( 1, 4 ) );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->backtrackTrail( 1 ) );
+        TS_ASSERT_EQUALS( tableau->getTrailLevel(), 1U );
+        TS_ASSERT_EQUALS( tableau->getTrailSize(), 0U );
+        TS_ASSERT_EQUALS( tableau->getM(), 3U );
+        TS_ASSERT_EQUALS( tableau->getN(), 7U );
+
+        TS_ASSERT_EQUALS( tableau->getLowerBound( 0 ), 1.0 );
+        TS_ASSERT_EQUALS( tableau->getLowerBound( 1 ), 1.0 );
+        TS_ASSERT_EQUALS( tableau->getUpperBound( 5 ), 114.0 );
+        TS_ASSERT_EQUALS( tableau->getLowerBound( 4 ), 200.0 );
+
+        // The assignment is consistent with the restored tableau
+        TS_ASSERT_EQUALS( tableau->getValue( 0 ), 3.0 );
+        TS_ASSERT_EQUALS( tableau->getValue( 4 ), 225.0 - 3 * 3 - 2 - 1 - 2 );
+
+        // Adding the equation again reuses the row and column that were
+        // kept by the restore, without leftovers from before
+        TS_ASSERT_EQUALS( tableau->pushTrailLevel(), 2U );
+        equation.setScalar( 1 );
+        TS_ASSERT_THROWS_NOTHING( tableau->addEquation( equation ) );
+        TS_ASSERT_EQUALS( tableau->getM(), 4U );
+        TS_ASSERT_EQUALS( tableau->getN(), 8U );
+        TS_ASSERT_EQUALS( tableau->getSparseAColumn( 7 )->getNnz(), 1U );
+        TS_ASSERT_EQUALS( tableau->getSparseARow( 3 )->getNnz(), 3U );
+
+        tableau->computeAssignment();
+        TS_ASSERT_EQUALS( tableau->getValue( 7 ),
+                          1 - tableau->getValue( 0 ) + tableau->getValue( 1 ) );
+        TS_ASSERT_EQUALS( tableau->getValue( 4 ), 225.0 - 3 * 3 - 2 - 1 - 2 );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->backtrackTrail( 1 ) );
+        TS_ASSERT_EQUALS( tableau->getM(), 3U );
+        TS_ASSERT_EQUALS( tableau->getN(), 7U );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->clearTrail() );
+        TS_ASSERT_EQUALS( tableau->getTrailLevel(), 0U );
+
+        TS_ASSERT_THROWS_NOTHING( delete tableau );
+    }
+
     void test_add_equation()
     {
         Tableau *tableau = NULL;
@@ -1279,6 +1580,96 @@ public:
         TS_ASSERT_THROWS_NOTHING( delete tableau );
     }
 
+    void test_add_equations()
+    {
+        Tableau *tableau = NULL;
+        MockCostFunctionManager costFunctionManager;
+
+        TS_ASSERT( tableau = new Tableau );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setDimensions( 3, 7 ) );
+        tableau->registerCostFunctionManager( &costFunctionManager );
+        initializeTableauValues( *tableau );
+
+        for ( unsigned i = 0; i < 4; ++i )
+        {
+            TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( i, 1 ) );
+            TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( i, 10 ) );
+        }
+
+        for ( unsigned i = 4; i < 7; ++i )
+        {
+            TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( i, 0 ) );
+            TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( i, 500 ) );
+        }
+
+        List<unsigned> basics = { 4, 5, 6 };
+        TS_ASSERT_THROWS_NOTHING( tableau->initializeTableau( basics ) );
+
+        /*
+          Add two equations at once:
+
+              x1 + x2 + x8 = 3
+              x3 - x4 + x9 = 0
+
+          where x8 and x9 are new basic variables.
+        */
+        List<Equation> equations;
+        Equation equation1;
+        equation1.addAddend( 1, 0 );
+        equation1.addAddend( 1, 1 );
+        equation1.setScalar( 3 );
+        equations.append( equation1 );
+
+        Equation equation2;
+        equation2.addAddend( 1, 2 );
+        equation2.addAddend( -1, 3 );
+        equation2.setScalar( 0 );
+        equations.append( equation2 );
+
+        unsigned auxVariable = 0;
+        TS_ASSERT_THROWS_NOTHING( auxVariable = tableau->addEquations( equations ) );
+        TS_ASSERT_EQUALS( auxVariable, 7U );
+        TS_ASSERT_EQUALS( tableau->getM(), 5U );
+        TS_ASSERT_EQUALS( tableau->getN(), 9U );
+        TS_ASSERT( tableau->isBasic( 7U ) );
+        TS_ASSERT( tableau->isBasic( 8U ) );
+
+        TS_ASSERT_EQUALS( tableau->getLowerBound( 7 ), -17.0 );
+        TS_ASSERT_EQUALS( tableau->getUpperBound( 7 ), 1.0 );
+        TS_ASSERT_EQUALS( tableau->getLowerBound( 8 ), -9.0 );
+        TS_ASSERT_EQUALS( tableau->getUpperBound( 8 ), 9.0 );
+
+        // A single equation afterwards fits in the grown capacity
+        Equation equation3;
+        equation3.addAddend( 2, 0 );
+        equation3.setScalar( 5 );
+        TS_ASSERT_THROWS_NOTHING( auxVariable = tableau->addEquation( equation3 ) );
+        TS_ASSERT_EQUALS( auxVariable, 9U );
+        TS_ASSERT_EQUALS( tableau->getM(), 6U );
+        TS_ASSERT_EQUALS( tableau->getN(), 10U );
+
+        // Old and new rows are consistent with the assignment
+        tableau->computeAssignment();
+        TS_ASSERT_EQUALS( tableau->getValue( 4 ), 217.0 );
+        TS_ASSERT_EQUALS( tableau->getValue( 5 ), 113.0 );
+        TS_ASSERT_EQUALS( tableau->getValue( 6 ), 406.0 );
+        TS_ASSERT_EQUALS( tableau->getValue( 7 ), 1.0 );
+        TS_ASSERT_EQUALS( tableau->getValue( 8 ), 0.0 );
+        TS_ASSERT_EQUALS( tableau->getValue( 9 ), 3.0 );
+
+        TableauRow row( 4 );
+        tableau->getTableauRow( 4, &row );
+        TS_ASSERT_EQUALS( row._scalar, 0.0 );
+        for ( unsigned i = 0; i < 4; ++i )
+        {
+            double expected = row._row[i]._var == 2 ? -1 : row._row[i]._var == 3 ? 1 : 0;
+            TS_ASSERT_EQUALS( row._row[i]._coefficient, expected );
+        }
+
+        TS_ASSERT_THROWS_NOTHING( delete tableau );
+    }
+
     void test_tighten_bounds()
     {
         Tableau *tableau = NULL;
@@ -0,0 +1,140 @@
+/*********************                                                        */
+/*! \file Test_WorkerQueue.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Haoze Wu
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include <cxxtest/TestSuite.h>
+
+#include "SubQuery.h"
+#include "WorkerQueue.h"
+
+#include <atomic>
+#include <thread>
+
+class WorkerQueueTestSuite : public CxxTest::TestSuite
+{
+public:
+    SubQuery *createSubQuery( String queryId )
+    {
+        SubQuery *subQuery = new SubQuery;
+        subQuery->_queryId = queryId;
+        subQuery->_timeoutInSeconds = 0;
+        subQuery->_depth = 0;
+        return subQuery;
+    }
+
+    void test_push_and_pop_own_deque()
+    {
+        WorkerQueue workload( 2 );
+        TS_ASSERT( workload.empty() );
+        TS_ASSERT_EQUALS( workload.getNumWorkers(), 2U );
+
+        workload.push( 0, createSubQuery( "1" ) );
+        workload.push( 0, createSubQuery( "2" ) );
+        TS_ASSERT_EQUALS( workload.size(), 2U );
+
+        // The owner pops the most recently pushed subquery
+        SubQuery *subQuery = NULL;
+        TS_ASSERT( workload.pop( 0, subQuery ) );
+        TS_ASSERT_EQUALS( subQuery->_queryId, String( "2" ) );
+        delete subQuery;
+
+        TS_ASSERT( workload.pop( 0, subQuery ) );
+        TS_ASSERT_EQUALS( subQuery->_queryId, String( "1" ) );
+        delete subQuery;
+
+        TS_ASSERT( workload.empty() );
+        TS_ASSERT( !workload.pop( 0, subQuery ) );
+
+        TS_ASSERT_EQUALS( workload.getWorkerStatistics( 0 )._numPopped, 2U );
+        TS_ASSERT_EQUALS( workload.getWorkerStatistics( 0 )._numStolen, 0U );
+    }
+
+    void test_steal()
+    {
+        WorkerQueue workload( 3 );
+
+        workload.push( 2, createSubQuery( "1" ) );
+        workload.push( 2, createSubQuery( "2" ) );
+        workload.push( 2, createSubQuery( "3" ) );
+
+        // A thief takes the oldest subquery of its victim
+        SubQuery *subQuery = NULL;
+        TS_ASSERT( workload.pop( 0, subQuery ) );
+        TS_ASSERT_EQUALS( subQuery->_queryId, String( "1" ) );
+        delete subQuery;
+
+        TS_ASSERT( workload.pop( 1, subQuery ) );
+        TS_ASSERT_EQUALS( subQuery->_queryId, String( "2" ) );
+        delete subQuery;
+
+        TS_ASSERT( workload.pop( 2, subQuery ) );
+        TS_ASSERT_EQUALS( subQuery->_queryId, String( "3" ) );
+        delete subQuery;
+
+        TS_ASSERT( workload.empty() );
+
+        TS_ASSERT_EQUALS( workload.getWorkerStatistics( 0 )._numStolen, 1U );
+        TS_ASSERT_EQUALS( workload.getWorkerStatistics( 1 )._numStolen, 1U );
+        TS_ASSERT_EQUALS( workload.getWorkerStatistics( 2 )._numStolen, 0U );
+        TS_ASSERT_EQUALS( workload.getWorkerStatistics( 2 )._numPopped, 1U );
+    }
+
+    void test_wait_and_pop()
+    {
+        WorkerQueue workload( 2 );
+        std::atomic_bool shouldQuit( false );
+
+        // An idle worker is woken up by a push onto another worker's deque
+        SubQuery *popped = NULL;
+        bool result = false;
+        std::thread worker( [&] {
+                                result = workload.waitAndPop( 1, popped, shouldQuit );
+                            } );
+        workload.push( 0, createSubQuery( "1" ) );
+        worker.join();
+
+        TS_ASSERT( result );
+        TS_ASSERT( popped );
+        TS_ASSERT_EQUALS( popped->_queryId, String( "1" ) );
+        delete popped;
+        popped = NULL;
+
+        // An idle worker is woken up when solving should stop
+        std::thread idleWorker( [&] {
+                                    result = workload.waitAndPop( 1, popped, shouldQuit );
+                                } );
+        shouldQuit = true;
+        workload.notifyAll();
+        idleWorker.join();
+
+        TS_ASSERT( !result );
+        TS_ASSERT( !popped );
+
+        // Remaining work is still handed out after the quit flag is set
+        workload.push( 0, createSubQuery( "2" ) );
+        TS_ASSERT( workload.waitAndPop( 1, popped, shouldQuit ) );
+        delete popped;
+
+        // The manager returns immediately once the flag is set
+        TS_ASSERT_THROWS_NOTHING( workload.waitForQuit( shouldQuit, 0 ) );
+    }
+};
+
+//
+// Local Variables:
+// compile-command: "make -C ../../.. "
+// tags-file-name: "../../../TAGS"
+// c-basic-offset: 4
+// End:
+//
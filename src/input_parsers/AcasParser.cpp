@@ -18,6 +18,7 @@
 #include "InputParserError.h"
 #include "InputQuery.h"
 #include "MString.h"
+#include "NetworkLevelReasoner.h"
 #include "ReluConstraint.h"
 
 AcasParser::NodeIndex::NodeIndex( unsigned layer, unsigned node )
@@ -145,6 +146,7 @@ void AcasParser::generateQuery( InputQuery &inputQuery )
     }
 
     // Add the ReLU constraints
+    List<PiecewiseLinearConstraint *> relus;
     for ( unsigned i = 1; i < numberOfLayers - 1; ++i )
     {
         unsigned currentLayerSize = _acasNeuralNetwork.getLayerSize( i );
@@ -156,6 +158,7 @@ void AcasParser::generateQuery( InputQuery &inputQuery )
             PiecewiseLinearConstraint *relu = new ReluConstraint( b, f );
 
             inputQuery.addPiecewiseLinearConstraint( relu );
+            relus.append( relu );
         }
     }
 
@@ -165,6 +168,82 @@ void AcasParser::generateQuery( InputQuery &inputQuery )
 
     for ( unsigned i = 0; i < outputLayerSize; ++i )
         inputQuery.markOutputVariable( _nodeToB[NodeIndex( numberOfLayers - 1, i )], i );
+
+    // Finally, hand over the network's topology
+    inputQuery.setNetworkLevelReasoner( generateNetworkLevelReasoner( inputQuery, relus ) );
+}
+
+NLR::NetworkLevelReasoner *AcasParser::generateNetworkLevelReasoner( const InputQuery &inputQuery,
+                                                                    const List<PiecewiseLinearConstraint *> &relus )
+{
+    NLR::NetworkLevelReasoner *nlr = new NLR::NetworkLevelReasoner;
+
+    /*
+      Each internal layer of the network becomes a weighted sum layer
+      over the F variables of the previous layer, followed by a ReLU
+      layer. The output layer is a weighted sum layer.
+    */
+    unsigned numberOfLayers = _acasNeuralNetwork.getNumLayers() + 1;
+
+    nlr->addLayer( 0, NLR::Layer::INPUT, _acasNeuralNetwork.getLayerSize( 0 ) );
+    for ( unsigned j = 0; j < _acasNeuralNetwork.getLayerSize( 0 ); ++j )
+        nlr->setNeuronVariable( NLR::NeuronIndex( 0, j ), _nodeToF.get( NodeIndex( 0, j ) ) );
+
+    for ( unsigned layer = 1; layer < numberOfLayers; ++layer )
+    {
+        unsigned layerSize = _acasNeuralNetwork.getLayerSize( layer );
+        unsigned previousLayerSize = _acasNeuralNetwork.getLayerSize( layer - 1 );
+        unsigned sourceIndex = 2 * layer - 2;
+        unsigned weightedSumIndex = 2 * layer - 1;
+
+        nlr->addLayer( weightedSumIndex, NLR::Layer::WEIGHTED_SUM, layerSize );
+        nlr->addLayerDependency( sourceIndex, weightedSumIndex );
+
+        for ( unsigned target = 0; target < layerSize; ++target )
+        {
+            nlr->setNeuronVariable( NLR::NeuronIndex( weightedSumIndex, target ),
+                                    _nodeToB.get( NodeIndex( layer, target ) ) );
+            nlr->setBias( weightedSumIndex, target, _acasNeuralNetwork.getBias( layer, target ) );
+
+            for ( unsigned source = 0; source < previousLayerSize; ++source )
+                nlr->setWeight( sourceIndex,
+                                source,
+                                weightedSumIndex,
+                                target,
+                                _acasNeuralNetwork.getWeight( layer - 1, source, target ) );
+        }
+
+        if ( layer == numberOfLayers - 1 )
+            break;
+
+        unsigned reluIndex = 2 * layer;
+        nlr->addLayer( reluIndex, NLR::Layer::RELU, layerSize );
+        nlr->addLayerDependency( weightedSumIndex, reluIndex );
+
+        for ( unsigned j = 0; j < layerSize; ++j )
+        {
+            nlr->setNeuronVariable( NLR::NeuronIndex( reluIndex, j ),
+                                    _nodeToF.get( NodeIndex( layer, j ) ) );
+            nlr->addActivationSource( weightedSumIndex, j, reluIndex, j );
+        }
+    }
+
+    for ( const auto &relu : relus )
+        nlr->addConstraintInTopologicalOrder( relu );
+
+    // Store the initial bounds of all neurons
+    for ( unsigned i = 0; i < nlr->getNumberOfLayers(); ++i )
+    {
+        NLR::Layer *layer = nlr->getLayer( i );
+        for ( unsigned j = 0; j < layer->getSize(); ++j )
+        {
+            unsigned variable = layer->neuronToVariable( j );
+            layer->setLb( j, inputQuery.getLowerBound( variable ) );
+            layer->setUb( j, inputQuery.getUpperBound( variable ) );
+        }
+    }
+
+    return nlr;
 }
 
 unsigned AcasParser::getNumInputVaribales() const
@@ -17,11 +17,17 @@
 #define __AcasParser_h__
 
 #include "AcasNeuralNetwork.h"
+#include "List.h"
 #include "Map.h"
 
 class InputQuery;
+class PiecewiseLinearConstraint;
 class String;
 
+namespace NLR {
+class NetworkLevelReasoner;
+}
+
 class AcasParser
 {
 public:
@@ -55,6 +61,14 @@ private:
     AcasNeuralNetwork _acasNeuralNetwork;
     Map<NodeIndex, unsigned> _nodeToB;
     Map<NodeIndex, unsigned> _nodeToF;
+
+    /*
+      Construct the network level reasoner of the query directly from
+      the network, instead of having the query rediscover the layers
+      from its equations.
+    */
+    NLR::NetworkLevelReasoner *generateNetworkLevelReasoner( const InputQuery &inputQuery,
+                                                             const List<PiecewiseLinearConstraint *> &relus );
 };
 
 #endif // __AcasParser_h__
@@ -16,6 +16,7 @@
 #include "BerkeleyParser.h"
 #include "FloatUtils.h"
 #include "InputQuery.h"
+#include "NetworkLevelReasoner.h"
 #include "ReluConstraint.h"
 
 BerkeleyParser::BerkeleyParser( const String &path )
@@ -50,6 +51,7 @@ void BerkeleyParser::generateQuery( InputQuery &inputQuery )
 
     // Declare relu pairs and set bounds
     Map<unsigned, unsigned> fToB = _berkeleyNeuralNetwork.getFToB();
+    Map<unsigned, PiecewiseLinearConstraint *> fToRelu;
     for ( const auto &it : fToB )
     {
         unsigned f = it.first;
@@ -57,6 +59,7 @@ void BerkeleyParser::generateQuery( InputQuery &inputQuery )
 
         PiecewiseLinearConstraint *relu = new ReluConstraint( b, f );
         inputQuery.addPiecewiseLinearConstraint( relu );
+        fToRelu[f] = relu;
 
         inputQuery.setLowerBound( f, 0.0 );
         inputQuery.setUpperBound( f, FloatUtils::infinity() );
@@ -86,6 +89,169 @@ void BerkeleyParser::generateQuery( InputQuery &inputQuery )
         marabouEquation.setScalar( berkeleyEquation._constant );
         inputQuery.addEquation( marabouEquation );
     }
+
+    // Mark the input and output variables
+    unsigned index = 0;
+    for ( const auto &it : inputVariables )
+        inputQuery.markInputVariable( it, index++ );
+
+    index = 0;
+    for ( const auto &it : _berkeleyNeuralNetwork.getOutputVariables() )
+        inputQuery.markOutputVariable( it, index++ );
+
+    // Finally, hand over the network's topology, if it is layered
+    NLR::NetworkLevelReasoner *nlr = generateNetworkLevelReasoner( inputQuery, fToRelu );
+    if ( nlr )
+        inputQuery.setNetworkLevelReasoner( nlr );
+}
+
+bool BerkeleyParser::computeDepth( unsigned variable,
+                                   const Map<unsigned, const BerkeleyNeuralNetwork::Equation *> &lhsToEquation,
+                                   const Map<unsigned, unsigned> &fToB,
+                                   Map<unsigned, unsigned> &variableToDepth,
+                                   Set<unsigned> &visited ) const
+{
+    if ( variableToDepth.exists( variable ) )
+        return true;
+
+    // A variable that is neither an input nor defined, or a cycle
+    if ( visited.exists( variable ) )
+        return false;
+    visited.insert( variable );
+
+    unsigned depth = 0;
+    if ( fToB.exists( variable ) )
+    {
+        unsigned b = fToB.get( variable );
+        if ( !computeDepth( b, lhsToEquation, fToB, variableToDepth, visited ) )
+            return false;
+
+        depth = variableToDepth[b] + 1;
+    }
+    else if ( lhsToEquation.exists( variable ) )
+    {
+        for ( const auto &rhs : lhsToEquation.get( variable )->_rhs )
+        {
+            if ( !computeDepth( rhs._var, lhsToEquation, fToB, variableToDepth, visited ) )
+                return false;
+
+            if ( variableToDepth[rhs._var] + 1 > depth )
+                depth = variableToDepth[rhs._var] + 1;
+        }
+    }
+    else
+        return false;
+
+    variableToDepth[variable] = depth;
+    return true;
+}
+
+NLR::NetworkLevelReasoner *BerkeleyParser::generateNetworkLevelReasoner( const InputQuery &inputQuery,
+                                                                        const Map<unsigned, PiecewiseLinearConstraint *> &fToRelu ) const
+{
+    Map<unsigned, unsigned> fToB = _berkeleyNeuralNetwork.getFToB();
+    List<BerkeleyNeuralNetwork::Equation> equations = _berkeleyNeuralNetwork.getEquations();
+
+    Map<unsigned, const BerkeleyNeuralNetwork::Equation *> lhsToEquation;
+    for ( const auto &equation : equations )
+        lhsToEquation[equation._lhs] = &equation;
+
+    /*
+      Place each neuron one layer after the last of its sources. The
+      network is layered if the layers alternate between weighted sums
+      (odd depths) and ReLUs (even depths). Otherwise, the query is left
+      without a network level reasoner, and one can be constructed from
+      its equations.
+    */
+    Map<unsigned, unsigned> variableToDepth;
+    Map<unsigned, List<unsigned>> depthToVariables;
+    for ( const auto &input : _berkeleyNeuralNetwork.getInputVariables() )
+    {
+        variableToDepth[input] = 0;
+        depthToVariables[0].append( input );
+    }
+
+    Set<unsigned> visited;
+    for ( const auto &equation : equations )
+    {
+        if ( !computeDepth( equation._lhs, lhsToEquation, fToB, variableToDepth, visited ) ||
+             variableToDepth[equation._lhs] % 2 != 1 )
+            return NULL;
+
+        depthToVariables[variableToDepth[equation._lhs]].append( equation._lhs );
+    }
+
+    for ( const auto &it : fToB )
+    {
+        if ( !computeDepth( it.first, lhsToEquation, fToB, variableToDepth, visited ) ||
+             variableToDepth[it.first] % 2 != 0 )
+            return NULL;
+
+        depthToVariables[variableToDepth[it.first]].append( it.first );
+    }
+
+    unsigned numberOfLayers = depthToVariables.size();
+    for ( unsigned i = 0; i < numberOfLayers; ++i )
+    {
+        if ( !depthToVariables.exists( i ) )
+            return NULL;
+    }
+
+    NLR::NetworkLevelReasoner *nlr = new NLR::NetworkLevelReasoner;
+    for ( unsigned i = 0; i < numberOfLayers; ++i )
+    {
+        NLR::Layer::Type type = ( i == 0 ) ? NLR::Layer::INPUT :
+            ( i % 2 == 1 ) ? NLR::Layer::WEIGHTED_SUM : NLR::Layer::RELU;
+        nlr->addLayer( i, type, depthToVariables[i].size() );
+
+        NLR::Layer *layer = nlr->getLayer( i );
+        unsigned neuron = 0;
+        for ( const auto &variable : depthToVariables[i] )
+        {
+            nlr->setNeuronVariable( NLR::NeuronIndex( i, neuron ), variable );
+            layer->setLb( neuron, inputQuery.getLowerBound( variable ) );
+            layer->setUb( neuron, inputQuery.getUpperBound( variable ) );
+            ++neuron;
+        }
+    }
+
+    // The weighted sums: y = x1 + x2 + x3 + c
+    for ( const auto &equation : equations )
+    {
+        unsigned targetLayer = variableToDepth[equation._lhs];
+        unsigned targetNeuron = nlr->getLayer( targetLayer )->variableToNeuron( equation._lhs );
+
+        nlr->setBias( targetLayer, targetNeuron, equation._constant );
+        for ( const auto &rhs : equation._rhs )
+        {
+            unsigned sourceLayer = variableToDepth[rhs._var];
+            unsigned sourceNeuron = nlr->getLayer( sourceLayer )->variableToNeuron( rhs._var );
+
+            nlr->addLayerDependency( sourceLayer, targetLayer );
+            nlr->setWeight( sourceLayer, sourceNeuron, targetLayer, targetNeuron, rhs._coefficient );
+        }
+    }
+
+    // The ReLUs, in topological order
+    for ( unsigned i = 2; i < numberOfLayers; i += 2 )
+    {
+        unsigned neuron = 0;
+        for ( const auto &f : depthToVariables[i] )
+        {
+            unsigned b = fToB[f];
+            unsigned sourceLayer = variableToDepth[b];
+
+            nlr->addLayerDependency( sourceLayer, i );
+            nlr->addActivationSource( sourceLayer,
+                                      nlr->getLayer( sourceLayer )->variableToNeuron( b ),
+                                      i,
+                                      neuron );
+            nlr->addConstraintInTopologicalOrder( fToRelu.get( f ) );
+            ++neuron;
+        }
+    }
+
+    return nlr;
 }
 
 Set<unsigned> BerkeleyParser::getOutputVariables() const
@@ -22,8 +22,13 @@
 
 class Equation;
 class InputQuery;
+class PiecewiseLinearConstraint;
 class String;
 
+namespace NLR {
+class NetworkLevelReasoner;
+}
+
 class BerkeleyParser
 {
 public:
@@ -53,6 +58,24 @@ private:
 
     void addAuxiliaryEquations( List<Equation> &auxiliaryEquations );
     void addAuxiliaryEquation( unsigned xf, unsigned xb, List<Equation> &auxiliaryEquations );
+
+    /*
+      Construct the network level reasoner of the query directly from
+      the network. Return NULL if the network is not made of
+      alternating weighted sum and ReLU layers.
+    */
+    NLR::NetworkLevelReasoner *generateNetworkLevelReasoner( const InputQuery &inputQuery,
+                                                             const Map<unsigned, PiecewiseLinearConstraint *> &fToRelu ) const;
+
+    /*
+      Compute the depth of a variable in the network: 0 for inputs, and
+      one more than the deepest of its sources otherwise.
+    */
+    bool computeDepth( unsigned variable,
+                       const Map<unsigned, const BerkeleyNeuralNetwork::Equation *> &lhsToEquation,
+                       const Map<unsigned, unsigned> &fToB,
+                       Map<unsigned, unsigned> &variableToDepth,
+                       Set<unsigned> &visited ) const;
 };
 
 #endif // __BerkeleyParser_h__
@@ -33,14 +33,9 @@
 
 namespace NLR {
 
-DeepPolyAnalysis::DeepPolyAnalysis( LayerOwner *layerOwner )
+DeepPolyAnalysis::DeepPolyAnalysis( LayerOwner *layerOwner, ThreadPool *threadPool )
     : _layerOwner( layerOwner )
-    , _work1SymbolicLb( NULL )
-    , _work1SymbolicUb( NULL )
-    , _work2SymbolicLb( NULL )
-    , _work2SymbolicUb( NULL )
-    , _workSymbolicLowerBias( NULL )
-    , _workSymbolicUpperBias( NULL )
+    , _threadPool( threadPool )
 {
     const Map<unsigned, Layer *> &layers = _layerOwner->getLayerIndexToLayer();
     allocateMemory( layers );
@@ -71,39 +66,17 @@ void DeepPolyAnalysis::freeMemoryIfNeeded()
         if ( pair.second )
             delete pair.second;
     }
-    if ( _work1SymbolicLb )
-    {
-        delete[] _work1SymbolicLb;
-        _work1SymbolicLb = NULL;
-    }
-    if ( _work2SymbolicLb )
-    {
-        delete[] _work2SymbolicLb;
-        _work2SymbolicLb = NULL;
-    }
-    if ( _work1SymbolicUb )
-    {
-        delete[] _work1SymbolicUb;
-        _work1SymbolicUb = NULL;
-    }
-    if ( _work2SymbolicUb )
-    {
-        delete[] _work2SymbolicUb;
-        _work2SymbolicUb = NULL;
-    }
-    if ( _workSymbolicLowerBias )
-    {
-        delete[] _workSymbolicLowerBias;
-        _workSymbolicLowerBias = NULL;
-    }
-    if ( _workSymbolicUpperBias )
+    _deepPolyElements.clear();
+
+    for ( auto &workingMemory : _workingMemory )
     {
-        delete[] _workSymbolicUpperBias;
-        _workSymbolicUpperBias = NULL;
+        delete workingMemory;
+        workingMemory = NULL;
     }
+    _workingMemory.clear();
 }
 
-void DeepPolyAnalysis::run()
+void DeepPolyAnalysis::run( unsigned firstLayer )
 {
     struct timespec deepPolyStart;
     (void) deepPolyStart;
@@ -113,6 +86,11 @@ void DeepPolyAnalysis::run()
     deepPolyStart = TimeUtils::sampleMicro();
 
     const Map<unsigned, Layer *> &layers = _layerOwner->getLayerIndexToLayer();
+
+    // The weights are read concurrently during back-substitution
+    for ( const auto &pair : layers )
+        pair.second->updateWeightRepresentations();
+
     for ( const auto &pair : layers )
     {
         /*
@@ -122,6 +100,9 @@ void DeepPolyAnalysis::run()
         unsigned index = pair.first;
         Layer *layer = pair.second;
 
+        if ( index < firstLayer )
+            continue;
+
         ASSERT( _deepPolyElements.exists( index ) );
         log( Stringf( "Running deeppoly analysis for layer %u...", index ) );
         DeepPolyElement *deepPolyElement = _deepPolyElements[index];
@@ -170,21 +151,11 @@ void DeepPolyAnalysis::allocateMemory( const Map<unsigned, Layer *> &layers )
             maxLayerSize = thisLayerSize;
     }
 
-   _work1SymbolicLb= new double[maxLayerSize * maxLayerSize];
-   _work1SymbolicUb= new double[maxLayerSize * maxLayerSize];
-   _work2SymbolicLb= new double[maxLayerSize * maxLayerSize];
-   _work2SymbolicUb= new double[maxLayerSize * maxLayerSize];
-
-   _workSymbolicLowerBias = new double[maxLayerSize];
-   _workSymbolicUpperBias = new double[maxLayerSize];
-
-   std::fill_n( _work1SymbolicLb, maxLayerSize * maxLayerSize, 0 );
-   std::fill_n( _work1SymbolicUb, maxLayerSize * maxLayerSize, 0 );
-   std::fill_n( _work2SymbolicLb, maxLayerSize * maxLayerSize, 0 );
-   std::fill_n( _work2SymbolicUb, maxLayerSize * maxLayerSize, 0 );
-
-   std::fill_n( _workSymbolicLowerBias, maxLayerSize, 0 );
-   std::fill_n( _workSymbolicUpperBias, maxLayerSize, 0 );
+    unsigned numThreads = _threadPool ? _threadPool->getNumThreads() : 1;
+    unsigned capacity =
+        DeepPolyWeightedSumElement::getRangeSize( maxLayerSize, numThreads );
+    for ( unsigned i = 0; i < numThreads; ++i )
+        _workingMemory.append( new DeepPolyWorkingMemory( maxLayerSize, capacity ) );
 }
 
 DeepPolyElement *DeepPolyAnalysis::createDeepPolyElement( Layer *layer )
@@ -197,10 +168,7 @@ DeepPolyElement *DeepPolyAnalysis::createDeepPolyElement( Layer *layer )
     {
         deepPolyElement = new DeepPolyWeightedSumElement( layer );
         // Weighted sum layers need working memory for back substitution
-        deepPolyElement->setWorkingMemory( _work1SymbolicLb, _work1SymbolicUb,
-                                           _work2SymbolicLb, _work2SymbolicUb,
-                                           _workSymbolicLowerBias,
-                                           _workSymbolicUpperBias );
+        deepPolyElement->setWorkingMemory( &_workingMemory, _threadPool );
     }
     else if ( type ==  Layer::RELU )
         deepPolyElement = new DeepPolyReLUElement( layer );
@@ -20,6 +20,8 @@
 #include "Layer.h"
 #include "LayerOwner.h"
 #include "Map.h"
+#include "ThreadPool.h"
+#include "Vector.h"
 #include <climits>
 
 namespace NLR {
@@ -28,10 +30,19 @@ class DeepPolyAnalysis
 {
 public:
 
-    DeepPolyAnalysis( LayerOwner *layerOwner );
+    /*
+      If a thread pool is given, the neurons of each weighted sum layer
+      are split among its threads
+    */
+    DeepPolyAnalysis( LayerOwner *layerOwner, ThreadPool *threadPool = NULL );
     ~DeepPolyAnalysis();
 
-    void run();
+    /*
+      Execute the abstract elements of the layers from firstLayer on.
+      The elements of the layers before it keep the results of the
+      previous run, which must still be valid.
+    */
+    void run( unsigned firstLayer = 0 );
 
 private:
     LayerOwner *_layerOwner;
@@ -41,15 +52,12 @@ private:
     */
     Map<unsigned, DeepPolyElement *> _deepPolyElements;
 
+    ThreadPool *_threadPool;
+
     /*
-      Working memory for the abstract elements to execute
+      Working memory for the abstract elements to execute, one per thread
     */
-    double * _work1SymbolicLb;
-    double * _work1SymbolicUb;
-    double * _work2SymbolicLb;
-    double * _work2SymbolicUb;
-    double * _workSymbolicLowerBias;
-    double * _workSymbolicUpperBias;
+    Vector<DeepPolyWorkingMemory *> _workingMemory;
 
     void allocateMemory( const Map<unsigned, Layer *> &layers );
     void freeMemoryIfNeeded();
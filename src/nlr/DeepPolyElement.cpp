@@ -27,12 +27,8 @@ DeepPolyElement::DeepPolyElement()
     , _symbolicUpperBias( NULL )
     , _lb( NULL )
     , _ub( NULL )
-    , _work1SymbolicLb( NULL )
-    , _work1SymbolicUb( NULL )
-    , _work2SymbolicLb( NULL )
-    , _work2SymbolicUb( NULL )
-    , _workSymbolicLowerBias( NULL )
-    , _workSymbolicUpperBias( NULL )
+    , _workingMemory( NULL )
+    , _threadPool( NULL )
 {};
 
 unsigned DeepPolyElement::getSize() const
@@ -137,19 +133,11 @@ void DeepPolyElement::freeMemoryIfNeeded()
     }
 }
 
-void DeepPolyElement::setWorkingMemory( double *work1SymbolicLb,
-                                        double *work1SymbolicUb,
-                                        double *work2SymbolicLb,
-                                        double *work2SymbolicUb,
-                                        double *workSymbolicLowerBias,
-                                        double *workSymbolicUpperBias )
+void DeepPolyElement::setWorkingMemory( const Vector<DeepPolyWorkingMemory *>
+                                        *workingMemory, ThreadPool *threadPool )
 {
-    _work1SymbolicLb = work1SymbolicLb;
-    _work1SymbolicUb = work1SymbolicUb;
-    _work2SymbolicLb = work2SymbolicLb;
-    _work2SymbolicUb = work2SymbolicUb;
-    _workSymbolicLowerBias = workSymbolicLowerBias;
-    _workSymbolicUpperBias = workSymbolicUpperBias;
+    _workingMemory = workingMemory;
+    _threadPool = threadPool;
 }
 
 } // namespace NLR
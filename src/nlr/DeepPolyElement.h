@@ -16,10 +16,13 @@
 #ifndef __DeepPolyElement_h__
 #define __DeepPolyElement_h__
 
+#include "DeepPolyWorkingMemory.h"
 #include "Layer.h"
 #include "Map.h"
 #include "MStringf.h"
 #include "NLRError.h"
+#include "ThreadPool.h"
+#include "Vector.h"
 #include <climits>
 
 namespace NLR {
@@ -66,10 +69,12 @@ public:
     double getLowerBound( unsigned index ) const;
     double getUpperBound( unsigned index ) const;
 
-    void setWorkingMemory( double *work1SymbolicLb, double *work1SymbolicUb,
-                           double *work2SymbolicLb, double *work2SymbolicUb,
-                           double *workSymbolicLowerBias,
-                           double *workSymbolicUpperBias );
+    /*
+      Elements that back-substitute use one working memory per thread of
+      the given pool, or only the first one if there is no pool.
+    */
+    void setWorkingMemory( const Vector<DeepPolyWorkingMemory *> *workingMemory,
+                           ThreadPool *threadPool );
 
     double getLowerBoundFromLayer( unsigned index ) const;
     double getUpperBoundFromLayer( unsigned index ) const;
@@ -91,12 +96,8 @@ protected:
     double *_lb;
     double *_ub;
 
-    double * _work1SymbolicLb;
-    double * _work1SymbolicUb;
-    double * _work2SymbolicLb;
-    double * _work2SymbolicUb;
-    double * _workSymbolicLowerBias;
-    double * _workSymbolicUpperBias;
+    const Vector<DeepPolyWorkingMemory *> *_workingMemory;
+    ThreadPool *_threadPool;
 
     void allocateMemory();
     void freeMemoryIfNeeded();
@@ -15,6 +15,7 @@
 
 #include "DeepPolyReLUElement.h"
 #include "FloatUtils.h"
+#include "SimdKernels.h"
 
 namespace NLR {
 
@@ -156,38 +157,27 @@ void DeepPolyReLUElement::symbolicBoundInTermsOfPredecessor
         double lowerBias = _symbolicLowerBias[i];
         double upperBias = _symbolicUpperBias[i];
 
-        // Substitute the ReLU input for the ReLU output
-        for ( unsigned j = 0; j < targetLayerSize; ++j )
-        {
-            // The symbolic lower- and upper- bounds of the j-th neuron in the
-            // target layer are ... + weightLb * f_i + ...
-            // and ... + weightUb * f_i + ..., respectively.
-            unsigned index = i * targetLayerSize + j;
-
-            // Update the symbolic lower bound
-            double weightLb = symbolicLb[index];
-            if ( weightLb >= 0 )
-            {
-                symbolicLbInTermsOfPredecessor[index] += weightLb * coeffLb;
-                symbolicLowerBias[j] += weightLb * lowerBias;
-            } else
-            {
-                symbolicLbInTermsOfPredecessor[index] += weightLb * coeffUb;
-                symbolicLowerBias[j] += weightLb * upperBias;
-            }
-
-            // Update the symbolic upper bound
-            double weightUb = symbolicUb[index];
-            if ( weightUb >= 0 )
-            {
-                symbolicUbInTermsOfPredecessor[index] += weightUb * coeffUb;
-                symbolicUpperBias[j] += weightUb * upperBias;
-            } else
-            {
-                symbolicUbInTermsOfPredecessor[index] += weightUb * coeffLb;
-                symbolicUpperBias[j] += weightUb * lowerBias;
-            }
-        }
+        // Substitute the ReLU input for the ReLU output. The symbolic
+        // lower- and upper- bounds of the j-th neuron in the target layer
+        // are ... + symbolicLb[i][j] * f_i + ... and
+        // ... + symbolicUb[i][j] * f_i + ..., respectively.
+        unsigned rowStart = i * targetLayerSize;
+
+        // Update the symbolic lower bound
+        SimdKernels::addSignedScaled( symbolicLb + rowStart, coeffLb, coeffUb,
+                                      symbolicLbInTermsOfPredecessor + rowStart,
+                                      targetLayerSize );
+        if ( symbolicLowerBias )
+            SimdKernels::addSignedScaled( symbolicLb + rowStart, lowerBias, upperBias,
+                                          symbolicLowerBias, targetLayerSize );
+
+        // Update the symbolic upper bound
+        SimdKernels::addSignedScaled( symbolicUb + rowStart, coeffUb, coeffLb,
+                                      symbolicUbInTermsOfPredecessor + rowStart,
+                                      targetLayerSize );
+        if ( symbolicUpperBias )
+            SimdKernels::addSignedScaled( symbolicUb + rowStart, upperBias, lowerBias,
+                                          symbolicUpperBias, targetLayerSize );
     }
 }
 
@@ -15,14 +15,14 @@
 
 #include "DeepPolyWeightedSumElement.h"
 #include "FloatUtils.h"
+#include "GlobalConfiguration.h"
+#include "SimdKernels.h"
 
 #include <string.h>
 
 namespace NLR {
 
 DeepPolyWeightedSumElement::DeepPolyWeightedSumElement( Layer *layer )
-    : _workLb( NULL )
-    , _workUb( NULL )
 {
     _layer = layer;
     _size = layer->getSize();
@@ -39,17 +39,67 @@ void DeepPolyWeightedSumElement::execute
 {
     log( "Executing..." );
     ASSERT( hasPredecessor() );
+    ASSERT( _workingMemory && !_workingMemory->empty() );
     allocateMemory();
     getConcreteBounds();
-    // Compute bounds with back-substitution
-    computeBoundWithBackSubstitution( deepPolyElementsBefore );
+
+    // Compute bounds with back-substitution. The neurons of this layer are
+    // independent, so they are split into ranges that are handled by
+    // separate jobs.
+    unsigned rangeSize = getRangeSize( _size, _workingMemory->size() );
+    unsigned numJobs = ( _size + rangeSize - 1 ) / rangeSize;
+
+    ThreadPool::Job job = [&]( unsigned jobIndex, unsigned threadIndex )
+        {
+            unsigned begin = jobIndex * rangeSize;
+            unsigned end = std::min( begin + rangeSize, _size );
+            computeBoundWithBackSubstitution( deepPolyElementsBefore, begin,
+                                              end - begin,
+                                              *_workingMemory->get( threadIndex ) );
+        };
+
+    if ( _threadPool && numJobs > 1 )
+        _threadPool->parallelFor( numJobs, job );
+    else
+    {
+        for ( unsigned i = 0; i < numJobs; ++i )
+            job( i, 0 );
+    }
+
     log( "Executing - done" );
 }
 
+unsigned DeepPolyWeightedSumElement::getRangeSize( unsigned layerSize, unsigned numThreads )
+{
+    unsigned rangeSize = ( layerSize + numThreads - 1 ) / numThreads;
+    rangeSize = std::max( rangeSize, GlobalConfiguration::DEEPPOLY_MIN_NEURONS_PER_JOB );
+    return std::max( 1u, std::min( rangeSize, layerSize ) );
+}
+
+void DeepPolyWeightedSumElement::copyWeights( unsigned predecessorIndex,
+                                              unsigned predecessorSize,
+                                              unsigned begin,
+                                              unsigned rangeSize,
+                                              double *target )
+{
+    const double *weights = _layer->getWeights( predecessorIndex );
+    if ( rangeSize == _size )
+    {
+        memcpy( target, weights, _size * predecessorSize * sizeof(double) );
+        return;
+    }
+
+    for ( unsigned i = 0; i < predecessorSize; ++i )
+        memcpy( target + i * rangeSize, weights + i * _size + begin,
+                rangeSize * sizeof(double) );
+}
+
 void DeepPolyWeightedSumElement::computeBoundWithBackSubstitution
-( const Map<unsigned, DeepPolyElement *> &deepPolyElementsBefore )
+( const Map<unsigned, DeepPolyElement *> &deepPolyElementsBefore,
+  unsigned begin, unsigned rangeSize, DeepPolyWorkingMemory &memory )
 {
-    log( "Computing bounds with back substitution..." );
+    log( Stringf( "Computing bounds of neurons %u-%u with back substitution...",
+                  begin, begin + rangeSize - 1 ) );
 
     // Start with the symbolic upper-/lower- bounds of this layer with
     // respect to its immediate predecessor.
@@ -58,6 +108,7 @@ void DeepPolyWeightedSumElement::computeBoundWithBackSubstitution
     unsigned counter = 0;
     unsigned numPredecessors = predecessorIndices.size();
     ASSERT( numPredecessors > 0 );
+    ASSERT( rangeSize <= memory._capacity );
     // # The invariant we are maintaining:
     // thisLayer <= ( residualUb * residualLayer for each residualLayer ) +
     //                _work1SymbolicUb * currentElement + _workSymbolicUpperBias;
@@ -72,12 +123,11 @@ void DeepPolyWeightedSumElement::computeBoundWithBackSubstitution
         {
             log( Stringf( "Adding residual from layer %u...",
                           predecessorIndex ) );
-            allocateMemoryForResidualsIfNeeded( predecessorIndex, pair.second );
-            const double *weights = _layer->getWeights( predecessorIndex );
-            memcpy( _residualLb[predecessorIndex], weights,
-                    _size * pair.second * sizeof(double) );
-            memcpy( _residualUb[predecessorIndex], weights,
-                    _size * pair.second * sizeof(double) );
+            memory.addResidualLayer( predecessorIndex, pair.second, rangeSize );
+            copyWeights( predecessorIndex, pair.second, begin, rangeSize,
+                         memory._residualLb[predecessorIndex] );
+            copyWeights( predecessorIndex, pair.second, begin, rangeSize,
+                         memory._residualUb[predecessorIndex] );
             ++counter;
             log( Stringf( "Adding residual from layer %u - done", pair.first ) );
         }
@@ -89,21 +139,21 @@ void DeepPolyWeightedSumElement::computeBoundWithBackSubstitution
         deepPolyElementsBefore[predecessorIndex];
     unsigned sourceLayerSize = precedingElement->getSize();
 
-    const double *weights = _layer->getWeights( predecessorIndex );
-    memcpy( _work1SymbolicLb,
-            weights, _size * sourceLayerSize * sizeof(double) );
-    memcpy( _work1SymbolicUb,
-            weights, _size * sourceLayerSize * sizeof(double) );
+    copyWeights( predecessorIndex, sourceLayerSize, begin, rangeSize,
+                 memory._work1SymbolicLb );
+    copyWeights( predecessorIndex, sourceLayerSize, begin, rangeSize,
+                 memory._work1SymbolicUb );
 
     double *bias = _layer->getBiases();
-    memcpy( _workSymbolicLowerBias, bias, _size * sizeof(double) );
-    memcpy( _workSymbolicUpperBias, bias, _size * sizeof(double) );
+    memcpy( memory._workSymbolicLowerBias, bias + begin, rangeSize * sizeof(double) );
+    memcpy( memory._workSymbolicUpperBias, bias + begin, rangeSize * sizeof(double) );
 
     DeepPolyElement *currentElement = precedingElement;
-    concretizeSymbolicBound( _work1SymbolicLb, _work1SymbolicUb,
-                             _workSymbolicLowerBias,
-                             _workSymbolicUpperBias,
-                             currentElement, deepPolyElementsBefore );
+    concretizeSymbolicBound( memory._work1SymbolicLb, memory._work1SymbolicUb,
+                             memory._workSymbolicLowerBias,
+                             memory._workSymbolicUpperBias,
+                             currentElement, deepPolyElementsBefore,
+                             begin, rangeSize, memory );
     log( Stringf( "Computing symbolic bounds with respect to layer %u - done",
                   predecessorIndex ) );
 
@@ -128,107 +178,107 @@ void DeepPolyWeightedSumElement::computeBoundWithBackSubstitution
                 unsigned predecessorIndex = pair.first;
                 log( Stringf( "Adding residual from layer %u...",
                               predecessorIndex ) );
-                allocateMemoryForResidualsIfNeeded( predecessorIndex,
-                                                    pair.second );
+                memory.addResidualLayer( predecessorIndex, pair.second, rangeSize );
                 // Do we need to add bias here?
                 currentElement->symbolicBoundInTermsOfPredecessor
-                    ( _work1SymbolicLb, _work1SymbolicUb, NULL, NULL,
-                      _residualLb[predecessorIndex],
-                      _residualUb[predecessorIndex],
-                      _size, precedingElement );
+                    ( memory._work1SymbolicLb, memory._work1SymbolicUb, NULL, NULL,
+                      memory._residualLb[predecessorIndex],
+                      memory._residualUb[predecessorIndex],
+                      rangeSize, precedingElement );
                 ++counter;
                 log( Stringf( "Adding residual from layer %u - done", pair.first ) );
             }
         }
 
-        std::fill_n( _work2SymbolicLb, _size * precedingElement->getSize(), 0 );
-        std::fill_n( _work2SymbolicUb, _size * precedingElement->getSize(), 0 );
+        std::fill_n( memory._work2SymbolicLb, rangeSize * precedingElement->getSize(), 0 );
+        std::fill_n( memory._work2SymbolicUb, rangeSize * precedingElement->getSize(), 0 );
         currentElement->symbolicBoundInTermsOfPredecessor
-            ( _work1SymbolicLb, _work1SymbolicUb, _workSymbolicLowerBias,
-              _workSymbolicUpperBias, _work2SymbolicLb, _work2SymbolicUb,
-              _size, precedingElement );
+            ( memory._work1SymbolicLb, memory._work1SymbolicUb,
+              memory._workSymbolicLowerBias, memory._workSymbolicUpperBias,
+              memory._work2SymbolicLb, memory._work2SymbolicUb,
+              rangeSize, precedingElement );
 
         // The symbolic lower-bound is
         // _work2SymbolicLb * precedingElement + residualLb1 * residualElement1 +
         // residualLb2 * residualElement2 + ...
         // If the precedingElement is a residual source layer, we can merge
         // in the residualWeights, and remove it from the residual source layers.
-        if ( _residualLayerIndices.exists( predecessorIndex ) )
+        if ( memory._residualLayerIndices.exists( predecessorIndex ) )
         {
             log( Stringf( "merge residual from layer %u...", predecessorIndex ) );
             // Add weights of this residual layer
-            for ( unsigned i = 0; i < _size * precedingElement->getSize(); ++i )
+            double *residualLb = memory._residualLb[predecessorIndex];
+            double *residualUb = memory._residualUb[predecessorIndex];
+            for ( unsigned i = 0; i < rangeSize * precedingElement->getSize(); ++i )
             {
-                _work2SymbolicLb[i] += _residualLb[predecessorIndex][i];
-                _work2SymbolicUb[i] += _residualUb[predecessorIndex][i];
+                memory._work2SymbolicLb[i] += residualLb[i];
+                memory._work2SymbolicUb[i] += residualUb[i];
             }
-            _residualLayerIndices.erase( predecessorIndex );
-            std::fill_n( _residualLb[predecessorIndex],
-                         _size * precedingElement->getSize(), 0 );
-            std::fill_n( _residualUb[predecessorIndex],
-                         _size * precedingElement->getSize(), 0 );
+            memory._residualLayerIndices.erase( predecessorIndex );
             log( Stringf( "merge residual from layer %u - done", predecessorIndex ) );
         }
 
         DEBUG({
                 // Residual layers topologically after precedingElement should
                 // have been merged already.
-                for ( const auto &residualLayerIndex : _residualLayerIndices )
+                for ( const auto &residualLayerIndex : memory._residualLayerIndices )
                 {
                     ASSERT( residualLayerIndex < predecessorIndex );
                 }
             });
 
-        double *temp = _work1SymbolicLb;
-        _work1SymbolicLb = _work2SymbolicLb;
-        _work2SymbolicLb = temp;
-
-        temp = _work1SymbolicUb;
-        _work1SymbolicUb = _work2SymbolicUb;
-        _work2SymbolicUb = temp;
+        std::swap( memory._work1SymbolicLb, memory._work2SymbolicLb );
+        std::swap( memory._work1SymbolicUb, memory._work2SymbolicUb );
 
         currentElement = precedingElement;
-        concretizeSymbolicBound( _work1SymbolicLb, _work1SymbolicUb,
-                                 _workSymbolicLowerBias, _workSymbolicUpperBias,
-                                 currentElement, deepPolyElementsBefore );
+        concretizeSymbolicBound( memory._work1SymbolicLb, memory._work1SymbolicUb,
+                                 memory._workSymbolicLowerBias,
+                                 memory._workSymbolicUpperBias,
+                                 currentElement, deepPolyElementsBefore,
+                                 begin, rangeSize, memory );
     }
-    ASSERT( _residualLayerIndices.empty() );
-    log( "Computing bounds with back substitution - done" );
+    ASSERT( memory._residualLayerIndices.empty() );
+    log( Stringf( "Computing bounds of neurons %u-%u with back substitution - done",
+                  begin, begin + rangeSize - 1 ) );
 }
 
 void DeepPolyWeightedSumElement::concretizeSymbolicBound
 ( const double *symbolicLb, const double*symbolicUb, double const
   *symbolicLowerBias, const double *symbolicUpperBias, DeepPolyElement
   *sourceElement, const Map<unsigned, DeepPolyElement *>
-  &deepPolyElementsBefore )
+  &deepPolyElementsBefore, unsigned begin, unsigned rangeSize,
+  DeepPolyWorkingMemory &memory )
 {
     log( "Concretizing bound..." );
-    std::fill_n( _workLb, _size, 0 );
-    std::fill_n( _workUb, _size, 0 );
+    std::fill_n( memory._workLb, rangeSize, 0 );
+    std::fill_n( memory._workUb, rangeSize, 0 );
 
     concretizeSymbolicBoundForSourceLayer( symbolicLb, symbolicUb,
                                            symbolicLowerBias, symbolicUpperBias,
-                                           sourceElement );
+                                           sourceElement, rangeSize, memory );
 
-    for ( const auto &residualLayerIndex : _residualLayerIndices )
+    for ( const auto &residualLayerIndex : memory._residualLayerIndices )
     {
         ASSERT( residualLayerIndex < sourceElement->getLayerIndex() );
         DeepPolyElement *residualElement =
             deepPolyElementsBefore[residualLayerIndex];
-        concretizeSymbolicBoundForSourceLayer( _residualLb[residualLayerIndex],
-                                               _residualUb[residualLayerIndex],
+        concretizeSymbolicBoundForSourceLayer( memory._residualLb[residualLayerIndex],
+                                               memory._residualUb[residualLayerIndex],
                                                NULL,
                                                NULL,
-                                               residualElement );
+                                               residualElement,
+                                               rangeSize, memory );
     }
-    for ( unsigned i = 0; i <_size; ++i )
+    for ( unsigned i = 0; i < rangeSize; ++i )
     {
-        if ( _lb[i] < _workLb[i] )
-            _lb[i] = _workLb[i];
-        if ( _ub[i] > _workUb[i] )
-            _ub[i] = _workUb[i];
-        log( Stringf( "Neuron%u working LB: %f, UB: %f", i, _workLb[i], _workUb[i] ) );
-        log( Stringf( "Neuron%u LB: %f, UB: %f", i, _lb[i], _ub[i] ) );
+        unsigned neuron = begin + i;
+        if ( _lb[neuron] < memory._workLb[i] )
+            _lb[neuron] = memory._workLb[i];
+        if ( _ub[neuron] > memory._workUb[i] )
+            _ub[neuron] = memory._workUb[i];
+        log( Stringf( "Neuron%u working LB: %f, UB: %f", neuron,
+                      memory._workLb[i], memory._workUb[i] ) );
+        log( Stringf( "Neuron%u LB: %f, UB: %f", neuron, _lb[neuron], _ub[neuron] ) );
     }
 
     log( "Concretizing bound - done" );
@@ -237,17 +287,17 @@ void DeepPolyWeightedSumElement::concretizeSymbolicBound
 void DeepPolyWeightedSumElement::concretizeSymbolicBoundForSourceLayer
 ( const double *symbolicLb, const double*symbolicUb, const double
   *symbolicLowerBias, const double *symbolicUpperBias, DeepPolyElement
-  *sourceElement )
+  *sourceElement, unsigned rangeSize, DeepPolyWorkingMemory &memory )
 {
     /*
     DEBUG({
             log( Stringf( "Source layer: %u", sourceElement->getLayerIndex() ) );
             String s = Stringf( "Symbolic lowerbounds w.r.t. layer %u: \n ", sourceElement->getLayerIndex() );
-            for ( unsigned i = 0; i <_size; ++i )
+            for ( unsigned i = 0; i < rangeSize; ++i )
             {
                 for ( unsigned j = 0; j < sourceElement->getSize(); ++j )
                 {
-                    s += Stringf( "%f ", symbolicLb[j * _size + i] );
+                    s += Stringf( "%f ", symbolicLb[j * rangeSize + i] );
                 }
                 s += "\n";
             }
@@ -255,18 +305,18 @@ void DeepPolyWeightedSumElement::concretizeSymbolicBoundForSourceLayer
             if ( symbolicLowerBias )
             {
                 s += Stringf( "Symbolic lower bias w.r.t. layer %u: \n ", sourceElement->getLayerIndex() );
-                for ( unsigned i = 0; i <_size; ++i )
+                for ( unsigned i = 0; i < rangeSize; ++i )
                 {
                     s += Stringf( "%f ", symbolicLowerBias[i] );
                 }
                 s += "\n";
             }
             s += Stringf( "Symbolic upperbounds w.r.t. layer %u: \n ", sourceElement->getLayerIndex() );
-            for ( unsigned i = 0; i <_size; ++i )
+            for ( unsigned i = 0; i < rangeSize; ++i )
             {
                 for ( unsigned j = 0; j < sourceElement->getSize(); ++j )
                 {
-                    s += Stringf( "%f ", symbolicUb[j * _size + i] );
+                    s += Stringf( "%f ", symbolicUb[j * rangeSize + i] );
                 }
                 s += "\n";
             }
@@ -274,7 +324,7 @@ void DeepPolyWeightedSumElement::concretizeSymbolicBoundForSourceLayer
             if ( symbolicUpperBias )
             {
                 s += Stringf( "Symbolic upper bias w.r.t. layer %u: \n ", sourceElement->getLayerIndex() );
-                for ( unsigned i = 0; i <_size; ++i )
+                for ( unsigned i = 0; i < rangeSize; ++i )
                 {
                     s += Stringf( "%f ", symbolicUpperBias[i] );
                 }
@@ -293,36 +343,21 @@ void DeepPolyWeightedSumElement::concretizeSymbolicBoundForSourceLayer
         log( Stringf( "Bounds of neuron%u_%u: [%f, %f]\n", sourceElement->
                       getLayerIndex(), i, sourceLb, sourceUb ) );
 
-        for ( unsigned j = 0; j < _size; ++j )
-        {
-            // Compute lower bound
-            double weight = symbolicLb[i * _size + j];
-            if ( weight >= 0 )
-            {
-                _workLb[j] += ( weight * sourceLb );
-            } else
-            {
-                _workLb[j] += ( weight * sourceUb );
-            }
+        // Compute lower bound
+        SimdKernels::addSignedScaled( symbolicLb + i * rangeSize, sourceLb, sourceUb,
+                                      memory._workLb, rangeSize );
 
-            // Compute upper bound
-            weight = symbolicUb[i * _size + j];
-            if ( weight >= 0 )
-            {
-                _workUb[j] += ( weight * sourceUb );
-            } else
-            {
-                _workUb[j] += ( weight * sourceLb );
-            }
-        }
+        // Compute upper bound
+        SimdKernels::addSignedScaled( symbolicUb + i * rangeSize, sourceUb, sourceLb,
+                                      memory._workUb, rangeSize );
     }
 
-    for ( unsigned i = 0; i < _size; ++i )
+    for ( unsigned i = 0; i < rangeSize; ++i )
     {
         if ( symbolicLowerBias )
-            _workLb[i] += symbolicLowerBias[i];
+            memory._workLb[i] += symbolicLowerBias[i];
         if ( symbolicUpperBias )
-            _workUb[i] += symbolicUpperBias[i];
+            memory._workUb[i] += symbolicUpperBias[i];
     }
 }
 
@@ -338,17 +373,44 @@ void DeepPolyWeightedSumElement::symbolicBoundInTermsOfPredecessor
                   predecessorIndex ) );
     unsigned predecessorSize = predecessor->getSize();
 
-    double *weights = _layer->getWeights( predecessorIndex );
     double *biases = _layer->getBiases();
 
     // newSymbolicLb = weights * symbolicLb
     // newSymbolicUb = weights * symbolicUb
-    matrixMultiplication( weights, symbolicLb,
-                          symbolicLbInTermsOfPredecessor, predecessorSize,
-                          _size, targetLayerSize );
-    matrixMultiplication( weights, symbolicUb,
-                          symbolicUbInTermsOfPredecessor, predecessorSize,
-                          _size, targetLayerSize );
+    const CSRMatrix *sparseWeights = _layer->getSparseWeights( predecessorIndex );
+    if ( sparseWeights )
+    {
+        // Row k of the result only combines the rows of symbolicLb and
+        // symbolicUb that correspond to the non-zero weights in row k
+        const double *values = sparseWeights->getA();
+        const unsigned *rowStart = sparseWeights->getIA();
+        const unsigned *columns = sparseWeights->getJA();
+
+        for ( unsigned k = 0; k < predecessorSize; ++k )
+        {
+            double *lbRow = symbolicLbInTermsOfPredecessor + k * targetLayerSize;
+            double *ubRow = symbolicUbInTermsOfPredecessor + k * targetLayerSize;
+
+            for ( unsigned entry = rowStart[k]; entry < rowStart[k + 1]; ++entry )
+            {
+                double weight = values[entry];
+                SimdKernels::addScaled( symbolicLb + columns[entry] * targetLayerSize,
+                                        weight, lbRow, targetLayerSize );
+                SimdKernels::addScaled( symbolicUb + columns[entry] * targetLayerSize,
+                                        weight, ubRow, targetLayerSize );
+            }
+        }
+    }
+    else
+    {
+        double *weights = _layer->getWeights( predecessorIndex );
+        matrixMultiplication( weights, symbolicLb,
+                              symbolicLbInTermsOfPredecessor, predecessorSize,
+                              _size, targetLayerSize );
+        matrixMultiplication( weights, symbolicUb,
+                              symbolicUbInTermsOfPredecessor, predecessorSize,
+                              _size, targetLayerSize );
+    }
 
     // symbolicLowerBias = biases * symbolicLb
     // symbolicUpperBias = biases * symbolicUb
@@ -362,64 +424,6 @@ void DeepPolyWeightedSumElement::symbolicBoundInTermsOfPredecessor
                   predecessorIndex ) );
 }
 
-void DeepPolyWeightedSumElement::allocateMemoryForResidualsIfNeeded
-( unsigned residualLayerIndex, unsigned residualLayerSize )
-{
-    _residualLayerIndices.insert( residualLayerIndex );
-    unsigned matrixSize = residualLayerSize * _size;
-    if ( !_residualLb.exists( residualLayerIndex ) )
-    {
-        double *residualLb = new double[matrixSize];
-        std::fill_n( residualLb, matrixSize, 0 );
-        _residualLb[residualLayerIndex] = residualLb;
-    }
-    if ( !_residualUb.exists( residualLayerIndex ) )
-    {
-        double *residualUb = new double[residualLayerSize * _size];
-        std::fill_n( residualUb, matrixSize, 0 );
-        _residualUb[residualLayerIndex] = residualUb;
-    }
-}
-
-void DeepPolyWeightedSumElement::allocateMemory()
-{
-    freeMemoryIfNeeded();
-
-    DeepPolyElement::allocateMemory();
-
-    _workLb = new double[_size];
-    _workUb = new double[_size];
-
-    std::fill_n( _workLb, _size, FloatUtils::negativeInfinity() );
-    std::fill_n( _workUb, _size, FloatUtils::infinity() );
-}
-
-void DeepPolyWeightedSumElement::freeMemoryIfNeeded()
-{
-    DeepPolyElement::freeMemoryIfNeeded();
-    if ( _workLb )
-    {
-        delete[] _workLb;
-        _workLb = NULL;
-    }
-    if ( _workUb )
-    {
-        delete[] _workUb;
-        _workUb = NULL;
-    }
-    for ( auto const &pair : _residualLb )
-    {
-        delete[] pair.second;
-    }
-    _residualLb.clear();
-    for ( auto const &pair : _residualUb )
-    {
-        delete[] pair.second;
-    }
-    _residualUb.clear();
-    _residualLayerIndices.clear();
-}
-
 void DeepPolyWeightedSumElement::log( const String &message )
 {
     if ( GlobalConfiguration::NETWORK_LEVEL_REASONER_LOGGING )
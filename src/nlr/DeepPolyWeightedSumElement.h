@@ -38,25 +38,30 @@ public:
       *symbolicLbInTermsOfPredecessor, double *symbolicUbInTermsOfPredecessor,
       unsigned targetLayerSize, DeepPolyElement *predecessor );
 
-private:
-
     /*
-      Memory allocated to store concrete bounds computed at different stages
-      of back substitution.
+      The number of consecutive neurons of a layer of the given size that
+      a single back-substitution job handles, when the layer is split
+      among the given number of threads
     */
-    double *_workLb;
-    double *_workUb;
+    static unsigned getRangeSize( unsigned layerSize, unsigned numThreads );
 
-    Set<unsigned>  _residualLayerIndices;
-    Map<unsigned, double *>  _residualLb;
-    Map<unsigned, double *>  _residualUb;
+private:
+    /*
+      Copy the columns [begin, begin + rangeSize) of the weights from the
+      given predecessor into target, which then has rangeSize columns
+    */
+    void copyWeights( unsigned predecessorIndex, unsigned predecessorSize,
+                      unsigned begin, unsigned rangeSize, double *target );
 
     /*
-      Compute the concrete upper- and lower- bounds of this layer by concretizing
-      the symbolic bounds with respect to every preceding element.
+      Compute the concrete upper- and lower- bounds of the neurons
+      [begin, begin + rangeSize) of this layer by concretizing the symbolic
+      bounds with respect to every preceding element.
     */
     void computeBoundWithBackSubstitution( const Map<unsigned, DeepPolyElement *>
-                                           &deepPolyElementsBefore );
+                                           &deepPolyElementsBefore,
+                                           unsigned begin, unsigned rangeSize,
+                                           DeepPolyWorkingMemory &memory );
 
     /*
       Compute concrete bounds using symbolic bounds with respect to a
@@ -67,18 +72,18 @@ private:
                                   const double *symbolicUpperBias,
                                   DeepPolyElement *sourceElement,
                                   const Map<unsigned, DeepPolyElement *>
-                                  &deepPolyElementsBefore );
+                                  &deepPolyElementsBefore,
+                                  unsigned begin, unsigned rangeSize,
+                                  DeepPolyWorkingMemory &memory );
 
     void concretizeSymbolicBoundForSourceLayer( const double *symbolicLb,
                                                 const double*symbolicUb,
                                                 const double *symbolicLowerBias,
                                                 const double *symbolicUpperBias,
-                                                DeepPolyElement *sourceElement );
+                                                DeepPolyElement *sourceElement,
+                                                unsigned rangeSize,
+                                                DeepPolyWorkingMemory &memory );
 
-    void allocateMemoryForResidualsIfNeeded( unsigned residualLayerIndex,
-                                             unsigned residualLayerSize );
-    void allocateMemory();
-    void freeMemoryIfNeeded();
     void log( const String &message );
 };
 
@@ -0,0 +1,85 @@
+/*********************                                                        */
+/*! \file DeepPolyWorkingMemory.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Haoze Andrew Wu
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include "DeepPolyWorkingMemory.h"
+#include "MarabouError.h"
+
+#include <algorithm>
+
+namespace NLR {
+
+static double *allocateZeros( unsigned size )
+{
+    double *memory = new double[size];
+    if ( !memory )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED,
+                            "DeepPolyWorkingMemory" );
+    std::fill_n( memory, size, 0 );
+    return memory;
+}
+
+DeepPolyWorkingMemory::DeepPolyWorkingMemory( unsigned maxLayerSize, unsigned capacity )
+    : _capacity( capacity )
+{
+    _work1SymbolicLb = allocateZeros( maxLayerSize * capacity );
+    _work1SymbolicUb = allocateZeros( maxLayerSize * capacity );
+    _work2SymbolicLb = allocateZeros( maxLayerSize * capacity );
+    _work2SymbolicUb = allocateZeros( maxLayerSize * capacity );
+
+    _workSymbolicLowerBias = allocateZeros( capacity );
+    _workSymbolicUpperBias = allocateZeros( capacity );
+
+    _workLb = allocateZeros( capacity );
+    _workUb = allocateZeros( capacity );
+}
+
+DeepPolyWorkingMemory::~DeepPolyWorkingMemory()
+{
+    delete[] _work1SymbolicLb;
+    delete[] _work1SymbolicUb;
+    delete[] _work2SymbolicLb;
+    delete[] _work2SymbolicUb;
+    delete[] _workSymbolicLowerBias;
+    delete[] _workSymbolicUpperBias;
+    delete[] _workLb;
+    delete[] _workUb;
+
+    for ( const auto &pair : _residualLb )
+        delete[] pair.second;
+    for ( const auto &pair : _residualUb )
+        delete[] pair.second;
+}
+
+void DeepPolyWorkingMemory::addResidualLayer( unsigned residualLayerIndex,
+                                              unsigned residualLayerSize,
+                                              unsigned rangeSize )
+{
+    if ( !_residualLb.exists( residualLayerIndex ) )
+    {
+        _residualLb[residualLayerIndex] =
+            allocateZeros( residualLayerSize * _capacity );
+        _residualUb[residualLayerIndex] =
+            allocateZeros( residualLayerSize * _capacity );
+    }
+
+    if ( _residualLayerIndices.exists( residualLayerIndex ) )
+        return;
+
+    _residualLayerIndices.insert( residualLayerIndex );
+    std::fill_n( _residualLb[residualLayerIndex], residualLayerSize * rangeSize, 0 );
+    std::fill_n( _residualUb[residualLayerIndex], residualLayerSize * rangeSize, 0 );
+}
+
+} // namespace NLR
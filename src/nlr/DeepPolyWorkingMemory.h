@@ -0,0 +1,69 @@
+/*********************                                                        */
+/*! \file DeepPolyWorkingMemory.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Haoze Andrew Wu
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#ifndef __DeepPolyWorkingMemory_h__
+#define __DeepPolyWorkingMemory_h__
+
+#include "Map.h"
+#include "Set.h"
+
+namespace NLR {
+
+/*
+  The working memory of a single back-substitution job, which computes
+  the bounds of a range of at most _capacity consecutive neurons of a
+  weighted sum layer. Jobs that run in parallel use separate instances.
+  The symbolic bounds are stored row by row, with one row per neuron of
+  the layer that is being substituted, and one column per neuron of the
+  range.
+*/
+class DeepPolyWorkingMemory
+{
+public:
+    DeepPolyWorkingMemory( unsigned maxLayerSize, unsigned capacity );
+    ~DeepPolyWorkingMemory();
+
+    /*
+      Make sure the residual bounds with respect to the given layer are
+      allocated, and, if the layer is not yet a residual source of the
+      current job, mark it as one and zero its first rangeSize columns
+    */
+    void addResidualLayer( unsigned residualLayerIndex,
+                           unsigned residualLayerSize,
+                           unsigned rangeSize );
+
+    unsigned _capacity;
+
+    double *_work1SymbolicLb;
+    double *_work1SymbolicUb;
+    double *_work2SymbolicLb;
+    double *_work2SymbolicUb;
+    double *_workSymbolicLowerBias;
+    double *_workSymbolicUpperBias;
+
+    /*
+      Concrete bounds computed at different stages of back substitution
+    */
+    double *_workLb;
+    double *_workUb;
+
+    Set<unsigned> _residualLayerIndices;
+    Map<unsigned, double *> _residualLb;
+    Map<unsigned, double *> _residualUb;
+};
+
+} // namespace NLR
+
+#endif // __DeepPolyWorkingMemory_h__
@@ -14,6 +14,7 @@
  **/
 
 #include "Debug.h"
+#include "GlobalConfiguration.h"
 #include "InfeasibleQueryException.h"
 #include "IterativePropagator.h"
 #include "Layer.h"
@@ -24,8 +25,6 @@
 
 #include "Vector.h"
 
-#include <boost/thread.hpp>
-
 namespace NLR {
 
 IterativePropagator::IterativePropagator( LayerOwner *layerOwner )
@@ -42,30 +41,13 @@ IterativePropagator::~IterativePropagator()
 
 void IterativePropagator::optimizeBoundsWithIterativePropagation( const Map<unsigned, Layer *> &layers )
 {
-    unsigned numberOfWorkers = Options::get()->getInt( Options::NUM_WORKERS );
-
-    // Time to wait if no idle worker is availble
-    boost::chrono::milliseconds waitTime( numberOfWorkers - 1 );
+    // One solver per thread of the pool
+    Solvers solvers;
+    createSolvers( solvers );
 
-    Map<GurobiWrapper *, unsigned> solverToIndex;
-    // Create a queue of free workers
-    // When a worker is working, it is popped off the queue, when it is done, it
-    // is added back to the queue.
-    SolverQueue freeSolvers( numberOfWorkers );
-    for ( unsigned i = 0; i < numberOfWorkers; ++i )
-    {
-        GurobiWrapper *gurobi = new GurobiWrapper();
-        solverToIndex[gurobi] = i;
-        enqueueSolver( freeSolvers, gurobi );
-    }
-
-    std::vector<boost::thread> threads( numberOfWorkers );
     std::mutex mtx;
     std::atomic_bool infeasible( false );
 
-    double currentLb;
-    double currentUb;
-
     std::atomic_uint tighterBoundCounter( 0 );
     std::atomic_uint signChanges( 0 );
     std::atomic_uint cutoffs( 0 );
@@ -79,7 +61,7 @@ void IterativePropagator::optimizeBoundsWithIterativePropagation( const Map<unsi
     NeuronIndex lastFixedNeuronFromPreviousIteration = lastIndex;
     // The latest neuron fixed in the current iteration
     NeuronIndex lastFixedNeuronThisIteration = lastIndex;
-    bool shouldQuit = false;
+    std::atomic_bool shouldQuit( false );
 
     struct timespec gurobiStart;
     (void) gurobiStart;
@@ -88,16 +70,17 @@ void IterativePropagator::optimizeBoundsWithIterativePropagation( const Map<unsi
 
     gurobiStart = TimeUtils::sampleMicro();
 
+    unsigned numberOfPasses = 0;
     do
     {
+        ++numberOfPasses;
+
         if ( Options::get()->getInt( Options::VERBOSITY ) > 0 )
             printf( "Number of tighter bounds found by Gurobi before this iteration: %u. Sign changes: %u. Cutoffs: %u\n",
                     tighterBoundCounter.load(), signChanges.load(), cutoffs.load() );
 
-        mtx.lock();
         lastFixedNeuronFromPreviousIteration = lastFixedNeuronThisIteration;
         lastFixedNeuronThisIteration = lastIndex;
-        mtx.unlock();
 
         DEBUG({
                 std::cout << "Last fixed Neuron From Previous Iteration: " <<
@@ -112,13 +95,14 @@ void IterativePropagator::optimizeBoundsWithIterativePropagation( const Map<unsi
             Layer *layer = currentLayer.second;
             if ( layer->getLayerType() == Layer::INPUT )
                 continue;
-            for ( unsigned i = 0; i < layer->getSize(); ++i )
+
+            runJobs( layer->getSize(), [&]( unsigned i, unsigned threadIndex )
             {
-                if ( layer->neuronEliminated( i ) )
-                    continue;
+                if ( infeasible || shouldQuit || layer->neuronEliminated( i ) )
+                    return;
 
-                currentLb = layer->getLb( i );
-                currentUb = layer->getUb( i );
+                double currentLb = layer->getLb( i );
+                double currentUb = layer->getUb( i );
 
                 mtx.lock();
                 bool progressMade = lastFixedNeuronThisIteration != lastIndex;
@@ -130,72 +114,53 @@ void IterativePropagator::optimizeBoundsWithIterativePropagation( const Map<unsi
                 {
                     // If we reached the last fixed neuron from the
                     // previous iteration but this iteration hasn't fixed any neurons
-                    if ( Options::get()->getInt( Options::VERBOSITY ) > 0 )
+                    if ( !shouldQuit.exchange( true ) &&
+                         Options::get()->getInt( Options::VERBOSITY ) > 0 )
                         printf( "No progress made this iteration, quitting...\n" );
-
-                    for ( unsigned i = 0; i < numberOfWorkers; ++i )
-                    {
-                        threads[i].interrupt();
-                        threads[i].join();
-                    }
-                    shouldQuit = true;
-                    break;
+                    return;
                 }
 
                 if ( _cutoffInUse && ( currentLb > _cutoffValue || currentUb < _cutoffValue ) )
-                    continue;
+                    return;
 
                 if ( Options::get()->getInt( Options::VERBOSITY ) > 1 )
                     printf( "Handling layer %d neuron %d\n",
                             layer->getLayerIndex(), i );
 
-                if ( infeasible )
-                {
-                    // infeasibility is derived, interupt all active threads
-                    for ( unsigned i = 0; i < numberOfWorkers; ++i )
-                    {
-                        threads[i].interrupt();
-                        threads[i].join();
-                    }
-                    clearSolverQueue( freeSolvers );
-                    throw InfeasibleQueryException();
-                }
-
-                // Wait until there is an idle solver
-                GurobiWrapper *freeSolver;
-                while ( !freeSolvers.pop( freeSolver ) )
-                    boost::this_thread::sleep_for( waitTime );
-
-                freeSolver->resetModel();
+                ILPSolver *solver = solvers[threadIndex].get();
+                solver->resetModel();
                 mtx.lock();
                 _milpFormulator.createMILPEncoding
-                    ( layers, *freeSolver, _layerOwner->getNumberOfLayers() );
+                    ( layers, *solver, _layerOwner->getNumberOfLayers() );
                 mtx.unlock();
 
-                // spawn a thread to tighten the bounds for the current variable
-                ThreadArgument argument( freeSolver, layer,
+                ThreadArgument argument( solver, layer,
                                          i, currentLb, currentUb,
                                          _cutoffInUse, _cutoffValue,
-                                         _layerOwner, std::ref( freeSolvers ),
+                                         _layerOwner,
                                          std::ref( mtx ), std::ref( infeasible ),
                                          std::ref( tighterBoundCounter ),
                                          std::ref( signChanges ),
                                          std::ref( cutoffs ),
                                          &lastFixedNeuronThisIteration );
 
-                threads[solverToIndex[freeSolver]] = boost::thread
-                    ( tightenSingleVariableBounds, argument );
-            }
-        }
+                tightenSingleVariableBounds( argument );
+            } );
 
-        for ( unsigned i = 0; i < numberOfWorkers; ++i )
-        {
-            threads[i].join();
+            if ( infeasible )
+                throw InfeasibleQueryException();
         }
 
         if ( Options::get()->getInt( Options::VERBOSITY ) > 0 )
             printf( "Number of tighter bounds found by Gurobi after this iteration: %u. Sign changes: %u. Cutoffs: %u\n",
                     tighterBoundCounter.load(), signChanges.load(), cutoffs.load() );
+
+        // The check inside the pass only fires once some neuron has been
+        // fixed, so a pass that fixes nothing ends the propagation here
+        bool progressMade = lastFixedNeuronThisIteration != lastIndex;
+        if ( !progressMade ||
+             numberOfPasses >= GlobalConfiguration::ITERATIVE_PROPAGATION_MAX_PASSES )
+            shouldQuit = true;
     }
     while ( !shouldQuit );
 
@@ -204,11 +169,6 @@ void IterativePropagator::optimizeBoundsWithIterativePropagation( const Map<unsi
     IterativePropagator_LOG( Stringf( "Number of tighter bounds found by Gurobi: %u. Sign changes: %u. Cutoffs: %u\n",
                                tighterBoundCounter.load(), signChanges.load(), cutoffs.load() ).ascii() );
     IterativePropagator_LOG( Stringf( "Seconds spent Gurobiing: %llu\n", TimeUtils::timePassed( gurobiStart, gurobiEnd ) / 1000000 ).ascii() );
-
-    clearSolverQueue( freeSolvers );
-
-    if ( infeasible )
-        throw InfeasibleQueryException();
 }
 
 void IterativePropagator::setCutoff( double cutoff )
@@ -218,13 +178,13 @@ void IterativePropagator::setCutoff( double cutoff )
 }
 
 
-double IterativePropagator::optimizeWithGurobi( GurobiWrapper &gurobi, MinOrMax
+double IterativePropagator::optimizeWithGurobi( ILPSolver &gurobi, MinOrMax
                                            minOrMax, String variableName,
                                            double cutoffValue,
                                            std::atomic_bool *infeasible )
 {
-    List<GurobiWrapper::Term> terms;
-    terms.append( GurobiWrapper::Term( 1, variableName ) );
+    List<ILPSolver::Term> terms;
+    terms.append( ILPSolver::Term( 1, variableName ) );
 
     if ( minOrMax == MAX )
         gurobi.setObjective( terms );
@@ -264,32 +224,22 @@ double IterativePropagator::optimizeWithGurobi( GurobiWrapper &gurobi, MinOrMax
 
 void IterativePropagator::tightenSingleVariableBounds( ThreadArgument &argument )
 {
-    try
+    // try the phase corresponding to the larger interval first
+    if ( -argument._currentLb < argument._currentUb )
     {
-        // try the phase corresponding to the larger interval first
-        if ( -argument._currentLb < argument._currentUb )
-        {
-            if ( tightenSingleVariableLowerBounds( argument ) )
-                tightenSingleVariableUpperBounds( argument );
-        }
-        else
-        {
-            if ( tightenSingleVariableUpperBounds( argument ) )
-                tightenSingleVariableLowerBounds( argument );
-        }
-        SolverQueue &freeSolvers = argument._freeSolvers;
-        GurobiWrapper *gurobi = argument._gurobi;
-        enqueueSolver( freeSolvers, gurobi );
+        if ( tightenSingleVariableLowerBounds( argument ) )
+            tightenSingleVariableUpperBounds( argument );
     }
-    catch ( boost::thread_interrupted& )
+    else
     {
-        enqueueSolver( argument._freeSolvers, argument._gurobi );
+        if ( tightenSingleVariableUpperBounds( argument ) )
+            tightenSingleVariableLowerBounds( argument );
     }
 }
 
 bool IterativePropagator::tightenSingleVariableLowerBounds( ThreadArgument &argument )
 {
-    GurobiWrapper *gurobi = argument._gurobi;
+    ILPSolver *gurobi = argument._gurobi;
     Layer *layer = argument._layer;
     unsigned index = argument._index;
     double currentLb = argument._currentLb;
@@ -345,7 +295,7 @@ bool IterativePropagator::tightenSingleVariableLowerBounds( ThreadArgument &argu
 
 bool IterativePropagator::tightenSingleVariableUpperBounds( ThreadArgument &argument )
 {
-    GurobiWrapper *gurobi = argument._gurobi;
+    ILPSolver *gurobi = argument._gurobi;
     Layer *layer = argument._layer;
     unsigned index = argument._index;
     double currentUb = argument._currentUb;
@@ -13,16 +13,16 @@
 
  **/
 
-#include "GurobiWrapper.h"
 #include "InfeasibleQueryException.h"
 #include "LPFormulator.h"
+#include "LPSolverFactory.h"
 #include "Layer.h"
 #include "MStringf.h"
 #include "NLRError.h"
 #include "Options.h"
 #include "TimeUtils.h"
 
-#include <boost/thread.hpp>
+#include <memory>
 
 namespace NLR {
 
@@ -30,6 +30,7 @@ LPFormulator::LPFormulator( LayerOwner *layerOwner )
     : _layerOwner( layerOwner )
     , _cutoffInUse( false )
     , _cutoffValue( 0 )
+    , _statistics( NULL )
 {
 }
 
@@ -37,7 +38,42 @@ LPFormulator::~LPFormulator()
 {
 }
 
-double LPFormulator::solveLPRelaxation( GurobiWrapper &gurobi,
+void LPFormulator::setStatistics( Statistics *statistics )
+{
+    _statistics = statistics;
+}
+
+void LPFormulator::recordSolve( LayerSolveStatistics *solveStatistics,
+                                const struct timespec &start, bool warmStart )
+{
+    if ( !solveStatistics )
+        return;
+
+    ++solveStatistics->_numSolves;
+    if ( warmStart )
+        ++solveStatistics->_numWarmStartedSolves;
+    solveStatistics->_solveTimeMicro += TimeUtils::timePassed( start, TimeUtils::sampleMicro() );
+}
+
+void LPFormulator::reportSolveStatistics( const Map<unsigned, LayerSolveStatistics> &solveStatistics ) const
+{
+    for ( const auto &layer : solveStatistics )
+    {
+        unsigned numSolves = layer.second._numSolves;
+        unsigned numWarmStartedSolves = layer.second._numWarmStartedSolves;
+        unsigned long long timeMicro = layer.second._solveTimeMicro;
+
+        LPFormulator_LOG( Stringf( "Layer %u: %u LP solves (%u warm started), %llu milli",
+                                   layer.first, numSolves, numWarmStartedSolves,
+                                   timeMicro / 1000 ).ascii() );
+
+        if ( _statistics )
+            _statistics->addLPBoundTighteningSolves( layer.first, numSolves,
+                                                     numWarmStartedSolves, timeMicro );
+    }
+}
+
+double LPFormulator::solveLPRelaxation( ILPSolver &gurobi,
                                         const Map<unsigned, Layer *> &layers,
                                         MinOrMax minOrMax, String variableName,
                                         unsigned lastLayer )
@@ -47,12 +83,12 @@ double LPFormulator::solveLPRelaxation( GurobiWrapper &gurobi,
     return optimizeWithGurobi( gurobi, minOrMax, variableName, _cutoffValue );
 }
 
-double LPFormulator::optimizeWithGurobi( GurobiWrapper &gurobi,
+double LPFormulator::optimizeWithGurobi( ILPSolver &gurobi,
                                          MinOrMax minOrMax, String variableName,
                                          double cutoffValue, std::atomic_bool *infeasible )
 {
-    List<GurobiWrapper::Term> terms;
-    terms.append( GurobiWrapper::Term( 1, variableName ) );
+    List<ILPSolver::Term> terms;
+    terms.append( ILPSolver::Term( 1, variableName ) );
 
     if ( minOrMax == MAX )
         gurobi.setObjective( terms );
@@ -92,9 +128,10 @@ double LPFormulator::optimizeWithGurobi( GurobiWrapper &gurobi,
 
 void LPFormulator::optimizeBoundsWithIncrementalLpRelaxation( const Map<unsigned, Layer *> &layers )
 {
-    GurobiWrapper gurobi;
+    std::unique_ptr<ILPSolver> lpSolver( LPSolverFactory::createLPSolver() );
+    ILPSolver &gurobi = *lpSolver;
 
-    List<GurobiWrapper::Term> terms;
+    List<ILPSolver::Term> terms;
     Map<String, double> dontCare;
     double lb = 0;
     double ub = 0;
@@ -110,6 +147,9 @@ void LPFormulator::optimizeBoundsWithIncrementalLpRelaxation( const Map<unsigned
     struct timespec gurobiEnd;
     (void) gurobiEnd;
 
+    Map<unsigned, LayerSolveStatistics> solveStatistics;
+    bool warmStart = false;
+
     gurobiStart = TimeUtils::sampleMicro();
 
     for ( unsigned i = 0; i < _layerOwner->getNumberOfLayers(); ++i )
@@ -122,6 +162,9 @@ void LPFormulator::optimizeBoundsWithIncrementalLpRelaxation( const Map<unsigned
         Layer *layer = layers[i];
         addLayerToModel( gurobi, layer );
 
+        LayerSolveStatistics *layerSolveStatistics = &solveStatistics[i];
+        struct timespec solveStart;
+
         for ( unsigned j = 0; j < layer->getSize(); ++j )
         {
             if ( layer->neuronEliminated( j ) )
@@ -137,12 +180,15 @@ void LPFormulator::optimizeBoundsWithIncrementalLpRelaxation( const Map<unsigned
             Stringf variableName( "x%u", variable );
 
             terms.clear();
-            terms.append( GurobiWrapper::Term( 1, variableName ) );
+            terms.append( ILPSolver::Term( 1, variableName ) );
 
             // Maximize
+            solveStart = TimeUtils::sampleMicro();
             gurobi.reset();
             gurobi.setObjective( terms );
             gurobi.solve();
+            recordSolve( layerSolveStatistics, solveStart, warmStart );
+            warmStart = true;
 
             if ( gurobi.infeasbile() )
                 throw InfeasibleQueryException();
@@ -187,9 +233,11 @@ void LPFormulator::optimizeBoundsWithIncrementalLpRelaxation( const Map<unsigned
             }
 
             // Minimize
+            solveStart = TimeUtils::sampleMicro();
             gurobi.reset();
             gurobi.setCost( terms );
             gurobi.solve();
+            recordSolve( layerSolveStatistics, solveStart, warmStart );
 
             if ( gurobi.infeasbile() )
                 throw InfeasibleQueryException();
@@ -237,6 +285,8 @@ void LPFormulator::optimizeBoundsWithIncrementalLpRelaxation( const Map<unsigned
 
     gurobiEnd = TimeUtils::sampleMicro();
 
+    reportSolveStatistics( solveStatistics );
+
     LPFormulator_LOG( Stringf( "Number of tighter bounds found by Gurobi: %u. Sign changes: %u. Cutoffs: %u\n",
                                tighterBoundCounter, signChanges, cutoffs ).ascii() );
     LPFormulator_LOG( Stringf( "Seconds spent Gurobiing: %llu\n", TimeUtils::timePassed( gurobiStart, gurobiEnd ) / 1000000 ).ascii() );
@@ -244,30 +294,13 @@ void LPFormulator::optimizeBoundsWithIncrementalLpRelaxation( const Map<unsigned
 
 void LPFormulator::optimizeBoundsWithLpRelaxation( const Map<unsigned, Layer *> &layers )
 {
-    unsigned numberOfWorkers = Options::get()->getInt( Options::NUM_WORKERS );
-
-    // Time to wait if no idle worker is availble
-    boost::chrono::milliseconds waitTime( numberOfWorkers - 1 );
-
-    Map<GurobiWrapper *, unsigned> solverToIndex;
-    // Create a queue of free workers
-    // When a worker is working, it is popped off the queue, when it is done, it
-    // is added back to the queue.
-    SolverQueue freeSolvers( numberOfWorkers );
-    for ( unsigned i = 0; i < numberOfWorkers; ++i )
-    {
-        GurobiWrapper *gurobi = new GurobiWrapper();
-        solverToIndex[gurobi] = i;
-        enqueueSolver( freeSolvers, gurobi );
-    }
+    // One solver per thread of the pool
+    Solvers solvers;
+    createSolvers( solvers );
 
-    boost::thread *threads = new boost::thread[numberOfWorkers];
     std::mutex mtx;
     std::atomic_bool infeasible( false );
 
-    double currentLb;
-    double currentUb;
-
     std::atomic_uint tighterBoundCounter( 0 );
     std::atomic_uint signChanges( 0 );
     std::atomic_uint cutoffs( 0 );
@@ -277,171 +310,165 @@ void LPFormulator::optimizeBoundsWithLpRelaxation( const Map<unsigned, Layer *>
     struct timespec gurobiEnd;
     (void) gurobiEnd;
 
+    /*
+      The model of each solver encodes the layers up to the one it last
+      worked on. Tightening the bounds of a layer does not change the
+      LP relaxation of that layer, as these bounds are implied by the
+      model, so a solver can keep its model for the remaining neurons of
+      the layer and re-optimize from its last basis.
+    */
+    Vector<unsigned> solverToModelLayer( solvers.size(), UINT_MAX );
+
+    // The workers' solves, per layer
+    Map<unsigned, LayerSolveStatistics> solveStatistics;
+    for ( const auto &currentLayer : layers )
+        solveStatistics[currentLayer.first];
+
     gurobiStart = TimeUtils::sampleMicro();
 
     for ( const auto &currentLayer : layers )
     {
         Layer *layer = currentLayer.second;
+        unsigned layerIndex = layer->getLayerIndex();
+        LayerSolveStatistics *layerStatistics = &solveStatistics[layerIndex];
 
-        for ( unsigned i = 0; i < layer->getSize(); ++i )
+        runJobs( layer->getSize(), [&]( unsigned i, unsigned threadIndex )
         {
-            if ( layer->neuronEliminated( i ) )
-                continue;
+            if ( infeasible || layer->neuronEliminated( i ) )
+                return;
 
-            currentLb = layer->getLb( i );
-            currentUb = layer->getUb( i );
+            double currentLb = layer->getLb( i );
+            double currentUb = layer->getUb( i );
 
             if ( _cutoffInUse && ( currentLb > _cutoffValue || currentUb < _cutoffValue ) )
-                continue;
+                return;
 
-            if ( infeasible )
-            {
-                // infeasibility is derived, interupt all active threads
-                for ( unsigned i = 0; i < numberOfWorkers; ++i )
-                {
-                    threads[i].interrupt();
-                    threads[i].join();
-                }
-                clearSolverQueue( freeSolvers );
-                throw InfeasibleQueryException();
-            }
+            ILPSolver *solver = solvers[threadIndex].get();
+            bool warmStart = solverToModelLayer[threadIndex] == layerIndex;
 
-            // Wait until there is an idle solver
-            GurobiWrapper *freeSolver;
-            while ( !freeSolvers.pop( freeSolver ) )
-                boost::this_thread::sleep_for( waitTime );
+            if ( !warmStart )
+            {
+                solver->resetModel();
 
-            freeSolver->resetModel();
+                mtx.lock();
+                createLPRelaxation( layers, *solver, layerIndex );
+                mtx.unlock();
 
-            mtx.lock();
-            createLPRelaxation( layers, *freeSolver, layer->getLayerIndex() );
-            mtx.unlock();
+                solverToModelLayer[threadIndex] = layerIndex;
+            }
 
-            // spawn a thread to tighten the bounds for the current variable
-            ThreadArgument argument( freeSolver, layer,
+            ThreadArgument argument( solver, layer,
                                      i, currentLb, currentUb,
                                      _cutoffInUse, _cutoffValue,
-                                     _layerOwner, std::ref( freeSolvers ),
+                                     _layerOwner,
                                      std::ref( mtx ), std::ref( infeasible ),
                                      std::ref( tighterBoundCounter ),
                                      std::ref( signChanges ),
                                      std::ref( cutoffs ) );
+            argument._solveStatistics = layerStatistics;
+            argument._warmStart = warmStart;
 
-            if ( numberOfWorkers == 1 )
-                tightenSingleVariableBoundsWithLPRelaxation( argument );
-            else
-                threads[solverToIndex[freeSolver]] = boost::thread
-                    ( tightenSingleVariableBoundsWithLPRelaxation, argument );
-        }
-    }
+            tightenSingleVariableBoundsWithLPRelaxation( argument );
+        } );
 
-    for ( unsigned i = 0; i < numberOfWorkers; ++i )
-    {
-        threads[i].join();
+        if ( infeasible )
+            throw InfeasibleQueryException();
     }
 
     gurobiEnd = TimeUtils::sampleMicro();
 
+    reportSolveStatistics( solveStatistics );
+
     LPFormulator_LOG( Stringf( "Number of tighter bounds found by Gurobi: %u. Sign changes: %u. Cutoffs: %u\n",
                                tighterBoundCounter.load(), signChanges.load(), cutoffs.load() ).ascii() );
     LPFormulator_LOG( Stringf( "Seconds spent Gurobiing: %llu\n", TimeUtils::timePassed( gurobiStart, gurobiEnd ) / 1000000 ).ascii() );
-
-    clearSolverQueue( freeSolvers );
-
-    if ( infeasible )
-        throw InfeasibleQueryException();
 }
 
 void LPFormulator::tightenSingleVariableBoundsWithLPRelaxation( ThreadArgument &argument )
 {
-    try
+    ILPSolver *gurobi = argument._gurobi;
+    Layer *layer = argument._layer;
+    unsigned index = argument._index;
+    double currentLb = argument._currentLb;
+    double currentUb = argument._currentUb;
+    bool cutoffInUse = argument._cutoffInUse;
+    double cutoffValue = argument._cutoffValue;
+    LayerOwner *layerOwner = argument._layerOwner;
+    std::mutex &mtx = argument._mtx;
+    std::atomic_bool &infeasible = argument._infeasible;
+    std::atomic_uint &tighterBoundCounter = argument._tighterBoundCounter;
+    std::atomic_uint &signChanges = argument._signChanges;
+    std::atomic_uint &cutoffs = argument._cutoffs;
+
+    LPFormulator_LOG( Stringf( "Tightening bounds for layer %u index %u",
+                               layer->getLayerIndex(), index ).ascii() );
+
+    unsigned variable = layer->neuronToVariable( index );
+    Stringf variableName( "x%u", variable );
+
+    LPFormulator_LOG( Stringf( "Computing upperbound..." ).ascii() );
+    struct timespec solveStart = TimeUtils::sampleMicro();
+    gurobi->reset();
+    double ub = optimizeWithGurobi( *gurobi, MinOrMax::MAX, variableName,
+                                    cutoffValue, &infeasible );
+    recordSolve( argument._solveStatistics, solveStart, argument._warmStart );
+    LPFormulator_LOG( Stringf( "Upperbound computed %f", ub ).ascii() );
+
+    // Store the new bound if it is tighter
+    if ( ub < currentUb )
     {
-        GurobiWrapper *gurobi = argument._gurobi;
-        Layer *layer = argument._layer;
-        unsigned index = argument._index;
-        double currentLb = argument._currentLb;
-        double currentUb = argument._currentUb;
-        bool cutoffInUse = argument._cutoffInUse;
-        double cutoffValue = argument._cutoffValue;
-        LayerOwner *layerOwner = argument._layerOwner;
-        SolverQueue &freeSolvers = argument._freeSolvers;
-        std::mutex &mtx = argument._mtx;
-        std::atomic_bool &infeasible = argument._infeasible;
-        std::atomic_uint &tighterBoundCounter = argument._tighterBoundCounter;
-        std::atomic_uint &signChanges = argument._signChanges;
-        std::atomic_uint &cutoffs = argument._cutoffs;
-
-        LPFormulator_LOG( Stringf( "Tightening bounds for layer %u index %u",
-                                   layer->getLayerIndex(), index ).ascii() );
-
-        unsigned variable = layer->neuronToVariable( index );
-        Stringf variableName( "x%u", variable );
-
-        LPFormulator_LOG( Stringf( "Computing upperbound..." ).ascii() );
-        double ub = optimizeWithGurobi( *gurobi, MinOrMax::MAX, variableName,
-                                        cutoffValue, &infeasible );
-        LPFormulator_LOG( Stringf( "Upperbound computed %f", ub ).ascii() );
-
-        // Store the new bound if it is tighter
-        if ( ub < currentUb )
-        {
-            if ( FloatUtils::isPositive( currentUb ) &&
-                 !FloatUtils::isPositive( ub ) )
-                ++signChanges;
+        if ( FloatUtils::isPositive( currentUb ) &&
+             !FloatUtils::isPositive( ub ) )
+            ++signChanges;
 
-            mtx.lock();
-            layer->setUb( index, ub );
-            layerOwner->receiveTighterBound( Tightening( variable,
-                                                         ub,
-                                                         Tightening::UB ) );
-            mtx.unlock();
+        mtx.lock();
+        layer->setUb( index, ub );
+        layerOwner->receiveTighterBound( Tightening( variable,
+                                                     ub,
+                                                     Tightening::UB ) );
+        mtx.unlock();
 
-            ++tighterBoundCounter;
+        ++tighterBoundCounter;
 
-            if ( cutoffInUse && ub < cutoffValue )
-            {
-                ++cutoffs;
-                enqueueSolver( freeSolvers, gurobi );
-                return;
-            }
+        if ( cutoffInUse && ub < cutoffValue )
+        {
+            ++cutoffs;
+            return;
         }
+    }
 
-        LPFormulator_LOG( Stringf( "Computing lowerbound..." ).ascii() );
-        gurobi->reset();
-        double lb = optimizeWithGurobi( *gurobi, MinOrMax::MIN, variableName,
-                                        cutoffValue, &infeasible );
-        LPFormulator_LOG( Stringf( "Lowerbound computed: %f", lb ).ascii() );
+    LPFormulator_LOG( Stringf( "Computing lowerbound..." ).ascii() );
+    solveStart = TimeUtils::sampleMicro();
+    gurobi->reset();
+    double lb = optimizeWithGurobi( *gurobi, MinOrMax::MIN, variableName,
+                                    cutoffValue, &infeasible );
+    recordSolve( argument._solveStatistics, solveStart, true );
+    LPFormulator_LOG( Stringf( "Lowerbound computed: %f", lb ).ascii() );
 
-        // Store the new bound if it is tighter
-        if ( lb > currentLb )
+    // Store the new bound if it is tighter
+    if ( lb > currentLb )
+    {
+        if ( FloatUtils::isNegative( currentLb ) &&
+             !FloatUtils::isNegative( lb ) )
+            ++signChanges;
+
+        mtx.lock();
+        layer->setLb( index, lb );
+        layerOwner->receiveTighterBound( Tightening( variable,
+                                                     lb,
+                                                     Tightening::LB ) );
+        mtx.unlock();
+        ++tighterBoundCounter;
+
+        if ( cutoffInUse && lb > cutoffValue )
         {
-            if ( FloatUtils::isNegative( currentLb ) &&
-                 !FloatUtils::isNegative( lb ) )
-                ++signChanges;
-
-            mtx.lock();
-            layer->setLb( index, lb );
-            layerOwner->receiveTighterBound( Tightening( variable,
-                                                         lb,
-                                                         Tightening::LB ) );
-            mtx.unlock();
-            ++tighterBoundCounter;
-
-            if ( cutoffInUse && lb > cutoffValue )
-            {
-                ++cutoffs;
-            }
+            ++cutoffs;
         }
-        enqueueSolver( freeSolvers, gurobi );
-    }
-    catch ( boost::thread_interrupted& )
-    {
-        enqueueSolver( argument._freeSolvers, argument._gurobi );
     }
 }
 
 void LPFormulator::createLPRelaxation( const Map<unsigned, Layer *> &layers,
-                                       GurobiWrapper &gurobi,
+                                       ILPSolver &gurobi,
                                        unsigned lastLayer )
 {
     for ( const auto &layer : layers )
@@ -453,7 +480,7 @@ void LPFormulator::createLPRelaxation( const Map<unsigned, Layer *> &layers,
     }
 }
 
-void LPFormulator::addLayerToModel( GurobiWrapper &gurobi, const Layer *layer )
+void LPFormulator::addLayerToModel( ILPSolver &gurobi, const Layer *layer )
 {
     switch ( layer->getLayerType() )
     {
@@ -483,7 +510,7 @@ void LPFormulator::addLayerToModel( GurobiWrapper &gurobi, const Layer *layer )
     }
 }
 
-void LPFormulator::addInputLayerToLpRelaxation( GurobiWrapper &gurobi,
+void LPFormulator::addInputLayerToLpRelaxation( ILPSolver &gurobi,
                                                 const Layer *layer )
 {
     for ( unsigned i = 0; i < layer->getSize(); ++i )
@@ -495,7 +522,7 @@ void LPFormulator::addInputLayerToLpRelaxation( GurobiWrapper &gurobi,
     }
 }
 
-void LPFormulator::addReluLayerToLpRelaxation( GurobiWrapper &gurobi,
+void LPFormulator::addReluLayerToLpRelaxation( ILPSolver &gurobi,
                                                const Layer *layer )
 {
     for ( unsigned i = 0; i < layer->getSize(); ++i )
@@ -535,16 +562,16 @@ void LPFormulator::addReluLayerToLpRelaxation( GurobiWrapper &gurobi,
                 if ( sourceLb < 0 )
                     sourceLb = 0;
 
-                List<GurobiWrapper::Term> terms;
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-                terms.append( GurobiWrapper::Term( -1, Stringf( "x%u", sourceVariable ) ) );
+                List<ILPSolver::Term> terms;
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                terms.append( ILPSolver::Term( -1, Stringf( "x%u", sourceVariable ) ) );
                 gurobi.addEqConstraint( terms, 0 );
             }
             else if ( !FloatUtils::isPositive( sourceUb ) )
             {
                 // The ReLU is inactive, y = 0
-                List<GurobiWrapper::Term> terms;
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                List<ILPSolver::Term> terms;
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
                 gurobi.addEqConstraint( terms, 0 );
             }
             else
@@ -560,14 +587,14 @@ void LPFormulator::addReluLayerToLpRelaxation( GurobiWrapper &gurobi,
                 */
 
                 // y >= 0
-                List<GurobiWrapper::Term> terms;
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                List<ILPSolver::Term> terms;
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
                 gurobi.addGeqConstraint( terms, 0 );
 
                 // y >= x, i.e. y - x >= 0
                 terms.clear();
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-                terms.append( GurobiWrapper::Term( -1, Stringf( "x%u", sourceVariable ) ) );
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                terms.append( ILPSolver::Term( -1, Stringf( "x%u", sourceVariable ) ) );
                 gurobi.addGeqConstraint( terms, 0 );
 
                 /*
@@ -576,15 +603,15 @@ void LPFormulator::addReluLayerToLpRelaxation( GurobiWrapper &gurobi,
                        u - l     u - l
                 */
                 terms.clear();
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-                terms.append( GurobiWrapper::Term( -sourceUb / ( sourceUb - sourceLb ), Stringf( "x%u", sourceVariable ) ) );
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                terms.append( ILPSolver::Term( -sourceUb / ( sourceUb - sourceLb ), Stringf( "x%u", sourceVariable ) ) );
                 gurobi.addLeqConstraint( terms, ( -sourceUb * sourceLb ) / ( sourceUb - sourceLb ) );
             }
         }
     }
 }
 
-void LPFormulator::addSignLayerToLpRelaxation( GurobiWrapper &gurobi,
+void LPFormulator::addSignLayerToLpRelaxation( ILPSolver &gurobi,
                                                const Layer *layer )
 {
     for ( unsigned i = 0; i < layer->getSize(); ++i )
@@ -646,9 +673,9 @@ void LPFormulator::addSignLayerToLpRelaxation( GurobiWrapper &gurobi,
               y <= ----- x + 1
                     - l
             */
-            List<GurobiWrapper::Term> terms;
-            terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-            terms.append( GurobiWrapper::Term( 2.0 / sourceLb, Stringf( "x%u", sourceVariable ) ) );
+            List<ILPSolver::Term> terms;
+            terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+            terms.append( ILPSolver::Term( 2.0 / sourceLb, Stringf( "x%u", sourceVariable ) ) );
             gurobi.addLeqConstraint( terms, 1 );
 
             /*
@@ -657,14 +684,14 @@ void LPFormulator::addSignLayerToLpRelaxation( GurobiWrapper &gurobi,
                      u
             */
             terms.clear();
-            terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-            terms.append( GurobiWrapper::Term( -2.0 / sourceUb, Stringf( "x%u", sourceVariable ) ) );
+            terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+            terms.append( ILPSolver::Term( -2.0 / sourceUb, Stringf( "x%u", sourceVariable ) ) );
             gurobi.addGeqConstraint( terms, -1 );
         }
     }
 }
 
-void LPFormulator::addMaxLayerToLpRelaxation( GurobiWrapper &gurobi,
+void LPFormulator::addMaxLayerToLpRelaxation( ILPSolver &gurobi,
                                               const Layer *layer )
 {
     for ( unsigned i = 0; i < layer->getSize(); ++i )
@@ -682,7 +709,7 @@ void LPFormulator::addMaxLayerToLpRelaxation( GurobiWrapper &gurobi,
 
         double maxConcreteUb = FloatUtils::negativeInfinity();
 
-        List<GurobiWrapper::Term> terms;
+        List<ILPSolver::Term> terms;
 
         for ( const auto &source : sources )
         {
@@ -702,8 +729,8 @@ void LPFormulator::addMaxLayerToLpRelaxation( GurobiWrapper &gurobi,
 
             // Target is at least source: target - source >= 0
             terms.clear();
-            terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-            terms.append( GurobiWrapper::Term( -1, Stringf( "x%u", sourceVariable ) ) );
+            terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+            terms.append( ILPSolver::Term( -1, Stringf( "x%u", sourceVariable ) ) );
             gurobi.addGeqConstraint( terms, 0 );
 
             // Find maximal concrete upper bound
@@ -717,7 +744,7 @@ void LPFormulator::addMaxLayerToLpRelaxation( GurobiWrapper &gurobi,
             // At least one of the sources has a fixed value,
             // and this fixed value dominates other sources.
             terms.clear();
-            terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
+            terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
             gurobi.addEqConstraint( terms, maxFixedSourceValue );
         }
         else
@@ -726,19 +753,19 @@ void LPFormulator::addMaxLayerToLpRelaxation( GurobiWrapper &gurobi,
             if ( haveFixedSourceValue )
             {
                 terms.clear();
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
                 gurobi.addGeqConstraint( terms, maxFixedSourceValue );
             }
 
             // Target must be smaller than greatest concrete upper bound
             terms.clear();
-            terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
+            terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
             gurobi.addLeqConstraint( terms, maxConcreteUb );
         }
     }
 }
 
-void LPFormulator::addWeightedSumLayerToLpRelaxation( GurobiWrapper &gurobi, const Layer *layer )
+void LPFormulator::addWeightedSumLayerToLpRelaxation( ILPSolver &gurobi, const Layer *layer )
 {
     for ( unsigned i = 0; i < layer->getSize(); ++i )
     {
@@ -750,8 +777,8 @@ void LPFormulator::addWeightedSumLayerToLpRelaxation( GurobiWrapper &gurobi, con
                                 layer->getLb( i ),
                                 layer->getUb( i ) );
 
-            List<GurobiWrapper::Term> terms;
-            terms.append( GurobiWrapper::Term( -1, Stringf( "x%u", variable ) ) );
+            List<ILPSolver::Term> terms;
+            terms.append( ILPSolver::Term( -1, Stringf( "x%u", variable ) ) );
 
             double bias = -layer->getBias( i );
 
@@ -767,7 +794,7 @@ void LPFormulator::addWeightedSumLayerToLpRelaxation( GurobiWrapper &gurobi, con
                     {
                         Stringf sourceVariableName( "x%u",
                                                     sourceLayer->neuronToVariable( j ) );
-                        terms.append( GurobiWrapper::Term( weight, sourceVariableName ) );
+                        terms.append( ILPSolver::Term( weight, sourceVariableName ) );
                     }
                     else
                     {
@@ -16,14 +16,13 @@
 #ifndef __LPFormulator_h__
 #define __LPFormulator_h__
 
-#include "GurobiWrapper.h"
+#include "ILPSolver.h"
 #include "LayerOwner.h"
 #include "ParallelSolver.h"
+#include "Statistics.h"
 #include <climits>
 
 #include <atomic>
-#include <boost/lockfree/queue.hpp>
-#include <boost/chrono.hpp>
 #include <mutex>
 
 namespace NLR {
@@ -58,6 +57,14 @@ public:
     */
     void setCutoff( double cutoff );
 
+    /*
+      Where to report the number and duration of the LP solves, per
+      layer. A solve counts as warm started if the solver had already
+      solved the same model, for another objective; the native solver
+      then starts from the last optimal basis.
+    */
+    void setStatistics( Statistics *statistics );
+
     /*
       Calls for creating an LP relaxation instance and solving it for
       a particular variable. These calls are useful if invoked as part
@@ -65,42 +72,43 @@ public:
       tightening
     */
     void createLPRelaxation( const Map<unsigned, Layer *> &layers,
-                             GurobiWrapper &gurobi,
+                             ILPSolver &gurobi,
                              unsigned lastLayer = UINT_MAX );
 
-    double solveLPRelaxation( GurobiWrapper &gurobi,
+    double solveLPRelaxation( ILPSolver &gurobi,
                               const Map<unsigned, Layer *> &layers,
                               MinOrMax minOrMax, String variableName,
                               unsigned lastLayer = UINT_MAX );
 
-    void addLayerToModel( GurobiWrapper &gurobi, const Layer *layer );
+    void addLayerToModel( ILPSolver &gurobi, const Layer *layer );
 
 private:
 
     LayerOwner *_layerOwner;
     bool _cutoffInUse;
     double _cutoffValue;
+    Statistics *_statistics;
 
-    void addInputLayerToLpRelaxation( GurobiWrapper &gurobi,
+    void addInputLayerToLpRelaxation( ILPSolver &gurobi,
                                       const Layer *layer );
 
-    void addReluLayerToLpRelaxation( GurobiWrapper &gurobi,
+    void addReluLayerToLpRelaxation( ILPSolver &gurobi,
                                      const Layer *layer );
 
-    void addSignLayerToLpRelaxation( GurobiWrapper &gurobi,
+    void addSignLayerToLpRelaxation( ILPSolver &gurobi,
                                      const Layer *layer );
 
-    void addMaxLayerToLpRelaxation( GurobiWrapper &gurobi,
+    void addMaxLayerToLpRelaxation( ILPSolver &gurobi,
                                      const Layer *layer );
 
-    void addWeightedSumLayerToLpRelaxation( GurobiWrapper &gurobi,
+    void addWeightedSumLayerToLpRelaxation( ILPSolver &gurobi,
                                             const Layer *layer );
 
     /*
       Optimize for the min/max value of variableName with respect to the constraints
       encoded in gurobi. If the query is infeasible, *infeasible is set to true.
     */
-    static double optimizeWithGurobi( GurobiWrapper &gurobi, MinOrMax minOrMax,
+    static double optimizeWithGurobi( ILPSolver &gurobi, MinOrMax minOrMax,
                                       String variableName, double cutoffValue,
                                       std::atomic_bool *infeasible = NULL );
 
@@ -108,6 +116,10 @@ private:
       Tighten the upper- and lower- bound of a varaible with LPRelaxation
     */
     static void tightenSingleVariableBoundsWithLPRelaxation( ThreadArgument &argument );
+
+    static void recordSolve( LayerSolveStatistics *solveStatistics,
+                             const struct timespec &start, bool warmStart );
+    void reportSolveStatistics( const Map<unsigned, LayerSolveStatistics> &solveStatistics ) const;
 };
 
 } // namespace NLR
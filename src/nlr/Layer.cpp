@@ -13,6 +13,7 @@
 
  **/
 
+#include "GlobalConfiguration.h"
 #include "Layer.h"
 #include "Options.h"
 #include "SymbolicBoundTighteningType.h"
@@ -38,6 +39,9 @@ Layer::Layer( unsigned index, Type type, unsigned size, LayerOwner *layerOwner )
     , _assignment( NULL )
     , _lb( NULL )
     , _ub( NULL )
+    , _propagatedLb( NULL )
+    , _propagatedUb( NULL )
+    , _propagatedBoundsValid( false )
     , _inputLayerSize( 0 )
     , _symbolicLb( NULL )
     , _symbolicUb( NULL )
@@ -65,6 +69,9 @@ void Layer::allocateMemory()
     std::fill_n( _lb, _size, 0 );
     std::fill_n( _ub, _size, 0 );
 
+    _propagatedLb = new double[_size];
+    _propagatedUb = new double[_size];
+
     _assignment = new double[_size];
 
     _inputLayerSize = ( _type == INPUT ) ? _size : _layerOwner->getLayer( 0 )->getSize();
@@ -203,17 +210,129 @@ void Layer::addSourceLayer( unsigned layerNumber, unsigned layerSize )
         return;
 
     _sourceLayers[layerNumber] = layerSize;
+    invalidatePropagatedBounds();
 
     if ( _type == WEIGHTED_SUM )
     {
-        _layerToWeights[layerNumber] = new double[layerSize * _size];
-        _layerToPositiveWeights[layerNumber] = new double[layerSize * _size];
-        _layerToNegativeWeights[layerNumber] = new double[layerSize * _size];
+        unsigned matrixSize = layerSize * _size;
+        double *storage = new double[matrixSize];
+        if ( !storage )
+            throw MarabouError( MarabouError::ALLOCATION_FAILED, "Layer::weights" );
+        std::fill_n( storage, matrixSize, 0 );
+
+        setWeightStorage( layerNumber, std::shared_ptr<double>
+                          ( storage, std::default_delete<double[]>() ) );
+    }
+}
+
+void Layer::setWeightStorage( unsigned sourceLayer, std::shared_ptr<double> storage )
+{
+    _layerToWeightStorage[sourceLayer] = storage;
+    _layerToWeights[sourceLayer] = storage.get();
+}
+
+void Layer::makeWeightsExclusive( unsigned sourceLayer )
+{
+    // Layers cloned from this one may still be reading the shared
+    // matrix, so copy it before the first write
+    if ( _layerToWeightStorage[sourceLayer].use_count() <= 1 )
+        return;
+
+    unsigned matrixSize = _sourceLayers[sourceLayer] * _size;
+    double *storage = new double[matrixSize];
+    if ( !storage )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Layer::weights" );
+    memcpy( storage, _layerToWeightStorage[sourceLayer].get(),
+            sizeof(double) * matrixSize );
+
+    setWeightStorage( sourceLayer, std::shared_ptr<double>
+                      ( storage, std::default_delete<double[]>() ) );
+}
+
+void Layer::discardWeightRepresentation( unsigned sourceLayer )
+{
+    if ( _layerToSignedWeightStorage.exists( sourceLayer ) )
+    {
+        _layerToSignedWeightStorage.erase( sourceLayer );
+        _layerToPositiveWeights.erase( sourceLayer );
+        _layerToNegativeWeights.erase( sourceLayer );
+    }
+
+    if ( _layerToSparseWeights.exists( sourceLayer ) )
+        _layerToSparseWeights.erase( sourceLayer );
+}
+
+void Layer::updateWeightRepresentation( unsigned sourceLayer )
+{
+    if ( _layerToSparseWeights.exists( sourceLayer ) ||
+         _layerToSignedWeightStorage.exists( sourceLayer ) )
+        return;
+
+    unsigned sourceLayerSize = _sourceLayers[sourceLayer];
+    unsigned matrixSize = sourceLayerSize * _size;
+    const double *weights = _layerToWeights[sourceLayer];
+
+    /*
+      Tiny weights are kept: multiplied by a huge or infinite source
+      bound, they still matter, and dropping them would make the
+      bounds tighter than those of the dense representation.
+    */
+    unsigned nnz = 0;
+    for ( unsigned i = 0; i < matrixSize; ++i )
+    {
+        if ( weights[i] != 0 )
+            ++nnz;
+    }
+
+    if ( nnz <= GlobalConfiguration::NLR_SPARSE_WEIGHTS_DENSITY_THRESHOLD * matrixSize )
+    {
+        // Rows correspond to neurons of the source layer
+        std::shared_ptr<CSRMatrix> sparseWeights = std::make_shared<CSRMatrix>();
+        sparseWeights->initializeExact( weights, sourceLayerSize, _size );
+        _layerToSparseWeights[sourceLayer] = sparseWeights;
+        return;
+    }
+
+    double *storage = new double[2 * matrixSize];
+    if ( !storage )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Layer::signedWeights" );
 
-        std::fill_n( _layerToWeights[layerNumber], layerSize * _size, 0 );
-        std::fill_n( _layerToPositiveWeights[layerNumber], layerSize * _size, 0 );
-        std::fill_n( _layerToNegativeWeights[layerNumber], layerSize * _size, 0 );
+    double *positiveWeights = storage;
+    double *negativeWeights = storage + matrixSize;
+    for ( unsigned i = 0; i < matrixSize; ++i )
+    {
+        positiveWeights[i] = weights[i] > 0 ? weights[i] : 0;
+        negativeWeights[i] = weights[i] > 0 ? 0 : weights[i];
     }
+
+    _layerToSignedWeightStorage[sourceLayer] = std::shared_ptr<double>
+        ( storage, std::default_delete<double[]>() );
+    _layerToPositiveWeights[sourceLayer] = positiveWeights;
+    _layerToNegativeWeights[sourceLayer] = negativeWeights;
+}
+
+const CSRMatrix *Layer::getSparseWeights( unsigned sourceLayer )
+{
+    updateWeightRepresentation( sourceLayer );
+    if ( !_layerToSparseWeights.exists( sourceLayer ) )
+        return NULL;
+    return _layerToSparseWeights[sourceLayer].get();
+}
+
+void Layer::updateWeightRepresentations()
+{
+    if ( _type != WEIGHTED_SUM )
+        return;
+
+    for ( const auto &sourceLayer : _sourceLayers )
+        updateWeightRepresentation( sourceLayer.first );
+}
+
+bool Layer::sharesWeightsWith( const Layer &other, unsigned sourceLayer ) const
+{
+    return _layerToWeightStorage.exists( sourceLayer ) &&
+        other._layerToWeightStorage.exists( sourceLayer ) &&
+        _layerToWeightStorage[sourceLayer] == other._layerToWeightStorage[sourceLayer];
 }
 
 const Map<unsigned, unsigned> &Layer::getSourceLayers() const
@@ -231,31 +350,21 @@ void Layer::removeSourceLayer( unsigned sourceLayer )
 {
     ASSERT( _sourceLayers.exists( sourceLayer ) );
 
-    delete[] _layerToWeights[sourceLayer];
-    delete[] _layerToPositiveWeights[sourceLayer];
-    delete[] _layerToNegativeWeights[sourceLayer];
-
     _sourceLayers.erase( sourceLayer );
+    invalidatePropagatedBounds();
+    _layerToWeightStorage.erase( sourceLayer );
     _layerToWeights.erase( sourceLayer );
-    _layerToPositiveWeights.erase( sourceLayer );
-    _layerToNegativeWeights.erase( sourceLayer );
+    discardWeightRepresentation( sourceLayer );
 }
 
 void Layer::setWeight( unsigned sourceLayer, unsigned sourceNeuron, unsigned targetNeuron, double weight )
 {
+    makeWeightsExclusive( sourceLayer );
+    discardWeightRepresentation( sourceLayer );
+    invalidatePropagatedBounds();
+
     unsigned index = sourceNeuron * _size + targetNeuron;
     _layerToWeights[sourceLayer][index] = weight;
-
-    if ( weight > 0 )
-    {
-        _layerToPositiveWeights[sourceLayer][index] = weight;
-        _layerToNegativeWeights[sourceLayer][index] = 0;
-    }
-    else
-    {
-        _layerToPositiveWeights[sourceLayer][index] = 0;
-        _layerToNegativeWeights[sourceLayer][index] = weight;
-    }
 }
 
 double Layer::getWeight( unsigned sourceLayer,
@@ -271,19 +380,10 @@ double *Layer::getWeights( unsigned sourceLayerIndex ) const
     return _layerToWeights[sourceLayerIndex];
 }
 
-double *Layer::getPositiveWeights( unsigned sourceLayerIndex ) const
-{
-    return _layerToPositiveWeights[sourceLayerIndex];
-}
-
-double *Layer::getNegativeWeights( unsigned sourceLayerIndex ) const
-{
-    return _layerToNegativeWeights[sourceLayerIndex];
-}
-
 void Layer::setBias( unsigned neuron, double bias )
 {
     _bias[neuron] = bias;
+    invalidatePropagatedBounds();
 }
 
 double Layer::getBias( unsigned neuron ) const
@@ -304,6 +404,7 @@ void Layer::addActivationSource( unsigned sourceLayer, unsigned sourceNeuron, un
         _neuronToActivationSources[targetNeuron] = List<NeuronIndex>();
 
     _neuronToActivationSources[targetNeuron].append( NeuronIndex( sourceLayer, sourceNeuron ) );
+    invalidatePropagatedBounds();
 
     DEBUG({
             if ( _type == RELU || _type == ABSOLUTE_VALUE || _type == SIGN )
@@ -391,6 +492,32 @@ void Layer::setUb( unsigned neuron, double bound )
     _ub[neuron] = bound;
 }
 
+void Layer::storePropagatedBounds()
+{
+    memcpy( _propagatedLb, _lb, sizeof(double) * _size );
+    memcpy( _propagatedUb, _ub, sizeof(double) * _size );
+    _propagatedBoundsValid = true;
+}
+
+void Layer::invalidatePropagatedBounds()
+{
+    _propagatedBoundsValid = false;
+}
+
+bool Layer::boundsChangedSincePropagation() const
+{
+    if ( !_propagatedBoundsValid )
+        return true;
+
+    for ( unsigned i = 0; i < _size; ++i )
+    {
+        if ( _lb[i] != _propagatedLb[i] || _ub[i] != _propagatedUb[i] )
+            return true;
+    }
+
+    return false;
+}
+
 void Layer::computeIntervalArithmeticBounds()
 {
     ASSERT( _type != INPUT );
@@ -438,6 +565,41 @@ void Layer::computeIntervalArithmeticBoundsForWeightedSum()
         unsigned sourceLayerIndex = sourceLayerEntry.first;
         unsigned sourceLayerSize = sourceLayerEntry.second;
         const Layer *sourceLayer = _layerOwner->getLayer( sourceLayerIndex );
+
+        const CSRMatrix *sparseWeights = getSparseWeights( sourceLayerIndex );
+        if ( sparseWeights )
+        {
+            // Only visit the non-zero weights, row by row
+            const double *values = sparseWeights->getA();
+            const unsigned *rowStart = sparseWeights->getIA();
+            const unsigned *columns = sparseWeights->getJA();
+
+            for ( unsigned j = 0; j < sourceLayerSize; ++j )
+            {
+                double previousLb = sourceLayer->getLb( j );
+                double previousUb = sourceLayer->getUb( j );
+
+                for ( unsigned entry = rowStart[j]; entry < rowStart[j + 1]; ++entry )
+                {
+                    unsigned i = columns[entry];
+                    double weight = values[entry];
+
+                    if ( weight > 0 )
+                    {
+                        newLb[i] += weight * previousLb;
+                        newUb[i] += weight * previousUb;
+                    }
+                    else
+                    {
+                        newLb[i] += weight * previousUb;
+                        newUb[i] += weight * previousLb;
+                    }
+                }
+            }
+
+            continue;
+        }
+
         const double *weights = _layerToWeights[sourceLayerIndex];
 
         for ( unsigned i = 0; i < _size; ++i )
@@ -1204,6 +1366,14 @@ void Layer::computeSymbolicBoundsForWeightedSum()
         unsigned sourceLayerSize = sourceLayerEntry.second;
         const Layer *sourceLayer = _layerOwner->getLayer( sourceLayerEntry.first );
 
+        const CSRMatrix *sparseWeights = getSparseWeights( sourceLayerIndex );
+        if ( sparseWeights )
+        {
+            computeSymbolicBoundsForSparseWeightedSum( sourceLayer, sourceLayerSize,
+                                                       sparseWeights );
+            continue;
+        }
+
         /*
           Perform the multiplication
 
@@ -1331,6 +1501,92 @@ void Layer::computeSymbolicBoundsForWeightedSum()
     }
 }
 
+void Layer::computeSymbolicBoundsForSparseWeightedSum( const Layer *sourceLayer,
+                                                       unsigned sourceLayerSize,
+                                                       const CSRMatrix *weights )
+{
+    /*
+      Same as the dense multiplication, but row k of the weights only
+      contributes its non-zero entries:
+
+      newUB[i][j] += oldUB[i][k] * w_kj   if w_kj > 0, and oldLB[i][k] * w_kj otherwise
+      newLB[i][j] += oldLB[i][k] * w_kj   if w_kj > 0, and oldUB[i][k] * w_kj otherwise
+    */
+    const double *values = weights->getA();
+    const unsigned *rowStart = weights->getIA();
+    const unsigned *columns = weights->getJA();
+
+    const double *sourceSymbolicLb = sourceLayer->getSymbolicLb();
+    const double *sourceSymbolicUb = sourceLayer->getSymbolicUb();
+
+    for ( unsigned i = 0; i < _inputLayerSize; ++i )
+    {
+        double *symbolicLbRow = _symbolicLb + i * _size;
+        double *symbolicUbRow = _symbolicUb + i * _size;
+
+        for ( unsigned k = 0; k < sourceLayerSize; ++k )
+        {
+            double sourceLb = sourceSymbolicLb[i * sourceLayerSize + k];
+            double sourceUb = sourceSymbolicUb[i * sourceLayerSize + k];
+            if ( sourceLb == 0 && sourceUb == 0 )
+                continue;
+
+            for ( unsigned entry = rowStart[k]; entry < rowStart[k + 1]; ++entry )
+            {
+                unsigned j = columns[entry];
+                double weight = values[entry];
+
+                if ( weight > 0 )
+                {
+                    symbolicLbRow[j] += sourceLb * weight;
+                    symbolicUbRow[j] += sourceUb * weight;
+                }
+                else
+                {
+                    symbolicLbRow[j] += sourceUb * weight;
+                    symbolicUbRow[j] += sourceLb * weight;
+                }
+            }
+        }
+    }
+
+    // Restore the zero bound on eliminated neurons
+    for ( const auto &eliminated : _eliminatedNeurons )
+    {
+        for ( unsigned i = 0; i < _inputLayerSize; ++i )
+        {
+            unsigned index = i * _size + eliminated.first;
+            _symbolicLb[index] = 0;
+            _symbolicUb[index] = 0;
+        }
+    }
+
+    // Add the weighted biases from the source layer
+    const double *sourceLowerBias = sourceLayer->getSymbolicLowerBias();
+    const double *sourceUpperBias = sourceLayer->getSymbolicUpperBias();
+    for ( unsigned k = 0; k < sourceLayerSize; ++k )
+    {
+        for ( unsigned entry = rowStart[k]; entry < rowStart[k + 1]; ++entry )
+        {
+            unsigned j = columns[entry];
+            if ( !_eliminatedNeurons.empty() && _eliminatedNeurons.exists( j ) )
+                continue;
+
+            double weight = values[entry];
+            if ( weight > 0 )
+            {
+                _symbolicLowerBias[j] += sourceLowerBias[k] * weight;
+                _symbolicUpperBias[j] += sourceUpperBias[k] * weight;
+            }
+            else
+            {
+                _symbolicLowerBias[j] += sourceUpperBias[k] * weight;
+                _symbolicUpperBias[j] += sourceLowerBias[k] * weight;
+            }
+        }
+    }
+}
+
 void Layer::eliminateVariable( unsigned variable, double value )
 {
     if ( !_variableToNeuron.exists( variable ) )
@@ -1342,6 +1598,7 @@ void Layer::eliminateVariable( unsigned variable, double value )
     _eliminatedNeurons[neuron] = value;
     _lb[neuron] = value;
     _ub[neuron] = value;
+    invalidatePropagatedBounds();
     _neuronToVariable.erase( _variableToNeuron[variable] );
     _variableToNeuron.erase( variable );
 }
@@ -1402,6 +1659,9 @@ Layer::Layer( const Layer *other )
     , _assignment( NULL )
     , _lb( NULL )
     , _ub( NULL )
+    , _propagatedLb( NULL )
+    , _propagatedUb( NULL )
+    , _propagatedBoundsValid( false )
     , _inputLayerSize( 0 )
     , _symbolicLb( NULL )
     , _symbolicUb( NULL )
@@ -1419,25 +1679,16 @@ Layer::Layer( const Layer *other )
 
     allocateMemory();
 
-    for ( auto &sourceLayerEntry : other->_sourceLayers )
-    {
-        addSourceLayer( sourceLayerEntry.first, sourceLayerEntry.second );
-
-        if ( other->_layerToWeights.exists( sourceLayerEntry.first ) )
-            memcpy( _layerToWeights[sourceLayerEntry.first],
-                    other->_layerToWeights[sourceLayerEntry.first],
-                    sizeof(double) * sourceLayerEntry.second * _size );
-
-        if ( other->_layerToPositiveWeights.exists( sourceLayerEntry.first ) )
-            memcpy( _layerToPositiveWeights[sourceLayerEntry.first],
-                    other->_layerToPositiveWeights[sourceLayerEntry.first],
-                    sizeof(double) * sourceLayerEntry.second * _size );
-
-        if ( other->_layerToNegativeWeights.exists( sourceLayerEntry.first ) )
-            memcpy( _layerToNegativeWeights[sourceLayerEntry.first],
-                    other->_layerToNegativeWeights[sourceLayerEntry.first],
-                    sizeof(double) * sourceLayerEntry.second * _size );
-    }
+    // The weight matrices are shared with the other layer, and are only
+    // copied if one of the layers later changes them
+    _sourceLayers = other->_sourceLayers;
+    for ( const auto &storage : other->_layerToWeightStorage )
+        setWeightStorage( storage.first, storage.second );
+
+    _layerToSignedWeightStorage = other->_layerToSignedWeightStorage;
+    _layerToPositiveWeights = other->_layerToPositiveWeights;
+    _layerToNegativeWeights = other->_layerToNegativeWeights;
+    _layerToSparseWeights = other->_layerToSparseWeights;
 
     if ( other->_bias )
         memcpy( _bias, other->_bias, sizeof(double) * _size );
@@ -1493,17 +1744,12 @@ double Layer::getSymbolicUbOfUb( unsigned neuron ) const
 
 void Layer::freeMemoryIfNeeded()
 {
-    for ( const auto &weights : _layerToWeights )
-        delete[] weights.second;
+    _layerToWeightStorage.clear();
     _layerToWeights.clear();
-
-    for ( const auto &weights : _layerToPositiveWeights )
-        delete[] weights.second;
+    _layerToSignedWeightStorage.clear();
     _layerToPositiveWeights.clear();
-
-    for ( const auto &weights : _layerToNegativeWeights )
-        delete[] weights.second;
     _layerToNegativeWeights.clear();
+    _layerToSparseWeights.clear();
 
     if ( _bias )
     {
@@ -1529,6 +1775,20 @@ void Layer::freeMemoryIfNeeded()
         _ub = NULL;
     }
 
+    if ( _propagatedLb )
+    {
+        delete[] _propagatedLb;
+        _propagatedLb = NULL;
+    }
+
+    if ( _propagatedUb )
+    {
+        delete[] _propagatedUb;
+        _propagatedUb = NULL;
+    }
+
+    _propagatedBoundsValid = false;
+
     if ( _symbolicLb )
     {
         delete[] _symbolicLb;
@@ -1726,6 +1986,8 @@ double Layer::getEliminatedNeuronValue( unsigned neuron ) const
 
 void Layer::reduceIndexFromAllMaps( unsigned startIndex )
 {
+    invalidatePropagatedBounds();
+
     // Adjust the source layers
     Map<unsigned, unsigned> copyOfSources = _sourceLayers;
     _sourceLayers.clear();
@@ -1733,9 +1995,12 @@ void Layer::reduceIndexFromAllMaps( unsigned startIndex )
         _sourceLayers[pair.first >= startIndex ? pair.first - 1 : pair.first] = pair.second;
 
     // Adjust all weight maps
+    adjustWeightMapIndexing( _layerToWeightStorage, startIndex );
     adjustWeightMapIndexing( _layerToWeights, startIndex );
+    adjustWeightMapIndexing( _layerToSignedWeightStorage, startIndex );
     adjustWeightMapIndexing( _layerToPositiveWeights, startIndex );
     adjustWeightMapIndexing( _layerToNegativeWeights, startIndex );
+    adjustWeightMapIndexing( _layerToSparseWeights, startIndex );
 
     // Adjust the neuron activations
     for ( auto &neuronToSources : _neuronToActivationSources )
@@ -1748,14 +2013,6 @@ void Layer::reduceIndexFromAllMaps( unsigned startIndex )
     }
 }
 
-void Layer::adjustWeightMapIndexing( Map<unsigned, double *> &map, unsigned startIndex )
-{
-    Map<unsigned, double *> copyOfWeights = map;
-    map.clear();
-    for ( const auto &pair : copyOfWeights )
-        map[pair.first >= startIndex ? pair.first - 1 : pair.first] = pair.second;
-}
-
 void Layer::reduceIndexAfterMerge( unsigned startIndex )
 {
     if ( _layerIndex >= startIndex )
@@ -1788,15 +2045,10 @@ bool Layer::operator==( const Layer &layer ) const
     if ( _sourceLayers != layer._sourceLayers )
         return false;
 
+    // The other weight representations are derived from these weights
     if ( !compareWeights( _layerToWeights, layer._layerToWeights ) )
         return false;
 
-    if ( !compareWeights( _layerToPositiveWeights, layer._layerToPositiveWeights ) )
-        return false;
-
-    if ( !compareWeights( _layerToNegativeWeights, layer._layerToNegativeWeights ) )
-        return false;
-
     return true;
 }
 
@@ -17,6 +17,7 @@
 #define __Layer_h__
 
 #include "AbsoluteValueConstraint.h"
+#include "CSRMatrix.h"
 #include "Debug.h"
 #include "FloatUtils.h"
 #include "LayerOwner.h"
@@ -27,6 +28,8 @@
 #include "ReluConstraint.h"
 #include "SignConstraint.h"
 
+#include <memory>
+
 namespace NLR {
 
 class Layer
@@ -58,6 +61,12 @@ public:
     const Map<unsigned, unsigned> &getSourceLayers() const;
     const double *getWeightMatrix( unsigned sourceLayer ) const;
 
+    /*
+      Whether this layer and the other layer, typically a clone, share the
+      same weight matrices for the given source layer
+    */
+    bool sharesWeightsWith( const Layer &other, unsigned sourceLayer ) const;
+
     /*
      Receives an index of a layer and updates all the layer maps (for weights, source layers and
      activations) so any layer index in the map, which is equal or higher than the given startIndex,
@@ -73,8 +82,20 @@ public:
                       unsigned sourceNeuron,
                       unsigned targetNeuron ) const;
     double *getWeights( unsigned sourceLayerIndex ) const;
-    double *getPositiveWeights( unsigned sourceLayerIndex ) const;
-    double *getNegativeWeights( unsigned sourceLayerIndex ) const;
+
+    /*
+      The weights from the given source layer in CSR format, with a row
+      per source neuron, if the matrix is sparse enough to be propagated
+      in this form; or NULL otherwise.
+    */
+    const CSRMatrix *getSparseWeights( unsigned sourceLayerIndex );
+
+    /*
+      Build the representations of all weight matrices that
+      getSparseWeights() and the propagation passes use, so that they can
+      then be read concurrently
+    */
+    void updateWeightRepresentations();
 
     void setBias( unsigned neuron, double bias );
     double getBias( unsigned neuron ) const;
@@ -119,6 +140,17 @@ public:
     void computeSymbolicBounds();
     void computeIntervalArithmeticBounds();
 
+    /*
+      Symbolic propagation passes record the bounds of the layer once
+      they are done with it. As long as the bounds of this layer and of
+      all layers before it are unchanged, and the layer itself is not
+      modified, the results of the previous pass for this layer are still
+      valid and need not be recomputed.
+    */
+    void storePropagatedBounds();
+    void invalidatePropagatedBounds();
+    bool boundsChangedSincePropagation() const;
+
     /*
       Preprocessing functionality: variable elimination and reindexing
     */
@@ -150,9 +182,23 @@ private:
 
     Map<unsigned, unsigned> _sourceLayers;
 
+    /*
+      The dense weight matrix from each source layer. Matrices are shared
+      between a layer and its clones, and copied on the first write.
+    */
+    Map<unsigned, std::shared_ptr<double>> _layerToWeightStorage;
     Map<unsigned, double *> _layerToWeights;
+
+    /*
+      The representation of each weight matrix used for propagation,
+      derived from the dense matrix when first needed and discarded when
+      a weight changes: a CSR matrix if the matrix is sparse, or else its
+      positive and negative parts, stored in a single block.
+    */
+    Map<unsigned, std::shared_ptr<double>> _layerToSignedWeightStorage;
     Map<unsigned, double *> _layerToPositiveWeights;
     Map<unsigned, double *> _layerToNegativeWeights;
+    Map<unsigned, std::shared_ptr<CSRMatrix>> _layerToSparseWeights;
     double *_bias;
 
     double *_assignment;
@@ -160,6 +206,13 @@ private:
     double *_lb;
     double *_ub;
 
+    /*
+      The bounds recorded by storePropagatedBounds()
+    */
+    double *_propagatedLb;
+    double *_propagatedUb;
+    bool _propagatedBoundsValid;
+
     Map<unsigned, List<NeuronIndex>> _neuronToActivationSources;
 
     Map<unsigned, unsigned> _neuronToVariable;
@@ -179,6 +232,20 @@ private:
     void allocateMemory();
     void freeMemoryIfNeeded();
 
+    /*
+      Point the weight map of the given source layer at a weight matrix,
+      and copy the matrix first if it is shared with another layer
+    */
+    void setWeightStorage( unsigned sourceLayer, std::shared_ptr<double> storage );
+    void makeWeightsExclusive( unsigned sourceLayer );
+
+    /*
+      Build the sparse or signed representation of a weight matrix, if
+      it is not already available, or discard it
+    */
+    void updateWeightRepresentation( unsigned sourceLayer );
+    void discardWeightRepresentation( unsigned sourceLayer );
+
     /*
       Helper functions for symbolic bound tightening
     */
@@ -187,6 +254,9 @@ private:
     void computeSymbolicBoundsForSign();
     void computeSymbolicBoundsForAbsoluteValue();
     void computeSymbolicBoundsForWeightedSum();
+    void computeSymbolicBoundsForSparseWeightedSum( const Layer *sourceLayer,
+                                                    unsigned sourceLayerSize,
+                                                    const CSRMatrix *weights );
     void computeSymbolicBoundsDefault();
 
     /*
@@ -206,8 +276,14 @@ private:
     double getSymbolicLbOfUb( unsigned neuron ) const;
     double getSymbolicUbOfUb( unsigned neuron ) const;
 
-    void adjustWeightMapIndexing( Map<unsigned, double *> &map,
-                                  unsigned indexToStart );
+    template <typename T>
+    void adjustWeightMapIndexing( Map<unsigned, T> &map, unsigned startIndex )
+    {
+        Map<unsigned, T> copyOfWeights = map;
+        map.clear();
+        for ( const auto &pair : copyOfWeights )
+            map[pair.first >= startIndex ? pair.first - 1 : pair.first] = pair.second;
+    }
     };
 
 } // namespace NLR
@@ -13,9 +13,9 @@
 
  **/
 
-#include "GurobiWrapper.h"
 #include "InfeasibleQueryException.h"
 #include "LPFormulator.h"
+#include "LPSolverFactory.h"
 #include "Layer.h"
 #include "MILPFormulator.h"
 #include "MStringf.h"
@@ -23,7 +23,7 @@
 #include "Options.h"
 #include "TimeUtils.h"
 
-#include <boost/thread.hpp>
+#include <memory>
 
 namespace NLR {
 
@@ -48,11 +48,12 @@ void MILPFormulator::optimizeBoundsWithIncrementalMILPEncoding( const Map<unsign
     _signChanges = 0;
     _cutoffs = 0;
 
-    GurobiWrapper gurobi;
+    std::unique_ptr<ILPSolver> lpSolver( LPSolverFactory::createLPSolver() );
+    ILPSolver &gurobi = *lpSolver;
 
     double currentLb;
     double currentUb;
-    List<GurobiWrapper::Term> terms;
+    List<ILPSolver::Term> terms;
     Map<String, double> dontCare;
 
     struct timespec gurobiStart = TimeUtils::sampleMicro();
@@ -100,7 +101,7 @@ void MILPFormulator::optimizeBoundsWithIncrementalMILPEncoding( const Map<unsign
             Stringf variableName( "x%u", variable );
 
             terms.clear();
-            terms.append( GurobiWrapper::Term( 1, variableName ) );
+            terms.append( ILPSolver::Term( 1, variableName ) );
 
             // Maximize, using just the LP relaxation for the current layer
             if ( tightenUpperBound( gurobi, layer, j, variable, currentUb ) )
@@ -145,30 +146,13 @@ void MILPFormulator::optimizeBoundsWithIncrementalMILPEncoding( const Map<unsign
 
 void MILPFormulator::optimizeBoundsWithMILPEncoding( const Map<unsigned, Layer *> &layers )
 {
-    unsigned numberOfWorkers = Options::get()->getInt( Options::NUM_WORKERS );
+    // One solver per thread of the pool
+    Solvers solvers;
+    createSolvers( solvers );
 
-    // Time to wait if no idle worker is availble
-    boost::chrono::milliseconds waitTime( numberOfWorkers - 1 );
-
-    Map<GurobiWrapper *, unsigned> solverToIndex;
-    // Create a queue of free workers
-    // When a worker is working, it is popped off the queue, when it is done, it
-    // is added back to the queue.
-    SolverQueue freeSolvers( numberOfWorkers );
-    for ( unsigned i = 0; i < numberOfWorkers; ++i )
-    {
-        GurobiWrapper *gurobi = new GurobiWrapper();
-        solverToIndex[gurobi] = i;
-        enqueueSolver( freeSolvers, gurobi );
-    }
-
-    boost::thread *threads = new boost::thread[numberOfWorkers];
     std::mutex mtx;
     std::atomic_bool infeasible( false );
 
-    double currentLb;
-    double currentUb;
-
     std::atomic_uint tighterBoundCounter( 0 );
     std::atomic_uint signChanges( 0 );
     std::atomic_uint cutoffs( 0 );
@@ -179,61 +163,38 @@ void MILPFormulator::optimizeBoundsWithMILPEncoding( const Map<unsigned, Layer *
     {
         Layer *layer = currentLayer.second;
 
-        for ( unsigned i = 0; i < layer->getSize(); ++i )
+        runJobs( layer->getSize(), [&]( unsigned i, unsigned threadIndex )
         {
-            if ( layer->neuronEliminated( i ) )
-                continue;
+            if ( infeasible || layer->neuronEliminated( i ) )
+                return;
 
-            currentLb = layer->getLb( i );
-            currentUb = layer->getUb( i );
+            double currentLb = layer->getLb( i );
+            double currentUb = layer->getUb( i );
 
             if ( _cutoffInUse && ( currentLb > _cutoffValue || currentUb < _cutoffValue ) )
-                continue;
-
-            if ( infeasible )
-            {
-                // infeasibility is derived, interupt all active threads
-                for ( unsigned i = 0; i < numberOfWorkers; ++i )
-                {
-                    threads[i].interrupt();
-                    threads[i].join();
-                }
-                clearSolverQueue( freeSolvers );
-                throw InfeasibleQueryException();
-            }
-
-            // Wait until there is an idle solver
-            GurobiWrapper *freeSolver;
-            while ( !freeSolvers.pop( freeSolver ) )
-                boost::this_thread::sleep_for( waitTime );
+                return;
 
-            freeSolver->resetModel();
+            ILPSolver *solver = solvers[threadIndex].get();
+            solver->resetModel();
 
             mtx.lock();
-            _lpFormulator.createLPRelaxation( layers, *freeSolver, layer->getLayerIndex() );
+            _lpFormulator.createLPRelaxation( layers, *solver, layer->getLayerIndex() );
             mtx.unlock();
 
-            // spawn a thread to tighten the bounds for the current variable
-            ThreadArgument argument( freeSolver, layer, &layers,
+            ThreadArgument argument( solver, layer, &layers,
                                      i, currentLb, currentUb,
                                      _cutoffInUse, _cutoffValue,
-                                     _layerOwner, std::ref( freeSolvers ),
+                                     _layerOwner,
                                      std::ref( mtx ), std::ref( infeasible ),
                                      std::ref( tighterBoundCounter ),
                                      std::ref( signChanges ),
                                      std::ref( cutoffs ) );
 
-            if ( numberOfWorkers == 1 )
-                tightenSingleVariableBoundsWithMILPEncoding( argument );
-            else
-                threads[solverToIndex[freeSolver]] = boost::thread
-                    ( tightenSingleVariableBoundsWithMILPEncoding, argument );
-        }
-    }
+            tightenSingleVariableBoundsWithMILPEncoding( argument );
+        } );
 
-    for ( unsigned i = 0; i < numberOfWorkers; ++i )
-    {
-        threads[i].join();
+        if ( infeasible )
+            throw InfeasibleQueryException();
     }
 
     struct timespec gurobiEnd = TimeUtils::sampleMicro();
@@ -241,194 +202,176 @@ void MILPFormulator::optimizeBoundsWithMILPEncoding( const Map<unsigned, Layer *
     log( Stringf( "Number of tighter bounds found by Gurobi: %u. Sign changes: %u. Cutoffs: %u\n",
                   tighterBoundCounter.load(), signChanges.load(), cutoffs.load() ) );
     log( Stringf( "Seconds spent Gurobiing: %llu\n", TimeUtils::timePassed( gurobiStart, gurobiEnd ) / 1000000 ) );
-
-    clearSolverQueue( freeSolvers );
-
-    if ( infeasible )
-        throw InfeasibleQueryException();
 }
 
 void MILPFormulator::tightenSingleVariableBoundsWithMILPEncoding( ThreadArgument &argument )
 {
-    try
-    {
-        /*
-          The optimiziation is performed layer by layer, and for each
-          individual neuron. It has 4 steps:
+    /*
+      The optimiziation is performed layer by layer, and for each
+      individual neuron. It has 4 steps:
+
+      1. Use an LP relaxation to minimize the variable
+      2. Use an LP relaxation to maximize the variable
+      3. Use a MILP encoding to minimize the variable
+      4. Use a MILP encoding to maximize the variable
+
+      We perform the steps in this order, and stop if at some
+      point we discover either an upper bound that is non-positive
+      or a lower obund that is non-negative (this is aimed at
+      ReLUs, as their phase would become fixed in these cases)
+    */
 
-          1. Use an LP relaxation to minimize the variable
-          2. Use an LP relaxation to maximize the variable
-          3. Use a MILP encoding to minimize the variable
-          4. Use a MILP encoding to maximize the variable
+    ILPSolver *gurobi = argument._gurobi;
+    Layer *layer = argument._layer;
+    const Map<unsigned, Layer *> &layers = *( argument._layers );
+    unsigned index = argument._index;
+    double currentLb = argument._currentLb;
+    double currentUb = argument._currentUb;
+    bool cutoffInUse = argument._cutoffInUse;
+    double cutoffValue = argument._cutoffValue;
+    LayerOwner *layerOwner = argument._layerOwner;
+    std::mutex &mtx = argument._mtx;
+    std::atomic_bool &infeasible = argument._infeasible;
+    std::atomic_uint &tighterBoundCounter = argument._tighterBoundCounter;
+    std::atomic_uint &signChanges = argument._signChanges;
+    std::atomic_uint &cutoffs = argument._cutoffs;
+
+    // LP Relaxation
+    log( Stringf( "Tightening bounds for layer %u index %u",
+                               layer->getLayerIndex(), index ).ascii() );
+
+    unsigned variable = layer->neuronToVariable( index );
+    Stringf variableName( "x%u", variable );
 
-          We perform the steps in this order, and stop if at some
-          point we discover either an upper bound that is non-positive
-          or a lower obund that is non-negative (this is aimed at
-          ReLUs, as their phase would become fixed in these cases)
-        */
+    log( Stringf( "Computing lowerbound..." ).ascii() );
+    double lb = optimizeWithGurobi( *gurobi, MinOrMax::MIN, variableName,
+                                    cutoffValue, &infeasible );
+    log( Stringf( "Lowerbound computed: %f", lb ).ascii() );
 
-        GurobiWrapper *gurobi = argument._gurobi;
-        Layer *layer = argument._layer;
-        const Map<unsigned, Layer *> &layers = *( argument._layers );
-        unsigned index = argument._index;
-        double currentLb = argument._currentLb;
-        double currentUb = argument._currentUb;
-        bool cutoffInUse = argument._cutoffInUse;
-        double cutoffValue = argument._cutoffValue;
-        LayerOwner *layerOwner = argument._layerOwner;
-        SolverQueue &freeSolvers = argument._freeSolvers;
-        std::mutex &mtx = argument._mtx;
-        std::atomic_bool &infeasible = argument._infeasible;
-        std::atomic_uint &tighterBoundCounter = argument._tighterBoundCounter;
-        std::atomic_uint &signChanges = argument._signChanges;
-        std::atomic_uint &cutoffs = argument._cutoffs;
-
-        // LP Relaxation
-        log( Stringf( "Tightening bounds for layer %u index %u",
-                                   layer->getLayerIndex(), index ).ascii() );
-
-        unsigned variable = layer->neuronToVariable( index );
-        Stringf variableName( "x%u", variable );
-
-        log( Stringf( "Computing lowerbound..." ).ascii() );
-        double lb = optimizeWithGurobi( *gurobi, MinOrMax::MIN, variableName,
-                                        cutoffValue, &infeasible );
-        log( Stringf( "Lowerbound computed: %f", lb ).ascii() );
-
-        // Store the new bound if it is tighter
-        if ( lb > currentLb )
+    // Store the new bound if it is tighter
+    if ( lb > currentLb )
+    {
+        if ( FloatUtils::isNegative( currentLb ) &&
+             !FloatUtils::isNegative( lb ) )
+            ++signChanges;
+
+        mtx.lock();
+        layer->setLb( index, lb );
+        layerOwner->receiveTighterBound( Tightening( variable,
+                                                     lb,
+                                                     Tightening::LB ) );
+        mtx.unlock();
+        ++tighterBoundCounter;
+
+        if ( cutoffInUse && lb > cutoffValue )
         {
-            if ( FloatUtils::isNegative( currentLb ) &&
-                 !FloatUtils::isNegative( lb ) )
-                ++signChanges;
-
-            mtx.lock();
-            layer->setLb( index, lb );
-            layerOwner->receiveTighterBound( Tightening( variable,
-                                                         lb,
-                                                         Tightening::LB ) );
-            mtx.unlock();
-            ++tighterBoundCounter;
-
-            if ( cutoffInUse && lb > cutoffValue )
-            {
-                ++cutoffs;
-                enqueueSolver( freeSolvers, gurobi );
-                return;
-            }
+            ++cutoffs;
+            return;
         }
+    }
 
-        log( Stringf( "Computing upperbound..." ).ascii() );
-        gurobi->reset();
-        double ub = optimizeWithGurobi( *gurobi, MinOrMax::MAX, variableName,
-                                        cutoffValue, &infeasible );
-        log( Stringf( "Upperbound computed %f", ub ).ascii() );
-
-        // Store the new bound if it is tighter
-        if ( ub < currentUb )
-        {
-            if ( FloatUtils::isPositive( currentUb ) &&
-                 !FloatUtils::isPositive( ub ) )
-                ++signChanges;
+    log( Stringf( "Computing upperbound..." ).ascii() );
+    gurobi->reset();
+    double ub = optimizeWithGurobi( *gurobi, MinOrMax::MAX, variableName,
+                                    cutoffValue, &infeasible );
+    log( Stringf( "Upperbound computed %f", ub ).ascii() );
 
-            mtx.lock();
-            layer->setUb( index, ub );
-            layerOwner->receiveTighterBound( Tightening( variable,
-                                                         ub,
-                                                         Tightening::UB ) );
-            mtx.unlock();
+    // Store the new bound if it is tighter
+    if ( ub < currentUb )
+    {
+        if ( FloatUtils::isPositive( currentUb ) &&
+             !FloatUtils::isPositive( ub ) )
+            ++signChanges;
 
-            ++tighterBoundCounter;
+        mtx.lock();
+        layer->setUb( index, ub );
+        layerOwner->receiveTighterBound( Tightening( variable,
+                                                     ub,
+                                                     Tightening::UB ) );
+        mtx.unlock();
 
-            if ( cutoffInUse && ub < cutoffValue )
-            {
-                ++cutoffs;
-                enqueueSolver( freeSolvers, gurobi );
-                return;
-            }
-        }
+        ++tighterBoundCounter;
 
-        gurobi->reset();
-        // Exact encoding
-        // Now, add the MILP constraints
-        unsigned lastLayer = layer->getLayerIndex();
-        for ( const auto &layer : layers )
+        if ( cutoffInUse && ub < cutoffValue )
         {
-            if ( layer.second->getLayerIndex() > lastLayer )
-                continue;
-
-            addLayerToModel( *gurobi, layer.second, layerOwner );
+            ++cutoffs;
+            return;
         }
+    }
 
-        log( Stringf( "Computing lowerbound..." ).ascii() );
-        lb = optimizeWithGurobi( *gurobi, MinOrMax::MIN, variableName,
-                                 cutoffValue, &infeasible );
-        log( Stringf( "Lowerbound computed: %f", lb ).ascii() );
+    gurobi->reset();
+    // Exact encoding
+    // Now, add the MILP constraints
+    unsigned lastLayer = layer->getLayerIndex();
+    for ( const auto &layer : layers )
+    {
+        if ( layer.second->getLayerIndex() > lastLayer )
+            continue;
 
-        // Store the new bound if it is tighter
-        if ( lb > currentLb )
-        {
-            if ( FloatUtils::isNegative( currentLb ) &&
-                 !FloatUtils::isNegative( lb ) )
-                ++signChanges;
+        addLayerToModel( *gurobi, layer.second, layerOwner );
+    }
 
-            mtx.lock();
-            layer->setLb( index, lb );
-            layerOwner->receiveTighterBound( Tightening( variable,
-                                                         lb,
-                                                         Tightening::LB ) );
-            mtx.unlock();
-            ++tighterBoundCounter;
+    log( Stringf( "Computing lowerbound..." ).ascii() );
+    lb = optimizeWithGurobi( *gurobi, MinOrMax::MIN, variableName,
+                             cutoffValue, &infeasible );
+    log( Stringf( "Lowerbound computed: %f", lb ).ascii() );
 
-            if ( cutoffInUse && lb > cutoffValue )
-            {
-                ++cutoffs;
-                enqueueSolver( freeSolvers, gurobi );
-                return;
-            }
+    // Store the new bound if it is tighter
+    if ( lb > currentLb )
+    {
+        if ( FloatUtils::isNegative( currentLb ) &&
+             !FloatUtils::isNegative( lb ) )
+            ++signChanges;
+
+        mtx.lock();
+        layer->setLb( index, lb );
+        layerOwner->receiveTighterBound( Tightening( variable,
+                                                     lb,
+                                                     Tightening::LB ) );
+        mtx.unlock();
+        ++tighterBoundCounter;
+
+        if ( cutoffInUse && lb > cutoffValue )
+        {
+            ++cutoffs;
+            return;
         }
+    }
 
-        log( Stringf( "Tightening bounds for layer %u index %u",
-                                   layer->getLayerIndex(), index ).ascii() );
+    log( Stringf( "Tightening bounds for layer %u index %u",
+                               layer->getLayerIndex(), index ).ascii() );
 
-        log( Stringf( "Computing upperbound..." ).ascii() );
-        gurobi->reset();
-        ub = optimizeWithGurobi( *gurobi, MinOrMax::MAX, variableName,
-                                 cutoffValue, &infeasible );
-        log( Stringf( "Upperbound computed %f", ub ).ascii() );
+    log( Stringf( "Computing upperbound..." ).ascii() );
+    gurobi->reset();
+    ub = optimizeWithGurobi( *gurobi, MinOrMax::MAX, variableName,
+                             cutoffValue, &infeasible );
+    log( Stringf( "Upperbound computed %f", ub ).ascii() );
 
-        // Store the new bound if it is tighter
-        if ( ub < currentUb )
-        {
-            if ( FloatUtils::isPositive( currentUb ) &&
-                 !FloatUtils::isPositive( ub ) )
-                ++signChanges;
+    // Store the new bound if it is tighter
+    if ( ub < currentUb )
+    {
+        if ( FloatUtils::isPositive( currentUb ) &&
+             !FloatUtils::isPositive( ub ) )
+            ++signChanges;
 
-            mtx.lock();
-            layer->setUb( index, ub );
-            layerOwner->receiveTighterBound( Tightening( variable,
-                                                         ub,
-                                                         Tightening::UB ) );
-            mtx.unlock();
+        mtx.lock();
+        layer->setUb( index, ub );
+        layerOwner->receiveTighterBound( Tightening( variable,
+                                                     ub,
+                                                     Tightening::UB ) );
+        mtx.unlock();
 
-            ++tighterBoundCounter;
+        ++tighterBoundCounter;
 
-            if ( cutoffInUse && ub < cutoffValue )
-            {
-                ++cutoffs;
-            }
+        if ( cutoffInUse && ub < cutoffValue )
+        {
+            ++cutoffs;
         }
-
-        enqueueSolver( freeSolvers, gurobi );
-    }
-    catch ( boost::thread_interrupted& )
-    {
-        enqueueSolver( argument._freeSolvers, argument._gurobi );
     }
 }
 
 void MILPFormulator::createMILPEncoding( const Map<unsigned, Layer *> &layers,
-                                         GurobiWrapper &gurobi,
+                                         ILPSolver &gurobi,
                                          unsigned lastLayer )
 {
     // First, create the LP relaxation of the problem
@@ -444,7 +387,7 @@ void MILPFormulator::createMILPEncoding( const Map<unsigned, Layer *> &layers,
     }
 }
 
-void MILPFormulator::addLayerToModel( GurobiWrapper &gurobi, const Layer *layer,
+void MILPFormulator::addLayerToModel( ILPSolver &gurobi, const Layer *layer,
                                       LayerOwner *layerOwner )
 {
     switch ( layer->getLayerType() )
@@ -463,7 +406,7 @@ void MILPFormulator::addLayerToModel( GurobiWrapper &gurobi, const Layer *layer,
     }
 }
 
-void MILPFormulator::addNeuronToModel( GurobiWrapper &gurobi, const Layer *layer,
+void MILPFormulator::addNeuronToModel( ILPSolver &gurobi, const Layer *layer,
                                        unsigned neuron, LayerOwner *layerOwner )
 {
     if ( layer->getLayerType() != Layer::RELU )
@@ -505,21 +448,21 @@ void MILPFormulator::addNeuronToModel( GurobiWrapper &gurobi, const Layer *layer
     gurobi.addVariable( Stringf( "a%u", targetVariable ),
                         0,
                         1,
-                        GurobiWrapper::BINARY );
+                        ILPSolver::BINARY );
 
-    List<GurobiWrapper::Term> terms;
-    terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-    terms.append( GurobiWrapper::Term( -1, Stringf( "x%u", sourceVariable ) ) );
-    terms.append( GurobiWrapper::Term( -sourceLb, Stringf( "a%u", targetVariable ) ) );
+    List<ILPSolver::Term> terms;
+    terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+    terms.append( ILPSolver::Term( -1, Stringf( "x%u", sourceVariable ) ) );
+    terms.append( ILPSolver::Term( -sourceLb, Stringf( "a%u", targetVariable ) ) );
     gurobi.addLeqConstraint( terms, -sourceLb );
 
     terms.clear();
-    terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-    terms.append( GurobiWrapper::Term( -sourceUb, Stringf( "a%u", targetVariable ) ) );
+    terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+    terms.append( ILPSolver::Term( -sourceUb, Stringf( "a%u", targetVariable ) ) );
     gurobi.addLeqConstraint( terms, 0 );
 }
 
-void MILPFormulator::addReluLayerToMILPFormulation( GurobiWrapper &gurobi,
+void MILPFormulator::addReluLayerToMILPFormulation( ILPSolver &gurobi,
                                                     const Layer *layer,
                                                     LayerOwner *layerOwner )
 {
@@ -529,12 +472,12 @@ void MILPFormulator::addReluLayerToMILPFormulation( GurobiWrapper &gurobi,
     }
 }
 
-double MILPFormulator::optimizeWithGurobi( GurobiWrapper &gurobi,
+double MILPFormulator::optimizeWithGurobi( ILPSolver &gurobi,
                                            MinOrMax minOrMax, String variableName,
                                            double cutoffValue, std::atomic_bool *infeasible )
 {
-    List<GurobiWrapper::Term> terms;
-    terms.append( GurobiWrapper::Term( 1, variableName ) );
+    List<ILPSolver::Term> terms;
+    terms.append( ILPSolver::Term( 1, variableName ) );
 
     if ( minOrMax == MAX )
         gurobi.setObjective( terms );
@@ -610,7 +553,7 @@ void MILPFormulator::setCutoff( double cutoff )
     _cutoffValue = cutoff;
 }
 
-bool MILPFormulator::tightenUpperBound( GurobiWrapper &gurobi,
+bool MILPFormulator::tightenUpperBound( ILPSolver &gurobi,
                                         Layer *layer,
                                         unsigned neuron,
                                         unsigned variable,
@@ -620,8 +563,8 @@ bool MILPFormulator::tightenUpperBound( GurobiWrapper &gurobi,
 
     Stringf variableName( "x%u", variable );
 
-    List<GurobiWrapper::Term> terms;
-    terms.append( GurobiWrapper::Term( 1, variableName ) );
+    List<ILPSolver::Term> terms;
+    terms.append( ILPSolver::Term( 1, variableName ) );
 
     gurobi.reset();
     gurobi.setObjective( terms );
@@ -678,7 +621,7 @@ bool MILPFormulator::tightenUpperBound( GurobiWrapper &gurobi,
     return false;
 }
 
-bool MILPFormulator::tightenLowerBound( GurobiWrapper &gurobi,
+bool MILPFormulator::tightenLowerBound( ILPSolver &gurobi,
                                         Layer *layer,
                                         unsigned neuron,
                                         unsigned variable,
@@ -687,8 +630,8 @@ bool MILPFormulator::tightenLowerBound( GurobiWrapper &gurobi,
     double newLb = FloatUtils::negativeInfinity();
     Stringf variableName( "x%u", variable );
 
-    List<GurobiWrapper::Term> terms;
-    terms.append( GurobiWrapper::Term( 1, variableName ) );
+    List<ILPSolver::Term> terms;
+    terms.append( ILPSolver::Term( 1, variableName ) );
 
     gurobi.reset();
     gurobi.setCost( terms );
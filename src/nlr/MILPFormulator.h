@@ -16,13 +16,11 @@
 #ifndef __MILPFormulator_h__
 #define __MILPFormulator_h__
 
-#include "GurobiWrapper.h"
+#include "ILPSolver.h"
 #include "LayerOwner.h"
 #include "LPFormulator.h"
 
 #include <atomic>
-#include <boost/lockfree/queue.hpp>
-#include <boost/chrono.hpp>
 #include <climits>
 #include <mutex>
 
@@ -50,7 +48,7 @@ public:
     void setCutoff( double cutoff );
 
     void createMILPEncoding( const Map<unsigned, Layer *> &layers,
-                             GurobiWrapper &gurobi,
+                             ILPSolver &gurobi,
                              unsigned lastLayer = UINT_MAX );
 
 private:
@@ -62,26 +60,26 @@ private:
     bool _cutoffInUse;
     double _cutoffValue;
 
-    bool tightenLowerBound( GurobiWrapper &gurobi,
+    bool tightenLowerBound( ILPSolver &gurobi,
                             Layer *layer,
                             unsigned neuron,
                             unsigned variable,
                             double &currentLb );
 
-    bool tightenUpperBound( GurobiWrapper &gurobi,
+    bool tightenUpperBound( ILPSolver &gurobi,
                             Layer *layer,
                             unsigned neuron,
                             unsigned variable,
                             double &currentUb );
 
-    static void addLayerToModel( GurobiWrapper &gurobi, const Layer *layer,
+    static void addLayerToModel( ILPSolver &gurobi, const Layer *layer,
                                  LayerOwner *layerOwner );
 
-    static void addReluLayerToMILPFormulation( GurobiWrapper &gurobi,
+    static void addReluLayerToMILPFormulation( ILPSolver &gurobi,
                                                const Layer *layer,
                                                LayerOwner *layerOwner );
 
-    static void addNeuronToModel( GurobiWrapper &gurobi,
+    static void addNeuronToModel( ILPSolver &gurobi,
                                   const Layer *layer,
                                   unsigned neuron,
                                   LayerOwner *layerOwner );
@@ -90,7 +88,7 @@ private:
       Optimize for the min/max value of variableName with respect to the constraints
       encoded in gurobi. If the query is infeasible, *infeasible is set to true.
     */
-    static double optimizeWithGurobi( GurobiWrapper &gurobi, MinOrMax minOrMax,
+    static double optimizeWithGurobi( ILPSolver &gurobi, MinOrMax minOrMax,
                                       String variableName, double cutoffValue,
                                       std::atomic_bool *infeasible = NULL );
 
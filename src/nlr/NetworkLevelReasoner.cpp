@@ -35,7 +35,15 @@ namespace NLR {
 
 NetworkLevelReasoner::NetworkLevelReasoner()
     : _tableau( NULL )
+    , _threadPool( NULL )
+    , _statistics( NULL )
+    , _solverThreadPool( nullptr )
+    , _lastSolverThreadPool( NULL )
+    , _lastSolverThreadPoolBusyTime( 0 )
+    , _lastSolverThreadPoolIdleTime( 0 )
     , _deepPolyAnalysis( nullptr )
+    , _lastPropagationPass( NO_PROPAGATION )
+    , _numLayersReusedByLastPropagation( 0 )
 {
 }
 
@@ -132,22 +140,63 @@ void NetworkLevelReasoner::getConstraintTightenings( List<Tightening> &tightenin
 
 void NetworkLevelReasoner::symbolicBoundPropagation()
 {
-    for ( unsigned i = 0; i < _layerIndexToLayer.size(); ++i )
+    unsigned firstLayer = getFirstLayerToPropagate( SYMBOLIC_BOUND_PROPAGATION );
+
+    for ( unsigned i = firstLayer; i < _layerIndexToLayer.size(); ++i )
         _layerIndexToLayer[i]->computeSymbolicBounds();
+
+    storePropagatedBounds( SYMBOLIC_BOUND_PROPAGATION, firstLayer );
 }
 
 void NetworkLevelReasoner::deepPolyPropagation()
 {
     if ( _deepPolyAnalysis == nullptr )
+    {
         _deepPolyAnalysis = std::unique_ptr<DeepPolyAnalysis>
-            ( new DeepPolyAnalysis( this ) );
-    _deepPolyAnalysis->run();
+            ( new DeepPolyAnalysis( this, _threadPool ) );
+        _lastPropagationPass = NO_PROPAGATION;
+    }
+
+    unsigned firstLayer = getFirstLayerToPropagate( DEEP_POLY_PROPAGATION );
+    _deepPolyAnalysis->run( firstLayer );
+    storePropagatedBounds( DEEP_POLY_PROPAGATION, firstLayer );
+}
+
+unsigned NetworkLevelReasoner::getFirstLayerToPropagate( PropagationPass pass )
+{
+    if ( pass != _lastPropagationPass )
+        return 0;
+
+    unsigned numLayers = _layerIndexToLayer.size();
+    for ( unsigned i = 0; i < numLayers; ++i )
+    {
+        if ( _layerIndexToLayer[i]->boundsChangedSincePropagation() )
+            return i;
+    }
+
+    return numLayers;
+}
+
+void NetworkLevelReasoner::storePropagatedBounds( PropagationPass pass, unsigned firstLayer )
+{
+    for ( unsigned i = firstLayer; i < _layerIndexToLayer.size(); ++i )
+        _layerIndexToLayer[i]->storePropagatedBounds();
+
+    _lastPropagationPass = pass;
+    _numLayersReusedByLastPropagation = firstLayer;
+}
+
+unsigned NetworkLevelReasoner::getNumLayersReusedByLastPropagation() const
+{
+    return _numLayersReusedByLastPropagation;
 }
 
 void NetworkLevelReasoner::lpRelaxationPropagation()
 {
     LPFormulator lpFormulator( this );
     lpFormulator.setCutoff( 0 );
+    lpFormulator.setStatistics( _statistics );
+    lpFormulator.setThreadPool( getSolverThreadPool() );
 
     if ( Options::get()->getMILPSolverBoundTighteningType() ==
          MILPSolverBoundTighteningType::LP_RELAXATION )
@@ -155,12 +204,15 @@ void NetworkLevelReasoner::lpRelaxationPropagation()
     else if ( Options::get()->getMILPSolverBoundTighteningType() ==
               MILPSolverBoundTighteningType::LP_RELAXATION_INCREMENTAL )
         lpFormulator.optimizeBoundsWithIncrementalLpRelaxation( _layerIndexToLayer );
+
+    reportSolverThreadPoolTime();
 }
 
 void NetworkLevelReasoner::MILPPropagation()
 {
     MILPFormulator milpFormulator( this );
     milpFormulator.setCutoff( 0 );
+    milpFormulator.setThreadPool( getSolverThreadPool() );
 
     if ( Options::get()->getMILPSolverBoundTighteningType() ==
          MILPSolverBoundTighteningType::MILP_ENCODING )
@@ -168,13 +220,57 @@ void NetworkLevelReasoner::MILPPropagation()
     else if ( Options::get()->getMILPSolverBoundTighteningType() ==
               MILPSolverBoundTighteningType::MILP_ENCODING_INCREMENTAL )
         milpFormulator.optimizeBoundsWithIncrementalMILPEncoding( _layerIndexToLayer );
+
+    reportSolverThreadPoolTime();
 }
 
 void NetworkLevelReasoner::iterativePropagation()
 {
     IterativePropagator iterativePropagator( this );
     iterativePropagator.setCutoff( 0 );
+    iterativePropagator.setThreadPool( getSolverThreadPool() );
     iterativePropagator.optimizeBoundsWithIterativePropagation( _layerIndexToLayer );
+
+    reportSolverThreadPoolTime();
+}
+
+ThreadPool *NetworkLevelReasoner::getSolverThreadPool()
+{
+    unsigned numberOfWorkers = Options::get()->getInt( Options::NUM_WORKERS );
+
+    ThreadPool *threadPool = NULL;
+    if ( numberOfWorkers > 1 )
+    {
+        if ( _threadPool && _threadPool->getNumThreads() == numberOfWorkers )
+        {
+            threadPool = _threadPool;
+        }
+        else
+        {
+            if ( !_solverThreadPool || _solverThreadPool->getNumThreads() != numberOfWorkers )
+                _solverThreadPool = std::unique_ptr<ThreadPool>( new ThreadPool( numberOfWorkers ) );
+            threadPool = _solverThreadPool.get();
+        }
+    }
+
+    _lastSolverThreadPool = threadPool;
+    if ( threadPool )
+    {
+        _lastSolverThreadPoolBusyTime = threadPool->getBusyTimeMicro();
+        _lastSolverThreadPoolIdleTime = threadPool->getIdleTimeMicro();
+    }
+
+    return threadPool;
+}
+
+void NetworkLevelReasoner::reportSolverThreadPoolTime()
+{
+    if ( !_statistics || !_lastSolverThreadPool )
+        return;
+
+    _statistics->addLPBoundTighteningThreadTime
+        ( _lastSolverThreadPool->getBusyTimeMicro() - _lastSolverThreadPoolBusyTime,
+          _lastSolverThreadPool->getIdleTimeMicro() - _lastSolverThreadPoolIdleTime );
 }
 
 void NetworkLevelReasoner::intervalArithmeticBoundPropagation()
@@ -185,6 +281,10 @@ void NetworkLevelReasoner::intervalArithmeticBoundPropagation()
 
 void NetworkLevelReasoner::freeMemoryIfNeeded()
 {
+    // The analysis and the propagated state refer to the deleted layers
+    _deepPolyAnalysis = nullptr;
+    _lastPropagationPass = NO_PROPAGATION;
+
     for ( const auto &layer : _layerIndexToLayer )
         delete layer.second;
     _layerIndexToLayer.clear();
@@ -231,6 +331,19 @@ const ITableau *NetworkLevelReasoner::getTableau() const
     return _tableau;
 }
 
+void NetworkLevelReasoner::setThreadPool( ThreadPool *threadPool )
+{
+    _threadPool = threadPool;
+    // The analysis allocates working memory per thread of the pool
+    _deepPolyAnalysis = nullptr;
+    _lastPropagationPass = NO_PROPAGATION;
+}
+
+void NetworkLevelReasoner::setStatistics( Statistics *statistics )
+{
+    _statistics = statistics;
+}
+
 void NetworkLevelReasoner::eliminateVariable( unsigned variable, double value )
 {
     for ( auto &layer : _layerIndexToLayer )
@@ -420,24 +533,27 @@ void NetworkLevelReasoner::generateInputQueryForMaxLayer( InputQuery &inputQuery
 void NetworkLevelReasoner::generateInputQueryForWeightedSumLayer( InputQuery &inputQuery, const Layer &layer )
 {
     for ( unsigned i = 0; i < layer.getSize(); ++i )
+        inputQuery.addEquation( generateEquationForWeightedSumNeuron( layer, i ) );
+}
+
+Equation NetworkLevelReasoner::generateEquationForWeightedSumNeuron( const Layer &layer, unsigned neuron )
+{
+    Equation eq;
+    eq.setScalar( -layer.getBias( neuron ) );
+    eq.addAddend( -1, layer.neuronToVariable( neuron ) );
+
+    for ( const auto &it : layer.getSourceLayers() )
     {
-        Equation eq;
-        eq.setScalar( -layer.getBias( i ) );
-        eq.addAddend( -1, layer.neuronToVariable( i ) );
+        const Layer *sourceLayer = _layerIndexToLayer[it.first];
 
-        for ( const auto &it : layer.getSourceLayers() )
+        for ( unsigned j = 0; j < sourceLayer->getSize(); ++j )
         {
-            const Layer *sourceLayer = _layerIndexToLayer[it.first];
-
-            for ( unsigned j = 0; j < sourceLayer->getSize(); ++j )
-            {
-                double coefficient = layer.getWeight( sourceLayer->getLayerIndex(), j, i );
-                eq.addAddend( coefficient, sourceLayer->neuronToVariable( j ) );
-            }
+            double coefficient = layer.getWeight( sourceLayer->getLayerIndex(), j, neuron );
+            eq.addAddend( coefficient, sourceLayer->neuronToVariable( j ) );
         }
-
-        inputQuery.addEquation( eq );
     }
+
+    return eq;
 }
 
 void NetworkLevelReasoner::mergeConsecutiveWSLayers()
@@ -454,6 +570,156 @@ void NetworkLevelReasoner::mergeConsecutiveWSLayers()
     }
 }
 
+void NetworkLevelReasoner::mergeConsecutiveWSLayers( InputQuery &inputQuery )
+{
+    /*
+      Before merging, record the variables that feed each WS neuron.
+      Neurons are numbered by their layers, which are in topological
+      order.
+    */
+    Map<unsigned, unsigned> variableToOriginalLayer;
+    Vector<Set<unsigned>> originalSources;
+    for ( const auto &it : _layerIndexToLayer )
+    {
+        const Layer *layer = it.second;
+        if ( layer->getLayerType() != Layer::WEIGHTED_SUM )
+            continue;
+
+        for ( unsigned i = 0; i < layer->getSize(); ++i )
+            variableToOriginalLayer[layer->neuronToVariable( i )] = originalSources.size();
+        originalSources.append( getSourceVariables( *layer ) );
+    }
+
+    unsigned numberOfLayers = getNumberOfLayers();
+    mergeConsecutiveWSLayers();
+    if ( getNumberOfLayers() == numberOfLayers )
+        return;
+
+    /*
+      Neurons of layers whose sources have changed are rewritten, and
+      neurons that are no longer in the network are eliminated.
+    */
+    List<const Layer *> rewrittenLayers;
+    Set<unsigned> mergedVariables;
+    Set<unsigned> eliminatedVariables;
+    for ( const auto &it : variableToOriginalLayer )
+        eliminatedVariables.insert( it.first );
+
+    for ( const auto &it : _layerIndexToLayer )
+    {
+        const Layer *layer = it.second;
+        for ( unsigned i = 0; i < layer->getSize(); ++i )
+            eliminatedVariables.erase( layer->neuronToVariable( i ) );
+
+        if ( layer->getLayerType() != Layer::WEIGHTED_SUM || layer->getSize() == 0 )
+            continue;
+
+        unsigned originalLayer = variableToOriginalLayer[layer->neuronToVariable( 0 )];
+        if ( getSourceVariables( *layer ) != originalSources[originalLayer] )
+        {
+            rewrittenLayers.append( layer );
+            for ( unsigned i = 0; i < layer->getSize(); ++i )
+                mergedVariables.insert( layer->neuronToVariable( i ) );
+        }
+    }
+    for ( const auto &variable : eliminatedVariables )
+        mergedVariables.insert( variable );
+
+    /*
+      Find the equation that defined each merged neuron: it contains the
+      neuron's variable, and otherwise only variables of its original
+      sources. That variable is the deepest merged variable in the
+      equation. The variables of all other equations are used elsewhere.
+    */
+    List<Equation> &equations = inputQuery.getEquations();
+    Map<unsigned, List<Equation>::iterator> definingEquation;
+    Set<unsigned> usedElsewhere;
+    for ( auto eq = equations.begin(); eq != equations.end(); ++eq )
+    {
+        bool found = false;
+        unsigned definedVariable = 0;
+        for ( const auto &addend : eq->_addends )
+        {
+            if ( mergedVariables.exists( addend._variable ) &&
+                 ( !found ||
+                   variableToOriginalLayer[addend._variable] >
+                   variableToOriginalLayer[definedVariable] ) )
+            {
+                found = true;
+                definedVariable = addend._variable;
+            }
+        }
+
+        bool defining = found &&
+            eq->_type == Equation::EQ &&
+            !definingEquation.exists( definedVariable ) &&
+            !FloatUtils::isZero( eq->getCoefficient( definedVariable ) );
+
+        if ( defining )
+        {
+            const Set<unsigned> &sources = originalSources[variableToOriginalLayer[definedVariable]];
+            for ( const auto &addend : eq->_addends )
+            {
+                if ( addend._variable != definedVariable && !sources.exists( addend._variable ) )
+                    defining = false;
+            }
+        }
+
+        if ( defining )
+            definingEquation[definedVariable] = eq;
+        else
+        {
+            for ( const auto &addend : eq->_addends )
+                usedElsewhere.insert( addend._variable );
+        }
+    }
+
+    for ( const auto &constraint : inputQuery.getPiecewiseLinearConstraints() )
+    {
+        for ( const auto &variable : constraint->getParticipatingVariables() )
+            usedElsewhere.insert( variable );
+    }
+    for ( const auto &variable : inputQuery.getInputVariables() )
+        usedElsewhere.insert( variable );
+    for ( const auto &variable : inputQuery.getOutputVariables() )
+        usedElsewhere.insert( variable );
+
+    // Drop the equations of eliminated neurons that are not used
+    // elsewhere, and that have no bounds that would be lost
+    for ( const auto &variable : eliminatedVariables )
+    {
+        if ( definingEquation.exists( variable ) &&
+             !usedElsewhere.exists( variable ) &&
+             !FloatUtils::isFinite( inputQuery.getLowerBound( variable ) ) &&
+             !FloatUtils::isFinite( inputQuery.getUpperBound( variable ) ) )
+            equations.erase( definingEquation[variable] );
+    }
+
+    // Replace the equations of the rewritten neurons
+    for ( const auto &layer : rewrittenLayers )
+    {
+        for ( unsigned i = 0; i < layer->getSize(); ++i )
+        {
+            unsigned variable = layer->neuronToVariable( i );
+            if ( definingEquation.exists( variable ) )
+                equations.erase( definingEquation[variable] );
+            equations.append( generateEquationForWeightedSumNeuron( *layer, i ) );
+        }
+    }
+}
+
+Set<unsigned> NetworkLevelReasoner::getSourceVariables( const Layer &layer )
+{
+    Set<unsigned> result;
+    for ( const auto &it : layer.getSourceLayers() )
+    {
+        const Layer *sourceLayer = _layerIndexToLayer[it.first];
+        for ( unsigned i = 0; i < sourceLayer->getSize(); ++i )
+            result.insert( sourceLayer->neuronToVariable( i ) );
+    }
+    return result;
+}
+
 bool NetworkLevelReasoner::suitableForMerging( unsigned secondLayerIndex )
 {
     /*
@@ -17,6 +17,7 @@
 #define __NetworkLevelReasoner_h__
 
 #include "DeepPolyAnalysis.h"
+#include "Equation.h"
 #include "ITableau.h"
 #include "Layer.h"
 #include "LayerOwner.h"
@@ -24,7 +25,11 @@
 #include "MatrixMultiplication.h"
 #include "NeuronIndex.h"
 #include "PiecewiseLinearFunctionType.h"
+#include "Set.h"
+#include "Statistics.h"
+#include "ThreadPool.h"
 #include "Tightening.h"
+#include "Vector.h"
 #include <memory>
 
 namespace NLR {
@@ -105,6 +110,17 @@ public:
     void setTableau( const ITableau *tableau );
     const ITableau *getTableau() const;
 
+    /*
+      A pool of threads that the bound propagation passes may use. It is
+      owned by the caller, and must outlive this object.
+    */
+    void setThreadPool( ThreadPool *threadPool );
+
+    /*
+      Where the LP-based bound tightening passes report their solves
+    */
+    void setStatistics( Statistics *statistics );
+
     void obtainCurrentBounds();
     void intervalArithmeticBoundPropagation();
     void symbolicBoundPropagation();
@@ -116,6 +132,15 @@ public:
     void receiveTighterBound( Tightening tightening );
     void getConstraintTightenings( List<Tightening> &tightenings );
 
+    /*
+      Symbolic and DeepPoly propagation only recompute the layers from
+      the first layer whose bounds have changed since the previous pass
+      of the same kind, and reuse the results of the previous pass for
+      the layers before it. This is the number of layers that the last
+      such pass reused.
+    */
+    unsigned getNumLayersReusedByLastPropagation() const;
+
     /*
       For debugging purposes: dump the network topology
     */
@@ -156,6 +181,15 @@ public:
     */
     void mergeConsecutiveWSLayers();
 
+    /*
+      Merge consecutive WS layers, and update the query that this NLR
+      describes in place: the equations of the merged neurons are
+      replaced by equations over their new sources. The equation of an
+      eliminated neuron is kept if its variable is used elsewhere in
+      the query.
+    */
+    void mergeConsecutiveWSLayers( InputQuery &inputQuery );
+
     /*
       Print the bounds of variables layer by layer
     */
@@ -172,12 +206,52 @@ private:
     Map<unsigned, Layer *> _layerIndexToLayer;
     const ITableau *_tableau;
 
+    ThreadPool *_threadPool;
+
+    Statistics *_statistics;
+
+    /*
+      The pool on which the LP-based passes solve for several neurons
+      at once, if the number of workers is larger than 1. It is the
+      shared pool if that has the right size, and otherwise a pool
+      owned by this object, kept for all passes. The time its threads
+      spent busy and idle during the last pass is reported to the
+      statistics.
+    */
+    std::unique_ptr<ThreadPool> _solverThreadPool;
+    ThreadPool *_lastSolverThreadPool;
+    unsigned long long _lastSolverThreadPoolBusyTime;
+    unsigned long long _lastSolverThreadPoolIdleTime;
+    ThreadPool *getSolverThreadPool();
+    void reportSolverThreadPoolTime();
+
     // Tightenings discovered by the various layers
     List<Tightening> _boundTightenings;
 
 
     std::unique_ptr<DeepPolyAnalysis> _deepPolyAnalysis;
 
+    enum PropagationPass {
+        NO_PROPAGATION = 0,
+        SYMBOLIC_BOUND_PROPAGATION,
+        DEEP_POLY_PROPAGATION,
+    };
+
+    /*
+      The symbolic state stored in the layers, or in the DeepPoly
+      analysis, comes from the last pass of this kind
+    */
+    PropagationPass _lastPropagationPass;
+    unsigned _numLayersReusedByLastPropagation;
+
+    /*
+      The index of the first layer that the given pass needs to
+      recompute. Layers are indexed in topological order, so the layers
+      before it, and the bounds they were computed from, are unchanged.
+    */
+    unsigned getFirstLayerToPropagate( PropagationPass pass );
+    void storePropagatedBounds( PropagationPass pass, unsigned firstLayer );
+
     void freeMemoryIfNeeded();
 
     List<PiecewiseLinearConstraint *> _constraintsInTopologicalOrder;
@@ -185,6 +259,7 @@ private:
     // Helper functions for generating an input query
     void generateInputQueryForLayer( InputQuery &inputQuery, const Layer &layer );
     void generateInputQueryForWeightedSumLayer( InputQuery &inputQuery, const Layer &layer );
+    Equation generateEquationForWeightedSumNeuron( const Layer &layer, unsigned neuron );
     void generateInputQueryForReluLayer( InputQuery &inputQuery, const Layer &layer );
     void generateInputQueryForSignLayer( InputQuery &inputQuery, const Layer &layer );
     void generateInputQueryForAbsoluteValueLayer( InputQuery &inputQuery, const Layer &layer );
@@ -199,6 +274,9 @@ private:
                              unsigned outputDimension );
     void reduceLayerIndex( unsigned layer, unsigned startIndex );
 
+    // Helper for the in-place merge: the variables of a layer's sources
+    Set<unsigned> getSourceVariables( const Layer &layer );
+
     /*
       If the NLR is manipulated manually in order to generate a new
       input query, this method can be used to assign variable indices
@@ -13,32 +13,40 @@
 
  **/
 
-#include "InfeasibleQueryException.h"
-#include "Layer.h"
-#include "MStringf.h"
-#include "NLRError.h"
-#include "Options.h"
+#include "LPSolverFactory.h"
 #include "ParallelSolver.h"
-#include "TimeUtils.h"
-
-#include <boost/thread.hpp>
 
 namespace NLR {
 
-void ParallelSolver::clearSolverQueue( SolverQueue &freeSolvers )
+ParallelSolver::ParallelSolver()
+    : _threadPool( NULL )
 {
-    // Remove the solvers
-    GurobiWrapper *freeSolver;
-    while ( freeSolvers.pop( freeSolver ) )
-        delete freeSolver;
 }
 
-void ParallelSolver::enqueueSolver( SolverQueue &solvers, GurobiWrapper *solver )
+void ParallelSolver::setThreadPool( ThreadPool *threadPool )
 {
-    if ( !solvers.push( solver ) )
+    _threadPool = threadPool;
+}
+
+void ParallelSolver::createSolvers( Solvers &solvers ) const
+{
+    unsigned numberOfWorkers = _threadPool ? _threadPool->getNumThreads() : 1;
+
+    solvers.clear();
+    for ( unsigned i = 0; i < numberOfWorkers; ++i )
+        solvers.push_back( std::unique_ptr<ILPSolver>( LPSolverFactory::createLPSolver() ) );
+}
+
+void ParallelSolver::runJobs( unsigned numJobs, const ThreadPool::Job &job )
+{
+    if ( _threadPool )
     {
-        ASSERT( false );
+        _threadPool->parallelFor( numJobs, job );
+        return;
     }
+
+    for ( unsigned i = 0; i < numJobs; ++i )
+        job( i, 0 );
 }
 
 } // namespace NLR
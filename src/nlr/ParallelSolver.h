@@ -16,11 +16,13 @@
 #ifndef __ParallelSolver_h__
 #define __ParallelSolver_h__
 
-#include "GurobiWrapper.h"
+#include "ILPSolver.h"
+#include "ThreadPool.h"
 
 #include <atomic>
-#include <boost/lockfree/queue.hpp>
+#include <memory>
 #include <mutex>
+#include <vector>
 
 namespace NLR {
 
@@ -28,24 +30,53 @@ class Layer;
 class LayerOwner;
 struct NeuronIndex;
 
+/*
+  The base class of the LP-based bound tightening passes. The solves
+  for the neurons of a layer are independent of each other, and run as
+  jobs on a thread pool that outlives the pass. Each thread of the pool
+  has its own solver, selected by the thread index of the job.
+*/
 class ParallelSolver
 {
 public:
+    typedef std::vector<std::unique_ptr<ILPSolver>> Solvers;
 
-    typedef boost::lockfree::queue
-    <GurobiWrapper *, boost::lockfree::fixed_sized<true>> SolverQueue;
+    ParallelSolver();
 
     /*
-      Arguments for the spawned thread. This is needed because Boost::thread does
-      not seem to support functions with more than 7 arguments.
+      The pool on which the solves run. Without a pool, they run on the
+      calling thread.
+    */
+    void setThreadPool( ThreadPool *threadPool );
+
+    /*
+      Counters of the LP solves performed for the neurons of a layer,
+      updated by the worker threads
+    */
+    struct LayerSolveStatistics
+    {
+        LayerSolveStatistics()
+            : _numSolves( 0 )
+            , _numWarmStartedSolves( 0 )
+            , _solveTimeMicro( 0 )
+        {
+        }
+
+        std::atomic_uint _numSolves;
+        std::atomic_uint _numWarmStartedSolves;
+        std::atomic_ullong _solveTimeMicro;
+    };
+
+    /*
+      Arguments for the tightening of a single neuron
     */
     struct ThreadArgument{
 
-        ThreadArgument( GurobiWrapper *gurobi, Layer *layer,
+        ThreadArgument( ILPSolver *gurobi, Layer *layer,
                         const Map<unsigned, Layer *> *layers,
                         unsigned index, double currentLb, double currentUb,
                         bool cutoffInUse, double cutoffValue,
-                        LayerOwner *layerOwner, SolverQueue &freeSolvers,
+                        LayerOwner *layerOwner,
                         std::mutex &mtx, std::atomic_bool &infeasible,
                         std::atomic_uint &tighterBoundCounter,
                         std::atomic_uint &signChanges,
@@ -59,20 +90,21 @@ public:
         , _cutoffInUse( cutoffInUse )
         , _cutoffValue( cutoffValue )
         , _layerOwner( layerOwner )
-        , _freeSolvers( freeSolvers )
         , _mtx( mtx )
         , _infeasible( infeasible )
         , _tighterBoundCounter( tighterBoundCounter )
         , _signChanges( signChanges )
         , _cutoffs( cutoffs )
         , _lastFixedNeuron( NULL )
+        , _solveStatistics( NULL )
+        , _warmStart( false )
         {
         }
 
-        ThreadArgument( GurobiWrapper *gurobi, Layer *layer,
+        ThreadArgument( ILPSolver *gurobi, Layer *layer,
                         unsigned index, double currentLb, double currentUb,
                         bool cutoffInUse, double cutoffValue,
-                        LayerOwner *layerOwner, SolverQueue &freeSolvers,
+                        LayerOwner *layerOwner,
                         std::mutex &mtx, std::atomic_bool &infeasible,
                         std::atomic_uint &tighterBoundCounter,
                         std::atomic_uint &signChanges,
@@ -86,20 +118,21 @@ public:
         , _cutoffInUse( cutoffInUse )
         , _cutoffValue( cutoffValue )
         , _layerOwner( layerOwner )
-        , _freeSolvers( freeSolvers )
         , _mtx( mtx )
         , _infeasible( infeasible )
         , _tighterBoundCounter( tighterBoundCounter )
         , _signChanges( signChanges )
         , _cutoffs( cutoffs )
         , _lastFixedNeuron( NULL )
+        , _solveStatistics( NULL )
+        , _warmStart( false )
         {
         }
 
-        ThreadArgument( GurobiWrapper *gurobi, Layer *layer,
+        ThreadArgument( ILPSolver *gurobi, Layer *layer,
                         unsigned index, double currentLb, double currentUb,
                         bool cutoffInUse, double cutoffValue,
-                        LayerOwner *layerOwner, SolverQueue &freeSolvers,
+                        LayerOwner *layerOwner,
                         std::mutex &mtx, std::atomic_bool &infeasible,
                         std::atomic_uint &tighterBoundCounter,
                         std::atomic_uint &signChanges,
@@ -113,17 +146,18 @@ public:
         , _cutoffInUse( cutoffInUse )
         , _cutoffValue( cutoffValue )
         , _layerOwner( layerOwner )
-        , _freeSolvers( freeSolvers )
         , _mtx( mtx )
         , _infeasible( infeasible )
         , _tighterBoundCounter( tighterBoundCounter )
         , _signChanges( signChanges )
         , _cutoffs( cutoffs )
         , _lastFixedNeuron( lastFixedNeuron )
+        , _solveStatistics( NULL )
+        , _warmStart( false )
         {
         }
 
-        GurobiWrapper *_gurobi;
+        ILPSolver *_gurobi;
         Layer *_layer;
         const Map<unsigned, Layer *> *_layers;
         unsigned _index;
@@ -132,21 +166,37 @@ public:
         bool _cutoffInUse;
         double _cutoffValue;
         LayerOwner *_layerOwner;
-        SolverQueue &_freeSolvers;
         std::mutex &_mtx;
         std::atomic_bool &_infeasible;
         std::atomic_uint &_tighterBoundCounter;
         std::atomic_uint &_signChanges;
         std::atomic_uint &_cutoffs;
         NeuronIndex *_lastFixedNeuron;
+
+        /*
+          Where to record the solves, if anywhere, and whether the
+          solver still holds an optimal basis of the same model
+        */
+        LayerSolveStatistics *_solveStatistics;
+        bool _warmStart;
     };
 
     /*
-      Free all the solvers in the SolverQueue
+      Create a solver for every thread of the pool
     */
-    static void clearSolverQueue( SolverQueue &freeSolvers );
+    void createSolvers( Solvers &solvers ) const;
 
-    static void enqueueSolver( SolverQueue &solvers, GurobiWrapper *solver );
+protected:
+    ThreadPool *_threadPool;
+
+    /*
+      Run job( i, threadIndex ) for every i in [0, numJobs), on the pool
+      if there is one. A job that discovers infeasibility should record
+      it, and the remaining jobs should then return immediately; any
+      exception thrown by a job is rethrown here once all running jobs
+      are done.
+    */
+    void runJobs( unsigned numJobs, const ThreadPool::Job &job );
 };
 
 } // namespace NLR
@@ -20,6 +20,7 @@
 #include "InputQuery.h"
 #include "Layer.h"
 #include "NetworkLevelReasoner.h"
+#include "ThreadPool.h"
 #include "Tightening.h"
 
 class DeepPolyAnalysisTestSuite : public CxxTest::TestSuite
@@ -591,4 +592,103 @@ public:
         for ( const auto &bound : expectedBounds )
             TS_ASSERT( bounds.exists( bound ) );
     }
+
+    void populateWideNetwork( NLR::NetworkLevelReasoner &nlr, MockTableau &tableau )
+    {
+        /*
+          Input layer 0 of size 3, weighted sum layers 1 and 3 of size 40
+          followed by ReLU layers 2 and 4, and an output layer 5 of size 2.
+          Layer 3 also has a residual connection from the input layer.
+        */
+        const unsigned width = 40;
+
+        nlr.addLayer( 0, NLR::Layer::INPUT, 3 );
+        nlr.addLayer( 1, NLR::Layer::WEIGHTED_SUM, width );
+        nlr.addLayer( 2, NLR::Layer::RELU, width );
+        nlr.addLayer( 3, NLR::Layer::WEIGHTED_SUM, width );
+        nlr.addLayer( 4, NLR::Layer::RELU, width );
+        nlr.addLayer( 5, NLR::Layer::WEIGHTED_SUM, 2 );
+
+        for ( unsigned i = 1; i <= 5; ++i )
+            nlr.addLayerDependency( i - 1, i );
+        nlr.addLayerDependency( 0, 3 );
+
+        for ( unsigned j = 0; j < width; ++j )
+        {
+            for ( unsigned i = 0; i < 3; ++i )
+            {
+                nlr.setWeight( 0, i, 1, j, ( ( i * 7 + j * 13 ) % 11 - 5.0 ) / 5 );
+                nlr.setWeight( 0, i, 3, j, ( ( i * 3 + j * 5 ) % 7 - 3.0 ) / 3 );
+            }
+            for ( unsigned i = 0; i < width; ++i )
+                nlr.setWeight( 2, i, 3, j, ( ( i * 17 + j * 3 ) % 13 - 6.0 ) / 10 );
+            for ( unsigned i = 0; i < 2; ++i )
+                nlr.setWeight( 4, j, 5, i, ( ( i * 11 + j * 7 ) % 9 - 4.0 ) / 4 );
+
+            nlr.setBias( 1, j, ( j % 5 ) - 2.0 );
+            nlr.setBias( 3, j, ( j % 3 ) - 1.0 );
+
+            nlr.addActivationSource( 1, j, 2, j );
+            nlr.addActivationSource( 3, j, 4, j );
+        }
+
+        unsigned variable = 0;
+        for ( unsigned layer = 0; layer <= 5; ++layer )
+        {
+            for ( unsigned i = 0; i < nlr.getLayer( layer )->getSize(); ++i )
+            {
+                nlr.setNeuronVariable( NLR::NeuronIndex( layer, i ), variable );
+                if ( layer == 0 )
+                {
+                    tableau.setLowerBound( variable, -1 );
+                    tableau.setUpperBound( variable, 1 );
+                }
+                else
+                {
+                    tableau.setLowerBound( variable, -1000000 );
+                    tableau.setUpperBound( variable, 1000000 );
+                }
+                ++variable;
+            }
+        }
+    }
+
+    void test_deeppoly_parallel_matches_sequential()
+    {
+        NLR::NetworkLevelReasoner sequentialNlr;
+        MockTableau sequentialTableau;
+        sequentialNlr.setTableau( &sequentialTableau );
+        populateWideNetwork( sequentialNlr, sequentialTableau );
+
+        NLR::NetworkLevelReasoner parallelNlr;
+        MockTableau parallelTableau;
+        parallelNlr.setTableau( &parallelTableau );
+        populateWideNetwork( parallelNlr, parallelTableau );
+
+        // The layers of size 40 are split into uneven ranges
+        ThreadPool threadPool( 4 );
+        parallelNlr.setThreadPool( &threadPool );
+
+        TS_ASSERT_THROWS_NOTHING( sequentialNlr.obtainCurrentBounds() );
+        TS_ASSERT_THROWS_NOTHING( sequentialNlr.deepPolyPropagation() );
+        TS_ASSERT_THROWS_NOTHING( parallelNlr.obtainCurrentBounds() );
+        TS_ASSERT_THROWS_NOTHING( parallelNlr.deepPolyPropagation() );
+
+        for ( unsigned layer = 1; layer <= 5; ++layer )
+        {
+            const NLR::Layer *sequentialLayer = sequentialNlr.getLayer( layer );
+            const NLR::Layer *parallelLayer = parallelNlr.getLayer( layer );
+            for ( unsigned i = 0; i < sequentialLayer->getSize(); ++i )
+            {
+                TS_ASSERT( sequentialLayer->getUb( i ) < 1000000 );
+                TS_ASSERT( FloatUtils::areEqual( sequentialLayer->getLb( i ),
+                                                 parallelLayer->getLb( i ) ) );
+                TS_ASSERT( FloatUtils::areEqual( sequentialLayer->getUb( i ),
+                                                 parallelLayer->getUb( i ) ) );
+            }
+        }
+
+        // The analysis can be run again with the same pool
+        TS_ASSERT_THROWS_NOTHING( parallelNlr.deepPolyPropagation() );
+    }
 };
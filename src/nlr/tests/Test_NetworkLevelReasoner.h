@@ -16,11 +16,14 @@
 #include <cxxtest/TestSuite.h>
 
 #include "../../engine/tests/MockTableau.h" // TODO: fix this
+#include "AcasParser.h"
 #include "FloatUtils.h"
 #include "InputQuery.h"
 #include "Layer.h"
 #include "NetworkLevelReasoner.h"
 #include "Options.h"
+#include "Preprocessor.h"
+#include "Statistics.h"
 #include "Tightening.h"
 
 class MockForNetworkLevelReasoner
@@ -324,6 +327,49 @@ public:
         TS_ASSERT( FloatUtils::areEqual( output1[1], output2[1] ) );
     }
 
+    void test_store_into_other_shares_weights()
+    {
+        NLR::NetworkLevelReasoner nlr;
+
+        populateNetwork( nlr );
+
+        NLR::NetworkLevelReasoner nlr2;
+
+        TS_ASSERT_THROWS_NOTHING( nlr.storeIntoOther( nlr2 ) );
+
+        // The copy reads the same weight matrices
+        TS_ASSERT( nlr.getLayer( 1 )->sharesWeightsWith( *nlr2.getLayer( 1 ), 0 ) );
+        TS_ASSERT( nlr.getLayer( 3 )->sharesWeightsWith( *nlr2.getLayer( 3 ), 2 ) );
+        TS_ASSERT_EQUALS( nlr.getLayer( 3 )->getWeightMatrix( 2 ),
+                          nlr2.getLayer( 3 )->getWeightMatrix( 2 ) );
+
+        // Changing a weight in the copy does not affect the original
+        TS_ASSERT_THROWS_NOTHING( nlr2.setWeight( 2, 0, 3, 0, 100 ) );
+
+        TS_ASSERT( !nlr.getLayer( 3 )->sharesWeightsWith( *nlr2.getLayer( 3 ), 2 ) );
+        TS_ASSERT( nlr.getLayer( 1 )->sharesWeightsWith( *nlr2.getLayer( 1 ), 0 ) );
+        TS_ASSERT_EQUALS( nlr.getLayer( 3 )->getWeight( 2, 0, 0 ), 1 );
+        TS_ASSERT_EQUALS( nlr2.getLayer( 3 )->getWeight( 2, 0, 0 ), 100 );
+        TS_ASSERT_EQUALS( nlr2.getLayer( 3 )->getWeight( 2, 1, 0 ),
+                          nlr.getLayer( 3 )->getWeight( 2, 1, 0 ) );
+
+        // The copy remains valid after the original is destroyed
+        NLR::NetworkLevelReasoner *nlr3 = new NLR::NetworkLevelReasoner;
+        populateNetwork( *nlr3 );
+        TS_ASSERT_THROWS_NOTHING( nlr3->storeIntoOther( nlr2 ) );
+        delete nlr3;
+
+        double input[2] = { 1, 1 };
+        double output1[2];
+        double output2[2];
+
+        TS_ASSERT_THROWS_NOTHING( nlr.evaluate( input, output1 ) );
+        TS_ASSERT_THROWS_NOTHING( nlr2.evaluate( input, output2 ) );
+
+        TS_ASSERT( FloatUtils::areEqual( output1[0], output2[0] ) );
+        TS_ASSERT( FloatUtils::areEqual( output1[1], output2[1] ) );
+    }
+
     void test_interval_arithmetic_bound_propagation_relu_constraints()
     {
         NLR::NetworkLevelReasoner nlr;
@@ -947,6 +993,185 @@ public:
             TS_ASSERT( expectedBounds.exists( bound ) );
     }
 
+    void applyTightenings( const List<Tightening> &tightenings, MockTableau &tableau )
+    {
+        for ( const auto &tightening : tightenings )
+        {
+            if ( tightening._type == Tightening::LB )
+                tableau.setLowerBound( tightening._variable, tightening._value );
+            else
+                tableau.setUpperBound( tightening._variable, tightening._value );
+        }
+    }
+
+    void test_sbt_incremental()
+    {
+        Options::get()->setString( Options::SYMBOLIC_BOUND_TIGHTENING_TYPE,
+                                   "sbt" );
+
+        NLR::NetworkLevelReasoner nlr;
+        MockTableau tableau;
+        nlr.setTableau( &tableau );
+        populateNetworkSBT( nlr, tableau );
+
+        tableau.setLowerBound( 0, 4 );
+        tableau.setUpperBound( 0, 6 );
+        tableau.setLowerBound( 1, 1 );
+        tableau.setUpperBound( 1, 5 );
+        nlr.setBias( 1, 0, -15 );
+
+        List<Tightening> bounds;
+        TS_ASSERT_THROWS_NOTHING( nlr.obtainCurrentBounds() );
+        TS_ASSERT_THROWS_NOTHING( nlr.symbolicBoundPropagation() );
+        TS_ASSERT_EQUALS( nlr.getNumLayersReusedByLastPropagation(), 0U );
+        TS_ASSERT_THROWS_NOTHING( nlr.getConstraintTightenings( bounds ) );
+        TS_ASSERT_EQUALS( bounds.size(), 10U );
+        applyTightenings( bounds, tableau );
+
+        // Nothing changed, all layers are reused
+        TS_ASSERT_THROWS_NOTHING( nlr.obtainCurrentBounds() );
+        TS_ASSERT_THROWS_NOTHING( nlr.symbolicBoundPropagation() );
+        TS_ASSERT_EQUALS( nlr.getNumLayersReusedByLastPropagation(), 4U );
+        TS_ASSERT_THROWS_NOTHING( nlr.getConstraintTightenings( bounds ) );
+        TS_ASSERT( bounds.empty() );
+
+        // Split x2 to inactive: only the layers from layer 1 on are recomputed
+        tableau.setUpperBound( 2, 0 );
+        TS_ASSERT_THROWS_NOTHING( nlr.obtainCurrentBounds() );
+        TS_ASSERT_THROWS_NOTHING( nlr.symbolicBoundPropagation() );
+        TS_ASSERT_EQUALS( nlr.getNumLayersReusedByLastPropagation(), 1U );
+        TS_ASSERT_THROWS_NOTHING( nlr.getConstraintTightenings( bounds ) );
+
+        // The results match a full propagation from the same bounds
+        NLR::NetworkLevelReasoner freshNlr;
+        MockTableau freshTableau;
+        freshNlr.setTableau( &freshTableau );
+        populateNetworkSBT( freshNlr, freshTableau );
+        freshNlr.setBias( 1, 0, -15 );
+        for ( unsigned i = 0; i <= 6; ++i )
+        {
+            freshTableau.setLowerBound( i, tableau.getLowerBound( i ) );
+            freshTableau.setUpperBound( i, tableau.getUpperBound( i ) );
+        }
+
+        List<Tightening> expectedBounds;
+        TS_ASSERT_THROWS_NOTHING( freshNlr.obtainCurrentBounds() );
+        TS_ASSERT_THROWS_NOTHING( freshNlr.symbolicBoundPropagation() );
+        TS_ASSERT_THROWS_NOTHING( freshNlr.getConstraintTightenings( expectedBounds ) );
+
+        TS_ASSERT( !expectedBounds.empty() );
+        TS_ASSERT_EQUALS( expectedBounds.size(), bounds.size() );
+        for ( const auto &bound : expectedBounds )
+            TS_ASSERT( bounds.exists( bound ) );
+
+        // Changing a weight invalidates the reused results
+        applyTightenings( bounds, tableau );
+        nlr.setWeight( 2, 1, 3, 0, -2 );
+        TS_ASSERT_THROWS_NOTHING( nlr.obtainCurrentBounds() );
+        TS_ASSERT_THROWS_NOTHING( nlr.symbolicBoundPropagation() );
+        TS_ASSERT_EQUALS( nlr.getNumLayersReusedByLastPropagation(), 3U );
+    }
+
+    void runLpRelaxation( const String &type, unsigned numWorkers, List<Tightening> &bounds )
+    {
+        Options::get()->setString( Options::MILP_SOLVER_BOUND_TIGHTENING_TYPE, type.ascii() );
+        Options::get()->setInt( Options::NUM_WORKERS, numWorkers );
+
+        NLR::NetworkLevelReasoner nlr;
+        MockTableau tableau;
+        nlr.setTableau( &tableau );
+        populateNetworkSBT( nlr, tableau );
+        nlr.setBias( 1, 0, -15 );
+
+        tableau.setLowerBound( 0, 4 );
+        tableau.setUpperBound( 0, 6 );
+        tableau.setLowerBound( 1, 1 );
+        tableau.setUpperBound( 1, 5 );
+
+        Statistics statistics;
+        nlr.setStatistics( &statistics );
+
+        TS_ASSERT_THROWS_NOTHING( nlr.obtainCurrentBounds() );
+        TS_ASSERT_THROWS_NOTHING( nlr.lpRelaxationPropagation() );
+        TS_ASSERT_THROWS_NOTHING( nlr.getConstraintTightenings( bounds ) );
+
+        Options::get()->setString( Options::MILP_SOLVER_BOUND_TIGHTENING_TYPE, "" );
+        Options::get()->setInt( Options::NUM_WORKERS, 1 );
+    }
+
+    void assertSameBounds( const List<Tightening> &bounds, const List<Tightening> &expectedBounds )
+    {
+        TS_ASSERT_EQUALS( bounds.size(), expectedBounds.size() );
+        for ( const auto &bound : bounds )
+        {
+            bool found = false;
+            for ( const auto &other : expectedBounds )
+            {
+                if ( other._variable == bound._variable && other._type == bound._type &&
+                     FloatUtils::areEqual( other._value, bound._value, 0.0001 ) )
+                    found = true;
+            }
+            TS_ASSERT( found );
+        }
+    }
+
+    void test_lp_relaxation()
+    {
+        Options::get()->setString( Options::LP_SOLVER, "native" );
+
+        // One model per neuron, solved on the calling thread or on a
+        // pool of workers, and one incrementally-built, warm-started
+        // model
+        List<Tightening> lpBounds;
+        List<Tightening> parallelBounds;
+        List<Tightening> incrementalBounds;
+        runLpRelaxation( "lp", 1, lpBounds );
+        runLpRelaxation( "lp", 3, parallelBounds );
+        runLpRelaxation( "lp-inc", 1, incrementalBounds );
+
+        /*
+          x2 = 2x0 + 3x1 - 15 : [-4, 12], the ReLU is not fixed
+          x3 =  x0 +  x1      : [5, 11]
+        */
+        TS_ASSERT( lpBounds.exists( Tightening( 2, -4, Tightening::LB ) ) );
+        TS_ASSERT( lpBounds.exists( Tightening( 2, 12, Tightening::UB ) ) );
+        TS_ASSERT( lpBounds.exists( Tightening( 3, 5, Tightening::LB ) ) );
+        TS_ASSERT( lpBounds.exists( Tightening( 3, 11, Tightening::UB ) ) );
+
+        assertSameBounds( parallelBounds, lpBounds );
+        assertSameBounds( incrementalBounds, lpBounds );
+
+        Options::get()->setString( Options::LP_SOLVER, "" );
+    }
+
+    void test_iterative_propagation_stops_when_no_neuron_is_fixed()
+    {
+        Options::get()->setString( Options::LP_SOLVER, "native" );
+
+        NLR::NetworkLevelReasoner nlr;
+        MockTableau tableau;
+        nlr.setTableau( &tableau );
+        populateNetworkSBT( nlr, tableau );
+        nlr.setBias( 1, 0, -15 );
+
+        tableau.setLowerBound( 0, 4 );
+        tableau.setUpperBound( 0, 6 );
+        tableau.setLowerBound( 1, 1 );
+        tableau.setUpperBound( 1, 5 );
+
+        // The ReLU of x2 cannot be fixed, so the first pass makes no
+        // progress and the propagation ends after it
+        TS_ASSERT_THROWS_NOTHING( nlr.obtainCurrentBounds() );
+        TS_ASSERT_THROWS_NOTHING( nlr.iterativePropagation() );
+
+        List<Tightening> bounds;
+        TS_ASSERT_THROWS_NOTHING( nlr.getConstraintTightenings( bounds ) );
+        TS_ASSERT( bounds.exists( Tightening( 2, 12, Tightening::UB ) ) );
+        TS_ASSERT( bounds.exists( Tightening( 3, 11, Tightening::UB ) ) );
+
+        Options::get()->setString( Options::LP_SOLVER, "" );
+    }
+
     void test_sbt_relus_active_and_externally_fixed()
     {
         Options::get()->setString( Options::SYMBOLIC_BOUND_TIGHTENING_TYPE,
@@ -1492,6 +1717,212 @@ public:
             TS_ASSERT( expectedBounds.exists( bound ) );
     }
 
+    void populateSparseNetwork( NLR::NetworkLevelReasoner &nlr, MockTableau &tableau )
+    {
+        /*
+          Ten inputs, each feeding a single neuron of the first weighted
+          sum layer (weight 1 for even neurons, -2 for odd ones), so that
+          the first weight matrix is sparse. The ReLU outputs are summed
+          into a single output neuron.
+        */
+
+        nlr.addLayer( 0, NLR::Layer::INPUT, 10 );
+        nlr.addLayer( 1, NLR::Layer::WEIGHTED_SUM, 10 );
+        nlr.addLayer( 2, NLR::Layer::RELU, 10 );
+        nlr.addLayer( 3, NLR::Layer::WEIGHTED_SUM, 1 );
+
+        for ( unsigned i = 1; i <= 3; ++i )
+            nlr.addLayerDependency( i - 1, i );
+
+        for ( unsigned i = 0; i < 10; ++i )
+        {
+            nlr.setWeight( 0, i, 1, i, ( i % 2 == 0 ) ? 1 : -2 );
+            nlr.setWeight( 2, i, 3, 0, 1 );
+            nlr.addActivationSource( 1, i, 2, i );
+        }
+        nlr.setBias( 1, 0, 1 );
+
+        for ( unsigned layer = 0; layer < 3; ++layer )
+            for ( unsigned i = 0; i < 10; ++i )
+                nlr.setNeuronVariable( NLR::NeuronIndex( layer, i ), 10 * layer + i );
+        nlr.setNeuronVariable( NLR::NeuronIndex( 3, 0 ), 30 );
+
+        double large = 1000000;
+        for ( unsigned i = 0; i < 10; ++i )
+        {
+            tableau.setLowerBound( i, -1 );
+            tableau.setUpperBound( i, 2 );
+        }
+        for ( unsigned i = 10; i <= 30; ++i )
+        {
+            tableau.setLowerBound( i, -large );
+            tableau.setUpperBound( i, large );
+        }
+    }
+
+    void checkSparseNetworkBounds( NLR::NetworkLevelReasoner &nlr )
+    {
+        /*
+          x10       : [0, 3]
+          even x1i  : [-1, 2]
+          odd x1i   : [-4, 2]
+          x30.ub    : 3 + 9 * 2 = 21
+        */
+        const NLR::Layer *layer = nlr.getLayer( 1 );
+        for ( unsigned i = 0; i < 10; ++i )
+        {
+            double expectedLb = ( i == 0 ) ? 0 : ( ( i % 2 == 0 ) ? -1 : -4 );
+            double expectedUb = ( i == 0 ) ? 3 : 2;
+            TS_ASSERT( FloatUtils::areEqual( layer->getLb( i ), expectedLb ) );
+            TS_ASSERT( FloatUtils::areEqual( layer->getUb( i ), expectedUb ) );
+        }
+
+        TS_ASSERT( FloatUtils::areEqual( nlr.getLayer( 3 )->getUb( 0 ), 21 ) );
+    }
+
+    void test_sparse_weights()
+    {
+        NLR::NetworkLevelReasoner nlr;
+        MockTableau tableau;
+        nlr.setTableau( &tableau );
+        populateSparseNetwork( nlr, tableau );
+
+        // Only the first weight matrix is sparse enough
+        TS_ASSERT( nlr.getLayer( 1 )->getSparseWeights( 0 ) );
+        TS_ASSERT( !nlr.getLayer( 3 )->getSparseWeights( 2 ) );
+
+        const CSRMatrix *sparseWeights = nlr.getLayer( 1 )->getSparseWeights( 0 );
+        TS_ASSERT_EQUALS( sparseWeights->getNnz(), 10U );
+        TS_ASSERT_EQUALS( sparseWeights->get( 3, 3 ), -2 );
+        TS_ASSERT_EQUALS( sparseWeights->get( 3, 4 ), 0 );
+
+        // Interval arithmetic
+        TS_ASSERT_THROWS_NOTHING( nlr.obtainCurrentBounds() );
+        TS_ASSERT_THROWS_NOTHING( nlr.intervalArithmeticBoundPropagation() );
+        checkSparseNetworkBounds( nlr );
+
+        // Symbolic bound tightening
+        Options::get()->setString( Options::SYMBOLIC_BOUND_TIGHTENING_TYPE, "sbt" );
+        TS_ASSERT_THROWS_NOTHING( nlr.obtainCurrentBounds() );
+        TS_ASSERT_THROWS_NOTHING( nlr.symbolicBoundPropagation() );
+        checkSparseNetworkBounds( nlr );
+
+        // DeepPoly
+        TS_ASSERT_THROWS_NOTHING( nlr.obtainCurrentBounds() );
+        TS_ASSERT_THROWS_NOTHING( nlr.deepPolyPropagation() );
+        checkSparseNetworkBounds( nlr );
+
+        // A denser matrix falls back to the dense representation
+        TS_ASSERT_THROWS_NOTHING( nlr.setWeight( 0, 0, 1, 1, 1 ) );
+        TS_ASSERT( !nlr.getLayer( 1 )->getSparseWeights( 0 ) );
+    }
+
+    void populateNetworkWithTinyWeight( NLR::NetworkLevelReasoner &nlr, MockTableau &tableau,
+                                        bool dense, double x1Bound )
+    {
+        /*
+          y0 = x0 + 1e-12 x1
+          y1 = x2
+
+          x1 has bounds [-x1Bound, x1Bound]. For the dense version, x3
+          and x4 are added to the weighted sums. They are fixed at 0,
+          so the bounds do not change, but the weight matrix is no
+          longer sparse enough.
+        */
+        nlr.addLayer( 0, NLR::Layer::INPUT, 20 );
+        nlr.addLayer( 1, NLR::Layer::WEIGHTED_SUM, 2 );
+        nlr.addLayerDependency( 0, 1 );
+
+        nlr.setWeight( 0, 0, 1, 0, 1 );
+        nlr.setWeight( 0, 1, 1, 0, 1e-12 );
+        nlr.setWeight( 0, 2, 1, 1, 1 );
+        if ( dense )
+        {
+            nlr.setWeight( 0, 3, 1, 0, 1 );
+            nlr.setWeight( 0, 3, 1, 1, 1 );
+            nlr.setWeight( 0, 4, 1, 0, 1 );
+        }
+
+        for ( unsigned i = 0; i < 20; ++i )
+        {
+            nlr.setNeuronVariable( NLR::NeuronIndex( 0, i ), i );
+            tableau.setLowerBound( i, ( i < 3 ) ? -1 : 0 );
+            tableau.setUpperBound( i, ( i < 3 ) ? 1 : 0 );
+        }
+        tableau.setLowerBound( 1, -x1Bound );
+        tableau.setUpperBound( 1, x1Bound );
+
+        for ( unsigned i = 0; i < 2; ++i )
+        {
+            nlr.setNeuronVariable( NLR::NeuronIndex( 1, i ), 20 + i );
+            tableau.setLowerBound( 20 + i, FloatUtils::negativeInfinity() );
+            tableau.setUpperBound( 20 + i, FloatUtils::infinity() );
+        }
+    }
+
+    enum BoundMethod {
+        INTERVAL,
+        SBT,
+        DEEP_POLY,
+    };
+
+    void compareTinyWeightBounds( double x1Bound, BoundMethod method )
+    {
+        NLR::NetworkLevelReasoner sparseNlr;
+        MockTableau sparseTableau;
+        sparseNlr.setTableau( &sparseTableau );
+        populateNetworkWithTinyWeight( sparseNlr, sparseTableau, false, x1Bound );
+
+        NLR::NetworkLevelReasoner denseNlr;
+        MockTableau denseTableau;
+        denseNlr.setTableau( &denseTableau );
+        populateNetworkWithTinyWeight( denseNlr, denseTableau, true, x1Bound );
+
+        const CSRMatrix *sparseWeights = sparseNlr.getLayer( 1 )->getSparseWeights( 0 );
+        TS_ASSERT( sparseWeights );
+        TS_ASSERT_EQUALS( sparseWeights->getNnz(), 3U );
+        TS_ASSERT_EQUALS( sparseWeights->get( 1, 0 ), 1e-12 );
+        TS_ASSERT( !denseNlr.getLayer( 1 )->getSparseWeights( 0 ) );
+
+        NLR::NetworkLevelReasoner *nlrs[2] = { &sparseNlr, &denseNlr };
+        for ( NLR::NetworkLevelReasoner *nlr : nlrs )
+        {
+            TS_ASSERT_THROWS_NOTHING( nlr->obtainCurrentBounds() );
+            if ( method == INTERVAL )
+            {
+                TS_ASSERT_THROWS_NOTHING( nlr->intervalArithmeticBoundPropagation() );
+            }
+            else if ( method == SBT )
+            {
+                TS_ASSERT_THROWS_NOTHING( nlr->symbolicBoundPropagation() );
+            }
+            else
+            {
+                TS_ASSERT_THROWS_NOTHING( nlr->deepPolyPropagation() );
+            }
+        }
+
+        const NLR::Layer *sparseLayer = sparseNlr.getLayer( 1 );
+        const NLR::Layer *denseLayer = denseNlr.getLayer( 1 );
+        for ( unsigned i = 0; i < 2; ++i )
+        {
+            TS_ASSERT_EQUALS( sparseLayer->getLb( i ), denseLayer->getLb( i ) );
+            TS_ASSERT_EQUALS( sparseLayer->getUb( i ), denseLayer->getUb( i ) );
+        }
+    }
+
+    void test_sparse_weights_keep_tiny_weights()
+    {
+        // The 1e-12 weight of an unbounded source neuron makes y0 unbounded
+        compareTinyWeightBounds( FloatUtils::infinity(), INTERVAL );
+
+        // With a huge bound, it contributes 1000 either way
+        Options::get()->setString( Options::SYMBOLIC_BOUND_TIGHTENING_TYPE, "sbt" );
+        compareTinyWeightBounds( 1e15, INTERVAL );
+        compareTinyWeightBounds( 1e15, SBT );
+        compareTinyWeightBounds( 1e15, DEEP_POLY );
+    }
+
     void test_generate_input_query()
     {
         NLR::NetworkLevelReasoner nlr;
@@ -1590,4 +2021,63 @@ public:
         TS_ASSERT( FloatUtils::areEqual( output[0], 4 ) );
         TS_ASSERT( FloatUtils::areEqual( output[1], 4 ) );
     }
+
+    void test_network_level_reasoner_from_parser()
+    {
+        InputQuery inputQuery;
+        AcasParser acasParser( RESOURCES_DIR "/nnet/acasxu/ACASXU_experimental_v2a_1_1.nnet" );
+        acasParser.generateQuery( inputQuery );
+
+        // The parser hands over the topology: the input layer, a
+        // weighted sum and a ReLU layer per internal layer, and the
+        // output layer
+        NLR::NetworkLevelReasoner *nlr = inputQuery.getNetworkLevelReasoner();
+        TS_ASSERT( nlr );
+        TS_ASSERT_EQUALS( nlr->getNumberOfLayers(), 14U );
+        TS_ASSERT_EQUALS( nlr->getConstraintsInTopologicalOrder().size(), 300U );
+
+        double inputs[5] = { 0.1, -0.2, 0.3, 0.05, -0.4 };
+        double outputs[5];
+        TS_ASSERT_THROWS_NOTHING( nlr->evaluate( inputs, outputs ) );
+
+        Vector<double> inputVector;
+        for ( unsigned i = 0; i < 5; ++i )
+            inputVector.append( inputs[i] );
+        Vector<double> expectedOutputs;
+        acasParser.evaluate( inputVector, expectedOutputs );
+
+        for ( unsigned i = 0; i < 5; ++i )
+            TS_ASSERT( FloatUtils::areEqual( outputs[i], expectedOutputs[i] ) );
+
+        // An equation over the outputs, e.g. from a property, extends
+        // the existing network level reasoner
+        unsigned aux = inputQuery.getNumberOfVariables();
+        inputQuery.setNumberOfVariables( aux + 1 );
+
+        Equation equation;
+        equation.addAddend( 1, acasParser.getOutputVariable( 0 ) );
+        equation.addAddend( -1, acasParser.getOutputVariable( 1 ) );
+        equation.addAddend( -1, aux );
+        equation.setScalar( 0 );
+        inputQuery.addEquation( equation );
+
+        TS_ASSERT( inputQuery.constructNetworkLevelReasoner() );
+        TS_ASSERT_EQUALS( inputQuery.getNetworkLevelReasoner(), nlr );
+        TS_ASSERT_EQUALS( nlr->getNumberOfLayers(), 15U );
+        TS_ASSERT_EQUALS( nlr->getLayer( 14 )->neuronToVariable( 0 ), aux );
+
+        // The topology survives preprocessing
+        for ( const auto &constraint : inputQuery.getPiecewiseLinearConstraints() )
+        {
+            for ( unsigned variable : constraint->getParticipatingVariables() )
+            {
+                constraint->notifyLowerBound( variable, inputQuery.getLowerBound( variable ) );
+                constraint->notifyUpperBound( variable, inputQuery.getUpperBound( variable ) );
+            }
+        }
+
+        InputQuery processed = Preprocessor().preprocess( inputQuery, false );
+        TS_ASSERT( processed.getNetworkLevelReasoner() );
+        TS_ASSERT_EQUALS( processed.getNetworkLevelReasoner()->getNumberOfLayers(), 15U );
+    }
 };
@@ -14,10 +14,10 @@
 **/
 
 #include <cxxtest/TestSuite.h>
-#include "GurobiWrapper.h"
 #include "IterativePropagator.h"
 #include "NetworkLevelReasoner.h"
 #include "ParallelSolver.h"
+#include "ThreadPool.h"
 
 class MockForNetworkLevelReasoner
 {
@@ -36,34 +36,22 @@ public:
     {
     }
 
-    void test_enqueueSolver()
+    void test_create_solvers()
     {
         NLR::NetworkLevelReasoner nlr;
-        NLR::IterativePropagator mock = NLR::IterativePropagator( &nlr );
-        unsigned numberOfWorkers = 4;
-        NLR::ParallelSolver::SolverQueue solvers ( numberOfWorkers );
-        GurobiWrapper *gurobi = new GurobiWrapper();
-        TS_ASSERT_THROWS_NOTHING( mock.enqueueSolver( solvers, gurobi) );
-        TS_ASSERT( !solvers.empty() );
-        GurobiWrapper *gurobiPtr = NULL;
-        TS_ASSERT_THROWS_NOTHING( solvers.pop( gurobiPtr ) );
-        TS_ASSERT( solvers.empty() );
-        delete gurobiPtr;
-    }
-
-    void test_clear_solver_queue()
-    {
-        NLR::NetworkLevelReasoner nlr;
-        NLR::IterativePropagator mock = NLR::IterativePropagator( &nlr );
-        unsigned numberOfWorkers = 4;
-        NLR::ParallelSolver::SolverQueue solvers ( numberOfWorkers );
-        for ( unsigned i = 0; i < numberOfWorkers; ++i )
-        {
-            GurobiWrapper *gurobi = new GurobiWrapper();
-            TS_ASSERT_THROWS_NOTHING( mock.enqueueSolver( solvers, gurobi) );
-        }
-        TS_ASSERT( !solvers.empty() );
-        TS_ASSERT_THROWS_NOTHING( mock.clearSolverQueue( solvers ) );
-        TS_ASSERT( solvers.empty() );
+        NLR::IterativePropagator propagator( &nlr );
+
+        // Without a pool, the solves run on the calling thread
+        NLR::ParallelSolver::Solvers solvers;
+        TS_ASSERT_THROWS_NOTHING( propagator.createSolvers( solvers ) );
+        TS_ASSERT_EQUALS( solvers.size(), 1U );
+
+        // Otherwise there is one solver per thread of the pool
+        ThreadPool threadPool( 3 );
+        propagator.setThreadPool( &threadPool );
+        TS_ASSERT_THROWS_NOTHING( propagator.createSolvers( solvers ) );
+        TS_ASSERT_EQUALS( solvers.size(), 3U );
+        for ( const auto &solver : solvers )
+            TS_ASSERT( solver );
     }
 };
@@ -827,4 +827,74 @@ public:
         delete[] output;
         delete[] expectedOutput;
     }
+    const Equation *findEquation( const InputQuery &inputQuery, unsigned variable )
+    {
+        for ( const auto &equation : inputQuery.getEquations() )
+        {
+            if ( equation.getParticipatingVariables().exists( variable ) )
+                return &equation;
+        }
+        return NULL;
+    }
+
+    void test_eliminate_one_pair_in_input_query()
+    {
+        NLR::NetworkLevelReasoner nlr;
+        populateNetwork_CaseB( nlr );
+
+        // One equation per WS neuron, and no bounds on the hidden WS neurons
+        InputQuery inputQuery = nlr.generateInputQuery();
+        for ( unsigned variable = 8; variable <= 11; ++variable )
+        {
+            inputQuery.setLowerBound( variable, FloatUtils::negativeInfinity() );
+            inputQuery.setUpperBound( variable, FloatUtils::infinity() );
+        }
+        TS_ASSERT_EQUALS( inputQuery.getEquations().size(), 9U );
+
+        // Variable x8 is also used outside of the network
+        InputQuery inputQueryWithX8 = inputQuery;
+        Equation equation;
+        equation.addAddend( 1, 8 );
+        equation.addAddend( 1, 15 );
+        equation.setScalar( 0 );
+        inputQueryWithX8.addEquation( equation );
+
+        NLR::NetworkLevelReasoner nlr2;
+        populateNetwork_CaseB( nlr2 );
+
+        // Merging [WS] 3 into [WS] 4 eliminates x8 and x9, and rewrites
+        // the equations of x10 and x11
+        TS_ASSERT_THROWS_NOTHING( nlr.mergeConsecutiveWSLayers( inputQuery ) );
+        TS_ASSERT_EQUALS( nlr.getNumberOfLayers(), 6U );
+        TS_ASSERT_EQUALS( inputQuery.getEquations().size(), 7U );
+        TS_ASSERT( !findEquation( inputQuery, 8 ) );
+        TS_ASSERT( !findEquation( inputQuery, 9 ) );
+
+        // x10 = -2x5 + 4x6 - 4x7 + 25
+        const Equation *x10 = findEquation( inputQuery, 10 );
+        TS_ASSERT( x10 );
+        TS_ASSERT_EQUALS( x10->getParticipatingVariables(), Set<unsigned>( { 5, 6, 7, 10 } ) );
+        TS_ASSERT_EQUALS( x10->getCoefficient( 10 ), -1 );
+        TS_ASSERT_EQUALS( x10->getCoefficient( 5 ), -2 );
+        TS_ASSERT_EQUALS( x10->getCoefficient( 6 ), 4 );
+        TS_ASSERT_EQUALS( x10->getCoefficient( 7 ), -4 );
+        TS_ASSERT_EQUALS( x10->_scalar, -25 );
+
+        // The equations of the other layers are untouched
+        TS_ASSERT( findEquation( inputQuery, 2 ) );
+        TS_ASSERT( findEquation( inputQuery, 14 ) );
+
+        // When x8 is used elsewhere, its equation is kept
+        TS_ASSERT_THROWS_NOTHING( nlr2.mergeConsecutiveWSLayers( inputQueryWithX8 ) );
+        TS_ASSERT_EQUALS( inputQueryWithX8.getEquations().size(), 9U );
+        TS_ASSERT( !findEquation( inputQueryWithX8, 9 ) );
+
+        unsigned equationsWithX8 = 0;
+        for ( const auto &eq : inputQueryWithX8.getEquations() )
+        {
+            if ( eq.getParticipatingVariables().exists( 8 ) )
+                ++equationsWithX8;
+        }
+        TS_ASSERT_EQUALS( equationsWithX8, 2U );
+    }
 };
@@ -0,0 +1,484 @@
+/*********************                                                        */
+/*! \file BinaryQuery.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "AbsoluteValueConstraint.h"
+#include "BinaryQuery.h"
+#include "CommonError.h"
+#include "Equation.h"
+#include "InputQuery.h"
+#include "MStringf.h"
+#include "MarabouError.h"
+#include "MaxConstraint.h"
+#include "ReluConstraint.h"
+#include "SignConstraint.h"
+#include "T/sys/mman.h"
+#include "T/sys/stat.h"
+#include "T/unistd.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+static_assert( sizeof(BinaryQuery::Header) == 48, "Unexpected header size" );
+static_assert( sizeof(BinaryQuery::EquationRecord) == 24, "Unexpected equation record size" );
+static_assert( sizeof(BinaryQuery::AddendRecord) == 16, "Unexpected addend record size" );
+static_assert( sizeof(BinaryQuery::ConstraintRecord) == 16, "Unexpected constraint record size" );
+
+static const char MAGIC[8] = { 'M', 'A', 'R', 'A', 'B', 'O', 'U', 'Q' };
+
+static size_t alignToEight( size_t offset )
+{
+    return ( offset + 7 ) & ~( (size_t)7 );
+}
+
+BinaryQuery::BinaryQuery( const String &fileName )
+    : _data( NULL )
+    , _size( 0 )
+{
+    int descriptor = T::open( fileName.ascii(), O_RDONLY, 0 );
+    if ( descriptor == -1 )
+        throw MarabouError( MarabouError::FILE_DOES_NOT_EXIST,
+                            Stringf( "File %s not found.\n", fileName.ascii() ).ascii() );
+
+    struct stat fileStat;
+    if ( T::fstat( descriptor, &fileStat ) != 0 || (size_t)fileStat.st_size < sizeof(Header) )
+    {
+        T::close( descriptor );
+        throw MarabouError( MarabouError::INVALID_BINARY_QUERY,
+                            Stringf( "%s is too short", fileName.ascii() ).ascii() );
+    }
+
+    _size = fileStat.st_size;
+    void *data = T::mmap( NULL, _size, PROT_READ, MAP_PRIVATE, descriptor, 0 );
+    T::close( descriptor );
+
+    if ( data == MAP_FAILED )
+        throw MarabouError( MarabouError::INVALID_BINARY_QUERY,
+                            Stringf( "Cannot map %s", fileName.ascii() ).ascii() );
+
+    _data = (const char *)data;
+
+    try
+    {
+        const Header &header = getHeader();
+        if ( memcmp( header._magic, MAGIC, sizeof(MAGIC) ) != 0 ||
+             header._byteOrderMark != BYTE_ORDER_MARK )
+            throw MarabouError( MarabouError::INVALID_BINARY_QUERY,
+                                Stringf( "%s is not a binary query of this machine's byte order",
+                                         fileName.ascii() ).ascii() );
+
+        if ( header._version != VERSION )
+            throw MarabouError( MarabouError::UNSUPPORTED_BINARY_QUERY_VERSION,
+                                Stringf( "Version %u", header._version ).ascii() );
+
+        _layout = computeLayout( header );
+        if ( _layout._size != _size )
+            throw MarabouError( MarabouError::INVALID_BINARY_QUERY,
+                                Stringf( "%s has size %zu, expected %zu",
+                                         fileName.ascii(), _size, _layout._size ).ascii() );
+
+        checkRecords();
+    }
+    catch ( ... )
+    {
+        T::munmap( (void *)_data, _size );
+        throw;
+    }
+}
+
+BinaryQuery::~BinaryQuery()
+{
+    T::munmap( (void *)_data, _size );
+}
+
+BinaryQuery::Layout BinaryQuery::computeLayout( const Header &header )
+{
+    Layout layout;
+
+    layout._lowerBounds = sizeof(Header);
+    layout._upperBounds = layout._lowerBounds + sizeof(double) * header._numVariables;
+    layout._inputVariables = layout._upperBounds + sizeof(double) * header._numVariables;
+    layout._outputVariables = layout._inputVariables + 2 * sizeof(uint32_t) * header._numInputVariables;
+    layout._equations = layout._outputVariables + 2 * sizeof(uint32_t) * header._numOutputVariables;
+    layout._addends = layout._equations + sizeof(EquationRecord) * header._numEquations;
+    layout._constraints = layout._addends + sizeof(AddendRecord) * header._numAddends;
+    layout._constraintVariables = layout._constraints + sizeof(ConstraintRecord) * header._numConstraints;
+    layout._size = alignToEight( layout._constraintVariables +
+                                 sizeof(uint32_t) * header._numConstraintVariables );
+
+    return layout;
+}
+
+void BinaryQuery::checkRecords() const
+{
+    const Header &header = getHeader();
+    unsigned numVariables = header._numVariables;
+
+    const uint32_t *inputVariables = getInputVariables();
+    for ( unsigned i = 0; i < header._numInputVariables; ++i )
+    {
+        if ( inputVariables[2 * i + 1] >= numVariables )
+            throw MarabouError( MarabouError::INVALID_BINARY_QUERY, "Invalid input variable" );
+    }
+
+    const uint32_t *outputVariables = getOutputVariables();
+    for ( unsigned i = 0; i < header._numOutputVariables; ++i )
+    {
+        if ( outputVariables[2 * i + 1] >= numVariables )
+            throw MarabouError( MarabouError::INVALID_BINARY_QUERY, "Invalid output variable" );
+    }
+
+    const EquationRecord *equations = getEquations();
+    for ( unsigned i = 0; i < header._numEquations; ++i )
+    {
+        if ( equations[i]._type > (uint32_t)Equation::LE ||
+             (uint64_t)equations[i]._firstAddend + equations[i]._numAddends > header._numAddends )
+            throw MarabouError( MarabouError::INVALID_BINARY_QUERY,
+                                Stringf( "Invalid equation %u", i ).ascii() );
+    }
+
+    const AddendRecord *addends = getAddends();
+    for ( unsigned i = 0; i < header._numAddends; ++i )
+    {
+        if ( addends[i]._variable >= numVariables )
+            throw MarabouError( MarabouError::INVALID_BINARY_QUERY,
+                                Stringf( "Invalid addend %u", i ).ascii() );
+    }
+
+    const ConstraintRecord *constraints = getConstraints();
+    for ( unsigned i = 0; i < header._numConstraints; ++i )
+    {
+        const ConstraintRecord &constraint = constraints[i];
+        bool valid = false;
+        switch ( constraint._type )
+        {
+        case RELU:
+            valid = constraint._numVariables == 2 || constraint._numVariables == 3;
+            break;
+
+        case MAX:
+            valid = constraint._numVariables >= 2;
+            break;
+
+        case ABSOLUTE_VALUE:
+            valid = constraint._numVariables == 2 || constraint._numVariables == 4;
+            break;
+
+        case SIGN:
+            valid = constraint._numVariables == 2;
+            break;
+        }
+
+        if ( !valid ||
+             (uint64_t)constraint._firstVariable + constraint._numVariables > header._numConstraintVariables )
+            throw MarabouError( MarabouError::INVALID_BINARY_QUERY,
+                                Stringf( "Invalid constraint %u", i ).ascii() );
+    }
+
+    const uint32_t *constraintVariables = getConstraintVariables();
+    for ( unsigned i = 0; i < header._numConstraintVariables; ++i )
+    {
+        if ( constraintVariables[i] >= numVariables )
+            throw MarabouError( MarabouError::INVALID_BINARY_QUERY, "Invalid constraint variable" );
+    }
+}
+
+bool BinaryQuery::isBinaryQuery( const String &fileName )
+{
+    int descriptor = T::open( fileName.ascii(), O_RDONLY, 0 );
+    if ( descriptor == -1 )
+        return false;
+
+    char magic[sizeof(MAGIC)];
+    bool result =
+        T::read( descriptor, magic, sizeof(magic) ) == (ssize_t)sizeof(magic) &&
+        memcmp( magic, MAGIC, sizeof(MAGIC) ) == 0;
+
+    T::close( descriptor );
+    return result;
+}
+
+void BinaryQuery::saveQuery( const InputQuery &inputQuery, const String &fileName )
+{
+    // The constraints are described by their serialization
+    std::vector<ConstraintRecord> constraints;
+    std::vector<uint32_t> constraintVariables;
+    for ( const auto &constraint : inputQuery.getPiecewiseLinearConstraints() )
+    {
+        List<String> tokens = constraint->serializeToString().tokenize( "," );
+        auto token = tokens.begin();
+
+        ConstraintRecord record;
+        if ( *token == "relu" )
+            record._type = RELU;
+        else if ( *token == "max" )
+            record._type = MAX;
+        else if ( *token == "absoluteValue" )
+            record._type = ABSOLUTE_VALUE;
+        else if ( *token == "sign" )
+            record._type = SIGN;
+        else
+            throw MarabouError( MarabouError::UNSUPPORTED_PIECEWISE_LINEAR_CONSTRAINT,
+                                Stringf( "Constraint type %s", token->ascii() ).ascii() );
+
+        record._firstVariable = constraintVariables.size();
+        for ( ++token; token != tokens.end(); ++token )
+            constraintVariables.push_back( atoi( token->ascii() ) );
+        record._numVariables = constraintVariables.size() - record._firstVariable;
+        record._padding = 0;
+
+        constraints.push_back( record );
+    }
+
+    const List<Equation> &equations = inputQuery.getEquations();
+    unsigned numAddends = 0;
+    for ( const auto &equation : equations )
+        numAddends += equation._addends.size();
+
+    Header header;
+    memset( &header, 0, sizeof(header) );
+    memcpy( header._magic, MAGIC, sizeof(MAGIC) );
+    header._version = VERSION;
+    header._byteOrderMark = BYTE_ORDER_MARK;
+    header._numVariables = inputQuery.getNumberOfVariables();
+    header._numInputVariables = inputQuery._inputIndexToVariable.size();
+    header._numOutputVariables = inputQuery._outputIndexToVariable.size();
+    header._numEquations = equations.size();
+    header._numAddends = numAddends;
+    header._numConstraints = constraints.size();
+    header._numConstraintVariables = constraintVariables.size();
+
+    // The file is assembled in memory and written at once
+    Layout layout = computeLayout( header );
+    std::vector<char> buffer( layout._size, 0 );
+    memcpy( buffer.data(), &header, sizeof(header) );
+
+    double *lowerBounds = (double *)( buffer.data() + layout._lowerBounds );
+    double *upperBounds = (double *)( buffer.data() + layout._upperBounds );
+    std::fill_n( lowerBounds, header._numVariables, std::numeric_limits<double>::quiet_NaN() );
+    std::fill_n( upperBounds, header._numVariables, std::numeric_limits<double>::quiet_NaN() );
+    for ( const auto &lowerBound : inputQuery.getLowerBounds() )
+        lowerBounds[lowerBound.first] = lowerBound.second;
+    for ( const auto &upperBound : inputQuery.getUpperBounds() )
+        upperBounds[upperBound.first] = upperBound.second;
+
+    uint32_t *inputVariables = (uint32_t *)( buffer.data() + layout._inputVariables );
+    for ( const auto &input : inputQuery._inputIndexToVariable )
+    {
+        *inputVariables++ = input.first;
+        *inputVariables++ = input.second;
+    }
+
+    uint32_t *outputVariables = (uint32_t *)( buffer.data() + layout._outputVariables );
+    for ( const auto &output : inputQuery._outputIndexToVariable )
+    {
+        *outputVariables++ = output.first;
+        *outputVariables++ = output.second;
+    }
+
+    EquationRecord *equationRecord = (EquationRecord *)( buffer.data() + layout._equations );
+    AddendRecord *addendRecord = (AddendRecord *)( buffer.data() + layout._addends );
+    unsigned firstAddend = 0;
+    for ( const auto &equation : equations )
+    {
+        equationRecord->_scalar = equation._scalar;
+        equationRecord->_type = equation._type;
+        equationRecord->_firstAddend = firstAddend;
+        equationRecord->_numAddends = equation._addends.size();
+        firstAddend += equationRecord->_numAddends;
+        ++equationRecord;
+
+        for ( const auto &addend : equation._addends )
+        {
+            addendRecord->_coefficient = addend._coefficient;
+            addendRecord->_variable = addend._variable;
+            ++addendRecord;
+        }
+    }
+
+    if ( !constraints.empty() )
+        memcpy( buffer.data() + layout._constraints,
+                constraints.data(),
+                sizeof(ConstraintRecord) * constraints.size() );
+    if ( !constraintVariables.empty() )
+        memcpy( buffer.data() + layout._constraintVariables,
+                constraintVariables.data(),
+                sizeof(uint32_t) * constraintVariables.size() );
+
+    int descriptor = T::open( fileName.ascii(), O_CREAT | O_WRONLY | O_TRUNC, S_IRUSR | S_IWUSR );
+    if ( descriptor == -1 )
+        throw CommonError( CommonError::OPEN_FAILED,
+                           Stringf( "Cannot open %s for writing", fileName.ascii() ).ascii() );
+
+    size_t written = 0;
+    while ( written < buffer.size() )
+    {
+        ssize_t result = T::write( descriptor, buffer.data() + written, buffer.size() - written );
+        if ( result <= 0 )
+        {
+            T::close( descriptor );
+            throw CommonError( CommonError::WRITE_FAILED );
+        }
+        written += result;
+    }
+
+    if ( T::close( descriptor ) != 0 )
+        throw CommonError( CommonError::WRITE_FAILED );
+}
+
+void BinaryQuery::generateQuery( InputQuery &inputQuery ) const
+{
+    const Header &header = getHeader();
+
+    inputQuery.setNumberOfVariables( header._numVariables );
+
+    const double *lowerBounds = getLowerBounds();
+    const double *upperBounds = getUpperBounds();
+    for ( unsigned i = 0; i < header._numVariables; ++i )
+    {
+        if ( !std::isnan( lowerBounds[i] ) )
+            inputQuery.setLowerBound( i, lowerBounds[i] );
+        if ( !std::isnan( upperBounds[i] ) )
+            inputQuery.setUpperBound( i, upperBounds[i] );
+    }
+
+    const uint32_t *inputVariables = getInputVariables();
+    for ( unsigned i = 0; i < header._numInputVariables; ++i )
+        inputQuery.markInputVariable( inputVariables[2 * i + 1], inputVariables[2 * i] );
+
+    const uint32_t *outputVariables = getOutputVariables();
+    for ( unsigned i = 0; i < header._numOutputVariables; ++i )
+        inputQuery.markOutputVariable( outputVariables[2 * i + 1], outputVariables[2 * i] );
+
+    // Build the equations in place, to avoid copying their addends
+    List<Equation> &equations = inputQuery.getEquations();
+    const EquationRecord *equationRecords = getEquations();
+    const AddendRecord *addends = getAddends();
+    for ( unsigned i = 0; i < header._numEquations; ++i )
+    {
+        const EquationRecord &record = equationRecords[i];
+        equations.append( Equation( (Equation::EquationType)record._type ) );
+
+        Equation &equation = equations.back();
+        equation.setScalar( record._scalar );
+
+        const AddendRecord *addend = addends + record._firstAddend;
+        for ( unsigned j = 0; j < record._numAddends; ++j, ++addend )
+            equation.addAddend( addend->_coefficient, addend->_variable );
+    }
+
+    const ConstraintRecord *constraints = getConstraints();
+    for ( unsigned i = 0; i < header._numConstraints; ++i )
+    {
+        const ConstraintRecord &record = constraints[i];
+        const uint32_t *variables = getConstraintVariables() + record._firstVariable;
+
+        PiecewiseLinearConstraint *constraint = NULL;
+        switch ( record._type )
+        {
+        case RELU:
+            if ( record._numVariables == 2 )
+                constraint = new ReluConstraint( variables[1], variables[0] );
+            else
+                constraint = new ReluConstraint( Stringf( "relu,%u,%u,%u",
+                                                          variables[0],
+                                                          variables[1],
+                                                          variables[2] ) );
+            break;
+
+        case MAX:
+        {
+            Set<unsigned> elements;
+            for ( unsigned j = 1; j < record._numVariables; ++j )
+                elements.insert( variables[j] );
+            constraint = new MaxConstraint( variables[0], elements );
+            break;
+        }
+
+        case ABSOLUTE_VALUE:
+            if ( record._numVariables == 2 )
+                constraint = new AbsoluteValueConstraint( variables[1], variables[0] );
+            else
+                constraint = new AbsoluteValueConstraint( Stringf( "absoluteValue,%u,%u,%u,%u",
+                                                                   variables[0],
+                                                                   variables[1],
+                                                                   variables[2],
+                                                                   variables[3] ) );
+            break;
+
+        case SIGN:
+            constraint = new SignConstraint( variables[1], variables[0] );
+            break;
+        }
+
+        inputQuery.addPiecewiseLinearConstraint( constraint );
+    }
+}
+
+const BinaryQuery::Header &BinaryQuery::getHeader() const
+{
+    return *(const Header *)_data;
+}
+
+const double *BinaryQuery::getLowerBounds() const
+{
+    return (const double *)( _data + _layout._lowerBounds );
+}
+
+const double *BinaryQuery::getUpperBounds() const
+{
+    return (const double *)( _data + _layout._upperBounds );
+}
+
+const uint32_t *BinaryQuery::getInputVariables() const
+{
+    return (const uint32_t *)( _data + _layout._inputVariables );
+}
+
+const uint32_t *BinaryQuery::getOutputVariables() const
+{
+    return (const uint32_t *)( _data + _layout._outputVariables );
+}
+
+const BinaryQuery::EquationRecord *BinaryQuery::getEquations() const
+{
+    return (const EquationRecord *)( _data + _layout._equations );
+}
+
+const BinaryQuery::AddendRecord *BinaryQuery::getAddends() const
+{
+    return (const AddendRecord *)( _data + _layout._addends );
+}
+
+const BinaryQuery::ConstraintRecord *BinaryQuery::getConstraints() const
+{
+    return (const ConstraintRecord *)( _data + _layout._constraints );
+}
+
+const uint32_t *BinaryQuery::getConstraintVariables() const
+{
+    return (const uint32_t *)( _data + _layout._constraintVariables );
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
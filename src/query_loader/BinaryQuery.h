@@ -0,0 +1,175 @@
+/*********************                                                        */
+/*! \file BinaryQuery.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#ifndef __BinaryQuery_h__
+#define __BinaryQuery_h__
+
+#include "MString.h"
+
+#include <cstddef>
+#include <cstdint>
+
+class InputQuery;
+
+/*
+  A binary format for input queries, which is loaded by mapping the file
+  into memory. The file is a header followed by arrays of fixed-size
+  records, each starting at a multiple of 8 bytes:
+
+    Header
+    double lowerBounds[numVariables]      (NaN for a missing bound)
+    double upperBounds[numVariables]      (NaN for a missing bound)
+    uint32_t inputVariables[2 * numInputVariables]    (index, variable)
+    uint32_t outputVariables[2 * numOutputVariables]  (index, variable)
+    EquationRecord equations[numEquations]
+    AddendRecord addends[numAddends]
+    ConstraintRecord constraints[numConstraints]
+    uint32_t constraintVariables[numConstraintVariables]
+
+  The addends of an equation, and the variables of a constraint, are
+  consecutive. A constraint's variables are in the order of its text
+  serialization: f first, then b or the elements, then any auxiliary
+  variables. Numbers are stored in the byte order of the machine that
+  wrote the file, and files with a different byte order or version are
+  rejected.
+*/
+class BinaryQuery
+{
+public:
+    enum {
+        VERSION = 1,
+        BYTE_ORDER_MARK = 0x01020304,
+    };
+
+    enum ConstraintType {
+        RELU = 0,
+        MAX = 1,
+        ABSOLUTE_VALUE = 2,
+        SIGN = 3,
+    };
+
+    struct Header
+    {
+        char _magic[8];
+        uint32_t _version;
+        uint32_t _byteOrderMark;
+        uint32_t _numVariables;
+        uint32_t _numInputVariables;
+        uint32_t _numOutputVariables;
+        uint32_t _numEquations;
+        uint32_t _numAddends;
+        uint32_t _numConstraints;
+        uint32_t _numConstraintVariables;
+        uint32_t _padding;
+    };
+
+    struct EquationRecord
+    {
+        double _scalar;
+        uint32_t _type;
+        uint32_t _firstAddend;
+        uint32_t _numAddends;
+        uint32_t _padding;
+    };
+
+    struct AddendRecord
+    {
+        double _coefficient;
+        uint32_t _variable;
+        uint32_t _padding;
+    };
+
+    struct ConstraintRecord
+    {
+        uint32_t _type;
+        uint32_t _firstVariable;
+        uint32_t _numVariables;
+        uint32_t _padding;
+    };
+
+    /*
+      Map the file into memory and check its header and size
+    */
+    BinaryQuery( const String &fileName );
+    ~BinaryQuery();
+
+    /*
+      Return true iff the file exists and starts with the magic string
+      of the format
+    */
+    static bool isBinaryQuery( const String &fileName );
+
+    /*
+      Write a query in the binary format
+    */
+    static void saveQuery( const InputQuery &inputQuery, const String &fileName );
+
+    /*
+      Populate an input query from the mapped file
+    */
+    void generateQuery( InputQuery &inputQuery ) const;
+
+    /*
+      Direct access to the records in the mapped file
+    */
+    const Header &getHeader() const;
+    const double *getLowerBounds() const;
+    const double *getUpperBounds() const;
+    const uint32_t *getInputVariables() const;
+    const uint32_t *getOutputVariables() const;
+    const EquationRecord *getEquations() const;
+    const AddendRecord *getAddends() const;
+    const ConstraintRecord *getConstraints() const;
+    const uint32_t *getConstraintVariables() const;
+
+private:
+    /*
+      The offsets of the arrays in the file, and its total size
+    */
+    struct Layout
+    {
+        size_t _lowerBounds;
+        size_t _upperBounds;
+        size_t _inputVariables;
+        size_t _outputVariables;
+        size_t _equations;
+        size_t _addends;
+        size_t _constraints;
+        size_t _constraintVariables;
+        size_t _size;
+    };
+
+    static Layout computeLayout( const Header &header );
+
+    const char *_data;
+    size_t _size;
+    Layout _layout;
+
+    /*
+      Check that the records refer to valid variables and addends, so
+      that the file can be used without further checks
+    */
+    void checkRecords() const;
+};
+
+#endif // __BinaryQuery_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -15,6 +15,7 @@
  **/
 
 #include "AutoFile.h"
+#include "BinaryQuery.h"
 #include "Debug.h"
 #include "Equation.h"
 #include "GlobalConfiguration.h"
@@ -34,6 +35,15 @@ InputQuery QueryLoader::loadQuery( const String &fileName )
     }
 
     InputQuery inputQuery;
+
+    if ( BinaryQuery::isBinaryQuery( fileName ) )
+    {
+        QL_LOG( "Loading a binary query" );
+        BinaryQuery( fileName ).generateQuery( inputQuery );
+        inputQuery.constructNetworkLevelReasoner();
+        return inputQuery;
+    }
+
     AutoFile input( fileName );
     input->open( IFile::MODE_READ );
 
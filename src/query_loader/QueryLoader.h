@@ -29,7 +29,9 @@ public:
     unsigned _numConstraunsigneds;
 
     /*
-      Parse a serialized query and return it in InputQuery form
+      Parse a serialized query and return it in InputQuery form. The
+      query may be in the text format, or in the binary format of
+      BinaryQuery.
     */
     static InputQuery loadQuery( const String &fileName );
 };
@@ -0,0 +1,75 @@
+/*********************                                                        */
+/*! \file main.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** Convert a query between the text format and the binary format of
+ ** BinaryQuery. The format of the input file is detected, and the query
+ ** is written in the other format.
+
+ **/
+
+#include "BinaryQuery.h"
+#include "Error.h"
+#include "InputQuery.h"
+#include "QueryLoader.h"
+#include "TimeUtils.h"
+
+#include <cstdio>
+
+int main( int argc, char *argv[] )
+{
+    if ( argc != 3 )
+    {
+        printf( "Usage: %s <input query> <output query>\n", argv[0] );
+        return 1;
+    }
+
+    String inputPath( argv[1] );
+    String outputPath( argv[2] );
+
+    try
+    {
+        bool binaryInput = BinaryQuery::isBinaryQuery( inputPath );
+
+        struct timespec start = TimeUtils::sampleMicro();
+        InputQuery inputQuery = QueryLoader::loadQuery( inputPath );
+        unsigned long long loadTime = TimeUtils::timePassed( start, TimeUtils::sampleMicro() );
+
+        start = TimeUtils::sampleMicro();
+        if ( binaryInput )
+            inputQuery.saveQuery( outputPath );
+        else
+            BinaryQuery::saveQuery( inputQuery, outputPath );
+        unsigned long long saveTime = TimeUtils::timePassed( start, TimeUtils::sampleMicro() );
+
+        printf( "Converted %s (%s) to %s (%s). Loading: %llu milli. Saving: %llu milli\n",
+                inputPath.ascii(),
+                binaryInput ? "binary" : "text",
+                outputPath.ascii(),
+                binaryInput ? "text" : "binary",
+                loadTime / 1000,
+                saveTime / 1000 );
+    }
+    catch ( const Error &e )
+    {
+        printf( "Caught an error of class %s, code %d\n", e.getErrorClass(), e.getCode() );
+        return 1;
+    }
+
+    return 0;
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../../.. "
+// tags-file-name: "../../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -16,25 +16,146 @@
 #include <cxxtest/TestSuite.h>
 
 #include "AutoFile.h"
+#include "BinaryQuery.h"
 #include "Equation.h"
 #include "InputQuery.h"
+#include "MarabouError.h"
+#include "MaxConstraint.h"
+#include "MockErrno.h"
 #include "MockFileFactory.h"
 #include "QueryLoader.h"
 #include "ReluConstraint.h"
+#include "T/sys/mman.h"
+#include "T/sys/stat.h"
 #include "T/unistd.h"
 
+#include <algorithm>
+#include <vector>
+
 const String QUERY_TEST_FILE( "QueryTest.txt" );
+const String BINARY_QUERY_TEST_FILE( "QueryTest.bin" );
 
+/*
+  The binary query file is kept in memory: it is written through
+  open/write/close, and read through open/read/fstat/mmap.
+*/
 class MockForQueryLoader
     : public MockFileFactory
+    , public MockErrno
     , public T::Base_stat
+    , public T::Base_open
+    , public T::Base_fstat
+    , public T::Base_read
+    , public T::Base_write
+    , public T::Base_close
+    , public T::Base_mmap
+    , public T::Base_munmap
 {
 public:
+    MockForQueryLoader()
+        : binaryFileExists( false )
+        , isOpen( false )
+        , readOffset( 0 )
+        , readLimit( 0 )
+        , isMapped( false )
+    {
+    }
+
     int stat( const char */* path */, StructStat */* buf */ )
     {
         // 0 means file exists
         return 0;
     }
+
+    enum {
+        DESCRIPTOR = 17,
+    };
+
+    std::vector<char> binaryFile;
+    bool binaryFileExists;
+    bool isOpen;
+
+    int open( const char *pathname, int flags, mode_t /* mode */ )
+    {
+        if ( String( pathname ) != BINARY_QUERY_TEST_FILE )
+            return -1;
+
+        if ( flags & O_CREAT )
+        {
+            binaryFile.clear();
+            binaryFileExists = true;
+        }
+
+        if ( !binaryFileExists )
+            return -1;
+
+        TS_ASSERT( !isOpen );
+        isOpen = true;
+        readOffset = 0;
+        return DESCRIPTOR;
+    }
+
+    int close( int fd )
+    {
+        TS_ASSERT_EQUALS( fd, DESCRIPTOR );
+        TS_ASSERT( isOpen );
+        isOpen = false;
+        return 0;
+    }
+
+    int fstat( int fd, struct stat *buf )
+    {
+        TS_ASSERT_EQUALS( fd, DESCRIPTOR );
+        buf->st_size = binaryFile.size();
+        return 0;
+    }
+
+    size_t readOffset;
+    size_t readLimit;
+
+    ssize_t read( int fd, void *buf, size_t count )
+    {
+        TS_ASSERT_EQUALS( fd, DESCRIPTOR );
+
+        size_t bytes = std::min( count, binaryFile.size() - readOffset );
+        if ( readLimit > 0 )
+            bytes = std::min( bytes, readLimit );
+
+        memcpy( buf, binaryFile.data() + readOffset, bytes );
+        readOffset += bytes;
+        return bytes;
+    }
+
+    ssize_t write( int fd, const void *buf, size_t count )
+    {
+        TS_ASSERT_EQUALS( fd, DESCRIPTOR );
+        binaryFile.insert( binaryFile.end(), (const char *)buf, (const char *)buf + count );
+        return count;
+    }
+
+    // Doubles, so that the mapping is aligned like a real one
+    std::vector<double> mapping;
+    bool isMapped;
+
+    void *mmap( void */* addr */, size_t length, int /* prot */, int /* flags */, int fd, off_t /* offset */ )
+    {
+        TS_ASSERT_EQUALS( fd, DESCRIPTOR );
+        TS_ASSERT( !isMapped );
+        TS_ASSERT_EQUALS( length, binaryFile.size() );
+
+        mapping.assign( ( length + sizeof(double) - 1 ) / sizeof(double), 0 );
+        memcpy( mapping.data(), binaryFile.data(), length );
+        isMapped = true;
+        return mapping.data();
+    }
+
+    int munmap( void *addr, size_t /* length */ )
+    {
+        TS_ASSERT( isMapped );
+        TS_ASSERT_EQUALS( addr, (void *)mapping.data() );
+        isMapped = false;
+        return 0;
+    }
 };
 
 class QueryLoaderTestSuite : public CxxTest::TestSuite
@@ -129,6 +250,195 @@ public:
         // Constraints unchanged
         TS_ASSERT( inputQuery.getPiecewiseLinearConstraints() == inputQuery.getPiecewiseLinearConstraints() );
     }
+
+    List<String> serializeConstraints( const InputQuery &inputQuery )
+    {
+        List<String> result;
+        for ( const auto &constraint : inputQuery.getPiecewiseLinearConstraints() )
+            result.append( constraint->serializeToString() );
+        return result;
+    }
+
+    void assertQueriesEqual( const InputQuery &inputQuery, const InputQuery &inputQuery2 )
+    {
+        TS_ASSERT_EQUALS( inputQuery.getNumberOfVariables(), inputQuery2.getNumberOfVariables() );
+        TS_ASSERT_EQUALS( inputQuery.getInputVariables(), inputQuery2.getInputVariables() );
+        TS_ASSERT_EQUALS( inputQuery.getOutputVariables(), inputQuery2.getOutputVariables() );
+        TS_ASSERT_EQUALS( inputQuery.getLowerBounds(), inputQuery2.getLowerBounds() );
+        TS_ASSERT_EQUALS( inputQuery.getUpperBounds(), inputQuery2.getUpperBounds() );
+        TS_ASSERT( inputQuery.getEquations() == inputQuery2.getEquations() );
+        TS_ASSERT_EQUALS( serializeConstraints( inputQuery ), serializeConstraints( inputQuery2 ) );
+    }
+
+    void test_binary_query_round_trip()
+    {
+        // x0, x1 are inputs; x2 = relu( x0 + x1 - 1 ), with b = x3;
+        // x4 = relu( x0 - x1 ), with b = x5; x6 = max( x2, x4 ) is the
+        // output, and x1 has no upper bound
+        InputQuery inputQuery;
+        inputQuery.setNumberOfVariables( 7 );
+
+        inputQuery.markInputVariable( 0, 0 );
+        inputQuery.markInputVariable( 1, 1 );
+        inputQuery.markOutputVariable( 6, 0 );
+
+        inputQuery.setLowerBound( 0, -1 );
+        inputQuery.setUpperBound( 0, 1 );
+        inputQuery.setLowerBound( 1, 0.25 );
+        inputQuery.setUpperBound( 6, 10 );
+
+        Equation equation0;
+        equation0.addAddend( 1, 0 );
+        equation0.addAddend( 1, 1 );
+        equation0.addAddend( -1, 3 );
+        equation0.setScalar( 1 );
+        inputQuery.addEquation( equation0 );
+
+        Equation equation1;
+        equation1.addAddend( 1, 0 );
+        equation1.addAddend( -1, 1 );
+        equation1.addAddend( -1, 5 );
+        equation1.setScalar( 0 );
+        inputQuery.addEquation( equation1 );
+
+        Equation equation2( Equation::GE );
+        equation2.addAddend( 1, 6 );
+        equation2.setScalar( 0.5 );
+        inputQuery.addEquation( equation2 );
+
+        inputQuery.addPiecewiseLinearConstraint( new ReluConstraint( 3, 2 ) );
+        inputQuery.addPiecewiseLinearConstraint( new ReluConstraint( 5, 4 ) );
+        inputQuery.addPiecewiseLinearConstraint( new MaxConstraint( 6, Set<unsigned>( { 2, 4 } ) ) );
+
+        // Text round trip, through the mock file
+        inputQuery.saveQuery( QUERY_TEST_FILE );
+
+        mock->mockFile.wasCreated = false;
+        mock->mockFile.wasDiscarded = false;
+
+        InputQuery textQuery = QueryLoader::loadQuery( QUERY_TEST_FILE );
+
+        // Binary round trip, through the mock binary file
+        TS_ASSERT_THROWS_NOTHING( BinaryQuery::saveQuery( textQuery, BINARY_QUERY_TEST_FILE ) );
+        TS_ASSERT( BinaryQuery::isBinaryQuery( BINARY_QUERY_TEST_FILE ) );
+
+        InputQuery binaryQuery;
+        {
+            BinaryQuery binary( BINARY_QUERY_TEST_FILE );
+
+            const BinaryQuery::Header &header = binary.getHeader();
+            TS_ASSERT_EQUALS( header._version, (unsigned)BinaryQuery::VERSION );
+            TS_ASSERT_EQUALS( header._numVariables, 7U );
+            TS_ASSERT_EQUALS( header._numEquations, 3U );
+            TS_ASSERT_EQUALS( header._numAddends, 7U );
+            TS_ASSERT_EQUALS( header._numConstraints, 3U );
+            TS_ASSERT_EQUALS( header._numConstraintVariables, 7U );
+
+            // The records are accessible in place
+            TS_ASSERT_EQUALS( binary.getLowerBounds()[1], 0.25 );
+            TS_ASSERT( binary.getUpperBounds()[1] != binary.getUpperBounds()[1] );
+            TS_ASSERT_EQUALS( binary.getOutputVariables()[1], 6U );
+            TS_ASSERT_EQUALS( binary.getEquations()[2]._type, (unsigned)Equation::GE );
+            TS_ASSERT_EQUALS( binary.getEquations()[2]._firstAddend, 6U );
+            TS_ASSERT_EQUALS( binary.getAddends()[6]._variable, 6U );
+            TS_ASSERT_EQUALS( binary.getConstraints()[2]._type, (unsigned)BinaryQuery::MAX );
+            TS_ASSERT_EQUALS( binary.getConstraintVariables()[4], 6U );
+
+            TS_ASSERT_THROWS_NOTHING( binary.generateQuery( binaryQuery ) );
+        }
+
+        assertQueriesEqual( inputQuery, textQuery );
+        assertQueriesEqual( inputQuery, binaryQuery );
+
+        // The query loader accepts the binary format too
+        InputQuery loadedQuery = QueryLoader::loadQuery( BINARY_QUERY_TEST_FILE );
+        assertQueriesEqual( inputQuery, loadedQuery );
+
+        TS_ASSERT( !mock->isOpen );
+        TS_ASSERT( !mock->isMapped );
+    }
+
+    void saveSmallBinaryQuery()
+    {
+        // x1 = relu( x0 ), with b = x2 = x0 - 1
+        InputQuery inputQuery;
+        inputQuery.setNumberOfVariables( 3 );
+        inputQuery.setLowerBound( 0, -1 );
+        inputQuery.setUpperBound( 0, 1 );
+
+        Equation equation;
+        equation.addAddend( 1, 0 );
+        equation.addAddend( -1, 2 );
+        equation.setScalar( 1 );
+        inputQuery.addEquation( equation );
+
+        inputQuery.addPiecewiseLinearConstraint( new ReluConstraint( 2, 1 ) );
+
+        TS_ASSERT_THROWS_NOTHING( BinaryQuery::saveQuery( inputQuery, BINARY_QUERY_TEST_FILE ) );
+        TS_ASSERT( BinaryQuery::isBinaryQuery( BINARY_QUERY_TEST_FILE ) );
+    }
+
+    void test_binary_query_missing_file()
+    {
+        TS_ASSERT( !BinaryQuery::isBinaryQuery( BINARY_QUERY_TEST_FILE ) );
+        TS_ASSERT_THROWS_EQUALS( BinaryQuery binary( BINARY_QUERY_TEST_FILE ),
+                                 const MarabouError &e,
+                                 e.getCode(),
+                                 MarabouError::FILE_DOES_NOT_EXIST );
+    }
+
+    void test_binary_query_truncated_file()
+    {
+        saveSmallBinaryQuery();
+
+        // Shorter than the size implied by the header
+        mock->binaryFile.resize( mock->binaryFile.size() - 8 );
+        TS_ASSERT_THROWS_EQUALS( BinaryQuery binary( BINARY_QUERY_TEST_FILE ),
+                                 const MarabouError &e,
+                                 e.getCode(),
+                                 MarabouError::INVALID_BINARY_QUERY );
+        TS_ASSERT( !mock->isOpen );
+        TS_ASSERT( !mock->isMapped );
+
+        // Shorter than the header, so the file is not mapped
+        mock->binaryFile.resize( sizeof(BinaryQuery::Header) - 1 );
+        TS_ASSERT_THROWS_EQUALS( BinaryQuery binary( BINARY_QUERY_TEST_FILE ),
+                                 const MarabouError &e,
+                                 e.getCode(),
+                                 MarabouError::INVALID_BINARY_QUERY );
+        TS_ASSERT( !mock->isOpen );
+        TS_ASSERT( !mock->isMapped );
+    }
+
+    void test_binary_query_bad_magic()
+    {
+        saveSmallBinaryQuery();
+
+        mock->binaryFile[0] = 'X';
+        TS_ASSERT( !BinaryQuery::isBinaryQuery( BINARY_QUERY_TEST_FILE ) );
+        TS_ASSERT_THROWS_EQUALS( BinaryQuery binary( BINARY_QUERY_TEST_FILE ),
+                                 const MarabouError &e,
+                                 e.getCode(),
+                                 MarabouError::INVALID_BINARY_QUERY );
+        TS_ASSERT( !mock->isOpen );
+        TS_ASSERT( !mock->isMapped );
+    }
+
+    void test_binary_query_short_read()
+    {
+        saveSmallBinaryQuery();
+
+        // A read that returns only part of the magic string
+        mock->readLimit = 4;
+        TS_ASSERT( !BinaryQuery::isBinaryQuery( BINARY_QUERY_TEST_FILE ) );
+        TS_ASSERT( !mock->isOpen );
+
+        // An empty file
+        mock->readLimit = 0;
+        mock->binaryFile.clear();
+        TS_ASSERT( !BinaryQuery::isBinaryQuery( BINARY_QUERY_TEST_FILE ) );
+        TS_ASSERT( !mock->isOpen );
+    }
 };
 
 //